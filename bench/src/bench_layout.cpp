@@ -0,0 +1,141 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Channel layouts and sample rates covered by the benchmarks
+ */
+
+#include <sstream>
+#include <stdexcept>
+
+#include "bench_layout.h"
+
+const bench_layout bench_layouts[] =
+{
+    { "1_0",   DLB_MD_EMUL_CHMOD_1_0_0, 1, -1, "-p21 -a1" },
+    { "2_0",   DLB_MD_EMUL_CHMOD_2_0_0, 2, -1, "-p19 -a2" },
+    { "3_1",   DLB_MD_EMUL_CHMOD_3_1_0, 4, -1, "-p18 -a5" },
+    { "3_2_1", DLB_MD_EMUL_CHMOD_3_2_1, 6,  3, "-p11 -a7" },
+    { "3_4_1", DLB_MD_EMUL_CHMOD_3_4_1, 8,  3, "-p22 -a21" },
+};
+
+const int bench_num_layouts = (int)(sizeof(bench_layouts) / sizeof(bench_layouts[0]));
+
+const unsigned int bench_sample_rates[] = { 32000u, 44100u, 48000u };
+
+const int bench_num_sample_rates = (int)(sizeof(bench_sample_rates) / sizeof(bench_sample_rates[0]));
+
+static std::vector<std::string> split_list(const std::string &list)
+{
+    std::vector<std::string> items;
+    std::stringstream        stream(list);
+    std::string              item;
+
+    while (std::getline(stream, item, ','))
+    {
+        if (!item.empty())
+        {
+            items.push_back(item);
+        }
+    }
+    return items;
+}
+
+std::vector<const bench_layout *> bench_parse_layouts(const std::string &list)
+{
+    std::vector<const bench_layout *> layouts;
+
+    for (const std::string &name : split_list(list))
+    {
+        bool found = false;
+
+        for (int i = 0; i < bench_num_layouts; i++)
+        {
+            if (name == "all" || name == bench_layouts[i].name)
+            {
+                layouts.push_back(&bench_layouts[i]);
+                found = true;
+            }
+        }
+        if (!found)
+        {
+            throw std::runtime_error("Unknown channel layout " + name + ", use 1_0, 2_0, 3_1, 3_2_1, 3_4_1 or all");
+        }
+    }
+    return layouts;
+}
+
+std::vector<unsigned int> bench_parse_sample_rates(const std::string &list)
+{
+    std::vector<unsigned int> rates;
+
+    for (const std::string &name : split_list(list))
+    {
+        bool found = false;
+
+        for (int i = 0; i < bench_num_sample_rates; i++)
+        {
+            if (name == "all" || name == std::to_string(bench_sample_rates[i]))
+            {
+                rates.push_back(bench_sample_rates[i]);
+                found = true;
+            }
+        }
+        if (!found)
+        {
+            throw std::runtime_error("Unsupported sample rate " + name + ", use 32000, 44100, 48000 or all");
+        }
+    }
+    return rates;
+}
+
+void bench_layout_channel_map(const bench_layout *layout, dlb_md_emul_process_config_t *emul_conf)
+{
+    static const DLB_MD_EMUL_CHANNEL_MAP full_map[DLB_MD_EMUL_MAX_CHANS] =
+    {
+        DLB_MD_EMUL_CHAN_LEFT, DLB_MD_EMUL_CHAN_RGHT, DLB_MD_EMUL_CHAN_CNTR, DLB_MD_EMUL_CHAN_LFE,
+        DLB_MD_EMUL_CHAN_LSUR, DLB_MD_EMUL_CHAN_RSUR, DLB_MD_EMUL_CHAN_LBAK, DLB_MD_EMUL_CHAN_RBAK
+    };
+
+    for (int c = 0; c < DLB_MD_EMUL_MAX_CHANS; c++)
+    {
+        emul_conf->a_chan_map[c] = (c < layout->channels) ? full_map[c] : DLB_MD_EMUL_CHAN_NONE;
+    }
+    if (layout->channel_mode == DLB_MD_EMUL_CHMOD_3_1_0)
+    {
+        emul_conf->a_chan_map[3] = DLB_MD_EMUL_CHAN_MSUR;
+    }
+    emul_conf->lfe_on = (layout->lfe_channel >= 0);
+}
@@ -0,0 +1,73 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Channel layouts and sample rates covered by the benchmarks
+ */
+
+#ifndef BENCH_LAYOUT_H
+#define BENCH_LAYOUT_H
+
+#include <string>
+#include <vector>
+
+#include "dlb_md_emul_api.h"
+
+typedef struct
+{
+    const char                 *name;
+    DLB_MD_EMUL_CHANNEL_MODE    channel_mode;
+    int                         channels;
+    int                         lfe_channel;        /**< -1 for none */
+    const char                 *mdemu_flags;        /**< MdEmu options selecting the same channel mode */
+} bench_layout;
+
+extern const bench_layout bench_layouts[];
+extern const int          bench_num_layouts;
+
+/* AC-3 sample rates */
+extern const unsigned int bench_sample_rates[];
+extern const int          bench_num_sample_rates;
+
+/* Layouts named in a comma separated list, "all" for every layout, throws on unknown names */
+std::vector<const bench_layout *> bench_parse_layouts(const std::string &list);
+
+/* Sample rates in a comma separated list, "all" for every rate, throws on unsupported rates */
+std::vector<unsigned int> bench_parse_sample_rates(const std::string &list);
+
+/* Channel map of the layout in the order of metadata_emulation_main.cpp */
+void bench_layout_channel_map(const bench_layout *layout, dlb_md_emul_process_config_t *emul_conf);
+
+#endif /* BENCH_LAYOUT_H */
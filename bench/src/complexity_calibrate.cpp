@@ -0,0 +1,566 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Fits the complexity model of dlb_md_emul_query_complexity() on this host
+ *
+ * Times each kernel the model has a term for at the emulator's own stride
+ * and block size, then times whole dlb_md_emul_process() calls over the
+ * benchmark layouts, one and two outputs and two call sizes. What the
+ * kernels do not explain is fitted by least squares to the three terms no
+ * kernel isolates: the gain computers per block, the copy to the second
+ * output per channel sample and the fixed cost of a call. Every call is
+ * then predicted with the fitted and with the built-in model.
+ *
+ * The model is written as one "term value" pair per line and printed as a
+ * C initializer for the built-in model of src/dlb_md_emul_api.c.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define CALIBRATE_HAVE_CYCLES
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define CALIBRATE_HAVE_CYCLES
+#endif
+
+#include "dlb_md_emul_api.h"
+#include "md_emul_instance.h"
+#include "md_compr.h"
+#include "drc_applier.h"
+#include "dd_emulation.h"
+#include "bench_layout.h"
+extern "C" {
+#include "emul_filters.h"
+}
+
+#define CALIBRATE_REFRESH_CALLS 16      /* calls between restoring the input, keeps in-place filters away from denormals */
+#define CALIBRATE_REPETITIONS   3       /* best of */
+#define CALIBRATE_STRIDE        DLB_MD_EMUL_MAX_CHANS   /* as MdEmu and the engine lay out samples */
+#define CALIBRATE_BLOCK         DLB_MD_EMUL_BLOCK_SIZE
+#define CALIBRATE_FIT_TERMS     3       /* gain_calc, aux_copy, call */
+
+typedef struct
+{
+    std::string                     name;
+    dlb_md_emul_process_config_t    conf;
+    int                             num_outputs;
+    double                          measured;       /**< cycles per call */
+} calibrate_call;
+
+static double min_seconds = 0.05;
+static double clock_ghz = 0.0;                      /**< converts ns to cycles without a time stamp counter */
+
+static inline uint64_t read_cycles(void)
+{
+#ifdef CALIBRATE_HAVE_CYCLES
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+/* Deterministic noise at about -20 dBFS */
+static void fill_noise(std::vector<DLB_LFRACT> *buf, uint32_t seed)
+{
+    for (DLB_LFRACT &x : *buf)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        x = 0.1 * ((double)(int32_t)seed / 2147483648.0);
+    }
+}
+
+/*
+ * Cycles per run(), CALIBRATE_REFRESH_CALLS calls per timed batch with
+ * refresh() untimed in between, until min_seconds have been measured.
+ * Best of CALIBRATE_REPETITIONS.
+ */
+template<typename Run, typename Refresh>
+static double time_cycles(Run run, Refresh refresh)
+{
+    double best = -1.0;
+
+    refresh();
+    run();      /* warm up caches and branch predictors */
+
+    for (int rep = 0; rep < CALIBRATE_REPETITIONS; rep++)
+    {
+        double   elapsed = 0.0;
+        uint64_t cycles = 0;
+        uint64_t calls = 0;
+
+        while (elapsed < min_seconds)
+        {
+            refresh();
+            auto     start = std::chrono::steady_clock::now();
+            uint64_t start_cycles = read_cycles();
+            for (int i = 0; i < CALIBRATE_REFRESH_CALLS; i++)
+            {
+                run();
+            }
+            cycles += read_cycles() - start_cycles;
+            elapsed += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            calls += CALIBRATE_REFRESH_CALLS;
+        }
+        double per_call = clock_ghz > 0.0 ? elapsed * 1e9 * clock_ghz / (double)calls : (double)cycles / (double)calls;
+        if (best < 0.0 || per_call < best)
+        {
+            best = per_call;
+        }
+    }
+    return best;
+}
+
+/* Per channel sample costs of the kernels, on every channel of an interleaved 3/4 block */
+static void time_kernels(dlb_md_emul_complexity_model_t *m)
+{
+    const int               slots = CALIBRATE_STRIDE;
+    const double            samples = (double)slots * CALIBRATE_BLOCK;
+    std::vector<DLB_LFRACT> input((size_t)CALIBRATE_BLOCK * slots), work(input.size());
+    std::vector<DLB_LFRACT> state(DLB_MD_EMUL_MAX_CHANS * 4 * BQHISTORY, 0.0);
+    DLB_LFRACT             *channel_ptrs[DRC_MAX_NCHANS];
+    DD_EMU_CHAN_MAP         chan_map[DRC_MAX_NCHANS];
+    auto                    refresh = [&]() { std::copy(input.begin(), input.end(), work.begin()); };
+    uint32_t                internal_static, internal_dynamic, external_static;
+    HANDLE_COMPR            compr;
+
+    fill_noise(&input, 1);
+
+    m->hpf = time_cycles([&]() {
+        for (int c = 0; c < slots; c++)
+        {
+            emul_hpf(&work[c], (int16_t)slots, &state[c], CALIBRATE_BLOCK);
+        }
+    }, refresh) / samples;
+    m->bwlpf = time_cycles([&]() {
+        for (int c = 0; c < slots; c++)
+        {
+            emul_lpf_bwlimit(&work[c], (int16_t)slots, DD_EMU_CHMODE_3_2, &state[c * BWLIMORDER * BQHISTORY], CALIBRATE_BLOCK);
+        }
+    }, refresh) / samples;
+    m->lfelpf = time_cycles([&]() {
+        for (int c = 0; c < slots; c++)
+        {
+            emul_lpf_lfe(&work[c], (int16_t)slots, &state[c * BQHISTORY], CALIBRATE_BLOCK);
+        }
+    }, refresh) / samples;
+    m->psf_main = time_cycles([&]() {
+        for (int c = 0; c < slots; c++)
+        {
+            emul_psf_main(&work[c], (int16_t)slots, &state[c * MPHSTAGES * BQHISTORY], CALIBRATE_BLOCK);
+        }
+    }, refresh) / samples;
+    m->psf_surr = time_cycles([&]() {
+        for (int c = 0; c < slots; c++)
+        {
+            emul_psf_surr(&work[c], (int16_t)slots, &state[c * SPHSTAGES * BQHISTORY], CALIBRATE_BLOCK);
+        }
+    }, refresh) / samples;
+    m->suratt = time_cycles([&]() {
+        for (int c = 0; c < slots; c++)
+        {
+            attenuate_surrounds(&work[c], (int16_t)slots, DD_EMU_CHAN_LSUR, DD_EMU_CHMODE_3_4, CALIBRATE_BLOCK);
+        }
+    }, refresh) / samples;
+
+    /* The compressor kernels over a 3/4 + LFE frame of one block */
+    if (md_ComprGetRequiredBufferSize(COMPR_CHMODE_3_4, 1, &internal_static, &internal_dynamic, &external_static, CALIBRATE_BLOCK) != COMPR_OK)
+    {
+        throw std::runtime_error("Compressor does not support 3/4");
+    }
+    std::vector<DLB_LFRACT> mem_static(internal_static / sizeof(DLB_LFRACT) + 1);
+    std::vector<DLB_LFRACT> mem_dynamic(internal_dynamic / sizeof(DLB_LFRACT) + 1);
+    std::vector<DLB_LFRACT> mem_external(external_static / sizeof(DLB_LFRACT) + 1);
+
+    compr = md_ComprOpen(mem_static.data(), mem_dynamic.data(), mem_external.data(), COMPR_CHMODE_3_4, 1, 1, 48000, CALIBRATE_BLOCK);
+    if (!compr)
+    {
+        throw std::runtime_error("Compressor open failed");
+    }
+    m->loudness = time_cycles([&]() {
+        md_ComprBenchLoudness(compr, work.data(), slots, CALIBRATE_BLOCK);
+    }, refresh) / samples;
+    for (int dmx = 0; dmx < DLB_MD_EMUL_DMX_TYPES; dmx++)
+    {
+        m->downmix[dmx] = time_cycles([&]() {
+            md_ComprBenchDmx(compr, work.data(), slots, CALIBRATE_BLOCK, (uint16_t)(1u << dmx));
+        }, refresh) / samples;
+    }
+
+    /* 1/16 is unity gain after the 4 bits of boost headroom */
+    memset(chan_map, 0, sizeof(chan_map));
+    for (int c = 0; c < slots; c++)
+    {
+        channel_ptrs[c] = &work[c];
+    }
+    m->gain_apply = time_cycles([&]() {
+        apply_gain(channel_ptrs, 0.0625, 0.055, CALIBRATE_BLOCK, slots, slots, chan_map);
+    }, refresh) / samples;
+}
+
+/* Every benchmark layout with all encoder filters and both decoder outputs in use */
+static std::vector<calibrate_call> calls_to_time(void)
+{
+    std::vector<calibrate_call> calls;
+
+    for (int l = 0; l < bench_num_layouts; l++)
+    {
+        const bench_layout *layout = &bench_layouts[l];
+
+        for (int num_outputs = 1; num_outputs <= DLB_MD_EMUL_MAX_OUTPUTS; num_outputs++)
+        {
+            for (int blocks : { 1, 6 })
+            {
+                calibrate_call call;
+
+                memset(&call.conf, 0, sizeof(call.conf));
+                call.conf.channel_mode = layout->channel_mode;
+                call.conf.dolbye_channel_mode = layout->channel_mode;
+                call.conf.lfe_on = layout->lfe_channel >= 0;
+                bench_layout_channel_map(layout, &call.conf);
+                call.conf.sample_offset = CALIBRATE_STRIDE;
+                call.conf.num_samples = blocks * CALIBRATE_BLOCK;
+                call.conf.sample_rate = 48000u;
+                call.conf.hpfon = 1;
+                call.conf.bwlpfon = 1;
+                call.conf.lfelpfon = 1;
+                call.conf.sur90on = 1;
+                call.conf.suratton = 1;
+                call.conf.comp_mode[0] = DLB_MD_EMUL_CM_LINE;
+                call.conf.comp_mode[1] = DLB_MD_EMUL_CM_RF;
+                call.conf.dialnorm = 27;
+                call.conf.control = (DLB_MD_EMUL_CONTROL_ENCODER_ENABLE | DLB_MD_EMUL_CONTROL_DECODER_ENABLE | DLB_MD_EMUL_CONTROL_DRC_CALC_ENABLE);
+                call.conf.drc_profile = DLB_MD_EMUL_COMPR_FILM_STANDARD;
+                call.conf.comp_profile = DLB_MD_EMUL_COMPR_FILM_STANDARD;
+                call.num_outputs = num_outputs;
+                call.name = std::string(layout->name) + ":outputs" + std::to_string(num_outputs) + ":block" + std::to_string(blocks * CALIBRATE_BLOCK);
+                call.measured = 0.0;
+                calls.push_back(call);
+            }
+        }
+    }
+    return calls;
+}
+
+static void time_calls(std::vector<calibrate_call> *calls)
+{
+    for (calibrate_call &call : *calls)
+    {
+        dlb_md_emul_process_config_t conf = call.conf;
+        md_emul_instance             emul = {};
+        std::vector<DLB_LFRACT>      input((size_t)conf.num_samples * CALIBRATE_STRIDE), work(input.size());
+        std::vector<DLB_LFRACT>      secondary(input.size());
+
+        fill_noise(&input, 4);
+        conf.pa_in_data[0] = work.data();
+        conf.pa_in_data[1] = secondary.data();
+        md_emul_instance_open(&emul);
+        try
+        {
+            call.measured = time_cycles([&]() {
+                md_emul_instance_process(&emul, &conf, call.num_outputs);
+            }, [&]() { std::copy(input.begin(), input.end(), work.begin()); });
+        }
+        catch (...)
+        {
+            md_emul_instance_close(&emul);
+            throw;
+        }
+        md_emul_instance_close(&emul);
+    }
+}
+
+/* Cycles of one call predicted by the model */
+static double predict(const dlb_md_emul_complexity_model_t *m, const calibrate_call &call)
+{
+    dlb_md_emul_complexity_t complexity;
+
+    if (dlb_md_emul_query_complexity(&call.conf, call.num_outputs, m, &complexity) != 0)
+    {
+        throw std::runtime_error("dlb_md_emul_query_complexity failed for " + call.name);
+    }
+    return complexity.total * call.conf.num_samples;
+}
+
+/* Weighted least squares of the terms no kernel isolates on what the kernels leave unexplained */
+static void fit_model(dlb_md_emul_complexity_model_t *m, const std::vector<calibrate_call> &calls)
+{
+    double ata[CALIBRATE_FIT_TERMS][CALIBRATE_FIT_TERMS + 1] = {};
+    double terms[CALIBRATE_FIT_TERMS];
+
+    m->gain_calc = 0.0;
+    m->aux_copy = 0.0;
+    m->call = 0.0;
+    for (const calibrate_call &call : calls)
+    {
+        dlb_md_emul_complexity_model_t unit;
+        double                         weight = 1.0 / call.measured;    /* relative errors, or the big layouts decide alone */
+        double                         residual = weight * (call.measured - predict(m, call));
+
+        /* The library's own accounting gives how often each term occurs in the call */
+        for (int t = 0; t < CALIBRATE_FIT_TERMS; t++)
+        {
+            memset(&unit, 0, sizeof(unit));
+            (t == 0 ? unit.gain_calc : t == 1 ? unit.aux_copy : unit.call) = 1.0;
+            terms[t] = weight * predict(&unit, call);
+        }
+        for (int i = 0; i < CALIBRATE_FIT_TERMS; i++)
+        {
+            for (int j = 0; j < CALIBRATE_FIT_TERMS; j++)
+            {
+                ata[i][j] += terms[i] * terms[j];
+            }
+            ata[i][CALIBRATE_FIT_TERMS] += terms[i] * residual;
+        }
+    }
+
+    /* Gauss-Jordan with partial pivoting on the normal equations */
+    for (int col = 0; col < CALIBRATE_FIT_TERMS; col++)
+    {
+        int pivot = col;
+
+        for (int row = col + 1; row < CALIBRATE_FIT_TERMS; row++)
+        {
+            if (std::fabs(ata[row][col]) > std::fabs(ata[pivot][col]))
+            {
+                pivot = row;
+            }
+        }
+        if (std::fabs(ata[pivot][col]) < 1e-12)
+        {
+            throw std::runtime_error("Calls do not determine the fitted terms");
+        }
+        for (int k = 0; k <= CALIBRATE_FIT_TERMS; k++)
+        {
+            std::swap(ata[col][k], ata[pivot][k]);
+        }
+        for (int row = 0; row < CALIBRATE_FIT_TERMS; row++)
+        {
+            if (row != col)
+            {
+                double f = ata[row][col] / ata[col][col];
+
+                for (int k = col; k <= CALIBRATE_FIT_TERMS; k++)
+                {
+                    ata[row][k] -= f * ata[col][k];
+                }
+            }
+        }
+    }
+    /* A cost below zero only absorbs timing noise */
+    m->gain_calc = std::max(0.0, ata[0][CALIBRATE_FIT_TERMS] / ata[0][0]);
+    m->aux_copy  = std::max(0.0, ata[1][CALIBRATE_FIT_TERMS] / ata[1][1]);
+    m->call      = std::max(0.0, ata[2][CALIBRATE_FIT_TERMS] / ata[2][2]);
+}
+
+/* Measured against predicted, returns the largest error in percent */
+static double report(const dlb_md_emul_complexity_model_t *fitted, const std::vector<calibrate_call> &calls)
+{
+    double worst = 0.0;
+
+    printf("\n%-28s %12s %12s %8s %12s %8s\n", "call", "measured", "fitted", "error", "built-in", "error");
+    for (const calibrate_call &call : calls)
+    {
+        double samples = call.conf.num_samples;
+        double fit = predict(fitted, call);
+        double builtin = predict(nullptr, call);
+        double error = 100.0 * (fit - call.measured) / call.measured;
+
+        printf("%-28s %12.2f %12.2f %+7.1f%% %12.2f %+7.1f%%\n", call.name.c_str(),
+               call.measured / samples, fit / samples, error, builtin / samples,
+               100.0 * (builtin - call.measured) / call.measured);
+        worst = std::max(worst, std::fabs(error));
+    }
+    printf("cycles per sample frame, largest error of the fitted model %.1f%%\n", worst);
+    return worst;
+}
+
+#define MODEL_TERMS(X) \
+    X(hpf) X(bwlpf) X(lfelpf) X(psf_main) X(psf_surr) X(suratt) X(loudness) \
+    X(downmix[0]) X(downmix[1]) X(downmix[2]) X(downmix[3]) X(downmix[4]) \
+    X(gain_calc) X(gain_apply) X(aux_copy) X(call)
+
+static void save_model(const std::string &file, const dlb_md_emul_complexity_model_t *m)
+{
+    std::ofstream out(file);
+
+#define SAVE_TERM(term) out << #term << " " << m->term << "\n";
+    if (!out)
+    {
+        throw std::runtime_error("Cannot write " + file);
+    }
+    out.precision(6);
+    MODEL_TERMS(SAVE_TERM)
+#undef SAVE_TERM
+}
+
+/* Terms missing from the file keep the built-in value */
+static void load_model(const std::string &file, dlb_md_emul_complexity_model_t *m)
+{
+    std::ifstream in(file);
+    std::string   line;
+
+    if (!in)
+    {
+        throw std::runtime_error("Cannot read model " + file);
+    }
+    *m = *dlb_md_emul_get_complexity_model();
+    while (std::getline(in, line))
+    {
+        std::istringstream fields(line);
+        std::string        name;
+        double             value;
+
+        if (!(fields >> name >> value))
+        {
+            continue;
+        }
+#define LOAD_TERM(term) if (name == #term) { m->term = value; continue; }
+        MODEL_TERMS(LOAD_TERM)
+#undef LOAD_TERM
+        throw std::runtime_error("Unknown model term " + name + " in " + file);
+    }
+}
+
+static void print_initializer(const dlb_md_emul_complexity_model_t *m)
+{
+    char line[128];
+
+    printf("\n");
+    snprintf(line, sizeof(line), "%.2f, %.2f, %.2f, %.2f, %.2f, %.2f,", m->hpf, m->bwlpf, m->lfelpf, m->psf_main, m->psf_surr, m->suratt);
+    printf("    %-44s/* hpf, bwlpf, lfelpf, psf_main, psf_surr, suratt */\n", line);
+    snprintf(line, sizeof(line), "%.2f,", m->loudness);
+    printf("    %-44s/* loudness */\n", line);
+    snprintf(line, sizeof(line), "{ %.2f, %.2f, %.2f, %.2f, %.2f },", m->downmix[0], m->downmix[1], m->downmix[2], m->downmix[3], m->downmix[4]);
+    printf("    %-44s/* downmix */\n", line);
+    snprintf(line, sizeof(line), "%.1f, %.2f, %.2f, %.1f", m->gain_calc, m->gain_apply, m->aux_copy, m->call);
+    printf("    %-44s/* gain_calc, gain_apply, aux_copy, call */\n", line);
+}
+
+static void show_usage(void)
+{
+    std::cout << "Usage:" << std::endl <<
+"\tmdemu_calibrate [options]" << std::endl <<
+"Options:" << std::endl <<
+"        --min-time=S      Seconds measured per kernel or call and repetition [--min-time=0.05]" << std::endl <<
+"        --save=FILE       Write the fitted model, one term and value per line" << std::endl <<
+"        --check=FILE      Time the calls and report the errors of a saved model, no fit" << std::endl <<
+"        --clock-ghz=G     Count G cycles per ns instead of reading the time stamp counter" << std::endl <<
+"The model is in time stamp counter cycles; without a counter (not x86) --clock-ghz is required." << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    dlb_md_emul_complexity_model_t model;
+    std::vector<calibrate_call>    calls;
+    std::string                    save_file;
+    std::string                    check_file;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        size_t      eq = arg.find('=');
+        std::string name = arg.substr(0, eq);
+        std::string value = (eq == std::string::npos) ? "" : arg.substr(eq + 1);
+
+        if (name == "--min-time")
+        {
+            min_seconds = std::stod(value);
+        }
+        else if (name == "--save")
+        {
+            save_file = value;
+        }
+        else if (name == "--check")
+        {
+            check_file = value;
+        }
+        else if (name == "--clock-ghz")
+        {
+            clock_ghz = std::stod(value);
+        }
+        else
+        {
+            show_usage();
+            return 2;
+        }
+    }
+
+    try
+    {
+#ifndef CALIBRATE_HAVE_CYCLES
+        if (clock_ghz <= 0.0)
+        {
+            throw std::runtime_error("No time stamp counter on this processor, give --clock-ghz");
+        }
+#endif
+        calls = calls_to_time();
+        if (!check_file.empty())
+        {
+            load_model(check_file, &model);
+            time_calls(&calls);
+            report(&model, calls);
+            return 0;
+        }
+
+        time_kernels(&model);
+        time_calls(&calls);
+        fit_model(&model, calls);
+        report(&model, calls);
+        print_initializer(&model);
+        if (!save_file.empty())
+        {
+            save_model(save_file, &model);
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 2;
+    }
+    return 0;
+}
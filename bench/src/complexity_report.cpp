@@ -0,0 +1,338 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Weighted MCPS of every emulation configuration from intrinsic counts
+ *
+ * Needs a library built with -DMDEMU_INSTRUMENT=count. Runs the broadcast
+ * synthetic programme through the public API for each layout, sample rate,
+ * encoder filter setting and number of outputs, and converts the counted
+ * intrinsics to weighted MCPS: average and busiest block, for the whole
+ * process call and its main stages. The weights model the cost of each
+ * operation class on the target DSP.
+ */
+
+#ifndef DLB_INSTRUMENT_COUNT
+#error "mdemu_complexity needs the count instrumentation backend (-DMDEMU_INSTRUMENT=count)"
+#endif
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "dlb_md_emul_api.h"
+#include "md_emul_instance.h"
+#include "bench_layout.h"
+#include "synth_programme.h"
+
+#define COMPLEXITY_SEED     1u
+
+typedef struct
+{
+    const char *name;
+    bool        filters;        /**< all encoder filters on, otherwise only the LFE low pass */
+    int         num_outputs;    /**< 2: line mode main output and RF mode secondary output */
+} complexity_config;
+
+static const complexity_config complexity_configs[] =
+{
+    { "lfe-lpf 1out", false, 1 },
+    { "all-filt 1out", true, 1 },
+    { "all-filt 2out", true, 2 },
+};
+
+typedef struct
+{
+    std::string     layout;
+    unsigned int    sample_rate;
+    std::string     config;
+    double          mcps;
+    double          peak_mcps;
+    double          encoder_mcps;
+    double          compressor_mcps;
+    double          apply_mcps;
+} complexity_result;
+
+static const dlb_instrument_count_unit *find_unit(const dlb_instrument_count_report_t *report, const char *name)
+{
+    for (unsigned int i = 0; i < report->num_units; i++)
+    {
+        if (!strcmp(report->units[i].name, name))
+        {
+            return &report->units[i];
+        }
+    }
+    return nullptr;
+}
+
+static double unit_mcps(const dlb_instrument_count_report_t *report, const char *name, double frames_per_second)
+{
+    const dlb_instrument_count_unit *unit = find_unit(report, name);
+
+    if (!unit || report->frames == 0)
+    {
+        return 0.0;
+    }
+    return dlb_instrument_count_weighted(unit->total, report->weights) / (double)report->frames * frames_per_second * 1e-6;
+}
+
+static void prepare_config(const bench_layout *layout, unsigned int sample_rate, const complexity_config &config,
+                           dlb_md_emul_process_config_t *emul_conf)
+{
+    memset(emul_conf, 0, sizeof(*emul_conf));
+    emul_conf->channel_mode = layout->channel_mode;
+    emul_conf->dolbye_channel_mode = layout->channel_mode;
+    bench_layout_channel_map(layout, emul_conf);
+    emul_conf->sample_offset = layout->channels;
+    emul_conf->num_samples = DLB_MD_EMUL_BLOCK_SIZE;
+    emul_conf->sample_rate = sample_rate;
+    emul_conf->comp_mode[0] = DLB_MD_EMUL_CM_LINE;
+    emul_conf->comp_mode[1] = DLB_MD_EMUL_CM_RF;
+    emul_conf->dialnorm = 31;
+    emul_conf->lfelpfon = 1;
+    if (config.filters)
+    {
+        emul_conf->hpfon = 1;
+        emul_conf->bwlpfon = 1;
+        emul_conf->sur90on = 1;
+        emul_conf->suratton = 1;
+    }
+    emul_conf->control = (DLB_MD_EMUL_CONTROL_ENCODER_ENABLE | DLB_MD_EMUL_CONTROL_DECODER_ENABLE | DLB_MD_EMUL_CONTROL_DRC_CALC_ENABLE);
+    emul_conf->drc_profile = DLB_MD_EMUL_COMPRESSION_PROFILE(1);
+    emul_conf->comp_profile = DLB_MD_EMUL_COMPRESSION_PROFILE(1);
+}
+
+static complexity_result run_config(const bench_layout *layout, unsigned int sample_rate, const complexity_config &config,
+                                    double seconds, bool print_units)
+{
+    synth_programme_config        synth_config = { layout->channels, layout->lfe_channel, sample_rate, SYNTH_CONTENT_BROADCAST };
+    synth_programme               synth;
+    dlb_md_emul_process_config_t  emul_conf;
+    md_emul_instance              emul = {};
+    std::vector<DLB_LFRACT>       block((size_t)DLB_MD_EMUL_BLOCK_SIZE * DLB_MD_EMUL_MAX_CHANS);   /* the emulator addresses every channel slot */
+    std::vector<DLB_LFRACT>       secondary((size_t)DLB_MD_EMUL_BLOCK_SIZE * DLB_MD_EMUL_MAX_CHANS);
+    uint64_t                      blocks = (uint64_t)(seconds * sample_rate / DLB_MD_EMUL_BLOCK_SIZE);
+    double                        frames_per_second = (double)sample_rate / DLB_MD_EMUL_BLOCK_SIZE;
+    const dlb_instrument_count_report_t *report;
+    const dlb_instrument_count_unit     *process;
+    complexity_result             result;
+
+    prepare_config(layout, sample_rate, config, &emul_conf);
+    emul_conf.pa_in_data[0] = block.data();
+    emul_conf.pa_in_data[1] = secondary.data();
+    synth_programme_open(&synth, &synth_config, COMPLEXITY_SEED);
+    md_emul_instance_open(&emul);
+
+    DLB_INSTRUMENT_OPEN();
+    for (uint64_t b = 0; b < blocks; b++)
+    {
+        synth_programme_render(&synth, block.data(), DLB_MD_EMUL_BLOCK_SIZE);
+        md_emul_instance_process(&emul, &emul_conf, config.num_outputs);
+    }
+    md_emul_instance_close(&emul);
+    report = DLB_INSTRUMENT_REPORT();
+
+    process = find_unit(report, "dlb_md_emul_process");
+    result.layout = layout->name;
+    result.sample_rate = sample_rate;
+    result.config = config.name;
+    result.mcps = unit_mcps(report, "dlb_md_emul_process", frames_per_second);
+    result.peak_mcps = process ? process->peak * frames_per_second * 1e-6 : 0.0;
+    result.encoder_mcps = unit_mcps(report, "encoder_emulation", frames_per_second);
+    result.compressor_mcps = unit_mcps(report, "md_ComprProcess", frames_per_second);
+    result.apply_mcps = unit_mcps(report, "apply_drc", frames_per_second);
+    if (print_units)
+    {
+        printf("\n%s %u Hz %s\n", layout->name, sample_rate, config.name);
+        dlb_instrument_count_print(stdout, report, frames_per_second);
+        printf("\n");
+    }
+    DLB_INSTRUMENT_CLOSE();
+    return result;
+}
+
+static void print_result(const complexity_result &r)
+{
+    printf("%-6s %6u Hz  %-14s %9.3f %9.3f %9.3f %9.3f %9.3f\n", r.layout.c_str(), r.sample_rate, r.config.c_str(),
+           r.mcps, r.peak_mcps, r.encoder_mcps, r.compressor_mcps, r.apply_mcps);
+    fflush(stdout);
+}
+
+/* "add=1,div=20": weights of the named operation classes, the others keep their default */
+static void parse_weights(const std::string &list, double weights[DLB_OP_NUM])
+{
+    size_t start = 0;
+
+    while (start < list.size())
+    {
+        size_t      end = list.find(',', start);
+        std::string item = list.substr(start, (end == std::string::npos) ? std::string::npos : end - start);
+        size_t      eq = item.find('=');
+        int         op;
+
+        for (op = 0; op < DLB_OP_NUM; op++)
+        {
+            if (eq != std::string::npos && item.compare(0, eq, dlb_instrument_count_op_names[op]) == 0 &&
+                eq == strlen(dlb_instrument_count_op_names[op]))
+            {
+                break;
+            }
+        }
+        if (op == DLB_OP_NUM)
+        {
+            throw std::runtime_error("Unknown operation weight '" + item + "'");
+        }
+        weights[op] = std::stod(item.substr(eq + 1));
+        start = (end == std::string::npos) ? list.size() : end + 1;
+    }
+}
+
+static void save_csv(const std::string &file, const std::vector<complexity_result> &results)
+{
+    std::ofstream out(file);
+
+    if (!out)
+    {
+        throw std::runtime_error("Cannot write " + file);
+    }
+    out << "layout,sample_rate,config,mcps,peak_mcps,encoder_mcps,compressor_mcps,apply_drc_mcps\n";
+    for (const complexity_result &r : results)
+    {
+        char line[256];
+
+        snprintf(line, sizeof(line), "%s,%u,%s,%.4f,%.4f,%.4f,%.4f,%.4f\n", r.layout.c_str(), r.sample_rate,
+                 r.config.c_str(), r.mcps, r.peak_mcps, r.encoder_mcps, r.compressor_mcps, r.apply_mcps);
+        out << line;
+    }
+}
+
+static void show_usage(void)
+{
+    std::cout << "Usage:" << std::endl <<
+"\tmdemu_complexity [options]" << std::endl <<
+"Options:" << std::endl <<
+"        --seconds=S    Programme length per configuration [--seconds=20]" << std::endl <<
+"        --layouts=L    Comma separated layouts 1_0, 2_0, 3_1, 3_2_1, 3_4_1 [--layouts=all]" << std::endl <<
+"        --rates=R      Comma separated sample rates 32000, 44100, 48000 [--rates=48000]" << std::endl <<
+"        --weights=W    Operation costs, e.g. mac=1,div=20 [add, sadd, mpy, mac, shift, norm, cmp, rnd 1, div 16]" << std::endl <<
+"        --units        Also print the per-unit and per-operation tables of each configuration" << std::endl <<
+"        --csv=FILE     Also write the results as CSV" << std::endl <<
+"MCPS are weighted operations per second / 1e6; peak is the busiest 256 sample block." << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    std::vector<complexity_result> results;
+    std::string                    layouts_list = "all";
+    std::string                    rates_list = "48000";
+    std::string                    csv_file;
+    double                         weights[DLB_OP_NUM];
+    double                         seconds = 20.0;
+    bool                           print_units = false;
+
+    memcpy(weights, dlb_instrument_count_default_weights, sizeof(weights));
+    try
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            std::string arg = argv[i];
+            size_t      eq = arg.find('=');
+            std::string name = arg.substr(0, eq);
+            std::string value = (eq == std::string::npos) ? "" : arg.substr(eq + 1);
+
+            if (name == "--seconds")
+            {
+                seconds = std::stod(value);
+            }
+            else if (name == "--layouts")
+            {
+                layouts_list = value;
+            }
+            else if (name == "--rates")
+            {
+                rates_list = value;
+            }
+            else if (name == "--weights")
+            {
+                parse_weights(value, weights);
+            }
+            else if (name == "--units")
+            {
+                print_units = true;
+            }
+            else if (name == "--csv")
+            {
+                csv_file = value;
+            }
+            else
+            {
+                show_usage();
+                return 1;
+            }
+        }
+
+        std::vector<const bench_layout *> layouts = bench_parse_layouts(layouts_list);
+        std::vector<unsigned int>         rates = bench_parse_sample_rates(rates_list);
+
+        dlb_instrument_count_set_weights(weights);
+        printf("%-6s %9s  %-14s %9s %9s %9s %9s %9s\n", "layout", "rate", "config", "MCPS", "peak", "encoder",
+               "compr", "apply");
+        for (const bench_layout *layout : layouts)
+        {
+            for (unsigned int rate : rates)
+            {
+                for (const complexity_config &config : complexity_configs)
+                {
+                    results.push_back(run_config(layout, rate, config, seconds, print_units));
+                    print_result(results.back());
+                }
+            }
+        }
+        if (!csv_file.empty())
+        {
+            save_csv(csv_file, results);
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
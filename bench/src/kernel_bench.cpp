@@ -0,0 +1,665 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Microbenchmark of the metadata emulation DSP kernels
+ *
+ * Times the filters, the compressor kernels, the DRC gain application and
+ * whole dlb_md_emul_process() calls over channel modes, sample strides and
+ * block sizes. Results are reported per sample (one channel of one frame)
+ * and can be saved as a JSON baseline and compared with a later build.
+ *
+ * The compressor kernels are internal to md_compr.c; this target links a
+ * copy of the library built with MD_EMUL_KERNEL_BENCH, which exports them.
+ * The dsplib vector primitives are timed with each instruction set the
+ * processor supports when the x86 SIMD dsplib backend is built in.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define BENCH_HAVE_CYCLES
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAVE_CYCLES
+#endif
+
+#include "dlb_md_emul_api.h"
+#include "md_emul_instance.h"
+#include "md_compr.h"
+#include "drc_applier.h"
+#include "dlb_dsplib/blk.h"
+extern "C" {
+#include "emul_filters.h"
+}
+
+#define BENCH_REFRESH_CALLS     16      /* calls between restoring the input, keeps in-place filters away from denormals */
+#define BENCH_REPETITIONS       3       /* best of */
+#define BENCH_MAX_STRIDE        DLB_MD_EMUL_MAX_CHANS
+#define BENCH_PROCESS_BLOCK     DLB_MD_EMUL_BLOCK_SIZE
+
+typedef struct
+{
+    std::string     name;
+    double          ns_per_sample;
+    double          samples_per_s;
+    double          cycles_per_sample;      /**< TSC cycles, 0 when not available */
+} bench_result;
+
+/* Compressor channel modes from 1/0 to 3/4 with LFE */
+typedef struct
+{
+    const char     *name;
+    COMPR_CHMODE    compr_mode;
+    int             lfe_on;
+    unsigned        slots;                  /**< buffer slots in use, L R C LFE Ls Rs Lb Rb as in the compressor */
+    int16_t         acmod;                  /**< for the bandwidth filter */
+} bench_channel_mode;
+
+static const bench_channel_mode channel_modes[] =
+{
+    { "1_0",     COMPR_CHMODE_MONO,   0, 0x04, 1 },
+    { "2_0",     COMPR_CHMODE_STEREO, 0, 0x03, 2 },
+    { "3_0",     COMPR_CHMODE_3_0,    0, 0x07, 3 },
+    { "2_1",     COMPR_CHMODE_2_1,    0, 0x13, 4 },
+    { "3_1",     COMPR_CHMODE_3_1,    0, 0x17, 5 },
+    { "2_2",     COMPR_CHMODE_2_2,    0, 0x33, 6 },
+    { "3_2",     COMPR_CHMODE_3_2,    0, 0x37, 7 },
+    { "3_2_lfe", COMPR_CHMODE_3_2,    1, 0x3F, 7 },
+    { "3_4_lfe", COMPR_CHMODE_3_4,    1, 0xFF, 7 },
+};
+
+#define LFE_SLOT    3
+
+/* Slots of the channels of the mode, without the LFE when lfe is 0 */
+static std::vector<int> mode_slots(const bench_channel_mode &cm, int lfe)
+{
+    std::vector<int> slots;
+
+    for (int c = 0; c < DLB_MD_EMUL_MAX_CHANS; c++)
+    {
+        if (((cm.slots >> c) & 1) && (lfe || c != LFE_SLOT))
+        {
+            slots.push_back(c);
+        }
+    }
+    return slots;
+}
+
+static int mode_channels(const bench_channel_mode &cm, int lfe)
+{
+    return (int)mode_slots(cm, lfe).size();
+}
+
+/* Interleaved width of the mode, highest slot in use plus one */
+static int mode_width(const bench_channel_mode &cm)
+{
+    int width = 0;
+
+    for (int c = 0; c < DLB_MD_EMUL_MAX_CHANS; c++)
+    {
+        if ((cm.slots >> c) & 1)
+        {
+            width = c + 1;
+        }
+    }
+    return width;
+}
+
+/* Channel modes of the process API */
+typedef struct
+{
+    const char                 *name;
+    DLB_MD_EMUL_CHANNEL_MODE    mode;
+    int                         channels;
+    int                         lfe_on;
+} bench_process_mode;
+
+static const bench_process_mode process_modes[] =
+{
+    { "1_0",     DLB_MD_EMUL_CHMOD_1_0_0, 1, 0 },
+    { "2_0",     DLB_MD_EMUL_CHMOD_2_0_0, 2, 0 },
+    { "3_1",     DLB_MD_EMUL_CHMOD_3_1_0, 4, 0 },
+    { "3_2_lfe", DLB_MD_EMUL_CHMOD_3_2_1, 6, 1 },
+    { "3_4_lfe", DLB_MD_EMUL_CHMOD_3_4_1, 8, 1 },
+};
+
+static const int block_sizes[] = { 32, 64, 128, 256 };
+
+static double      min_seconds = 0.01;
+static std::string name_filter;
+
+static inline uint64_t read_cycles(void)
+{
+#ifdef BENCH_HAVE_CYCLES
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+/* Deterministic noise at about -20 dBFS */
+static void fill_noise(std::vector<DLB_LFRACT> *buf, uint32_t seed)
+{
+    for (DLB_LFRACT &x : *buf)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        x = 0.1 * ((double)(int32_t)seed / 2147483648.0);
+    }
+}
+
+/*
+ * Time run(), BENCH_REFRESH_CALLS calls per timed batch with refresh() untimed
+ * in between, until min_seconds have been measured. Best of BENCH_REPETITIONS.
+ */
+template<typename Run, typename Refresh>
+static bool time_case(const std::string &name, uint64_t samples_per_call, Run run, Refresh refresh,
+                      std::vector<bench_result> *results)
+{
+    bench_result result = { name, 0.0, 0.0, 0.0 };
+    double       best_ns = -1.0, best_cycles = 0.0;
+
+    if (!name_filter.empty() && name.find(name_filter) == std::string::npos)
+    {
+        return false;
+    }
+
+    refresh();
+    run();      /* warm up caches and branch predictors */
+
+    for (int rep = 0; rep < BENCH_REPETITIONS; rep++)
+    {
+        double   elapsed = 0.0;
+        uint64_t cycles = 0;
+        uint64_t calls = 0;
+
+        while (elapsed < min_seconds)
+        {
+            refresh();
+            auto     start = std::chrono::steady_clock::now();
+            uint64_t start_cycles = read_cycles();
+            for (int i = 0; i < BENCH_REFRESH_CALLS; i++)
+            {
+                run();
+            }
+            cycles += read_cycles() - start_cycles;
+            elapsed += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            calls += BENCH_REFRESH_CALLS;
+        }
+        double ns = elapsed * 1e9 / (double)(calls * samples_per_call);
+        if (best_ns < 0.0 || ns < best_ns)
+        {
+            best_ns = ns;
+            best_cycles = (double)cycles / (double)(calls * samples_per_call);
+        }
+    }
+
+    result.ns_per_sample = best_ns;
+    result.samples_per_s = 1e9 / best_ns;
+    result.cycles_per_sample = best_cycles;
+    results->push_back(result);
+
+    printf("%-52s %9.3f ns/sample %12.0f samples/s %8.2f cycles/sample\n",
+           name.c_str(), result.ns_per_sample, result.samples_per_s, result.cycles_per_sample);
+    fflush(stdout);
+    return true;
+}
+
+static std::string case_name(const char *kernel, const char *mode, int stride, int block)
+{
+    return std::string(kernel) + ":" + mode + ":stride" + std::to_string(stride) + ":block" + std::to_string(block);
+}
+
+/* emul_hpf, emul_lpf_bwlimit (emul_biquad), emul_lpf_lfe / emul_psf_main / emul_psf_surr (emul_biquad_ess) */
+static void bench_filters(const bench_channel_mode &cm, int stride, int block, std::vector<bench_result> *results)
+{
+    std::vector<DLB_LFRACT> input((size_t)block * stride), work(input.size());
+    std::vector<DLB_LFRACT> state(DLB_MD_EMUL_MAX_CHANS * 4 * BQHISTORY, 0.0);
+    std::vector<int>        slots = mode_slots(cm, 0);
+    int                     channels = (int)slots.size();
+    auto                    refresh = [&]() { std::copy(input.begin(), input.end(), work.begin()); };
+
+    fill_noise(&input, 1);
+
+    time_case(case_name("emul_hpf", cm.name, stride, block), (uint64_t)block * channels, [&]() {
+        for (int c : slots)
+        {
+            emul_hpf(&work[c], (int16_t)stride, &state[c], block);
+        }
+    }, refresh, results);
+
+    time_case(case_name("emul_biquad_bwlimit", cm.name, stride, block), (uint64_t)block * channels, [&]() {
+        for (int c : slots)
+        {
+            emul_lpf_bwlimit(&work[c], (int16_t)stride, cm.acmod, &state[c * BWLIMORDER * BQHISTORY], block);
+        }
+    }, refresh, results);
+
+    time_case(case_name("emul_biquad_ess_psf_main", cm.name, stride, block), (uint64_t)block * channels, [&]() {
+        for (int c : slots)
+        {
+            emul_psf_main(&work[c], (int16_t)stride, &state[c * MPHSTAGES * BQHISTORY], block);
+        }
+    }, refresh, results);
+
+    time_case(case_name("emul_biquad_ess_psf_surr", cm.name, stride, block), (uint64_t)block * channels, [&]() {
+        for (int c : slots)
+        {
+            emul_psf_surr(&work[c], (int16_t)stride, &state[c * SPHSTAGES * BQHISTORY], block);
+        }
+    }, refresh, results);
+
+    if (cm.lfe_on)
+    {
+        time_case(case_name("emul_biquad_ess_lfe", cm.name, stride, block), (uint64_t)block, [&]() {
+            emul_lpf_lfe(&work[LFE_SLOT], (int16_t)stride, &state[0], block);
+        }, refresh, results);
+    }
+}
+
+/* comprLoudnessCalc, comprDmxCalc and calcDrcGain on one frame of one block */
+static void bench_compressor(const bench_channel_mode &cm, int stride, int block, std::vector<bench_result> *results)
+{
+    uint32_t                internal_static, internal_dynamic, external_static;
+    std::vector<DLB_LFRACT> input((size_t)block * DLB_MD_EMUL_MAX_CHANS), work(input.size());  /* the compressor addresses every channel slot */
+    HANDLE_COMPR            compr;
+    auto                    refresh = [&]() { std::copy(input.begin(), input.end(), work.begin()); };
+    const uint16_t          dmx_mask = COMPR_DMX_LORO_CUSTOM_ACTIVE | COMPR_DMX_LTRT_DEFAULT_ACTIVE |
+                                       COMPR_DMX_LTRT_CUSTOM_ACTIVE | COMPR_DMX_PLII_DEFAULT_ACTIVE | COMPR_DMX_ITU_ACTIVE;
+
+    if (md_ComprGetRequiredBufferSize(cm.compr_mode, 1, &internal_static, &internal_dynamic, &external_static, block) != COMPR_OK)
+    {
+        throw std::runtime_error("Compressor does not support channel mode " + std::string(cm.name));
+    }
+    /* DLB_LFRACT vectors keep the memory aligned for the handle */
+    std::vector<DLB_LFRACT> mem_static(internal_static / sizeof(DLB_LFRACT) + 1);
+    std::vector<DLB_LFRACT> mem_dynamic(internal_dynamic / sizeof(DLB_LFRACT) + 1);
+    std::vector<DLB_LFRACT> mem_external(external_static / sizeof(DLB_LFRACT) + 1);
+
+    compr = md_ComprOpen(mem_static.data(), mem_dynamic.data(), mem_external.data(), cm.compr_mode,
+                         (int16_t)cm.lfe_on, 1, 48000, block);
+    if (!compr)
+    {
+        throw std::runtime_error("Compressor open failed for channel mode " + std::string(cm.name));
+    }
+    fill_noise(&input, 2);
+
+    time_case(case_name("comprLoudnessCalc", cm.name, stride, block), (uint64_t)block * mode_channels(cm, 1), [&]() {
+        md_ComprBenchLoudness(compr, work.data(), stride, block);
+    }, refresh, results);
+
+    if (cm.compr_mode >= COMPR_CHMODE_3_0)
+    {
+        time_case(case_name("comprDmxCalc", cm.name, stride, block), (uint64_t)block * mode_channels(cm, 1), [&]() {
+            md_ComprBenchDmx(compr, work.data(), stride, block, dmx_mask);
+        }, refresh, results);
+    }
+
+    /* once per block, reported per sample of the block it controls */
+    time_case(case_name("calcDrcGain", cm.name, stride, block), (uint64_t)block * mode_channels(cm, 1), [&]() {
+        md_ComprBenchDrcGain(compr, COMPR_FILM_STANDARD);
+    }, refresh, results);
+}
+
+static void bench_apply_gain(const bench_channel_mode &cm, int stride, int block, std::vector<bench_result> *results)
+{
+    std::vector<DLB_LFRACT> input((size_t)block * stride), work(input.size());
+    std::vector<int>        slots = mode_slots(cm, 1);
+    DLB_LFRACT             *channel_ptrs[DRC_MAX_NCHANS];
+    DD_EMU_CHAN_MAP         chan_map[DRC_MAX_NCHANS];
+    auto                    refresh = [&]() { std::copy(input.begin(), input.end(), work.begin()); };
+
+    fill_noise(&input, 3);
+    memset(chan_map, 0, sizeof(chan_map));
+    for (size_t c = 0; c < slots.size(); c++)
+    {
+        channel_ptrs[c] = &work[slots[c]];
+    }
+
+    /* 1/16 is unity gain after the 4 bits of boost headroom */
+    time_case(case_name("apply_gain", cm.name, stride, block), (uint64_t)block * slots.size(), [&]() {
+        apply_gain(channel_ptrs, 0.0625, 0.055, block, (int)slots.size(), stride, chan_map);
+    }, refresh, results);
+}
+
+/* dsplib vector primitives as called by the compressor, the mode is the instruction set */
+static void bench_vec(const char *isa, int stride, int block, std::vector<bench_result> *results)
+{
+    std::vector<DLB_LFRACT> a((size_t)block * stride), b(a.size()), out(a.size());
+    volatile DLB_NACCU      sink = 0;
+    auto                    none = []() {};
+
+    fill_noise(&a, 4);
+    fill_noise(&b, 5);
+    if (stride == 1)
+    {
+        time_case(case_name("vec_Labs_maxLU", isa, stride, block), (uint64_t)block, [&]() {
+            sink = sink + DLB_vec_Labs_maxLU(a.data(), (unsigned)block);
+        }, none, results);
+        time_case(case_name("vec_NdotLLU", isa, stride, block), (uint64_t)block, [&]() {
+            sink = sink + DLB_vec_NdotLLU(a.data(), b.data(), (unsigned)block);
+        }, none, results);
+        time_case(case_name("vec_LmpyLSU", isa, stride, block), (uint64_t)block, [&]() {
+            DLB_vec_LmpyLSU(out.data(), a.data(), 0.5, (unsigned)block);
+        }, none, results);
+    }
+    else
+    {
+        time_case(case_name("vec_Labs_max_strideLUU", isa, stride, block), (uint64_t)block, [&]() {
+            sink = sink + DLB_vec_Labs_max_strideLUU(a.data(), (unsigned)stride, (unsigned)block);
+        }, none, results);
+    }
+}
+
+static void bench_vec_all(std::vector<bench_result> *results)
+{
+#ifdef DLB_VEC_X86_SIMD_ACTIVE
+    dlb_vec_isa active = dlb_vec_x86_active();
+
+    for (int isa = DLB_VEC_ISA_GENERIC; isa <= (int)dlb_vec_x86_detect(); isa++)
+    {
+        const char *name = dlb_vec_x86_isa_name((dlb_vec_isa)isa);
+
+        dlb_vec_x86_select((dlb_vec_isa)isa);
+#else
+    {
+        const char *name = "generic";
+#endif
+        for (int stride : { 1, BENCH_MAX_STRIDE })
+        {
+            for (int block : block_sizes)
+            {
+                bench_vec(name, stride, block, results);
+            }
+        }
+    }
+#ifdef DLB_VEC_X86_SIMD_ACTIVE
+    dlb_vec_x86_select(active);
+#endif
+}
+
+static void bench_process(const bench_process_mode &pm, int stride, std::vector<bench_result> *results)
+{
+    static const DLB_MD_EMUL_CHANNEL_MAP layout[DLB_MD_EMUL_MAX_CHANS] =
+    {
+        DLB_MD_EMUL_CHAN_LEFT, DLB_MD_EMUL_CHAN_RGHT, DLB_MD_EMUL_CHAN_CNTR, DLB_MD_EMUL_CHAN_LFE,
+        DLB_MD_EMUL_CHAN_LSUR, DLB_MD_EMUL_CHAN_RSUR, DLB_MD_EMUL_CHAN_LBAK, DLB_MD_EMUL_CHAN_RBAK
+    };
+    dlb_md_emul_process_config_t emul_conf;
+    md_emul_instance             emul = {};
+    std::vector<DLB_LFRACT>      input((size_t)BENCH_PROCESS_BLOCK * DLB_MD_EMUL_MAX_CHANS), work(input.size());   /* the emulator addresses every channel slot */
+    std::vector<DLB_LFRACT>      secondary(DLB_MD_EMUL_MAX_CHANS * BENCH_PROCESS_BLOCK);
+    auto                         refresh = [&]() { std::copy(input.begin(), input.end(), work.begin()); };
+
+    memset(&emul_conf, 0, sizeof(emul_conf));
+    emul_conf.channel_mode = pm.mode;
+    emul_conf.dolbye_channel_mode = pm.mode;
+    emul_conf.lfe_on = pm.lfe_on;
+    for (int c = 0; c < DLB_MD_EMUL_MAX_CHANS; c++)
+    {
+        emul_conf.a_chan_map[c] = DLB_MD_EMUL_CHAN_NONE;
+    }
+    if (pm.mode == DLB_MD_EMUL_CHMOD_3_1_0)
+    {
+        emul_conf.a_chan_map[0] = DLB_MD_EMUL_CHAN_LEFT;
+        emul_conf.a_chan_map[1] = DLB_MD_EMUL_CHAN_RGHT;
+        emul_conf.a_chan_map[2] = DLB_MD_EMUL_CHAN_CNTR;
+        emul_conf.a_chan_map[3] = DLB_MD_EMUL_CHAN_MSUR;
+    }
+    else
+    {
+        for (int c = 0; c < pm.channels; c++)
+        {
+            emul_conf.a_chan_map[c] = layout[c];
+        }
+    }
+    emul_conf.sample_offset = stride;
+    emul_conf.num_samples = BENCH_PROCESS_BLOCK;
+    emul_conf.sample_rate = 48000u;
+    emul_conf.comp_mode[0] = DLB_MD_EMUL_CM_LINE;
+    emul_conf.dialnorm = 27;
+    emul_conf.lfelpfon = 1;
+    emul_conf.control = (DLB_MD_EMUL_CONTROL_ENCODER_ENABLE | DLB_MD_EMUL_CONTROL_DECODER_ENABLE | DLB_MD_EMUL_CONTROL_DRC_CALC_ENABLE);
+    emul_conf.drc_profile = DLB_MD_EMUL_COMPRESSION_PROFILE(1);
+    emul_conf.comp_profile = DLB_MD_EMUL_COMPRESSION_PROFILE(1);
+    emul_conf.pa_in_data[0] = work.data();
+    emul_conf.pa_in_data[1] = secondary.data();
+
+    fill_noise(&input, 4);
+    md_emul_instance_open(&emul);
+    try
+    {
+        time_case(case_name("dlb_md_emul_process", pm.name, stride, BENCH_PROCESS_BLOCK),
+                  (uint64_t)BENCH_PROCESS_BLOCK * pm.channels, [&]() {
+            md_emul_instance_process(&emul, &emul_conf, 1);
+        }, refresh, results);
+    }
+    catch (...)
+    {
+        md_emul_instance_close(&emul);
+        throw;
+    }
+    md_emul_instance_close(&emul);
+}
+
+/* One result per line, so the baseline can be read back without a JSON library */
+static void save_results(const std::string &file, const std::vector<bench_result> &results)
+{
+    std::ofstream out(file);
+
+    if (!out)
+    {
+        throw std::runtime_error("Cannot write " + file);
+    }
+    out << "{\n  \"version\": 1,\n  \"units\": \"per sample\",\n  \"results\": [\n";
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        char line[512];
+
+        snprintf(line, sizeof(line), "    { \"name\": \"%s\", \"ns_per_sample\": %.4f, \"samples_per_s\": %.0f, \"cycles_per_sample\": %.3f }%s\n",
+                 results[i].name.c_str(), results[i].ns_per_sample, results[i].samples_per_s,
+                 results[i].cycles_per_sample, (i + 1 < results.size()) ? "," : "");
+        out << line;
+    }
+    out << "  ]\n}\n";
+}
+
+static std::map<std::string, double> load_baseline(const std::string &file)
+{
+    std::ifstream                 in(file);
+    std::map<std::string, double> baseline;
+    std::string                   line;
+
+    if (!in)
+    {
+        throw std::runtime_error("Cannot read baseline " + file);
+    }
+    while (std::getline(in, line))
+    {
+        size_t name = line.find("\"name\": \"");
+        size_t ns = line.find("\"ns_per_sample\": ");
+
+        if (name == std::string::npos || ns == std::string::npos)
+        {
+            continue;
+        }
+        name += 9;
+        baseline[line.substr(name, line.find('"', name) - name)] = std::stod(line.substr(ns + 17));
+    }
+    return baseline;
+}
+
+/* Print the change of every case against the baseline, returns the number of regressions */
+static int compare_results(const std::map<std::string, double> &baseline, const std::vector<bench_result> &results,
+                           double threshold_percent)
+{
+    int regressions = 0;
+
+    printf("\n%-52s %10s %10s %8s\n", "case", "baseline", "current", "change");
+    for (const bench_result &r : results)
+    {
+        auto it = baseline.find(r.name);
+
+        if (it == baseline.end())
+        {
+            printf("%-52s %10s %10.3f %8s\n", r.name.c_str(), "-", r.ns_per_sample, "new");
+            continue;
+        }
+        double change = 100.0 * (r.ns_per_sample - it->second) / it->second;
+        bool   regressed = change > threshold_percent;
+
+        printf("%-52s %10.3f %10.3f %+7.1f%%%s\n", r.name.c_str(), it->second, r.ns_per_sample, change,
+               regressed ? "  REGRESSION" : "");
+        regressions += regressed;
+    }
+    printf("%d regression(s) above %.1f%%\n", regressions, threshold_percent);
+    return regressions;
+}
+
+static void show_usage(void)
+{
+    std::cout << "Usage:" << std::endl <<
+"\tmdemu_kernel_bench [options]" << std::endl <<
+"Options:" << std::endl <<
+"        --filter=TEXT     Only run cases whose name contains TEXT, e.g. comprDmxCalc or :3_2_lfe:" << std::endl <<
+"        --min-time=S      Seconds measured per case and repetition [--min-time=0.01]" << std::endl <<
+"        --save=FILE       Write the results as a JSON baseline" << std::endl <<
+"        --compare=FILE    Compare with a saved baseline, exit 1 on regressions" << std::endl <<
+"        --threshold=PCT   Slow down counted as a regression [--threshold=10]" << std::endl <<
+"Case names are kernel:channel mode:stride:block size. Samples are single channel" << std::endl <<
+"samples; cycles are time stamp counter cycles (0 where there is no counter)." << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    std::vector<bench_result> results;
+    std::string               save_file;
+    std::string               compare_file;
+    double                    threshold = 10.0;
+    int                       regressions = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        size_t      eq = arg.find('=');
+        std::string name = arg.substr(0, eq);
+        std::string value = (eq == std::string::npos) ? "" : arg.substr(eq + 1);
+
+        if (name == "--filter")
+        {
+            name_filter = value;
+        }
+        else if (name == "--min-time")
+        {
+            min_seconds = std::stod(value);
+        }
+        else if (name == "--save")
+        {
+            save_file = value;
+        }
+        else if (name == "--compare")
+        {
+            compare_file = value;
+        }
+        else if (name == "--threshold")
+        {
+            threshold = std::stod(value);
+        }
+        else
+        {
+            show_usage();
+            return 2;
+        }
+    }
+
+    try
+    {
+        for (const bench_channel_mode &cm : channel_modes)
+        {
+            /* packed and padded to the widest layout */
+            std::vector<int> strides = { mode_width(cm) };
+
+            if (mode_width(cm) != BENCH_MAX_STRIDE)
+            {
+                strides.push_back(BENCH_MAX_STRIDE);
+            }
+            for (int stride : strides)
+            {
+                for (int block : block_sizes)
+                {
+                    bench_filters(cm, stride, block, &results);
+                    bench_compressor(cm, stride, block, &results);
+                    bench_apply_gain(cm, stride, block, &results);
+                }
+            }
+        }
+        bench_vec_all(&results);
+        for (const bench_process_mode &pm : process_modes)
+        {
+            bench_process(pm, pm.channels, &results);
+            if (pm.channels != BENCH_MAX_STRIDE)
+            {
+                bench_process(pm, BENCH_MAX_STRIDE, &results);
+            }
+        }
+
+        if (!save_file.empty())
+        {
+            save_results(save_file, results);
+        }
+        if (!compare_file.empty())
+        {
+            regressions = compare_results(load_baseline(compare_file), results, threshold);
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 2;
+    }
+    return regressions ? 1 : 0;
+}
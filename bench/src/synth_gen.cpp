@@ -0,0 +1,169 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Writes the deterministic synthetic programme to a WAV file
+ *
+ * The same seed, layout, rate and duration always give the same file, so test
+ * and sizing material can be regenerated anywhere instead of being shipped.
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <sndfile.hh>
+
+#include "bench_layout.h"
+#include "synth_programme.h"
+
+#define SYNTH_CHUNK_FRAMES  48000
+
+static void show_usage(void)
+{
+    std::cout << "Usage:" << std::endl <<
+"\tmdemu_synth [options] outfile.wav" << std::endl <<
+"Options:" << std::endl <<
+"        --layout=L     Channel layout: 1_0, 2_0, 3_1, 3_2_1 or 3_4_1 [--layout=3_2_1]" << std::endl <<
+"        --rate=R       Sample rate: 32000, 44100 or 48000 [--rate=48000]" << std::endl <<
+"        --seconds=S    Duration [--seconds=60]" << std::endl <<
+"        --seed=N       Noise seed [--seed=1]" << std::endl <<
+"        --content=C    broadcast (pink noise steps, dialogue, transients, silence) or" << std::endl <<
+"                       conformance (the programme of the ctest curves) [--content=broadcast]" << std::endl <<
+"        --format=F     s16, s24 or f32 [--format=s24]" << std::endl <<
+"The outfile - writes to stdout." << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    std::string             layout_name = "3_2_1";
+    std::string             rate_name = "48000";
+    std::string             format = "s24";
+    std::string             output;
+    double                  seconds = 60.0;
+    uint32_t                seed = 1u;
+    synth_content           content = SYNTH_CONTENT_BROADCAST;
+
+    try
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            std::string arg = argv[i];
+            size_t      eq = arg.find('=');
+            std::string name = arg.substr(0, eq);
+            std::string value = (eq == std::string::npos) ? "" : arg.substr(eq + 1);
+
+            if (name == "--layout")
+            {
+                layout_name = value;
+            }
+            else if (name == "--rate")
+            {
+                rate_name = value;
+            }
+            else if (name == "--seconds")
+            {
+                seconds = std::stod(value);
+            }
+            else if (name == "--seed")
+            {
+                seed = (uint32_t)std::stoul(value);
+            }
+            else if (name == "--content" && (value == "broadcast" || value == "conformance"))
+            {
+                content = (value == "broadcast") ? SYNTH_CONTENT_BROADCAST : SYNTH_CONTENT_CONFORMANCE;
+            }
+            else if (name == "--format" && (value == "s16" || value == "s24" || value == "f32"))
+            {
+                format = value;
+            }
+            else if (output.empty() && (arg == "-" || arg[0] != '-'))
+            {
+                output = arg;
+            }
+            else
+            {
+                show_usage();
+                return 1;
+            }
+        }
+        if (output.empty())
+        {
+            show_usage();
+            return 1;
+        }
+
+        std::vector<const bench_layout *> layouts = bench_parse_layouts(layout_name);
+        std::vector<unsigned int>         rates = bench_parse_sample_rates(rate_name);
+
+        if (layouts.size() != 1 || rates.size() != 1)
+        {
+            throw std::runtime_error("Give a single layout and sample rate");
+        }
+
+        synth_programme_config  config = { layouts[0]->channels, layouts[0]->lfe_channel, rates[0], content };
+        synth_programme         synth;
+        int                     sf_format = SF_FORMAT_WAV | ((format == "s16") ? SF_FORMAT_PCM_16 :
+                                                             (format == "s24") ? SF_FORMAT_PCM_24 : SF_FORMAT_FLOAT);
+        SndfileHandle           file(output.c_str(), SFM_WRITE, sf_format, config.channels, (int)config.sample_rate);
+        uint64_t                frames_left = (uint64_t)(seconds * config.sample_rate + 0.5);
+        std::vector<DLB_LFRACT> chunk((size_t)SYNTH_CHUNK_FRAMES * config.channels);
+
+        if (file.error())
+        {
+            throw std::runtime_error("Cannot write " + output + ": " + file.strError());
+        }
+        synth_programme_open(&synth, &config, seed);
+        while (frames_left > 0)
+        {
+            uint32_t frames = (frames_left < SYNTH_CHUNK_FRAMES) ? (uint32_t)frames_left : SYNTH_CHUNK_FRAMES;
+
+            synth_programme_render(&synth, chunk.data(), frames);
+            if (file.writef(chunk.data(), frames) != (sf_count_t)frames)
+            {
+                throw std::runtime_error("Write to " + output + " failed");
+            }
+            frames_left -= frames;
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,367 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  End-to-end throughput of the emulator on the synthetic programme
+ *
+ * Pushes hours of the broadcast synthetic programme through the public API
+ * for every channel layout and sample rate, and through MdEmu as a headerless
+ * stdin to stdout stream, and reports the realtime factor, the peak resident
+ * memory and where the time went. The figures are meant for sizing hardware
+ * before any real content is available.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#include <sys/time.h>
+#define THROUGHPUT_HAVE_POSIX
+#endif
+
+#include "dlb_md_emul_api.h"
+#include "md_emul_instance.h"
+#include "bench_layout.h"
+#include "synth_programme.h"
+
+#define THROUGHPUT_SEED         1u
+#define MDEMU_SAMPLE_RATE       48000u      /* MdEmu always emulates at 48 kHz */
+#define MDEMU_CHUNK_BLOCKS      64
+
+typedef struct
+{
+    std::string     path;                   /**< "API" or "MdEmu" */
+    std::string     layout;
+    unsigned int    sample_rate;
+    double          audio_seconds;
+    double          wall_seconds;
+    double          generate_seconds;       /**< producing the programme */
+    double          emulate_seconds;        /**< dlb_md_emul_process() or the MdEmu process CPU time */
+    double          peak_rss_mb;
+} throughput_result;
+
+static double now_seconds(void)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/* Peak resident set of this process or of the largest waited-for child, in MB */
+static double peak_rss_mb(bool children)
+{
+#ifdef THROUGHPUT_HAVE_POSIX
+    struct rusage usage;
+
+    getrusage(children ? RUSAGE_CHILDREN : RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    return (double)usage.ru_maxrss / (1024.0 * 1024.0);     /* bytes */
+#else
+    return (double)usage.ru_maxrss / 1024.0;                /* kilobytes */
+#endif
+#else
+    (void)children;
+    return 0.0;
+#endif
+}
+
+#ifdef THROUGHPUT_HAVE_POSIX
+static double children_cpu_seconds(void)
+{
+    struct rusage usage;
+
+    getrusage(RUSAGE_CHILDREN, &usage);
+    return (double)(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec)
+         + (double)(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) * 1e-6;
+}
+#endif
+
+static void print_result(const throughput_result &r)
+{
+    double busy = r.generate_seconds + r.emulate_seconds;
+
+    printf("%-6s %-6s %6u Hz %8.0f s audio %8.2f s %8.1fx realtime %8.1fx emulation only  "
+           "split generate %4.1f%% emulate %4.1f%% other %4.1f%%  peak RSS %.1f MB\n",
+           r.path.c_str(), r.layout.c_str(), r.sample_rate, r.audio_seconds, r.wall_seconds,
+           r.audio_seconds / r.wall_seconds, r.audio_seconds / r.emulate_seconds,
+           100.0 * r.generate_seconds / r.wall_seconds, 100.0 * r.emulate_seconds / r.wall_seconds,
+           (busy < r.wall_seconds) ? 100.0 * (r.wall_seconds - busy) / r.wall_seconds : 0.0, r.peak_rss_mb);
+    fflush(stdout);
+}
+
+/* The settings of the MdEmu run below: line mode, film standard, dialnorm -31 */
+static void prepare_config(const bench_layout *layout, unsigned int sample_rate, dlb_md_emul_process_config_t *emul_conf)
+{
+    memset(emul_conf, 0, sizeof(*emul_conf));
+    emul_conf->channel_mode = layout->channel_mode;
+    emul_conf->dolbye_channel_mode = layout->channel_mode;
+    bench_layout_channel_map(layout, emul_conf);
+    emul_conf->sample_offset = layout->channels;
+    emul_conf->num_samples = DLB_MD_EMUL_BLOCK_SIZE;
+    emul_conf->sample_rate = sample_rate;
+    emul_conf->comp_mode[0] = DLB_MD_EMUL_CM_LINE;
+    emul_conf->dialnorm = 31;
+    emul_conf->lfelpfon = 1;
+    emul_conf->control = (DLB_MD_EMUL_CONTROL_ENCODER_ENABLE | DLB_MD_EMUL_CONTROL_DECODER_ENABLE | DLB_MD_EMUL_CONTROL_DRC_CALC_ENABLE);
+    emul_conf->drc_profile = DLB_MD_EMUL_COMPRESSION_PROFILE(1);
+    emul_conf->comp_profile = DLB_MD_EMUL_COMPRESSION_PROFILE(1);
+}
+
+static throughput_result run_api(const bench_layout *layout, unsigned int sample_rate, double seconds)
+{
+    synth_programme_config       config = { layout->channels, layout->lfe_channel, sample_rate, SYNTH_CONTENT_BROADCAST };
+    synth_programme              synth;
+    dlb_md_emul_process_config_t emul_conf;
+    md_emul_instance             emul = {};
+    std::vector<DLB_LFRACT>      block((size_t)DLB_MD_EMUL_BLOCK_SIZE * DLB_MD_EMUL_MAX_CHANS);    /* the emulator addresses every channel slot */
+    std::vector<DLB_LFRACT>      secondary((size_t)DLB_MD_EMUL_BLOCK_SIZE * DLB_MD_EMUL_MAX_CHANS);
+    uint64_t                     blocks = (uint64_t)(seconds * sample_rate / DLB_MD_EMUL_BLOCK_SIZE);
+    throughput_result            result = { "API", layout->name, sample_rate, 0.0, 0.0, 0.0, 0.0, 0.0 };
+    double                       start;
+
+    prepare_config(layout, sample_rate, &emul_conf);
+    emul_conf.pa_in_data[0] = block.data();
+    emul_conf.pa_in_data[1] = secondary.data();
+    synth_programme_open(&synth, &config, THROUGHPUT_SEED);
+    md_emul_instance_open(&emul);
+
+    start = now_seconds();
+    try
+    {
+        for (uint64_t b = 0; b < blocks; b++)
+        {
+            double t0 = now_seconds();
+
+            synth_programme_render(&synth, block.data(), DLB_MD_EMUL_BLOCK_SIZE);
+            double t1 = now_seconds();
+            md_emul_instance_process(&emul, &emul_conf, 1);
+            result.emulate_seconds += now_seconds() - t1;
+            result.generate_seconds += t1 - t0;
+        }
+    }
+    catch (...)
+    {
+        md_emul_instance_close(&emul);
+        throw;
+    }
+    result.wall_seconds = now_seconds() - start;
+    md_emul_instance_close(&emul);
+
+    result.audio_seconds = (double)(blocks * DLB_MD_EMUL_BLOCK_SIZE) / sample_rate;
+    result.peak_rss_mb = peak_rss_mb(false);
+    return result;
+}
+
+#ifdef THROUGHPUT_HAVE_POSIX
+/* Stream the programme through MdEmu as headerless doubles, discarding its output */
+static throughput_result run_mdemu(const std::string &mdemu, const bench_layout *layout, double seconds)
+{
+    synth_programme_config  config = { layout->channels, layout->lfe_channel, MDEMU_SAMPLE_RATE, SYNTH_CONTENT_BROADCAST };
+    synth_programme         synth;
+    uint32_t                chunk_frames = MDEMU_CHUNK_BLOCKS * DLB_MD_EMUL_BLOCK_SIZE;
+    std::vector<DLB_LFRACT> chunk((size_t)chunk_frames * layout->channels);
+    std::vector<double>     samples(chunk.size());
+    uint64_t                frames_left = (uint64_t)(seconds * MDEMU_SAMPLE_RATE);
+    throughput_result       result = { "MdEmu", layout->name, MDEMU_SAMPLE_RATE, 0.0, 0.0, 0.0, 0.0, 0.0 };
+    std::string             command = "\"" + mdemu + "\" " + layout->mdemu_flags + " -dn31 -k1 --format=f64 --channels=" +
+                                      std::to_string(layout->channels) + " --rate=" + std::to_string(MDEMU_SAMPLE_RATE) +
+                                      " - - > /dev/null 2> /dev/null";
+    double                  cpu_before = children_cpu_seconds();
+    double                  start = now_seconds();
+    FILE                   *pipe = popen(command.c_str(), "w");
+
+    if (!pipe)
+    {
+        throw std::runtime_error("Cannot start " + command);
+    }
+    synth_programme_open(&synth, &config, THROUGHPUT_SEED);
+    result.audio_seconds = (double)frames_left / MDEMU_SAMPLE_RATE;
+    while (frames_left > 0)
+    {
+        uint32_t frames = (frames_left < chunk_frames) ? (uint32_t)frames_left : chunk_frames;
+        double   t0 = now_seconds();
+
+        synth_programme_render(&synth, chunk.data(), frames);
+        std::copy(chunk.begin(), chunk.begin() + (size_t)frames * layout->channels, samples.begin());
+        result.generate_seconds += now_seconds() - t0;
+        if (fwrite(samples.data(), sizeof(double) * layout->channels, frames, pipe) != frames)
+        {
+            pclose(pipe);
+            throw std::runtime_error("MdEmu stopped reading: " + command);
+        }
+        frames_left -= frames;
+    }
+    if (pclose(pipe) != 0)
+    {
+        throw std::runtime_error("MdEmu failed: " + command);
+    }
+    result.wall_seconds = now_seconds() - start;
+    result.emulate_seconds = children_cpu_seconds() - cpu_before;
+    result.peak_rss_mb = peak_rss_mb(true);
+    return result;
+}
+#endif
+
+static void save_json(const std::string &file, const std::vector<throughput_result> &results)
+{
+    std::ofstream out(file);
+
+    if (!out)
+    {
+        throw std::runtime_error("Cannot write " + file);
+    }
+    out << "[\n";
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        const throughput_result &r = results[i];
+        char                     line[512];
+
+        snprintf(line, sizeof(line), "  { \"path\": \"%s\", \"layout\": \"%s\", \"sample_rate\": %u, \"audio_s\": %.1f, "
+                 "\"wall_s\": %.3f, \"realtime_factor\": %.2f, \"generate_s\": %.3f, \"emulate_s\": %.3f, "
+                 "\"peak_rss_mb\": %.1f }%s\n",
+                 r.path.c_str(), r.layout.c_str(), r.sample_rate, r.audio_seconds, r.wall_seconds,
+                 r.audio_seconds / r.wall_seconds, r.generate_seconds, r.emulate_seconds, r.peak_rss_mb,
+                 (i + 1 < results.size()) ? "," : "");
+        out << line;
+    }
+    out << "]\n";
+}
+
+static void show_usage(void)
+{
+    std::cout << "Usage:" << std::endl <<
+"\tmdemu_throughput [options]" << std::endl <<
+"Options:" << std::endl <<
+"        --hours=H      Programme length per run [--hours=1]" << std::endl <<
+"        --layouts=L    Comma separated layouts 1_0, 2_0, 3_1, 3_2_1, 3_4_1 [--layouts=all]" << std::endl <<
+"        --rates=R      Comma separated API sample rates 32000, 44100, 48000 [--rates=all]" << std::endl <<
+"        --mdemu=PATH   MdEmu executable [the one built alongside]" << std::endl <<
+"        --no-mdemu     Only measure the API" << std::endl <<
+"        --json=FILE    Also write the results as JSON" << std::endl <<
+"MdEmu runs are 48 kHz only and their emulate time is the CPU time of the MdEmu process." << std::endl <<
+"Peak RSS of MdEmu is the largest of the MdEmu runs so far." << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    std::vector<throughput_result> results;
+    std::string                    layouts_list = "all";
+    std::string                    rates_list = "all";
+    std::string                    json_file;
+#ifdef MDEMU_PATH
+    std::string                    mdemu = MDEMU_PATH;
+#else
+    std::string                    mdemu;
+#endif
+    double                         hours = 1.0;
+
+    try
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            std::string arg = argv[i];
+            size_t      eq = arg.find('=');
+            std::string name = arg.substr(0, eq);
+            std::string value = (eq == std::string::npos) ? "" : arg.substr(eq + 1);
+
+            if (name == "--hours")
+            {
+                hours = std::stod(value);
+            }
+            else if (name == "--layouts")
+            {
+                layouts_list = value;
+            }
+            else if (name == "--rates")
+            {
+                rates_list = value;
+            }
+            else if (name == "--mdemu")
+            {
+                mdemu = value;
+            }
+            else if (name == "--no-mdemu")
+            {
+                mdemu.clear();
+            }
+            else if (name == "--json")
+            {
+                json_file = value;
+            }
+            else
+            {
+                show_usage();
+                return 1;
+            }
+        }
+
+        std::vector<const bench_layout *> layouts = bench_parse_layouts(layouts_list);
+        std::vector<unsigned int>         rates = bench_parse_sample_rates(rates_list);
+
+        for (const bench_layout *layout : layouts)
+        {
+            for (unsigned int rate : rates)
+            {
+                results.push_back(run_api(layout, rate, hours * 3600.0));
+                print_result(results.back());
+            }
+        }
+#ifdef THROUGHPUT_HAVE_POSIX
+        if (!mdemu.empty())
+        {
+            for (const bench_layout *layout : layouts)
+            {
+                results.push_back(run_mdemu(mdemu, layout, hours * 3600.0));
+                print_result(results.back());
+            }
+        }
+#endif
+        if (!json_file.empty())
+        {
+            save_json(json_file, results);
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -59,6 +59,9 @@
  * Floating point values less than FLT_MIN can be set to 0.0f for performance reasons by
  * a call to the provided flush operation. If the define is not set these operations return
  * the input value.
+ * @par DLB_NO_FLOAT_SATURATE
+ * Saturating operations (e.g. L*s*addLS()) return the plain IEEE result instead of clipping
+ * to the range [-1,1]. The application must then clip where its signals leave the library.
  *
  * @}
  * @internal
@@ -186,8 +189,11 @@ static inline
 double
 _dlb_saturate(double f)
 {
+#ifdef DLB_NO_FLOAT_SATURATE
+    return f;
+#else
     return _dlb_fclip(f, -1.0, 1.0);
-
+#endif
 }
 
 static inline
@@ -277,9 +277,14 @@ file to include.
 #endif
 
 #ifndef DLB_DSPLIB
+#if defined DLB_DSPLIB_X86_SIMD
+/* Generic dsplib with x86 SIMD vector kernels selected at run time */
+#   define DLB_DSPLIB  "dlb_dsplib/backend/processor/x86_simd/dlb_dsplib_x86_simd.h"
+#else
 /* Use generic dsplib backend when no optimized one is available */
 #   define DLB_DSPLIB  "dlb_dsplib/backend/generic/dlb_dsplib_generic.h"
 #endif
+#endif
 
 /* Now we've got the path to the backend abstraction, include it. */
 #include DLB_BACKEND
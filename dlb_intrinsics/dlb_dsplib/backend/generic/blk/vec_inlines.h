@@ -43,6 +43,11 @@
 
 #include "dlb_intrinsics.h"
 
+/* A processor backend may replace any function below with its own
+ * implementation by defining DLB_VEC_HAVE_<function> before including this
+ * file; the generic versions stay the reference for the others.
+ */
+
 #define _dlb_vec_inlines_pad(x, N) ((((x) + (N) - 1)/(N))*(N))
 
 /** When allocating memory for a vector of n*DLB_LFRACTs, you should allocate
@@ -60,6 +65,7 @@
 #define DLB_SVEC_size(n) (_dlb_vec_inlines_pad((n), DLB_SVEC_PADDING))
 
 /** @brief compute the dot-product (sum of products) of two DLB_LFRACT vectors of length n */
+#ifndef DLB_VEC_HAVE_NdotLLU
 static inline
 DLB_NACCU
 DLB_vec_NdotLLU
@@ -74,6 +80,7 @@ DLB_vec_NdotLLU
 		acc = DLB_NmacNLL(acc, a[i], b[i]);
 	return acc;
 }
+#endif
 
 static inline
 DLB_SFRACT
@@ -93,6 +100,7 @@ DLB_vec_Sabs_maxSU
 	return DLB_SmaxSS(max, DLB_SsnegS(min));
 }
 
+#ifndef DLB_VEC_HAVE_Labs_maxLU
 static inline
 DLB_LFRACT
 DLB_vec_Labs_maxLU
@@ -110,6 +118,7 @@ DLB_vec_Labs_maxLU
 	}
 	return DLB_LmaxLL(max, DLB_LsnegL(min));
 }
+#endif
 
 static inline
 unsigned int
@@ -131,6 +140,30 @@ DLB_vec_UnormLU
 	return DLB_UnormL(DLB_vec_Labs_maxLU(a, n));
 }
 
+/** @brief maximum absolute value of n DLB_LFRACTs that are stride elements apart,
+ * such as one channel of interleaved audio */
+#ifndef DLB_VEC_HAVE_Labs_max_strideLUU
+static inline
+DLB_LFRACT
+DLB_vec_Labs_max_strideLUU
+	(const DLB_LFRACT *a
+	,unsigned int stride
+	,unsigned int n
+	)
+{
+	unsigned int i;
+	DLB_LFRACT min = a[0];
+	DLB_LFRACT max = a[0];
+	for (i = 1; i < n; i++)
+	{
+		max = DLB_LmaxLL(max, a[i*stride]);
+		min = DLB_LminLL(min, a[i*stride]);
+	}
+	return DLB_LmaxLL(max, DLB_LsnegL(min));
+}
+#endif
+
+#ifndef DLB_VEC_HAVE_LmaskLSU
 static inline
 void
 DLB_vec_LmaskLSU
@@ -144,6 +177,7 @@ DLB_vec_LmaskLSU
 	for (i = 0; i < n; ++i)
 		dest[i] = DLB_LmpyLS(x[i], w[i]);
 }
+#endif
 
 static inline
 void
@@ -266,6 +300,7 @@ DLB_vec_IeqLLU
 	return 1;
 }
 
+#ifndef DLB_VEC_HAVE_LmpyLSU
 static inline
 void
 DLB_vec_LmpyLSU
@@ -279,7 +314,9 @@ DLB_vec_LmpyLSU
 	for (i = 0; i < n; i++)
 		a[i] = DLB_LmpyLS(b[i], g);
 }
+#endif
 
+#ifndef DLB_VEC_HAVE_LmpyLSU_inplace
 static inline
 void
 DLB_vec_LmpyLSU_inplace
@@ -298,6 +335,7 @@ DLB_vec_LmpyLSU_inplace
 		*pio++ = DLB_LmpyLS(in, g);
     }
 }
+#endif
 
 #ifndef DLB_INTRINSICS_EXCLUDE_DEPRECATED_OPS
 static inline
@@ -49,6 +49,7 @@
 static inline DLB_LFRACT
 DLB_LdivLL(DLB_LFRACT x, DLB_LFRACT y)
 {
+  DLB_INSTRUMENT_OP(DLB_OP_DIV);
   assert(DLB_F_L(y) != 0.0);
   return DLB_L_F( DLB_F_L(x)/DLB_F_L(y) );
 }
@@ -57,6 +58,7 @@ DLB_LdivLL(DLB_LFRACT x, DLB_LFRACT y)
 static inline DLB_SFRACT
 DLB_SdivLL(DLB_LFRACT x, DLB_LFRACT y)
 {
+  DLB_INSTRUMENT_OP(DLB_OP_DIV);
   assert(DLB_F_L(y) != 0.0);
   return DLB_S_F( DLB_F_L(x)/DLB_F_L(y) );
 }
@@ -0,0 +1,134 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2010 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief Vector utility routines: x86 SIMD implementations with run-time dispatch
+ *
+ * With the 64 bit floating point backend, the primitives below call through
+ * a table of kernels chosen once at start-up from CPUID: SSE2 (the x86-64
+ * baseline), AVX2 or AVX-512F. All other primitives, and all primitives with
+ * other backends, are the generic ones.
+ *
+ * The kernels return the same values as the generic loops, with one
+ * exception: DLB_vec_NdotLLU sums in a different order (one partial sum per
+ * lane), so its result may differ in the last bits.
+ */
+
+#ifndef DLB_VECINLINES_X86_SIMD_H
+#define DLB_VECINLINES_X86_SIMD_H
+
+#include "dlb_dsplib/backend/processor/x86_simd/blk/vec_x86_simd.h"
+
+#ifdef DLB_VEC_X86_SIMD_ACTIVE
+
+#define DLB_VEC_HAVE_NdotLLU
+#define DLB_VEC_HAVE_Labs_maxLU
+#define DLB_VEC_HAVE_Labs_max_strideLUU
+#define DLB_VEC_HAVE_LmaskLSU
+#define DLB_VEC_HAVE_LmpyLSU
+#define DLB_VEC_HAVE_LmpyLSU_inplace
+
+static inline
+DLB_NACCU
+DLB_vec_NdotLLU
+	(const DLB_LFRACT *DLB_RESTRICT a
+	,const DLB_LFRACT *DLB_RESTRICT b
+	,unsigned int n
+	)
+{
+	return dlb_vec_x86.NdotLLU(a, b, n);
+}
+
+static inline
+DLB_LFRACT
+DLB_vec_Labs_maxLU
+	(const DLB_LFRACT *a
+	,unsigned int n
+	)
+{
+	return dlb_vec_x86.Labs_maxLU(a, n);
+}
+
+static inline
+DLB_LFRACT
+DLB_vec_Labs_max_strideLUU
+	(const DLB_LFRACT *a
+	,unsigned int stride
+	,unsigned int n
+	)
+{
+	return dlb_vec_x86.Labs_max_strideLUU(a, stride, n);
+}
+
+static inline
+void
+DLB_vec_LmaskLSU
+	(DLB_LFRACT dest[]
+	,const DLB_LFRACT x[]
+	,const DLB_SFRACT w[]
+	,unsigned int n
+	)
+{
+	dlb_vec_x86.LmaskLSU(dest, x, w, n);
+}
+
+static inline
+void
+DLB_vec_LmpyLSU
+	(DLB_LFRACT *DLB_RESTRICT a
+	,const DLB_LFRACT *DLB_RESTRICT b
+	,DLB_SFRACT g
+	,unsigned int n
+	)
+{
+	dlb_vec_x86.LmpyLSU(a, b, g, n);
+}
+
+static inline
+void
+DLB_vec_LmpyLSU_inplace
+	(DLB_LFRACT *inout
+	,DLB_SFRACT g
+	,unsigned int n
+	)
+{
+	dlb_vec_x86.LmpyLSU_inplace(inout, g, n);
+}
+
+#endif /* DLB_VEC_X86_SIMD_ACTIVE */
+
+#include "dlb_dsplib/backend/generic/blk/vec_inlines.h"
+
+#endif /* DLB_VECINLINES_X86_SIMD_H */
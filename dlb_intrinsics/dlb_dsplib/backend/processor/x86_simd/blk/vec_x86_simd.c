@@ -0,0 +1,632 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2010 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief x86 SIMD vector kernels and their run-time dispatch
+ *
+ * Each instruction set has its own kernels, compiled with the matching
+ * target attribute so that one binary runs on any x86 processor. The
+ * maximum and minimum instructions return their second operand on ties,
+ * like the generic (a > b) ? a : b, so the abs max kernels match the generic
+ * loop except for ties between +0 and -0 and for NaNs, which depend on the
+ * order of the comparisons; results of 0 or NaN are recomputed with the
+ * generic loop.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+
+#include "dlb_dsplib/backend/processor/x86_simd/blk/vec_x86_simd.h"
+#include "dlb_dsplib/backend/generic/blk/vec_inlines.h"     /* the generic kernels */
+
+#ifdef DLB_VEC_X86_SIMD_ACTIVE
+
+#if defined(__GNUC__)
+#define VEC_TARGET(isa)     __attribute__((target(isa)))
+#else
+#define VEC_TARGET(isa)
+#endif
+
+/******************************************************************************
+generic: the dsplib reference loops
+******************************************************************************/
+
+static DLB_NACCU
+generic_NdotLLU(const DLB_LFRACT *a, const DLB_LFRACT *b, unsigned int n)
+{
+    return DLB_vec_NdotLLU(a, b, n);
+}
+
+static DLB_LFRACT
+generic_Labs_maxLU(const DLB_LFRACT *a, unsigned int n)
+{
+    return DLB_vec_Labs_maxLU(a, n);
+}
+
+static DLB_LFRACT
+generic_Labs_max_strideLUU(const DLB_LFRACT *a, unsigned int stride, unsigned int n)
+{
+    return DLB_vec_Labs_max_strideLUU(a, stride, n);
+}
+
+static void
+generic_LmaskLSU(DLB_LFRACT *dest, const DLB_LFRACT *x, const DLB_SFRACT *w, unsigned int n)
+{
+    DLB_vec_LmaskLSU(dest, x, w, n);
+}
+
+static void
+generic_LmpyLSU(DLB_LFRACT *a, const DLB_LFRACT *b, DLB_SFRACT g, unsigned int n)
+{
+    DLB_vec_LmpyLSU(a, b, g, n);
+}
+
+static void
+generic_LmpyLSU_inplace(DLB_LFRACT *inout, DLB_SFRACT g, unsigned int n)
+{
+    DLB_vec_LmpyLSU_inplace(inout, g, n);
+}
+
+/* Combine the lane results of an abs max kernel, continuing with elements i to n-1 */
+static DLB_LFRACT
+finish_abs_max
+    (const DLB_LFRACT   *max_lanes
+    ,const DLB_LFRACT   *min_lanes
+    ,unsigned int        lanes
+    ,const DLB_LFRACT   *a
+    ,unsigned int        stride
+    ,unsigned int        i
+    ,unsigned int        n
+    )
+{
+    DLB_LFRACT   max = max_lanes[0];
+    DLB_LFRACT   min = min_lanes[0];
+    unsigned int l;
+
+    for (l = 1; l < lanes; l++)
+    {
+        max = DLB_LmaxLL(max, max_lanes[l]);
+        min = DLB_LminLL(min, min_lanes[l]);
+    }
+    for (; i < n; i++)
+    {
+        max = DLB_LmaxLL(max, a[i * stride]);
+        min = DLB_LminLL(min, a[i * stride]);
+    }
+    if (max == 0.0 || min == 0.0 || max != max || min != min)
+    {
+        return DLB_vec_Labs_max_strideLUU(a, stride, n);
+    }
+    return DLB_LmaxLL(max, DLB_LsnegL(min));
+}
+
+/******************************************************************************
+SSE2: two lanes
+******************************************************************************/
+
+VEC_TARGET("sse2") static DLB_NACCU
+sse2_NdotLLU(const DLB_LFRACT *a, const DLB_LFRACT *b, unsigned int n)
+{
+    __m128d      acc0 = _mm_setzero_pd();
+    __m128d      acc1 = _mm_setzero_pd();
+    DLB_NACCU    lanes[2];
+    DLB_NACCU    acc;
+    unsigned int i = 0;
+
+    for (; i + 4 <= n; i += 4)
+    {
+        acc0 = _mm_add_pd(acc0, _mm_mul_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+        acc1 = _mm_add_pd(acc1, _mm_mul_pd(_mm_loadu_pd(a + i + 2), _mm_loadu_pd(b + i + 2)));
+    }
+    _mm_storeu_pd(lanes, _mm_add_pd(acc0, acc1));
+    acc = lanes[0] + lanes[1];
+    for (; i < n; i++)
+    {
+        acc = DLB_NmacNLL(acc, a[i], b[i]);
+    }
+    return acc;
+}
+
+VEC_TARGET("sse2") static DLB_LFRACT
+sse2_Labs_maxLU(const DLB_LFRACT *a, unsigned int n)
+{
+    __m128d      max0 = _mm_set1_pd(a[0]), max1 = max0;
+    __m128d      min0 = max0, min1 = max0;
+    DLB_LFRACT   max_lanes[2], min_lanes[2];
+    unsigned int i = 0;
+
+    for (; i + 4 <= n; i += 4)
+    {
+        __m128d x0 = _mm_loadu_pd(a + i);
+        __m128d x1 = _mm_loadu_pd(a + i + 2);
+
+        max0 = _mm_max_pd(max0, x0);
+        min0 = _mm_min_pd(min0, x0);
+        max1 = _mm_max_pd(max1, x1);
+        min1 = _mm_min_pd(min1, x1);
+    }
+    _mm_storeu_pd(max_lanes, _mm_max_pd(max0, max1));
+    _mm_storeu_pd(min_lanes, _mm_min_pd(min0, min1));
+    return finish_abs_max(max_lanes, min_lanes, 2, a, 1, i, n);
+}
+
+VEC_TARGET("sse2") static DLB_LFRACT
+sse2_Labs_max_strideLUU(const DLB_LFRACT *a, unsigned int stride, unsigned int n)
+{
+    __m128d      max0 = _mm_set1_pd(a[0]);
+    __m128d      min0 = max0;
+    DLB_LFRACT   max_lanes[2], min_lanes[2];
+    unsigned int i = 0;
+
+    if (stride == 1)
+    {
+        return sse2_Labs_maxLU(a, n);
+    }
+    for (; i + 2 <= n; i += 2)
+    {
+        __m128d x = _mm_set_pd(a[(i + 1) * stride], a[i * stride]);
+
+        max0 = _mm_max_pd(max0, x);
+        min0 = _mm_min_pd(min0, x);
+    }
+    _mm_storeu_pd(max_lanes, max0);
+    _mm_storeu_pd(min_lanes, min0);
+    return finish_abs_max(max_lanes, min_lanes, 2, a, stride, i, n);
+}
+
+VEC_TARGET("sse2") static void
+sse2_LmaskLSU(DLB_LFRACT *dest, const DLB_LFRACT *x, const DLB_SFRACT *w, unsigned int n)
+{
+    unsigned int i = 0;
+
+    for (; i + 2 <= n; i += 2)
+    {
+        _mm_storeu_pd(dest + i, _mm_mul_pd(_mm_loadu_pd(x + i), _mm_loadu_pd(w + i)));
+    }
+    for (; i < n; i++)
+    {
+        dest[i] = DLB_LmpyLS(x[i], w[i]);
+    }
+}
+
+VEC_TARGET("sse2") static void
+sse2_LmpyLSU(DLB_LFRACT *a, const DLB_LFRACT *b, DLB_SFRACT g, unsigned int n)
+{
+    __m128d      vg = _mm_set1_pd(g);
+    unsigned int i = 0;
+
+    for (; i + 2 <= n; i += 2)
+    {
+        _mm_storeu_pd(a + i, _mm_mul_pd(_mm_loadu_pd(b + i), vg));
+    }
+    for (; i < n; i++)
+    {
+        a[i] = DLB_LmpyLS(b[i], g);
+    }
+}
+
+VEC_TARGET("sse2") static void
+sse2_LmpyLSU_inplace(DLB_LFRACT *inout, DLB_SFRACT g, unsigned int n)
+{
+    sse2_LmpyLSU(inout, inout, g, n);
+}
+
+/******************************************************************************
+AVX2: four lanes, hardware gather for strided access
+******************************************************************************/
+
+VEC_TARGET("avx2") static DLB_NACCU
+avx2_NdotLLU(const DLB_LFRACT *a, const DLB_LFRACT *b, unsigned int n)
+{
+    __m256d      acc0 = _mm256_setzero_pd();
+    __m256d      acc1 = _mm256_setzero_pd();
+    DLB_NACCU    lanes[4];
+    DLB_NACCU    acc;
+    unsigned int i = 0;
+
+    for (; i + 8 <= n; i += 8)
+    {
+        acc0 = _mm256_add_pd(acc0, _mm256_mul_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+        acc1 = _mm256_add_pd(acc1, _mm256_mul_pd(_mm256_loadu_pd(a + i + 4), _mm256_loadu_pd(b + i + 4)));
+    }
+    _mm256_storeu_pd(lanes, _mm256_add_pd(acc0, acc1));
+    acc = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    for (; i < n; i++)
+    {
+        acc = DLB_NmacNLL(acc, a[i], b[i]);
+    }
+    return acc;
+}
+
+VEC_TARGET("avx2") static DLB_LFRACT
+avx2_Labs_maxLU(const DLB_LFRACT *a, unsigned int n)
+{
+    __m256d      max0 = _mm256_set1_pd(a[0]), max1 = max0;
+    __m256d      min0 = max0, min1 = max0;
+    DLB_LFRACT   max_lanes[4], min_lanes[4];
+    unsigned int i = 0;
+
+    for (; i + 8 <= n; i += 8)
+    {
+        __m256d x0 = _mm256_loadu_pd(a + i);
+        __m256d x1 = _mm256_loadu_pd(a + i + 4);
+
+        max0 = _mm256_max_pd(max0, x0);
+        min0 = _mm256_min_pd(min0, x0);
+        max1 = _mm256_max_pd(max1, x1);
+        min1 = _mm256_min_pd(min1, x1);
+    }
+    _mm256_storeu_pd(max_lanes, _mm256_max_pd(max0, max1));
+    _mm256_storeu_pd(min_lanes, _mm256_min_pd(min0, min1));
+    return finish_abs_max(max_lanes, min_lanes, 4, a, 1, i, n);
+}
+
+VEC_TARGET("avx2") static DLB_LFRACT
+avx2_Labs_max_strideLUU(const DLB_LFRACT *a, unsigned int stride, unsigned int n)
+{
+    __m256d      max0 = _mm256_set1_pd(a[0]);
+    __m256d      min0 = max0;
+    __m256i      index = _mm256_set_epi64x(3 * (int64_t)stride, 2 * (int64_t)stride, (int64_t)stride, 0);
+    __m256i      step = _mm256_set1_epi64x(4 * (int64_t)stride);
+    DLB_LFRACT   max_lanes[4], min_lanes[4];
+    unsigned int i = 0;
+
+    if (stride == 1)
+    {
+        return avx2_Labs_maxLU(a, n);
+    }
+    for (; i + 4 <= n; i += 4)
+    {
+        __m256d x = _mm256_i64gather_pd(a, index, sizeof(DLB_LFRACT));
+
+        max0 = _mm256_max_pd(max0, x);
+        min0 = _mm256_min_pd(min0, x);
+        index = _mm256_add_epi64(index, step);
+    }
+    _mm256_storeu_pd(max_lanes, max0);
+    _mm256_storeu_pd(min_lanes, min0);
+    return finish_abs_max(max_lanes, min_lanes, 4, a, stride, i, n);
+}
+
+VEC_TARGET("avx2") static void
+avx2_LmaskLSU(DLB_LFRACT *dest, const DLB_LFRACT *x, const DLB_SFRACT *w, unsigned int n)
+{
+    unsigned int i = 0;
+
+    for (; i + 4 <= n; i += 4)
+    {
+        _mm256_storeu_pd(dest + i, _mm256_mul_pd(_mm256_loadu_pd(x + i), _mm256_loadu_pd(w + i)));
+    }
+    for (; i < n; i++)
+    {
+        dest[i] = DLB_LmpyLS(x[i], w[i]);
+    }
+}
+
+VEC_TARGET("avx2") static void
+avx2_LmpyLSU(DLB_LFRACT *a, const DLB_LFRACT *b, DLB_SFRACT g, unsigned int n)
+{
+    __m256d      vg = _mm256_set1_pd(g);
+    unsigned int i = 0;
+
+    for (; i + 4 <= n; i += 4)
+    {
+        _mm256_storeu_pd(a + i, _mm256_mul_pd(_mm256_loadu_pd(b + i), vg));
+    }
+    for (; i < n; i++)
+    {
+        a[i] = DLB_LmpyLS(b[i], g);
+    }
+}
+
+VEC_TARGET("avx2") static void
+avx2_LmpyLSU_inplace(DLB_LFRACT *inout, DLB_SFRACT g, unsigned int n)
+{
+    avx2_LmpyLSU(inout, inout, g, n);
+}
+
+/******************************************************************************
+AVX-512F: eight lanes, hardware gather for strided access
+******************************************************************************/
+
+VEC_TARGET("avx512f") static DLB_NACCU
+avx512_NdotLLU(const DLB_LFRACT *a, const DLB_LFRACT *b, unsigned int n)
+{
+    __m512d      acc0 = _mm512_setzero_pd();
+    __m512d      acc1 = _mm512_setzero_pd();
+    DLB_NACCU    lanes[8];
+    DLB_NACCU    acc;
+    unsigned int i = 0;
+
+    for (; i + 16 <= n; i += 16)
+    {
+        acc0 = _mm512_add_pd(acc0, _mm512_mul_pd(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i)));
+        acc1 = _mm512_add_pd(acc1, _mm512_mul_pd(_mm512_loadu_pd(a + i + 8), _mm512_loadu_pd(b + i + 8)));
+    }
+    _mm512_storeu_pd(lanes, _mm512_add_pd(acc0, acc1));
+    acc = ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) + ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+    for (; i < n; i++)
+    {
+        acc = DLB_NmacNLL(acc, a[i], b[i]);
+    }
+    return acc;
+}
+
+VEC_TARGET("avx512f") static DLB_LFRACT
+avx512_Labs_maxLU(const DLB_LFRACT *a, unsigned int n)
+{
+    __m512d      max0 = _mm512_set1_pd(a[0]), max1 = max0;
+    __m512d      min0 = max0, min1 = max0;
+    DLB_LFRACT   max_lanes[8], min_lanes[8];
+    unsigned int i = 0;
+
+    for (; i + 16 <= n; i += 16)
+    {
+        __m512d x0 = _mm512_loadu_pd(a + i);
+        __m512d x1 = _mm512_loadu_pd(a + i + 8);
+
+        max0 = _mm512_max_pd(max0, x0);
+        min0 = _mm512_min_pd(min0, x0);
+        max1 = _mm512_max_pd(max1, x1);
+        min1 = _mm512_min_pd(min1, x1);
+    }
+    _mm512_storeu_pd(max_lanes, _mm512_max_pd(max0, max1));
+    _mm512_storeu_pd(min_lanes, _mm512_min_pd(min0, min1));
+    return finish_abs_max(max_lanes, min_lanes, 8, a, 1, i, n);
+}
+
+VEC_TARGET("avx512f") static DLB_LFRACT
+avx512_Labs_max_strideLUU(const DLB_LFRACT *a, unsigned int stride, unsigned int n)
+{
+    __m512d      max0 = _mm512_set1_pd(a[0]);
+    __m512d      min0 = max0;
+    int64_t      s = (int64_t)stride;
+    __m512i      index = _mm512_set_epi64(7 * s, 6 * s, 5 * s, 4 * s, 3 * s, 2 * s, s, 0);
+    __m512i      step = _mm512_set1_epi64(8 * s);
+    DLB_LFRACT   max_lanes[8], min_lanes[8];
+    unsigned int i = 0;
+
+    if (stride == 1)
+    {
+        return avx512_Labs_maxLU(a, n);
+    }
+    for (; i + 8 <= n; i += 8)
+    {
+        __m512d x = _mm512_i64gather_pd(index, a, sizeof(DLB_LFRACT));
+
+        max0 = _mm512_max_pd(max0, x);
+        min0 = _mm512_min_pd(min0, x);
+        index = _mm512_add_epi64(index, step);
+    }
+    _mm512_storeu_pd(max_lanes, max0);
+    _mm512_storeu_pd(min_lanes, min0);
+    return finish_abs_max(max_lanes, min_lanes, 8, a, stride, i, n);
+}
+
+VEC_TARGET("avx512f") static void
+avx512_LmaskLSU(DLB_LFRACT *dest, const DLB_LFRACT *x, const DLB_SFRACT *w, unsigned int n)
+{
+    unsigned int i = 0;
+
+    for (; i + 8 <= n; i += 8)
+    {
+        _mm512_storeu_pd(dest + i, _mm512_mul_pd(_mm512_loadu_pd(x + i), _mm512_loadu_pd(w + i)));
+    }
+    for (; i < n; i++)
+    {
+        dest[i] = DLB_LmpyLS(x[i], w[i]);
+    }
+}
+
+VEC_TARGET("avx512f") static void
+avx512_LmpyLSU(DLB_LFRACT *a, const DLB_LFRACT *b, DLB_SFRACT g, unsigned int n)
+{
+    __m512d      vg = _mm512_set1_pd(g);
+    unsigned int i = 0;
+
+    for (; i + 8 <= n; i += 8)
+    {
+        _mm512_storeu_pd(a + i, _mm512_mul_pd(_mm512_loadu_pd(b + i), vg));
+    }
+    for (; i < n; i++)
+    {
+        a[i] = DLB_LmpyLS(b[i], g);
+    }
+}
+
+VEC_TARGET("avx512f") static void
+avx512_LmpyLSU_inplace(DLB_LFRACT *inout, DLB_SFRACT g, unsigned int n)
+{
+    avx512_LmpyLSU(inout, inout, g, n);
+}
+
+/******************************************************************************
+dispatch
+******************************************************************************/
+
+static const dlb_vec_kernels isa_kernels[DLB_VEC_ISA_NUM] =
+{
+    { generic_NdotLLU, generic_Labs_maxLU, generic_Labs_max_strideLUU, generic_LmaskLSU, generic_LmpyLSU, generic_LmpyLSU_inplace },
+    { sse2_NdotLLU, sse2_Labs_maxLU, sse2_Labs_max_strideLUU, sse2_LmaskLSU, sse2_LmpyLSU, sse2_LmpyLSU_inplace },
+    { avx2_NdotLLU, avx2_Labs_maxLU, avx2_Labs_max_strideLUU, avx2_LmaskLSU, avx2_LmpyLSU, avx2_LmpyLSU_inplace },
+    { avx512_NdotLLU, avx512_Labs_maxLU, avx512_Labs_max_strideLUU, avx512_LmaskLSU, avx512_LmpyLSU, avx512_LmpyLSU_inplace },
+};
+
+static const char *const isa_names[DLB_VEC_ISA_NUM] = { "generic", "sse2", "avx2", "avx512" };
+
+#if defined(__x86_64__) || defined(_M_X64)
+dlb_vec_kernels dlb_vec_x86 = { sse2_NdotLLU, sse2_Labs_maxLU, sse2_Labs_max_strideLUU, sse2_LmaskLSU, sse2_LmpyLSU, sse2_LmpyLSU_inplace };
+static dlb_vec_isa active_isa = DLB_VEC_ISA_SSE2;
+#else
+dlb_vec_kernels dlb_vec_x86 = { generic_NdotLLU, generic_Labs_maxLU, generic_Labs_max_strideLUU, generic_LmaskLSU, generic_LmpyLSU, generic_LmpyLSU_inplace };
+static dlb_vec_isa active_isa = DLB_VEC_ISA_GENERIC;
+#endif
+
+static
+void
+cpuid
+    (unsigned int leaf
+    ,unsigned int regs[4]
+    )
+{
+#if defined(_MSC_VER)
+    int r[4];
+
+    __cpuidex(r, (int)leaf, 0);
+    memcpy(regs, r, sizeof(r));
+#else
+    __cpuid_count(leaf, 0, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+static
+uint64_t
+xgetbv0
+    (void)
+{
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    uint32_t lo, hi;
+
+    __asm__ __volatile__("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+    return ((uint64_t)hi << 32) | lo;
+#endif
+}
+
+dlb_vec_isa
+dlb_vec_x86_detect
+    (void)
+{
+    unsigned int regs[4];
+    unsigned int max_leaf;
+    uint64_t     xcr0;
+
+    cpuid(0, regs);
+    max_leaf = regs[0];
+    cpuid(1, regs);
+    if (!(regs[3] & (1u << 26)))                            /* SSE2 */
+    {
+        return DLB_VEC_ISA_GENERIC;
+    }
+    if (max_leaf < 7 || !(regs[2] & (1u << 27)) || !(regs[2] & (1u << 28)))    /* OSXSAVE, AVX */
+    {
+        return DLB_VEC_ISA_SSE2;
+    }
+    xcr0 = xgetbv0();
+    if ((xcr0 & 0x6) != 0x6)                                /* XMM and YMM state enabled by the OS */
+    {
+        return DLB_VEC_ISA_SSE2;
+    }
+    cpuid(7, regs);
+    if ((regs[1] & (1u << 16)) && (xcr0 & 0xe0) == 0xe0)    /* AVX-512F, opmask and ZMM state */
+    {
+        return DLB_VEC_ISA_AVX512;
+    }
+    if (regs[1] & (1u << 5))                                /* AVX2 */
+    {
+        return DLB_VEC_ISA_AVX2;
+    }
+    return DLB_VEC_ISA_SSE2;
+}
+
+int
+dlb_vec_x86_select
+    (dlb_vec_isa isa
+    )
+{
+    if ((unsigned int)isa >= DLB_VEC_ISA_NUM || isa > dlb_vec_x86_detect())
+    {
+        return -1;
+    }
+    dlb_vec_x86 = isa_kernels[isa];
+    active_isa = isa;
+    return 0;
+}
+
+dlb_vec_isa
+dlb_vec_x86_active
+    (void)
+{
+    return active_isa;
+}
+
+const char *
+dlb_vec_x86_isa_name
+    (dlb_vec_isa isa
+    )
+{
+    return ((unsigned int)isa < DLB_VEC_ISA_NUM) ? isa_names[isa] : "unknown";
+}
+
+/* Pick the kernels before main(): the best supported, or the one named by DLB_VEC_ISA */
+static
+void
+dlb_vec_x86_startup
+    (void)
+{
+    const char *name = getenv("DLB_VEC_ISA");
+    int         isa;
+
+    if (name)
+    {
+        for (isa = 0; isa < DLB_VEC_ISA_NUM; isa++)
+        {
+            if (!strcmp(name, isa_names[isa]) && !dlb_vec_x86_select((dlb_vec_isa)isa))
+            {
+                return;
+            }
+        }
+    }
+    dlb_vec_x86_select(dlb_vec_x86_detect());
+}
+
+#if defined(__GNUC__)
+__attribute__((constructor)) static void vec_x86_constructor(void) { dlb_vec_x86_startup(); }
+#elif defined(_MSC_VER)
+static void __cdecl vec_x86_constructor(void) { dlb_vec_x86_startup(); }
+#pragma section(".CRT$XCU", read)
+__declspec(allocate(".CRT$XCU")) void (__cdecl *dlb_vec_x86_constructor_ptr)(void) = vec_x86_constructor;
+#endif
+
+#endif /* DLB_VEC_X86_SIMD_ACTIVE */
@@ -0,0 +1,105 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2010 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief x86 SIMD vector kernels and their run-time dispatch
+ */
+
+#ifndef DLB_VEC_X86_SIMD_H
+#define DLB_VEC_X86_SIMD_H
+
+#include "dlb_intrinsics.h"
+
+#if !(defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86))
+#error "The x86 SIMD dsplib backend needs an x86 target"
+#endif
+
+#if defined(DLB_METHOD_IS_FLOAT) && DLB_LFRACT_BITS == 64
+
+#define DLB_VEC_X86_SIMD_ACTIVE
+
+/** Instruction sets with their own kernels, in order of preference */
+typedef enum
+{
+    DLB_VEC_ISA_GENERIC,            /**< the generic C loops */
+    DLB_VEC_ISA_SSE2,
+    DLB_VEC_ISA_AVX2,
+    DLB_VEC_ISA_AVX512,             /**< AVX-512F */
+    DLB_VEC_ISA_NUM
+} dlb_vec_isa;
+
+/** Kernels of one instruction set */
+typedef struct
+{
+    DLB_NACCU  (*NdotLLU)(const DLB_LFRACT *a, const DLB_LFRACT *b, unsigned int n);
+    DLB_LFRACT (*Labs_maxLU)(const DLB_LFRACT *a, unsigned int n);
+    DLB_LFRACT (*Labs_max_strideLUU)(const DLB_LFRACT *a, unsigned int stride, unsigned int n);
+    void       (*LmaskLSU)(DLB_LFRACT *dest, const DLB_LFRACT *x, const DLB_SFRACT *w, unsigned int n);
+    void       (*LmpyLSU)(DLB_LFRACT *a, const DLB_LFRACT *b, DLB_SFRACT g, unsigned int n);
+    void       (*LmpyLSU_inplace)(DLB_LFRACT *inout, DLB_SFRACT g, unsigned int n);
+} dlb_vec_kernels;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** The active kernels; SSE2 until the start-up selection has run */
+extern dlb_vec_kernels dlb_vec_x86;
+
+/** Best instruction set supported by the processor and the operating system */
+dlb_vec_isa dlb_vec_x86_detect(void);
+
+/**
+ * Use the kernels of the given instruction set.
+ * Called at start-up with the detected instruction set, or the one named by
+ * the DLB_VEC_ISA environment variable (generic, sse2, avx2, avx512) when it
+ * is set and supported. Not thread-safe against concurrent vector calls.
+ * @return 0, or -1 if the processor does not support isa
+ */
+int dlb_vec_x86_select(dlb_vec_isa isa);
+
+/** Instruction set of the active kernels */
+dlb_vec_isa dlb_vec_x86_active(void);
+
+/** "generic", "sse2", "avx2" or "avx512" */
+const char *dlb_vec_x86_isa_name(dlb_vec_isa isa);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DLB_METHOD_IS_FLOAT && DLB_LFRACT_BITS == 64 */
+
+#endif /* DLB_VEC_X86_SIMD_H */
@@ -2812,6 +2812,11 @@ intrinsics debug macros (to collect file and line information in debug builds).
 
 #endif
 
+#ifdef DLB_INSTRUMENT_COUNT
+/* Wrap the intrinsics declared above so that each call is counted */
+#   include "instrument/count/dlb_instrument_count_ops.h"
+#endif
+
 /******************************************************************************
 compatibilty layer(s)
 ******************************************************************************/
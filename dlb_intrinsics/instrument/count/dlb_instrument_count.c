@@ -0,0 +1,422 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2010 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief Operation count instrumentation backend
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "dlb_instrument_count.h"
+
+#ifdef _WIN32
+#include <windows.h>
+static SRWLOCK count_lock = SRWLOCK_INIT;
+#define COUNT_LOCK()        AcquireSRWLockExclusive(&count_lock)
+#define COUNT_UNLOCK()      ReleaseSRWLockExclusive(&count_lock)
+#define COUNT_TLS           __declspec(thread)
+#else
+#include <pthread.h>
+static pthread_mutex_t count_lock = PTHREAD_MUTEX_INITIALIZER;
+#define COUNT_LOCK()        pthread_mutex_lock(&count_lock)
+#define COUNT_UNLOCK()      pthread_mutex_unlock(&count_lock)
+#define COUNT_TLS           __thread
+#endif
+
+const char *const dlb_instrument_count_op_names[DLB_OP_NUM] =
+{
+    "add", "sadd", "mpy", "mac", "shift", "norm", "div", "cmp", "rnd"
+};
+
+const double dlb_instrument_count_default_weights[DLB_OP_NUM] =
+{
+    1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 16.0, 1.0, 1.0
+};
+
+typedef struct
+{
+    int         unit;                       /* -1 when the unit table was full */
+    uint64_t    start[DLB_OP_NUM];          /* thread counts on entry */
+} count_frame;
+
+/* Counters of one thread */
+typedef struct count_thread_s
+{
+    struct count_thread_s      *next;
+    uint64_t                    frames;
+    uint64_t                    ops[DLB_OP_NUM];        /* all operations counted by this thread */
+    uint64_t                    outside[DLB_OP_NUM];
+    int                         depth;
+    unsigned int                num_units;
+    dlb_instrument_count_unit   units[DLB_INSTRUMENT_COUNT_MAX_UNITS];
+    uint64_t                    frame_start[DLB_INSTRUMENT_COUNT_MAX_UNITS][DLB_OP_NUM];  /* unit totals at the last frame */
+    count_frame                 stack[DLB_INSTRUMENT_COUNT_MAX_DEPTH];
+} count_thread;
+
+static count_thread                    *thread_list;
+static unsigned int                     list_generation = 1;    /* bumped by close, invalidates the thread pointers */
+static double                           op_weights[DLB_OP_NUM] = { 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 16.0, 1.0, 1.0 };
+static dlb_instrument_count_report_t    merged_report;
+
+static COUNT_TLS count_thread          *this_thread;
+static COUNT_TLS unsigned int           this_generation;
+
+static
+count_thread *
+get_thread
+    (void)
+{
+    count_thread *t = this_thread;
+
+    if (t && this_generation == list_generation)
+    {
+        return t;
+    }
+    t = (count_thread *)calloc(1, sizeof(count_thread));
+    if (t)
+    {
+        COUNT_LOCK();
+        t->next = thread_list;
+        thread_list = t;
+        this_generation = list_generation;
+        COUNT_UNLOCK();
+    }
+    this_thread = t;
+    return t;
+}
+
+static
+int
+find_unit
+    (count_thread   *t
+    ,const char     *punit
+    )
+{
+    unsigned int i;
+
+    for (i = 0; i < t->num_units; i++)
+    {
+        if (t->units[i].name == punit || !strcmp(t->units[i].name, punit))
+        {
+            return (int)i;
+        }
+    }
+    if (t->num_units == DLB_INSTRUMENT_COUNT_MAX_UNITS)
+    {
+        return -1;
+    }
+    t->units[t->num_units].name = punit;
+    t->units[t->num_units].depth = t->depth;
+    return (int)t->num_units++;
+}
+
+/* Weighted operations of the unit since the last frame boundary */
+static
+double
+frame_ops
+    (const count_thread *t
+    ,unsigned int        unit
+    )
+{
+    uint64_t ops[DLB_OP_NUM];
+    int      op;
+
+    for (op = 0; op < DLB_OP_NUM; op++)
+    {
+        ops[op] = t->units[unit].total[op] - t->frame_start[unit][op];
+    }
+    return dlb_instrument_count_weighted(ops, op_weights);
+}
+
+void
+dlb_instrument_count_open
+    (void)
+{
+    count_thread *t;
+
+    COUNT_LOCK();
+    for (t = thread_list; t; t = t->next)
+    {
+        t->frames = 0;
+        t->depth = 0;
+        t->num_units = 0;
+        memset(t->ops, 0, sizeof(t->ops));
+        memset(t->outside, 0, sizeof(t->outside));
+    }
+    COUNT_UNLOCK();
+}
+
+void
+dlb_instrument_count_close
+    (void)
+{
+    count_thread *t;
+
+    COUNT_LOCK();
+    while (thread_list)
+    {
+        t = thread_list;
+        thread_list = t->next;
+        free(t);
+    }
+    list_generation++;
+    COUNT_UNLOCK();
+}
+
+void
+dlb_instrument_count_set_weights
+    (const double weights[DLB_OP_NUM]
+    )
+{
+    memcpy(op_weights, weights, sizeof(op_weights));
+}
+
+void
+dlb_instrument_count_op
+    (dlb_instrument_op op
+    )
+{
+    count_thread *t = get_thread();
+    int           top;
+
+    if (!t)
+    {
+        return;
+    }
+    t->ops[op]++;
+    top = (t->depth < DLB_INSTRUMENT_COUNT_MAX_DEPTH) ? t->depth : DLB_INSTRUMENT_COUNT_MAX_DEPTH;
+    if (top == 0)
+    {
+        t->outside[op]++;
+    }
+    else if (t->stack[top - 1].unit >= 0)
+    {
+        t->units[t->stack[top - 1].unit].self[op]++;
+    }
+}
+
+void
+dlb_instrument_count_enter
+    (const char *punit
+    )
+{
+    count_thread *t = get_thread();
+
+    if (!t)
+    {
+        return;
+    }
+    if (t->depth < DLB_INSTRUMENT_COUNT_MAX_DEPTH)
+    {
+        count_frame *f = &t->stack[t->depth];
+
+        f->unit = find_unit(t, punit);
+        memcpy(f->start, t->ops, sizeof(f->start));
+    }
+    t->depth++;
+}
+
+void
+dlb_instrument_count_leave
+    (const char *punit
+    )
+{
+    count_thread *t = this_thread;
+    int           op;
+
+    (void)punit;    /* units are left in the reverse order of entry */
+    if (!t || this_generation != list_generation || t->depth == 0)
+    {
+        return;
+    }
+    t->depth--;
+    if (t->depth < DLB_INSTRUMENT_COUNT_MAX_DEPTH && t->stack[t->depth].unit >= 0)
+    {
+        const count_frame          *f = &t->stack[t->depth];
+        dlb_instrument_count_unit  *u = &t->units[f->unit];
+
+        u->calls++;
+        for (op = 0; op < DLB_OP_NUM; op++)
+        {
+            u->total[op] += t->ops[op] - f->start[op];
+        }
+    }
+}
+
+void
+dlb_instrument_count_enter_frame
+    (void)
+{
+    count_thread *t = get_thread();
+    unsigned int  i;
+
+    if (!t)
+    {
+        return;
+    }
+    /* Close the previous frame of every unit */
+    for (i = 0; i < t->num_units; i++)
+    {
+        double ops = frame_ops(t, i);
+
+        if (ops > t->units[i].peak)
+        {
+            t->units[i].peak = ops;
+        }
+        memcpy(t->frame_start[i], t->units[i].total, sizeof(t->frame_start[i]));
+    }
+    t->frames++;
+}
+
+const dlb_instrument_count_report_t *
+dlb_instrument_count_report
+    (void)
+{
+    count_thread *t;
+    unsigned int  i, j;
+    int           op;
+
+    COUNT_LOCK();
+    memset(&merged_report, 0, sizeof(merged_report));
+    memcpy(merged_report.weights, op_weights, sizeof(op_weights));
+    for (t = thread_list; t; t = t->next)
+    {
+        merged_report.frames += t->frames;
+        for (op = 0; op < DLB_OP_NUM; op++)
+        {
+            merged_report.outside[op] += t->outside[op];
+        }
+        for (i = 0; i < t->num_units; i++)
+        {
+            const dlb_instrument_count_unit *u = &t->units[i];
+            dlb_instrument_count_unit       *m;
+            double                           last = frame_ops(t, i);     /* the frame still open */
+
+            for (j = 0; j < merged_report.num_units; j++)
+            {
+                if (!strcmp(merged_report.units[j].name, u->name))
+                {
+                    break;
+                }
+            }
+            if (j == merged_report.num_units)
+            {
+                if (j == DLB_INSTRUMENT_COUNT_MAX_UNITS)
+                {
+                    continue;
+                }
+                merged_report.units[j].name = u->name;
+                merged_report.units[j].depth = u->depth;
+                merged_report.num_units++;
+            }
+            m = &merged_report.units[j];
+            m->calls += u->calls;
+            for (op = 0; op < DLB_OP_NUM; op++)
+            {
+                m->total[op] += u->total[op];
+                m->self[op] += u->self[op];
+            }
+            if (u->peak > m->peak)
+            {
+                m->peak = u->peak;
+            }
+            if (last > m->peak)
+            {
+                m->peak = last;
+            }
+        }
+    }
+    COUNT_UNLOCK();
+    return &merged_report;
+}
+
+double
+dlb_instrument_count_weighted
+    (const uint64_t ops[DLB_OP_NUM]
+    ,const double   weights[DLB_OP_NUM]
+    )
+{
+    double sum = 0.0;
+    int    op;
+
+    for (op = 0; op < DLB_OP_NUM; op++)
+    {
+        sum += (double)ops[op] * weights[op];
+    }
+    return sum;
+}
+
+void
+dlb_instrument_count_print
+    (FILE                                   *fp
+    ,const dlb_instrument_count_report_t    *report
+    ,double                                  frames_per_second
+    )
+{
+    double       frames = report->frames ? (double)report->frames : 1.0;
+    double       mcps = frames_per_second / frames * 1e-6;     /* weighted operations to MCPS */
+    uint64_t     all[DLB_OP_NUM];
+    unsigned int i;
+    int          op;
+
+    fprintf(fp, "%-32s %10s %14s %14s %10s %10s %10s\n", "unit", "calls/frm", "ops/frm", "self ops/frm",
+            "MCPS", "self MCPS", "peak MCPS");
+    memcpy(all, report->outside, sizeof(all));
+    for (i = 0; i < report->num_units; i++)
+    {
+        const dlb_instrument_count_unit *u = &report->units[i];
+        int                              indent = (u->depth < 8) ? 2 * u->depth : 16;
+        double                           total = dlb_instrument_count_weighted(u->total, report->weights);
+        double                           self = dlb_instrument_count_weighted(u->self, report->weights);
+
+        fprintf(fp, "%*s%-*s %10.2f %14.1f %14.1f %10.3f %10.3f %10.3f\n", indent, "", 32 - indent, u->name,
+                (double)u->calls / frames, total / frames, self / frames, total * mcps, self * mcps,
+                u->peak * frames_per_second * 1e-6);
+        for (op = 0; op < DLB_OP_NUM; op++)
+        {
+            all[op] += u->self[op];
+        }
+    }
+    fprintf(fp, "\n%-32s %10s %14s %10s\n", "operation", "weight", "ops/frm", "MCPS");
+    for (op = 0; op < DLB_OP_NUM; op++)
+    {
+        fprintf(fp, "%-32s %10.1f %14.1f %10.3f\n", dlb_instrument_count_op_names[op], report->weights[op],
+                (double)all[op] / frames, (double)all[op] * report->weights[op] * mcps);
+    }
+    fprintf(fp, "%-32s %10s %14.1f %10.3f\n", "all", "",
+            dlb_instrument_count_weighted(all, report->weights) / frames,
+            dlb_instrument_count_weighted(all, report->weights) * mcps);
+}
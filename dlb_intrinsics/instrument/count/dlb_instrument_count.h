@@ -0,0 +1,226 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2010 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief Operation count instrumentation backend
+ */
+
+#ifndef DLB_INSTRUMENT_COUNT_H
+#define DLB_INSTRUMENT_COUNT_H
+
+#include <stdio.h>
+#include <stdint.h>
+
+/**
+ * @addtogroup dlb_instrument_count
+ *
+ * @brief Counts the Dolby Intrinsics executed in each profiling unit.
+ *
+ * Selected with DLB_INSTRUMENT_COUNT. Every arithmetic intrinsic is wrapped
+ * so that it calls DLB_INSTRUMENT_OP() with its operation class before it
+ * executes (see dlb_instrument_count_ops.h); the DSP library divide does the
+ * same. Conversions from and to float, integers and memory, flushes and
+ * stores are not counted: they are data movement on the targets the counts
+ * are meant for.
+ *
+ * Operations are counted against the innermost profiling unit (self) and,
+ * when a unit is left, added to its total including nested units.
+ * Operations outside of any unit are counted separately. Counters are
+ * thread-local; DLB_INSTRUMENT_REPORT() merges the units of all threads by
+ * name.
+ *
+ * A frame is the span between two DLB_INSTRUMENT_ENTER_FRAME; the weighted
+ * operations of the busiest frame of each unit are kept for worst case
+ * (peak) load figures. Weighted operations per frame times frames per second
+ * give the MCPS estimate of dlb_instrument_count_print().
+ *
+ * Typical reporting code:
+ * @code
+ * DLB_INSTRUMENT_OPEN();
+ * ... process, calling DLB_INSTRUMENT_ENTER_FRAME once per block ...
+ * dlb_instrument_count_print(stdout, DLB_INSTRUMENT_REPORT(), sample_rate / block_size);
+ * DLB_INSTRUMENT_CLOSE();
+ * @endcode
+ *
+ * Counting cannot be combined with DLB_DEBUG_XARGS.
+ *
+ * @{
+ */
+
+#define DLB_INSTRUMENT_COUNT_MAX_UNITS  64      /**< distinct unit names */
+#define DLB_INSTRUMENT_COUNT_MAX_DEPTH  32      /**< deepest nesting that is attributed */
+
+/** Operation classes */
+typedef enum
+{
+    DLB_OP_ADD,         /**< add, subtract, negate, absolute value */
+    DLB_OP_SADD,        /**< saturating add, subtract, negate, absolute value */
+    DLB_OP_MPY,         /**< multiply */
+    DLB_OP_MAC,         /**< multiply-accumulate and multiply-subtract */
+    DLB_OP_SHIFT,       /**< shifts */
+    DLB_OP_NORM,        /**< normalisation (headroom) */
+    DLB_OP_DIV,         /**< divide */
+    DLB_OP_CMP,         /**< compare, min, max, clip, limit */
+    DLB_OP_RND,         /**< rounding, truncation and saturation between formats */
+    DLB_OP_NUM
+} dlb_instrument_op;
+
+/** Operation counts of one profiling unit */
+typedef struct
+{
+    const char *name;
+    int         depth;                      /**< nesting depth when first entered */
+    uint64_t    calls;
+    uint64_t    total[DLB_OP_NUM];          /**< including nested units */
+    uint64_t    self[DLB_OP_NUM];           /**< without nested units */
+    double      peak;                       /**< weighted total of the busiest frame */
+} dlb_instrument_count_unit;
+
+/** Units of all threads, in order of first entry */
+typedef struct
+{
+    uint64_t                    frames;     /**< DLB_INSTRUMENT_ENTER_FRAME count */
+    uint64_t                    outside[DLB_OP_NUM];    /**< operations outside of any unit */
+    double                      weights[DLB_OP_NUM];    /**< weights the peaks were computed with */
+    unsigned int                num_units;
+    dlb_instrument_count_unit   units[DLB_INSTRUMENT_COUNT_MAX_UNITS];
+} dlb_instrument_count_report_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Short names of the operation classes, "add" to "rnd" */
+extern const char *const dlb_instrument_count_op_names[DLB_OP_NUM];
+
+/** Default weights: one cycle per operation, divide 16 (iterative on most DSPs) */
+extern const double dlb_instrument_count_default_weights[DLB_OP_NUM];
+
+/** Discard all counts */
+void dlb_instrument_count_open(void);
+
+/** Discard all counts and free the per-thread counters */
+void dlb_instrument_count_close(void);
+
+/** Set the cost of each operation class; call before counting starts */
+void dlb_instrument_count_set_weights(const double weights[DLB_OP_NUM]);
+
+void dlb_instrument_count_op(dlb_instrument_op op);
+
+void dlb_instrument_count_enter(const char *punit);
+
+void dlb_instrument_count_leave(const char *punit);
+
+void dlb_instrument_count_enter_frame(void);
+
+/** Merge the counters of all threads, valid until the next call */
+const dlb_instrument_count_report_t *dlb_instrument_count_report(void);
+
+/** Sum of the counts times the weights */
+double dlb_instrument_count_weighted(const uint64_t ops[DLB_OP_NUM], const double weights[DLB_OP_NUM]);
+
+/** Print the weighted operations and MCPS per unit and per operation class */
+void dlb_instrument_count_print(FILE *fp, const dlb_instrument_count_report_t *report, double frames_per_second);
+
+#ifdef __cplusplus
+}
+#endif
+
+#undef DLB_INSTRUMENT_OPEN
+#define DLB_INSTRUMENT_OPEN()       dlb_instrument_count_open()
+
+#undef DLB_INSTRUMENT_CLOSE
+#define DLB_INSTRUMENT_CLOSE()      dlb_instrument_count_close()
+
+#undef DLB_INSTRUMENT_OP
+#define DLB_INSTRUMENT_OP(op)       dlb_instrument_count_op(op)
+
+#undef DLB_INSTRUMENT_ENTER_PUNIT
+#define DLB_INSTRUMENT_ENTER_PUNIT(punit_id)            dlb_instrument_count_enter(punit_id)
+
+#undef DLB_INSTRUMENT_ENTER_CRITICAL_PUNIT
+#define DLB_INSTRUMENT_ENTER_CRITICAL_PUNIT(punit_id)   dlb_instrument_count_enter(punit_id)
+
+#undef DLB_INSTRUMENT_LEAVE_PUNIT
+#define DLB_INSTRUMENT_LEAVE_PUNIT(punit_id)            dlb_instrument_count_leave(punit_id)
+
+#undef DLB_INSTRUMENT_LEAVE_CRITICAL_PUNIT
+#define DLB_INSTRUMENT_LEAVE_CRITICAL_PUNIT(punit_id)   dlb_instrument_count_leave(punit_id)
+
+#undef DLB_INSTRUMENT_ENTER_FRAME
+#define DLB_INSTRUMENT_ENTER_FRAME  dlb_instrument_count_enter_frame()
+
+#undef DLB_INSTRUMENT_LEAVE_FRAME
+#define DLB_INSTRUMENT_LEAVE_FRAME
+
+#undef DLB_INSTRUMENT_SUSPEND
+#define DLB_INSTRUMENT_SUSPEND(punit_id)
+
+#undef DLB_INSTRUMENT_RESUME
+#define DLB_INSTRUMENT_RESUME(punit_id)
+
+#undef DLB_INSTRUMENT_STACK_OPEN
+#define DLB_INSTRUMENT_STACK_OPEN
+
+#undef DLB_INSTRUMENT_STACK_CLOSE
+#define DLB_INSTRUMENT_STACK_CLOSE
+
+#undef DLB_INSTRUMENT_REPORT
+#define DLB_INSTRUMENT_REPORT()     dlb_instrument_count_report()
+
+#undef DLB_INSTRUMENT_ENTER_INIT
+#define DLB_INSTRUMENT_ENTER_INIT(punit)
+
+#undef DLB_INSTRUMENT_PSFRAC
+#define DLB_INSTRUMENT_PSFRAC(p)
+
+#undef DLB_INSTRUMENT_SFRAC
+#define DLB_INSTRUMENT_SFRAC(c)
+
+#undef DLB_INSTRUMENT_TSFRAC
+#define DLB_INSTRUMENT_TSFRAC(t, n)
+
+#undef DLB_INSTRUMENT_T2SFRAC
+#define DLB_INSTRUMENT_T2SFRAC(t, n, m)
+
+#undef DLB_INSTRUMENT_NSFRAC
+#define DLB_INSTRUMENT_NSFRAC(n)
+
+#undef DLB_INSTRUMENT_LEAVE_INIT
+#define DLB_INSTRUMENT_LEAVE_INIT(punit)
+
+/** @} */
+
+#endif
@@ -0,0 +1,251 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2010 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief Counting wrappers of the Dolby Intrinsics
+ *
+ * Included at the end of dlb_intrinsics.h when DLB_INSTRUMENT_COUNT is
+ * defined. Each macro has the name of the intrinsic it wraps, which is not
+ * replaced again inside its own expansion (C90 6.8.3.4), so calls made after
+ * this point count one operation of the given class and then execute the
+ * backend intrinsic. Intrinsics used inside the backend implementations are
+ * not counted.
+ */
+
+#ifndef DLB_INSTRUMENT_COUNT_OPS_H
+#define DLB_INSTRUMENT_COUNT_OPS_H
+
+#if defined DLB_DEBUG_XARGS && !defined DLB_SHOW_XARGS
+#error "DLB_INSTRUMENT_COUNT cannot be combined with DLB_DEBUG_XARGS"
+#endif
+
+#define DLB_SaddSS(a, b)             (DLB_INSTRUMENT_OP(DLB_OP_ADD), DLB_SaddSS(a, b))
+#define DLB_SsubSS(a, b)             (DLB_INSTRUMENT_OP(DLB_OP_ADD), DLB_SsubSS(a, b))
+#define DLB_LaddLL(a, b)             (DLB_INSTRUMENT_OP(DLB_OP_ADD), DLB_LaddLL(a, b))
+#define DLB_LsubLL(a, b)             (DLB_INSTRUMENT_OP(DLB_OP_ADD), DLB_LsubLL(a, b))
+#define DLB_LabsdiffLL(a, b)         (DLB_INSTRUMENT_OP(DLB_OP_ADD), DLB_LabsdiffLL(a, b))
+#define DLB_AaddAA(a, b)             (DLB_INSTRUMENT_OP(DLB_OP_ADD), DLB_AaddAA(a, b))
+#define DLB_AsubAA(a, b)             (DLB_INSTRUMENT_OP(DLB_OP_ADD), DLB_AsubAA(a, b))
+#define DLB_XaddXX(a, b)             (DLB_INSTRUMENT_OP(DLB_OP_ADD), DLB_XaddXX(a, b))
+#define DLB_XsubXX(a, b)             (DLB_INSTRUMENT_OP(DLB_OP_ADD), DLB_XsubXX(a, b))
+#define DLB_SnegS(a)                 (DLB_INSTRUMENT_OP(DLB_OP_ADD), DLB_SnegS(a))
+#define DLB_LnegL(a)                 (DLB_INSTRUMENT_OP(DLB_OP_ADD), DLB_LnegL(a))
+#define DLB_AnegA(a)                 (DLB_INSTRUMENT_OP(DLB_OP_ADD), DLB_AnegA(a))
+#define DLB_XnegX(a)                 (DLB_INSTRUMENT_OP(DLB_OP_ADD), DLB_XnegX(a))
+#define DLB_SabsS(a)                 (DLB_INSTRUMENT_OP(DLB_OP_ADD), DLB_SabsS(a))
+#define DLB_LabsL(a)                 (DLB_INSTRUMENT_OP(DLB_OP_ADD), DLB_LabsL(a))
+#define DLB_AabsA(a)                 (DLB_INSTRUMENT_OP(DLB_OP_ADD), DLB_AabsA(a))
+#define DLB_XabsX(a)                 (DLB_INSTRUMENT_OP(DLB_OP_ADD), DLB_XabsX(a))
+
+#define DLB_SsaddSS(a, b)            (DLB_INSTRUMENT_OP(DLB_OP_SADD), DLB_SsaddSS(a, b))
+#define DLB_SssubSS(a, b)            (DLB_INSTRUMENT_OP(DLB_OP_SADD), DLB_SssubSS(a, b))
+#define DLB_LsaddLL(a, b)            (DLB_INSTRUMENT_OP(DLB_OP_SADD), DLB_LsaddLL(a, b))
+#define DLB_LssubLL(a, b)            (DLB_INSTRUMENT_OP(DLB_OP_SADD), DLB_LssubLL(a, b))
+#define DLB_LsaddLS(a, b)            (DLB_INSTRUMENT_OP(DLB_OP_SADD), DLB_LsaddLS(a, b))
+#define DLB_LssubLS(a, b)            (DLB_INSTRUMENT_OP(DLB_OP_SADD), DLB_LssubLS(a, b))
+#define DLB_SsnegS(a)                (DLB_INSTRUMENT_OP(DLB_OP_SADD), DLB_SsnegS(a))
+#define DLB_LsnegL(a)                (DLB_INSTRUMENT_OP(DLB_OP_SADD), DLB_LsnegL(a))
+#define DLB_SsabsS(a)                (DLB_INSTRUMENT_OP(DLB_OP_SADD), DLB_SsabsS(a))
+#define DLB_LsabsL(a)                (DLB_INSTRUMENT_OP(DLB_OP_SADD), DLB_LsabsL(a))
+
+#define DLB_LmpySS(a, b)             (DLB_INSTRUMENT_OP(DLB_OP_MPY), DLB_LmpySS(a, b))
+#define DLB_LmpyLS(a, b)             (DLB_INSTRUMENT_OP(DLB_OP_MPY), DLB_LmpyLS(a, b))
+#define DLB_LmpyLL(a, b)             (DLB_INSTRUMENT_OP(DLB_OP_MPY), DLB_LmpyLL(a, b))
+#define DLB_LsmpySS(a, b)            (DLB_INSTRUMENT_OP(DLB_OP_MPY), DLB_LsmpySS(a, b))
+#define DLB_LsmpyLS(a, b)            (DLB_INSTRUMENT_OP(DLB_OP_MPY), DLB_LsmpyLS(a, b))
+#define DLB_LsmpyLL(a, b)            (DLB_INSTRUMENT_OP(DLB_OP_MPY), DLB_LsmpyLL(a, b))
+#define DLB_SrmpySS(a, b)            (DLB_INSTRUMENT_OP(DLB_OP_MPY), DLB_SrmpySS(a, b))
+#define DLB_SsrmpySS(a, b)           (DLB_INSTRUMENT_OP(DLB_OP_MPY), DLB_SsrmpySS(a, b))
+#define DLB_AmpySS(a, b)             (DLB_INSTRUMENT_OP(DLB_OP_MPY), DLB_AmpySS(a, b))
+#define DLB_AmpyLS(a, b)             (DLB_INSTRUMENT_OP(DLB_OP_MPY), DLB_AmpyLS(a, b))
+#define DLB_AmpyLL(a, b)             (DLB_INSTRUMENT_OP(DLB_OP_MPY), DLB_AmpyLL(a, b))
+#define DLB_XmpyLS(a, b)             (DLB_INSTRUMENT_OP(DLB_OP_MPY), DLB_XmpyLS(a, b))
+#define DLB_AmpyAS(a, b)             (DLB_INSTRUMENT_OP(DLB_OP_MPY), DLB_AmpyAS(a, b))
+#define DLB_XmpyXS(a, b)             (DLB_INSTRUMENT_OP(DLB_OP_MPY), DLB_XmpyXS(a, b))
+#define DLB_LmpyLI(a, i)             (DLB_INSTRUMENT_OP(DLB_OP_MPY), DLB_LmpyLI(a, i))
+#define DLB_ImpyIL(i, a)             (DLB_INSTRUMENT_OP(DLB_OP_MPY), DLB_ImpyIL(i, a))
+#define DLB_IrmpyIL(i, a)            (DLB_INSTRUMENT_OP(DLB_OP_MPY), DLB_IrmpyIL(i, a))
+#define DLB_UrmpyUL(i, a)            (DLB_INSTRUMENT_OP(DLB_OP_MPY), DLB_UrmpyUL(i, a))
+#define DLB_ImpyIS(i, a)             (DLB_INSTRUMENT_OP(DLB_OP_MPY), DLB_ImpyIS(i, a))
+#define DLB_IrmpyIS(i, a)            (DLB_INSTRUMENT_OP(DLB_OP_MPY), DLB_IrmpyIS(i, a))
+#define DLB_UrmpyUS(i, a)            (DLB_INSTRUMENT_OP(DLB_OP_MPY), DLB_UrmpyUS(i, a))
+
+#define DLB_LsmacLSS(a, x, y)        (DLB_INSTRUMENT_OP(DLB_OP_MAC), DLB_LsmacLSS(a, x, y))
+#define DLB_LsmacLLS(a, x, y)        (DLB_INSTRUMENT_OP(DLB_OP_MAC), DLB_LsmacLLS(a, x, y))
+#define DLB_LsmacLLL(a, x, y)        (DLB_INSTRUMENT_OP(DLB_OP_MAC), DLB_LsmacLLL(a, x, y))
+#define DLB_LmacLSS(a, x, y)         (DLB_INSTRUMENT_OP(DLB_OP_MAC), DLB_LmacLSS(a, x, y))
+#define DLB_LmacLLS(a, x, y)         (DLB_INSTRUMENT_OP(DLB_OP_MAC), DLB_LmacLLS(a, x, y))
+#define DLB_LmacLLL(a, x, y)         (DLB_INSTRUMENT_OP(DLB_OP_MAC), DLB_LmacLLL(a, x, y))
+#define DLB_AmacASS(a, x, y)         (DLB_INSTRUMENT_OP(DLB_OP_MAC), DLB_AmacASS(a, x, y))
+#define DLB_AmacALS(a, x, y)         (DLB_INSTRUMENT_OP(DLB_OP_MAC), DLB_AmacALS(a, x, y))
+#define DLB_AmacALL(a, x, y)         (DLB_INSTRUMENT_OP(DLB_OP_MAC), DLB_AmacALL(a, x, y))
+#define DLB_AmacAAS(a, x, y)         (DLB_INSTRUMENT_OP(DLB_OP_MAC), DLB_AmacAAS(a, x, y))
+#define DLB_XmacXLS(a, x, y)         (DLB_INSTRUMENT_OP(DLB_OP_MAC), DLB_XmacXLS(a, x, y))
+#define DLB_XmacXXS(a, x, y)         (DLB_INSTRUMENT_OP(DLB_OP_MAC), DLB_XmacXXS(a, x, y))
+#define DLB_LsmsuLSS(a, x, y)        (DLB_INSTRUMENT_OP(DLB_OP_MAC), DLB_LsmsuLSS(a, x, y))
+#define DLB_LsmsuLLS(a, x, y)        (DLB_INSTRUMENT_OP(DLB_OP_MAC), DLB_LsmsuLLS(a, x, y))
+#define DLB_LsmsuLLL(a, x, y)        (DLB_INSTRUMENT_OP(DLB_OP_MAC), DLB_LsmsuLLL(a, x, y))
+#define DLB_LmsuLSS(a, x, y)         (DLB_INSTRUMENT_OP(DLB_OP_MAC), DLB_LmsuLSS(a, x, y))
+#define DLB_LmsuLLS(a, x, y)         (DLB_INSTRUMENT_OP(DLB_OP_MAC), DLB_LmsuLLS(a, x, y))
+#define DLB_LmsuLLL(a, x, y)         (DLB_INSTRUMENT_OP(DLB_OP_MAC), DLB_LmsuLLL(a, x, y))
+#define DLB_AmsuASS(a, x, y)         (DLB_INSTRUMENT_OP(DLB_OP_MAC), DLB_AmsuASS(a, x, y))
+#define DLB_AmsuALS(a, x, y)         (DLB_INSTRUMENT_OP(DLB_OP_MAC), DLB_AmsuALS(a, x, y))
+#define DLB_AmsuALL(a, x, y)         (DLB_INSTRUMENT_OP(DLB_OP_MAC), DLB_AmsuALL(a, x, y))
+#define DLB_AmsuAAS(a, x, y)         (DLB_INSTRUMENT_OP(DLB_OP_MAC), DLB_AmsuAAS(a, x, y))
+#define DLB_XmsuXLS(a, x, y)         (DLB_INSTRUMENT_OP(DLB_OP_MAC), DLB_XmsuXLS(a, x, y))
+#define DLB_XmsuXXS(a, x, y)         (DLB_INSTRUMENT_OP(DLB_OP_MAC), DLB_XmsuXXS(a, x, y))
+
+#define DLB_SshlSU(a, i)             (DLB_INSTRUMENT_OP(DLB_OP_SHIFT), DLB_SshlSU(a, i))
+#define DLB_SsshlSU(a, i)            (DLB_INSTRUMENT_OP(DLB_OP_SHIFT), DLB_SsshlSU(a, i))
+#define DLB_SshrSU(a, i)             (DLB_INSTRUMENT_OP(DLB_OP_SHIFT), DLB_SshrSU(a, i))
+#define DLB_SshlSI(a, i)             (DLB_INSTRUMENT_OP(DLB_OP_SHIFT), DLB_SshlSI(a, i))
+#define DLB_SshrSI(a, i)             (DLB_INSTRUMENT_OP(DLB_OP_SHIFT), DLB_SshrSI(a, i))
+#define DLB_SsshlSI(a, i)            (DLB_INSTRUMENT_OP(DLB_OP_SHIFT), DLB_SsshlSI(a, i))
+#define DLB_SsshrSI(a, i)            (DLB_INSTRUMENT_OP(DLB_OP_SHIFT), DLB_SsshrSI(a, i))
+#define DLB_LshlLU(a, i)             (DLB_INSTRUMENT_OP(DLB_OP_SHIFT), DLB_LshlLU(a, i))
+#define DLB_LsshlLU(a, i)            (DLB_INSTRUMENT_OP(DLB_OP_SHIFT), DLB_LsshlLU(a, i))
+#define DLB_LsshlAU(a, i)            (DLB_INSTRUMENT_OP(DLB_OP_SHIFT), DLB_LsshlAU(a, i))
+#define DLB_SshlAU(a, i)             (DLB_INSTRUMENT_OP(DLB_OP_SHIFT), DLB_SshlAU(a, i))
+#define DLB_SsshlAU(a, i)            (DLB_INSTRUMENT_OP(DLB_OP_SHIFT), DLB_SsshlAU(a, i))
+#define DLB_LshrLU(a, i)             (DLB_INSTRUMENT_OP(DLB_OP_SHIFT), DLB_LshrLU(a, i))
+#define DLB_LshlLI(a, i)             (DLB_INSTRUMENT_OP(DLB_OP_SHIFT), DLB_LshlLI(a, i))
+#define DLB_LshrLI(a, i)             (DLB_INSTRUMENT_OP(DLB_OP_SHIFT), DLB_LshrLI(a, i))
+#define DLB_LsshlLI(a, i)            (DLB_INSTRUMENT_OP(DLB_OP_SHIFT), DLB_LsshlLI(a, i))
+#define DLB_LsshrLI(a, i)            (DLB_INSTRUMENT_OP(DLB_OP_SHIFT), DLB_LsshrLI(a, i))
+#define DLB_AshlAU(a, i)             (DLB_INSTRUMENT_OP(DLB_OP_SHIFT), DLB_AshlAU(a, i))
+#define DLB_AshrAU(a, i)             (DLB_INSTRUMENT_OP(DLB_OP_SHIFT), DLB_AshrAU(a, i))
+#define DLB_AshlAI(a, i)             (DLB_INSTRUMENT_OP(DLB_OP_SHIFT), DLB_AshlAI(a, i))
+#define DLB_AshrAI(a, i)             (DLB_INSTRUMENT_OP(DLB_OP_SHIFT), DLB_AshrAI(a, i))
+#define DLB_XshlXU(a, i)             (DLB_INSTRUMENT_OP(DLB_OP_SHIFT), DLB_XshlXU(a, i))
+#define DLB_XshrXU(a, i)             (DLB_INSTRUMENT_OP(DLB_OP_SHIFT), DLB_XshrXU(a, i))
+#define DLB_XshlXI(a, i)             (DLB_INSTRUMENT_OP(DLB_OP_SHIFT), DLB_XshlXI(a, i))
+#define DLB_XshrXI(a, i)             (DLB_INSTRUMENT_OP(DLB_OP_SHIFT), DLB_XshrXI(a, i))
+#define DLB_LshrAU(a, b)             (DLB_INSTRUMENT_OP(DLB_OP_SHIFT), DLB_LshrAU(a, b))
+#define DLB_LshlAU(a, b)             (DLB_INSTRUMENT_OP(DLB_OP_SHIFT), DLB_LshlAU(a, b))
+
+#define DLB_UpnormS(a)               (DLB_INSTRUMENT_OP(DLB_OP_NORM), DLB_UpnormS(a))
+#define DLB_UpnormL(a)               (DLB_INSTRUMENT_OP(DLB_OP_NORM), DLB_UpnormL(a))
+#define DLB_UpnormA(a)               (DLB_INSTRUMENT_OP(DLB_OP_NORM), DLB_UpnormA(a))
+#define DLB_UpnormX(a)               (DLB_INSTRUMENT_OP(DLB_OP_NORM), DLB_UpnormX(a))
+#define DLB_UnormS(a)                (DLB_INSTRUMENT_OP(DLB_OP_NORM), DLB_UnormS(a))
+#define DLB_UnormL(a)                (DLB_INSTRUMENT_OP(DLB_OP_NORM), DLB_UnormL(a))
+#define DLB_UnormA(a)                (DLB_INSTRUMENT_OP(DLB_OP_NORM), DLB_UnormA(a))
+#define DLB_UnormX(a)                (DLB_INSTRUMENT_OP(DLB_OP_NORM), DLB_UnormX(a))
+
+#define DLB_SminSS(a, b)             (DLB_INSTRUMENT_OP(DLB_OP_CMP), DLB_SminSS(a, b))
+#define DLB_SmaxSS(a, b)             (DLB_INSTRUMENT_OP(DLB_OP_CMP), DLB_SmaxSS(a, b))
+#define DLB_LminLL(a, b)             (DLB_INSTRUMENT_OP(DLB_OP_CMP), DLB_LminLL(a, b))
+#define DLB_LmaxLL(a, b)             (DLB_INSTRUMENT_OP(DLB_OP_CMP), DLB_LmaxLL(a, b))
+#define DLB_AminAA(a, b)             (DLB_INSTRUMENT_OP(DLB_OP_CMP), DLB_AminAA(a, b))
+#define DLB_AmaxAA(a, b)             (DLB_INSTRUMENT_OP(DLB_OP_CMP), DLB_AmaxAA(a, b))
+#define DLB_XminXX(a, b)             (DLB_INSTRUMENT_OP(DLB_OP_CMP), DLB_XminXX(a, b))
+#define DLB_XmaxXX(a, b)             (DLB_INSTRUMENT_OP(DLB_OP_CMP), DLB_XmaxXX(a, b))
+#define DLB_IltSS(a, b)              (DLB_INSTRUMENT_OP(DLB_OP_CMP), DLB_IltSS(a, b))
+#define DLB_IleqSS(a, b)             (DLB_INSTRUMENT_OP(DLB_OP_CMP), DLB_IleqSS(a, b))
+#define DLB_IeqSS(a, b)              (DLB_INSTRUMENT_OP(DLB_OP_CMP), DLB_IeqSS(a, b))
+#define DLB_IltLL(a, b)              (DLB_INSTRUMENT_OP(DLB_OP_CMP), DLB_IltLL(a, b))
+#define DLB_IleqLL(a, b)             (DLB_INSTRUMENT_OP(DLB_OP_CMP), DLB_IleqLL(a, b))
+#define DLB_IeqLL(a, b)              (DLB_INSTRUMENT_OP(DLB_OP_CMP), DLB_IeqLL(a, b))
+#define DLB_IltAA(a, b)              (DLB_INSTRUMENT_OP(DLB_OP_CMP), DLB_IltAA(a, b))
+#define DLB_IleqAA(a, b)             (DLB_INSTRUMENT_OP(DLB_OP_CMP), DLB_IleqAA(a, b))
+#define DLB_IeqAA(a, b)              (DLB_INSTRUMENT_OP(DLB_OP_CMP), DLB_IeqAA(a, b))
+#define DLB_IltXX(a, b)              (DLB_INSTRUMENT_OP(DLB_OP_CMP), DLB_IltXX(a, b))
+#define DLB_IleqXX(a, b)             (DLB_INSTRUMENT_OP(DLB_OP_CMP), DLB_IleqXX(a, b))
+#define DLB_IeqXX(a, b)              (DLB_INSTRUMENT_OP(DLB_OP_CMP), DLB_IeqXX(a, b))
+#define DLB_IlimsI(i)                (DLB_INSTRUMENT_OP(DLB_OP_CMP), DLB_IlimsI(i))
+#define DLB_IlimlI(i)                (DLB_INSTRUMENT_OP(DLB_OP_CMP), DLB_IlimlI(i))
+#define DLB_IlimaI(i)                (DLB_INSTRUMENT_OP(DLB_OP_CMP), DLB_IlimaI(i))
+#define DLB_IlimxI(i)                (DLB_INSTRUMENT_OP(DLB_OP_CMP), DLB_IlimxI(i))
+#define DLB_LclipALL(a, lo, hi)      (DLB_INSTRUMENT_OP(DLB_OP_CMP), DLB_LclipALL(a, lo, hi))
+#define DLB_SclipSSS(a, lo, hi)      (DLB_INSTRUMENT_OP(DLB_OP_CMP), DLB_SclipSSS(a, lo, hi))
+#define DLB_LclipLLL(a, lo, hi)      (DLB_INSTRUMENT_OP(DLB_OP_CMP), DLB_LclipLLL(a, lo, hi))
+#define DLB_AclipAAA(a, lo, hi)      (DLB_INSTRUMENT_OP(DLB_OP_CMP), DLB_AclipAAA(a, lo, hi))
+
+#define DLB_LsrndLU(a, i)            (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_LsrndLU(a, i))
+#define DLB_LtruncLU(a, i)           (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_LtruncLU(a, i))
+#define DLB_LrnddLU(a, i)            (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_LrnddLU(a, i))
+#define DLB_LrnddXU(a, i)            (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_LrnddXU(a, i))
+#define DLB_16srndS(s)               (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_16srndS(s))
+#define DLB_16sfloorS(s)             (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_16sfloorS(s))
+#define DLB_16srndL(l)               (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_16srndL(l))
+#define DLB_16sfloorL(l)             (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_16sfloorL(l))
+#define DLB_32srndS(s)               (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_32srndS(s))
+#define DLB_32sfloorS(s)             (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_32sfloorS(s))
+#define DLB_32srndL(l)               (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_32srndL(l))
+#define DLB_32sfloorL(l)             (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_32sfloorL(l))
+#define DLB_X_S(a)                   (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_X_S(a))
+#define DLB_A_S(a)                   (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_A_S(a))
+#define DLB_L_S(a)                   (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_L_S(a))
+#define DLB_X_L(a)                   (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_X_L(a))
+#define DLB_A_L(a)                   (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_A_L(a))
+#define DLB_X_A(a)                   (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_X_A(a))
+#define DLB_StruncL(a)               (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_StruncL(a))
+#define DLB_SsatL(a)                 (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_SsatL(a))
+#define DLB_SrndL(a)                 (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_SrndL(a))
+#define DLB_SsrndL(a)                (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_SsrndL(a))
+#define DLB_SrnddL(a)                (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_SrnddL(a))
+#define DLB_StruncA(a)               (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_StruncA(a))
+#define DLB_SsatA(a)                 (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_SsatA(a))
+#define DLB_SrndA(a)                 (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_SrndA(a))
+#define DLB_SsrndA(a)                (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_SsrndA(a))
+#define DLB_SrnddA(a)                (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_SrnddA(a))
+#define DLB_StruncX(a)               (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_StruncX(a))
+#define DLB_SsatX(a)                 (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_SsatX(a))
+#define DLB_SrndX(a)                 (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_SrndX(a))
+#define DLB_SsrndX(a)                (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_SsrndX(a))
+#define DLB_SrnddX(a)                (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_SrnddX(a))
+#define DLB_LtruncA(a)               (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_LtruncA(a))
+#define DLB_LsatA(a)                 (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_LsatA(a))
+#define DLB_LrndA(a)                 (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_LrndA(a))
+#define DLB_LsrndA(a)                (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_LsrndA(a))
+#define DLB_LrnddA(a)                (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_LrnddA(a))
+#define DLB_LtruncX(a)               (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_LtruncX(a))
+#define DLB_LsatX(a)                 (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_LsatX(a))
+#define DLB_LrndX(a)                 (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_LrndX(a))
+#define DLB_LsrndX(a)                (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_LsrndX(a))
+#define DLB_AtruncX(a)               (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_AtruncX(a))
+#define DLB_ArndX(a)                 (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_ArndX(a))
+#define DLB_ArnddX(a)                (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_ArnddX(a))
+#define DLB_I_S(a)                   (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_I_S(a))
+#define DLB_I_L(a)                   (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_I_L(a))
+#define DLB_IsrndS(a)                (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_IsrndS(a))
+#define DLB_S_I(i)                   (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_S_I(i))
+#define DLB_IsrndL(l)                (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_IsrndL(l))
+#define DLB_L_I(i)                   (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_L_I(i))
+#define DLB_IsrndLU(l, s)            (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_IsrndLU(l, s))
+#define DLB_IintLU(x, fp)            (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_IintLU(x, fp))
+#define DLB_LmantLU(x, fp)           (DLB_INSTRUMENT_OP(DLB_OP_RND), DLB_LmantLU(x, fp))
+
+#endif
@@ -0,0 +1,338 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2010 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief Timing profiler instrumentation backend
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "dlb_instrument_profiler.h"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define PROFILER_TSC
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define PROFILER_TSC
+#endif
+
+#ifdef _WIN32
+#include <windows.h>
+static SRWLOCK profiler_lock = SRWLOCK_INIT;
+#define PROFILER_LOCK()     AcquireSRWLockExclusive(&profiler_lock)
+#define PROFILER_UNLOCK()   ReleaseSRWLockExclusive(&profiler_lock)
+#define PROFILER_TLS        __declspec(thread)
+#else
+#include <pthread.h>
+static pthread_mutex_t profiler_lock = PTHREAD_MUTEX_INITIALIZER;
+#define PROFILER_LOCK()     pthread_mutex_lock(&profiler_lock)
+#define PROFILER_UNLOCK()   pthread_mutex_unlock(&profiler_lock)
+#define PROFILER_TLS        __thread
+#endif
+
+typedef struct
+{
+    int         unit;           /* -1 when the unit table was full */
+    uint64_t    start;
+    uint64_t    nested;         /* time of the units entered from this one */
+} profiler_frame;
+
+/* Accumulators of one thread */
+typedef struct profiler_thread_s
+{
+    struct profiler_thread_s       *next;
+    uint64_t                        frames;
+    int                             depth;
+    unsigned int                    num_units;
+    dlb_instrument_profiler_unit    units[DLB_INSTRUMENT_PROFILER_MAX_UNITS];
+    profiler_frame                  stack[DLB_INSTRUMENT_PROFILER_MAX_DEPTH];
+} profiler_thread;
+
+static profiler_thread                 *thread_list;
+static unsigned int                     list_generation = 1;    /* bumped by close, invalidates the thread pointers */
+static dlb_instrument_profiler_report_t merged_report;
+
+static PROFILER_TLS profiler_thread    *this_thread;
+static PROFILER_TLS unsigned int        this_generation;
+
+static inline
+uint64_t
+profiler_clock
+    (void)
+{
+#ifdef PROFILER_TSC
+    return __rdtsc();
+#elif defined(_WIN32)
+    LARGE_INTEGER counter, frequency;
+
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return (uint64_t)((double)counter.QuadPart * 1e9 / (double)frequency.QuadPart);
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+static
+profiler_thread *
+get_thread
+    (void)
+{
+    profiler_thread *t = this_thread;
+
+    if (t && this_generation == list_generation)
+    {
+        return t;
+    }
+    t = (profiler_thread *)calloc(1, sizeof(profiler_thread));
+    if (t)
+    {
+        PROFILER_LOCK();
+        t->next = thread_list;
+        thread_list = t;
+        this_generation = list_generation;
+        PROFILER_UNLOCK();
+    }
+    this_thread = t;
+    return t;
+}
+
+static
+int
+find_unit
+    (profiler_thread    *t
+    ,const char         *punit
+    )
+{
+    unsigned int i;
+
+    for (i = 0; i < t->num_units; i++)
+    {
+        if (t->units[i].name == punit || !strcmp(t->units[i].name, punit))
+        {
+            return (int)i;
+        }
+    }
+    if (t->num_units == DLB_INSTRUMENT_PROFILER_MAX_UNITS)
+    {
+        return -1;
+    }
+    t->units[t->num_units].name = punit;
+    t->units[t->num_units].depth = t->depth;
+    return (int)t->num_units++;
+}
+
+void
+dlb_instrument_profiler_open
+    (void)
+{
+    profiler_thread *t;
+
+    PROFILER_LOCK();
+    for (t = thread_list; t; t = t->next)
+    {
+        t->frames = 0;
+        t->num_units = 0;
+        t->depth = 0;
+    }
+    PROFILER_UNLOCK();
+}
+
+void
+dlb_instrument_profiler_close
+    (void)
+{
+    profiler_thread *t;
+
+    PROFILER_LOCK();
+    while (thread_list)
+    {
+        t = thread_list;
+        thread_list = t->next;
+        free(t);
+    }
+    list_generation++;
+    PROFILER_UNLOCK();
+}
+
+void
+dlb_instrument_profiler_enter
+    (const char *punit
+    )
+{
+    profiler_thread *t = get_thread();
+
+    if (!t)
+    {
+        return;
+    }
+    if (t->depth < DLB_INSTRUMENT_PROFILER_MAX_DEPTH)
+    {
+        profiler_frame *f = &t->stack[t->depth];
+
+        f->unit = find_unit(t, punit);
+        f->nested = 0;
+        f->start = profiler_clock();
+    }
+    t->depth++;
+}
+
+void
+dlb_instrument_profiler_leave
+    (const char *punit
+    )
+{
+    uint64_t         now = profiler_clock();
+    profiler_thread *t = this_thread;
+
+    (void)punit;    /* units are left in the reverse order of entry */
+    if (!t || this_generation != list_generation || t->depth == 0)
+    {
+        return;
+    }
+    t->depth--;
+    if (t->depth < DLB_INSTRUMENT_PROFILER_MAX_DEPTH)
+    {
+        profiler_frame *f = &t->stack[t->depth];
+        uint64_t        elapsed = now - f->start;
+
+        if (f->unit >= 0)
+        {
+            dlb_instrument_profiler_unit *u = &t->units[f->unit];
+
+            u->calls++;
+            u->total += elapsed;
+            u->self += elapsed - f->nested;
+        }
+        if (t->depth > 0)
+        {
+            t->stack[t->depth - 1].nested += elapsed;
+        }
+    }
+}
+
+void
+dlb_instrument_profiler_enter_frame
+    (void)
+{
+    profiler_thread *t = get_thread();
+
+    if (t)
+    {
+        t->frames++;
+    }
+}
+
+const dlb_instrument_profiler_report_t *
+dlb_instrument_profiler_report
+    (void)
+{
+    profiler_thread *t;
+    unsigned int     i, j;
+
+    PROFILER_LOCK();
+    memset(&merged_report, 0, sizeof(merged_report));
+#ifdef PROFILER_TSC
+    merged_report.clock_name = "cycles";
+#else
+    merged_report.clock_name = "ns";
+#endif
+    for (t = thread_list; t; t = t->next)
+    {
+        merged_report.frames += t->frames;
+        for (i = 0; i < t->num_units; i++)
+        {
+            const dlb_instrument_profiler_unit *u = &t->units[i];
+
+            for (j = 0; j < merged_report.num_units; j++)
+            {
+                if (!strcmp(merged_report.units[j].name, u->name))
+                {
+                    break;
+                }
+            }
+            if (j == merged_report.num_units)
+            {
+                if (j == DLB_INSTRUMENT_PROFILER_MAX_UNITS)
+                {
+                    continue;
+                }
+                merged_report.units[j].name = u->name;
+                merged_report.units[j].depth = u->depth;
+                merged_report.num_units++;
+            }
+            merged_report.units[j].calls += u->calls;
+            merged_report.units[j].total += u->total;
+            merged_report.units[j].self += u->self;
+        }
+    }
+    PROFILER_UNLOCK();
+    return &merged_report;
+}
+
+void
+dlb_instrument_profiler_print
+    (FILE                                   *fp
+    ,const dlb_instrument_profiler_report_t *report
+    ,uint64_t                                sample_frames
+    )
+{
+    unsigned int i;
+    uint64_t     all_self = 0;
+    double       frames = sample_frames ? (double)sample_frames : 1.0;
+
+    for (i = 0; i < report->num_units; i++)
+    {
+        all_self += report->units[i].self;
+    }
+    fprintf(fp, "%-32s %12s %16s %12s %12s %7s\n", "unit", "calls", report->clock_name,
+            "total/sample", "self/sample", "self %");
+    for (i = 0; i < report->num_units; i++)
+    {
+        const dlb_instrument_profiler_unit *u = &report->units[i];
+        int                                 indent = (u->depth < 8) ? 2 * u->depth : 16;
+
+        fprintf(fp, "%*s%-*s %12llu %16llu %12.2f %12.2f %6.1f%%\n", indent, "", 32 - indent, u->name,
+                (unsigned long long)u->calls, (unsigned long long)u->total,
+                (double)u->total / frames, (double)u->self / frames,
+                all_self ? 100.0 * (double)u->self / (double)all_self : 0.0);
+    }
+}
@@ -0,0 +1,187 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2010 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief Timing profiler instrumentation backend
+ */
+
+#ifndef DLB_INSTRUMENT_PROFILER_H
+#define DLB_INSTRUMENT_PROFILER_H
+
+#include <stdio.h>
+#include <stdint.h>
+
+/**
+ * @addtogroup dlb_instrument_profiler
+ *
+ * @brief Measures the time spent in each profiling unit.
+ *
+ * Selected with DLB_INSTRUMENT_PROFILER. Every DLB_INSTRUMENT_ENTER_PUNIT /
+ * DLB_INSTRUMENT_LEAVE_PUNIT pair reads the time stamp counter (x86) or the
+ * monotonic clock in nanoseconds (elsewhere). Units may nest; each unit keeps
+ * its total time and its self time without the units nested in it.
+ * Accumulators are thread-local, so instrumented code running on several
+ * threads is not serialised; DLB_INSTRUMENT_REPORT() merges the units of all
+ * threads by name.
+ *
+ * Units are identified by their name, normally a string literal. The
+ * accumulators must not be reset or closed while other threads are inside
+ * a unit.
+ *
+ * Typical reporting code:
+ * @code
+ * DLB_INSTRUMENT_OPEN();
+ * ... process num_frames sample frames ...
+ * dlb_instrument_profiler_print(stderr, DLB_INSTRUMENT_REPORT(), num_frames);
+ * DLB_INSTRUMENT_CLOSE();
+ * @endcode
+ *
+ * @{
+ */
+
+#define DLB_INSTRUMENT_PROFILER_MAX_UNITS   64      /**< distinct unit names */
+#define DLB_INSTRUMENT_PROFILER_MAX_DEPTH   32      /**< deepest nesting that is measured */
+
+/** Accumulated time of one profiling unit */
+typedef struct
+{
+    const char *name;
+    int         depth;          /**< nesting depth when first entered */
+    uint64_t    calls;
+    uint64_t    total;          /**< clock ticks including nested units */
+    uint64_t    self;           /**< clock ticks without nested units */
+} dlb_instrument_profiler_unit;
+
+/** Units of all threads, in order of first entry */
+typedef struct
+{
+    const char                     *clock_name;     /**< "cycles" or "ns" */
+    uint64_t                        frames;         /**< DLB_INSTRUMENT_ENTER_FRAME count */
+    unsigned int                    num_units;
+    dlb_instrument_profiler_unit    units[DLB_INSTRUMENT_PROFILER_MAX_UNITS];
+} dlb_instrument_profiler_report_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Discard all accumulated times */
+void dlb_instrument_profiler_open(void);
+
+/** Discard all accumulated times and free the per-thread accumulators */
+void dlb_instrument_profiler_close(void);
+
+void dlb_instrument_profiler_enter(const char *punit);
+
+void dlb_instrument_profiler_leave(const char *punit);
+
+void dlb_instrument_profiler_enter_frame(void);
+
+/** Merge the accumulators of all threads, valid until the next call */
+const dlb_instrument_profiler_report_t *dlb_instrument_profiler_report(void);
+
+/** Print a report as a table of calls, time and time per sample frame */
+void dlb_instrument_profiler_print(FILE *fp, const dlb_instrument_profiler_report_t *report, uint64_t sample_frames);
+
+#ifdef __cplusplus
+}
+#endif
+
+#undef DLB_INSTRUMENT_OPEN
+#define DLB_INSTRUMENT_OPEN()       dlb_instrument_profiler_open()
+
+#undef DLB_INSTRUMENT_CLOSE
+#define DLB_INSTRUMENT_CLOSE()      dlb_instrument_profiler_close()
+
+#undef DLB_INSTRUMENT_OP
+#define DLB_INSTRUMENT_OP(op)
+
+#undef DLB_INSTRUMENT_ENTER_PUNIT
+#define DLB_INSTRUMENT_ENTER_PUNIT(punit_id)            dlb_instrument_profiler_enter(punit_id)
+
+#undef DLB_INSTRUMENT_ENTER_CRITICAL_PUNIT
+#define DLB_INSTRUMENT_ENTER_CRITICAL_PUNIT(punit_id)   dlb_instrument_profiler_enter(punit_id)
+
+#undef DLB_INSTRUMENT_LEAVE_PUNIT
+#define DLB_INSTRUMENT_LEAVE_PUNIT(punit_id)            dlb_instrument_profiler_leave(punit_id)
+
+#undef DLB_INSTRUMENT_LEAVE_CRITICAL_PUNIT
+#define DLB_INSTRUMENT_LEAVE_CRITICAL_PUNIT(punit_id)   dlb_instrument_profiler_leave(punit_id)
+
+#undef DLB_INSTRUMENT_ENTER_FRAME
+#define DLB_INSTRUMENT_ENTER_FRAME  dlb_instrument_profiler_enter_frame()
+
+#undef DLB_INSTRUMENT_LEAVE_FRAME
+#define DLB_INSTRUMENT_LEAVE_FRAME
+
+#undef DLB_INSTRUMENT_SUSPEND
+#define DLB_INSTRUMENT_SUSPEND(punit_id)
+
+#undef DLB_INSTRUMENT_RESUME
+#define DLB_INSTRUMENT_RESUME(punit_id)
+
+#undef DLB_INSTRUMENT_STACK_OPEN
+#define DLB_INSTRUMENT_STACK_OPEN
+
+#undef DLB_INSTRUMENT_STACK_CLOSE
+#define DLB_INSTRUMENT_STACK_CLOSE
+
+#undef DLB_INSTRUMENT_REPORT
+#define DLB_INSTRUMENT_REPORT()     dlb_instrument_profiler_report()
+
+#undef DLB_INSTRUMENT_ENTER_INIT
+#define DLB_INSTRUMENT_ENTER_INIT(punit)
+
+#undef DLB_INSTRUMENT_PSFRAC
+#define DLB_INSTRUMENT_PSFRAC(p)
+
+#undef DLB_INSTRUMENT_SFRAC
+#define DLB_INSTRUMENT_SFRAC(c)
+
+#undef DLB_INSTRUMENT_TSFRAC
+#define DLB_INSTRUMENT_TSFRAC(t, n)
+
+#undef DLB_INSTRUMENT_T2SFRAC
+#define DLB_INSTRUMENT_T2SFRAC(t, n, m)
+
+#undef DLB_INSTRUMENT_NSFRAC
+#define DLB_INSTRUMENT_NSFRAC(n)
+
+#undef DLB_INSTRUMENT_LEAVE_INIT
+#define DLB_INSTRUMENT_LEAVE_INIT(punit)
+
+/** @} */
+
+#endif
@@ -57,6 +57,18 @@
 
 #define DLB_MD_EMUL_MAX_CHAN_MODE    5
 
+#define DLB_MD_EMUL_STATE_VERSION    1   /**< @brief <layout version of saved emulator states.> */
+
+#define DLB_MD_EMUL_ERR_CAPACITY     (-6) /**< @brief <the configuration needs more memory than the emulator was opened with.> */
+
+#define DLB_MD_EMUL_TAP_METER        1u  /**< @brief <storage for dlb_md_emul_set_meter.> */
+#define DLB_MD_EMUL_TAP_TRACE        2u  /**< @brief <storage for dlb_md_emul_set_trace.> */
+
+#define DLB_MD_EMUL_DMX_TYPES        5   /**< @brief <downmixes checked for clipping: LoRo custom, LtRt default, LtRt custom, PLII default, ITU.> */
+
+#define DLB_MD_EMUL_STATS_GR_BINS    8   /**< @brief <bins of the gain reduction histogram.> */
+#define DLB_MD_EMUL_STATS_GR_EDGES_DB {1.0, 2.0, 4.0, 6.0, 10.0, 15.0, 20.0} /**< @brief <upper bin edges in dB, the last bin is open.> */
+
 /**
  * @brief Version definition structure for component dlb_md_emul.
  *
@@ -80,9 +92,55 @@ typedef struct dlb_md_emul_size_s
   uint32_t    compr_static_mem_size;
   uint32_t    compr_ext_static_mem_size;
 
+  /* What the sizes hold, set by the query call for the open call. Sizes
+     with num_blocks 0 are taken to hold every configuration. */
+  int32_t     channel_mode;         /**< channel mode of the compressor memory (library internal value) */
+  uint32_t    num_blocks;           /**< blocks per process call of the compressor memory */
+  uint32_t    num_chans;            /**< buffer channels with encoder filter histories */
+  uint32_t    filters;              /**< encoder filters with histories (library internal bits) */
+  uint32_t    num_outputs;          /**< outputs per process call */
+  uint32_t    taps;                 /**< DLB_MD_EMUL_TAP_* with storage */
+
 } dlb_md_emul_size_t;
 
 
+/**
+ * Cost of each processing stage in cycles of one core. The library holds a
+ * model of the host it was calibrated on; bench/src/complexity_calibrate.cpp
+ * fits one for the current host.
+ */
+typedef struct dlb_md_emul_complexity_model_s
+{
+    double      hpf;                                /**< DC blocking filter, per channel sample */
+    double      bwlpf;                              /**< bandwidth limiting filter, per channel sample */
+    double      lfelpf;                             /**< LFE lowpass filter, per LFE sample */
+    double      psf_main;                           /**< 90 degree phase shift of a front channel, per channel sample */
+    double      psf_surr;                           /**< 90 degree phase shift of a surround channel, per channel sample */
+    double      suratt;                             /**< surround attenuation, per surround sample */
+    double      loudness;                           /**< compressor loudness and peak, per channel sample */
+    double      downmix[DLB_MD_EMUL_DMX_TYPES];     /**< worst case downmix peak, per channel sample and type */
+    double      gain_calc;                          /**< DRC and compr gain computers, per block */
+    double      gain_apply;                         /**< DRC and dialnorm gain, per channel sample of an output */
+    double      aux_copy;                           /**< copy to the second output, per channel sample */
+    double      call;                               /**< fixed cost of a process call */
+} dlb_md_emul_complexity_model_t;
+
+/**
+ * Estimated cost of a configuration by stage, in cycles per sample frame
+ * (one sample of every channel). A feed needs total * sample_rate cycles
+ * per second.
+ */
+typedef struct dlb_md_emul_complexity_s
+{
+    double      encoder_filters[DLB_MD_EMUL_MAX_CHANS]; /**< encoder emulation of each input channel slot */
+    double      loudness;                           /**< compressor loudness */
+    double      downmix[DLB_MD_EMUL_DMX_TYPES];     /**< compressor downmix peak of each type */
+    double      gain_calc;                          /**< DRC and compr gain computers */
+    double      gain_apply[DLB_MD_EMUL_MAX_OUTPUTS];/**< gain application of each output, the second one with its copy */
+    double      call;                               /**< fixed cost of the process call spread over its samples */
+    double      total;
+} dlb_md_emul_complexity_t;
+
 typedef struct dlb_md_emul_handler_s
 {
   void*     p_emul_hdl;      /**< metadata emulator handler pointer           */
@@ -177,6 +235,44 @@ typedef struct dlb_md_emul_process_config_s
    
 }dlb_md_emul_process_config_t;
 
+typedef enum
+{
+    DLB_MD_EMUL_STAGE_ENCODER   = 0  /* Channel clearing and encoder emulation filters */
+   ,DLB_MD_EMUL_STAGE_DRC_CALC  = 1  /* DRC and compr gain calculation */
+   ,DLB_MD_EMUL_STAGE_DRC_APPLY = 2  /* Copy to the second output and gain application */
+   ,DLB_MD_EMUL_NUM_STAGES      = 3
+} DLB_MD_EMUL_STAGE;
+
+/**
+ * @brief Runtime statistics of an emulator.
+ *
+ * Accumulated from dlb_md_emul_open or the last dlb_md_emul_get_stats call
+ * that reset them. Clip protection gains are those after each update, in dB;
+ * the minimum and mean are 0 while there were no updates.
+ */
+typedef struct dlb_md_emul_stats_s
+{
+    uint64_t    blocks_processed;       /**< Blocks of DLB_MD_EMUL_BLOCK_SIZE samples processed */
+    uint32_t    compr_reopens;          /**< Compressor re-opens on a change of channel mode, LFE, rate or block count */
+
+    uint64_t    dlim_updates;           /**< DRC clip protection updates, one per block with DRC calculation */
+    uint64_t    dlim_attacks;           /**< Updates that lowered dlim_gain and restarted its hold */
+    uint64_t    dlim_holds;             /**< Updates that held dlim_gain */
+    double      dlim_gain_min_db;       /**< Lowest dlim_gain */
+    double      dlim_gain_mean_db;      /**< Mean dlim_gain */
+
+    uint64_t    clim_updates;           /**< compr clip protection updates, one per call with DRC calculation */
+    uint64_t    clim_attacks;           /**< Updates that lowered clim_gain and restarted its hold */
+    uint64_t    clim_holds;             /**< Updates that held clim_gain */
+    double      clim_gain_min_db;       /**< Lowest clim_gain */
+    double      clim_gain_mean_db;      /**< Mean clim_gain */
+
+    /** Decoded blocks per output by DRC gain reduction (dialnorm excluded), bins DLB_MD_EMUL_STATS_GR_EDGES_DB */
+    uint64_t    gain_reduction_hist[DLB_MD_EMUL_MAX_OUTPUTS][DLB_MD_EMUL_STATS_GR_BINS];
+
+    uint64_t    stage_time_ns[DLB_MD_EMUL_NUM_STAGES];  /**< Wall clock time per DLB_MD_EMUL_STAGE */
+} dlb_md_emul_stats_t;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -196,6 +292,25 @@ uint32_t
 dlb_md_emul_query_latency( dlb_md_emul_process_config_t  *p_md_emul_conf);
 
 
+/*
+ * Estimate the cost of dlb_md_emul_process() calls with p_md_emul_conf and
+ * num_outputs. p_model NULL uses the model built into the library.
+ */
+int32_t
+dlb_md_emul_query_complexity
+    (
+     const dlb_md_emul_process_config_t    *p_md_emul_conf    /**< [in] configuration of the process calls */
+    ,int                                    num_outputs       /**< [in] outputs as passed to dlb_md_emul_process */
+    ,const dlb_md_emul_complexity_model_t  *p_model           /**< [in] cycles per stage, NULL for the built-in model */
+    ,dlb_md_emul_complexity_t              *p_complexity      /**< [out] cycles per sample frame by stage */
+    );
+
+/*
+ * The complexity model built into the library
+ */
+const dlb_md_emul_complexity_model_t *
+dlb_md_emul_get_complexity_model(void);
+
 /*
  * Query the memory size required by the open call
  */
@@ -205,6 +320,24 @@ dlb_md_emul_query_mem
      dlb_md_emul_size_t *p_md_emul_size        /**< [in/out] required 'dynamic' memory size */
     );
 
+/*
+ * Query the memory of an emulator that holds p_md_emul_conf with num_outputs
+ * and configurations that need no more: no more compressor channels or
+ * blocks per call, no channel mapped to a later buffer channel, no other
+ * encoder filters and no more outputs. dlb_md_emul_process and
+ * dlb_md_emul_load_state return DLB_MD_EMUL_ERR_CAPACITY for anything
+ * larger and leave the emulator as it was. Only the taps in taps can be
+ * set on the emulator, the others return DLB_MD_EMUL_ERR_CAPACITY.
+ */
+int32_t
+dlb_md_emul_query_mem_config
+    (
+     const dlb_md_emul_process_config_t *p_md_emul_conf    /**< [in] configuration of the process calls */
+    ,int                                 num_outputs       /**< [in] outputs as passed to dlb_md_emul_process */
+    ,uint32_t                            taps              /**< [in] DLB_MD_EMUL_TAP_* the emulator is set with */
+    ,dlb_md_emul_size_t                 *p_md_emul_size    /**< [out] required memory sizes */
+    );
+
 /*
  * Open emulator
  */
@@ -226,6 +359,16 @@ dlb_md_emul_close
      dlb_md_emul_hdl_t    *p_dlb_md_emul_hdl   /**< [in/out] pointer to metadata emulation handler */
     );
 
+/*
+ * Return an open emulator to the state it had right after dlb_md_emul_open,
+ * reusing its memory. Use it to start on a new, unrelated signal.
+ */
+int32_t
+dlb_md_emul_reset
+    (
+     dlb_md_emul_hdl_t    *p_dlb_md_emul_hdl   /**< [in/out] pointer to metadata emulation handler */
+    );
+
 /*
  * Perform the metadata encode emulation
  */
@@ -237,6 +380,51 @@ dlb_md_emul_process
     ,int                              /**< [in] number of outputs for independent DRC & dialnorm application */
     );
 
+/*
+ * Query the size of a saved emulator state in bytes
+ */
+uint32_t
+dlb_md_emul_query_state_size(void);
+
+/*
+ * Save the complete processing state (filter histories, gain windows and
+ * compressor state) of an open emulator. The state is only valid for a
+ * library built with the same backend and DLB_MD_EMUL_STATE_VERSION.
+ */
+int32_t
+dlb_md_emul_save_state
+    (
+     dlb_md_emul_hdl_t    *p_dlb_md_emul_hdl   /**< [in] pointer to metadata emulation handler */
+    ,void                 *p_state             /**< [out] buffer of dlb_md_emul_query_state_size() bytes */
+    ,uint32_t              state_size          /**< [in] size of p_state in bytes */
+    );
+
+/*
+ * Restore a state saved with dlb_md_emul_save_state. Processing then
+ * continues exactly as it would have after the save.
+ */
+int32_t
+dlb_md_emul_load_state
+    (
+     dlb_md_emul_hdl_t    *p_dlb_md_emul_hdl   /**< [in/out] pointer to metadata emulation handler */
+    ,const void           *p_state             /**< [in] state written by dlb_md_emul_save_state */
+    ,uint32_t              state_size          /**< [in] size of p_state in bytes */
+    );
+
+/*
+ * Copy the runtime statistics of an open emulator, and start them over
+ * if reset is non-zero so that a monitor can poll them per interval.
+ * dlb_md_emul_reset does not clear them. Returns non-zero for a library
+ * built without statistics (MD_EMUL_NO_STATS), p_stats is zeroed then.
+ */
+int32_t
+dlb_md_emul_get_stats
+    (
+     dlb_md_emul_hdl_t    *p_dlb_md_emul_hdl   /**< [in/out] pointer to metadata emulation handler */
+    ,dlb_md_emul_stats_t  *p_stats             /**< [out] statistics */
+    ,int                   reset               /**< [in] non-zero to clear the statistics after the copy */
+    );
+
 #ifdef __cplusplus
 }
 #endif
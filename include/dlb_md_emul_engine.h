@@ -0,0 +1,194 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ *
+ * @defgroup - Metadata emulation multi-stream engine public definition
+ * @{
+ * Runs many independent emulator instances on a fixed pool of worker
+ * threads. Blocks submitted to one stream are always processed in
+ * submission order and by one worker at a time; idle workers steal
+ * ready streams from busy ones.
+ * @}
+ */
+
+#ifndef DLB_MD_EMUL_ENGINE_H
+#define DLB_MD_EMUL_ENGINE_H
+
+#include<stddef.h>
+#include<dlb_md_emul_api.h>
+
+#define DLB_MD_EMUL_ENGINE_MAX_WORKERS     64
+#define DLB_MD_EMUL_ENGINE_HIST_BUCKETS    24   /**< log2(us) latency buckets, last one is open ended */
+
+typedef enum
+{
+    DLB_MD_EMUL_ENGINE_OK              =  0
+   ,DLB_MD_EMUL_ENGINE_INVALID_HANDLE  = -1
+   ,DLB_MD_EMUL_ENGINE_MEM_ALLOC_ERR   = -2
+   ,DLB_MD_EMUL_ENGINE_INVALID_PARAM   = -3
+   ,DLB_MD_EMUL_ENGINE_QUEUE_FULL      = -6   /**< stream queue has no free slot, retry later */
+   ,DLB_MD_EMUL_ENGINE_NO_FREE_STREAM  = -7
+   ,DLB_MD_EMUL_ENGINE_THREAD_ERR      = -8
+} DLB_MD_EMUL_ENGINE_STATUS;
+
+typedef struct dlb_md_emul_engine_s dlb_md_emul_engine_t;
+
+/**
+ * Called from a worker thread once a block has been processed. The buffers
+ * referenced by p_config->pa_in_data may be reused by the caller from here on.
+ */
+typedef void (*dlb_md_emul_block_done_fn)
+    (void                               *p_user        /**< [in] user pointer given at stream creation */
+    ,uint32_t                            stream_id     /**< [in] stream the block belongs to */
+    ,uint64_t                            block_index   /**< [in] 0-based submission index within the stream */
+    ,const dlb_md_emul_process_config_t *p_config      /**< [in] configuration the block was processed with */
+    ,int32_t                             status        /**< [in] return value of dlb_md_emul_process */
+    );
+
+typedef struct dlb_md_emul_engine_config_s
+{
+    uint32_t    num_workers;       /**< worker threads, 1..DLB_MD_EMUL_ENGINE_MAX_WORKERS */
+    uint32_t    max_streams;       /**< number of stream slots reserved in engine memory */
+    uint32_t    queue_depth;       /**< blocks that can be in flight per stream */
+    uint32_t    pin_workers;       /**< pin worker n to cpu first_cpu + n (Linux only) */
+    uint32_t    first_cpu;
+} dlb_md_emul_engine_config_t;
+
+typedef struct dlb_md_emul_stream_config_s
+{
+    int                         num_outputs;   /**< passed on to dlb_md_emul_process */
+    uint32_t                    deadline_us;   /**< submit to completion budget, 0 disables deadline accounting */
+    dlb_md_emul_block_done_fn   done_cb;       /**< may be NULL */
+    void                       *p_user;
+} dlb_md_emul_stream_config_t;
+
+typedef struct dlb_md_emul_stream_stats_s
+{
+    uint64_t    blocks_submitted;
+    uint64_t    blocks_processed;
+    uint64_t    blocks_failed;             /**< dlb_md_emul_process returned an error */
+    uint64_t    deadline_misses;
+    uint64_t    max_latency_us;
+    uint64_t    total_latency_us;
+    uint64_t    latency_hist[DLB_MD_EMUL_ENGINE_HIST_BUCKETS]; /**< bucket n counts latencies in [2^(n-1), 2^n) us, bucket 0 is < 1us */
+} dlb_md_emul_stream_stats_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Query the memory size required by dlb_md_emul_engine_open, including
+ * emulator memory for every stream slot
+ */
+int32_t
+dlb_md_emul_engine_query_mem
+    (const dlb_md_emul_engine_config_t *p_config   /**< [in] engine configuration */
+    ,size_t                            *p_mem_size /**< [out] required memory size in bytes */
+    );
+
+/*
+ * Open the engine inside externally allocated memory and start the workers
+ */
+int32_t
+dlb_md_emul_engine_open
+    (const dlb_md_emul_engine_config_t *p_config   /**< [in] engine configuration */
+    ,void                              *p_mem      /**< [in] memory of the size returned by the query call */
+    ,dlb_md_emul_engine_t             **pp_engine  /**< [out] engine handle */
+    );
+
+/*
+ * Stop the workers. Blocks still queued are discarded without callback.
+ */
+int32_t
+dlb_md_emul_engine_close
+    (dlb_md_emul_engine_t *p_engine
+    );
+
+/*
+ * Claim a stream slot and open a fresh emulator for it
+ */
+int32_t
+dlb_md_emul_engine_add_stream
+    (dlb_md_emul_engine_t              *p_engine
+    ,const dlb_md_emul_stream_config_t *p_stream_config
+    ,uint32_t                          *p_stream_id       /**< [out] id used by the other stream calls */
+    );
+
+/*
+ * Wait for the stream's queue to drain and release its slot
+ */
+int32_t
+dlb_md_emul_engine_remove_stream
+    (dlb_md_emul_engine_t *p_engine
+    ,uint32_t              stream_id
+    );
+
+/*
+ * Queue one block for a stream. Only one thread may submit to a given
+ * stream; the configuration is copied, the buffers it points to are not.
+ */
+int32_t
+dlb_md_emul_engine_submit
+    (dlb_md_emul_engine_t               *p_engine
+    ,uint32_t                            stream_id
+    ,const dlb_md_emul_process_config_t *p_config
+    );
+
+/*
+ * Block until every block submitted to the stream so far has been processed
+ */
+int32_t
+dlb_md_emul_engine_drain
+    (dlb_md_emul_engine_t *p_engine
+    ,uint32_t              stream_id
+    );
+
+/*
+ * Snapshot of the per-stream counters and latency histogram
+ */
+int32_t
+dlb_md_emul_engine_get_stream_stats
+    (dlb_md_emul_engine_t       *p_engine
+    ,uint32_t                    stream_id
+    ,dlb_md_emul_stream_stats_t *p_stats
+    );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DLB_MD_EMUL_ENGINE_H */
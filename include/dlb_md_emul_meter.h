@@ -0,0 +1,181 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ *
+ * @defgroup - Metadata emulation live metering tap
+ * @{
+ * Publishes one record per processed block into a ring that lives in
+ * caller memory, typically a POSIX shared memory object, so a monitor in
+ * another process can follow the emulator. The emulator thread is the
+ * only writer. Every slot carries a sequence number that is odd while the
+ * slot is being written; a reader copies a record and keeps it only if
+ * the sequence is unchanged. Readers take no lock and the writer never
+ * waits for them: a reader that falls behind by more than the capacity
+ * loses the oldest records and is told how many.
+ *
+ * The memory holds no pointers and may be mapped at a different address
+ * in every process.
+ * @}
+ */
+
+#ifndef DLB_MD_EMUL_METER_H
+#define DLB_MD_EMUL_METER_H
+
+#include<stddef.h>
+#include<dlb_md_emul_api.h>
+
+#define DLB_MD_EMUL_METER_MAGIC     0x544D444Du     /**< "MDMT" */
+#define DLB_MD_EMUL_METER_VERSION   1
+
+typedef enum
+{
+    DLB_MD_EMUL_METER_OK              =  0
+   ,DLB_MD_EMUL_METER_INVALID_HANDLE  = -1
+   ,DLB_MD_EMUL_METER_MEM_ALLOC_ERR   = -2   /**< memory smaller than the layout needs */
+   ,DLB_MD_EMUL_METER_INVALID_PARAM   = -3
+   ,DLB_MD_EMUL_METER_BAD_LAYOUT      = -4   /**< attached memory holds no meter of this version */
+} DLB_MD_EMUL_METER_STATUS;
+
+/* Valid fields of a record */
+#define DLB_MD_EMUL_METER_DRC_CALC  1u      /**< log_loudness_db, maxmix_db and the DRC/compr gains */
+#define DLB_MD_EMUL_METER_DECODER   2u      /**< applied_gain */
+
+typedef struct dlb_md_emul_meter_s dlb_md_emul_meter_t;
+
+/**
+ * One processed block of DLB_MD_EMUL_BLOCK_SIZE samples
+ */
+typedef struct dlb_md_emul_meter_record_s
+{
+    uint64_t    block_index;        /**< blocks since the meter was attached to the emulator */
+    uint32_t    flags;              /**< DLB_MD_EMUL_METER_* */
+    uint32_t    num_outputs;
+    uint32_t    channel_mask;       /**< bit per interleaved channel mapped to a programme channel */
+    uint32_t    reserved;
+    double      peak[DLB_MD_EMUL_MAX_OUTPUTS][DLB_MD_EMUL_MAX_CHANS];  /**< linear sample peak of each interleaved channel of the output, 1.0 is full scale */
+    double      log_loudness_db;    /**< weighted power of the block as the compressor measures it, -31 dB at the dialogue level */
+    double      maxmix_db;          /**< peak of the worst case downmix in dBFS, 31 - dialnorm dB low like the loudness */
+    double      drc_gain_db;        /**< line mode (dynrng) gain of the block */
+    double      compr_gain_db;      /**< RF mode (compr) gain of the frame holding the block */
+    double      applied_gain[DLB_MD_EMUL_MAX_OUTPUTS];  /**< linear windowed gain at the end of the block, dialnorm included */
+} dlb_md_emul_meter_record_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Query the memory size of a meter holding capacity records
+ */
+int32_t
+dlb_md_emul_meter_query_mem
+    (uint32_t    capacity       /**< [in] records, >= 2 */
+    ,size_t     *p_mem_size     /**< [out] required memory size in bytes */
+    );
+
+/*
+ * Writer side: lay out an empty meter in p_mem. The memory must be
+ * aligned to 64 bytes, as mmap and page allocations are.
+ */
+int32_t
+dlb_md_emul_meter_init
+    (void                   *p_mem       /**< [in] memory of at least the queried size */
+    ,size_t                  mem_size
+    ,uint32_t                capacity
+    ,dlb_md_emul_meter_t   **pp_meter    /**< [out] meter handle, points at p_mem */
+    );
+
+/*
+ * Reader side: check the layout of a meter laid out by
+ * dlb_md_emul_meter_init, possibly in another process
+ */
+int32_t
+dlb_md_emul_meter_attach
+    (void                   *p_mem
+    ,size_t                  mem_size
+    ,dlb_md_emul_meter_t   **pp_meter    /**< [out] meter handle, points at p_mem */
+    );
+
+/*
+ * Writer side: append one record, overwriting the oldest when the ring is full
+ */
+int32_t
+dlb_md_emul_meter_publish
+    (dlb_md_emul_meter_t                 *p_meter
+    ,const dlb_md_emul_meter_record_t    *p_record
+    );
+
+/*
+ * Reader side: number of records published so far. A reader starting at
+ * this cursor sees only the blocks to come.
+ */
+int32_t
+dlb_md_emul_meter_get_head
+    (const dlb_md_emul_meter_t *p_meter
+    ,uint64_t                  *p_head
+    );
+
+/*
+ * Reader side: copy up to max_records records from *p_cursor on and
+ * advance the cursor. Records overwritten before they could be copied are
+ * skipped and added to *p_num_lost. Never waits for the writer.
+ */
+int32_t
+dlb_md_emul_meter_read
+    (const dlb_md_emul_meter_t      *p_meter
+    ,uint64_t                       *p_cursor       /**< [in,out] next record to read, start at 0 */
+    ,dlb_md_emul_meter_record_t     *p_records      /**< [out] max_records records */
+    ,uint32_t                        max_records
+    ,uint32_t                       *p_num_read     /**< [out] records copied */
+    ,uint64_t                       *p_num_lost     /**< [in,out] incremented by the records skipped, may be NULL */
+    );
+
+/*
+ * Publish every block processed by the emulator to p_meter from now on,
+ * p_meter == NULL detaches the meter. The block index starts over at 0.
+ * DLB_MD_EMUL_ERR_CAPACITY if the emulator was sized without DLB_MD_EMUL_TAP_METER.
+ */
+int32_t
+dlb_md_emul_set_meter
+    (dlb_md_emul_hdl_t     *p_dlb_md_emul_hdl
+    ,dlb_md_emul_meter_t   *p_meter
+    );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DLB_MD_EMUL_METER_H */
@@ -0,0 +1,129 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ *
+ * @defgroup - Metadata emulation power versus time analyser
+ * @{
+ * Measures the mean power of every channel over consecutive windows
+ * (100 ms by default) in a single pass over interleaved audio. The curves
+ * match the .res files of SATS pwr_vs_time that the DRC regression
+ * compares: one point per window at the window centre, in dB relative to
+ * digital full scale, with silence clamped to DLB_MD_EMUL_PWR_FLOOR_DB.
+ * @}
+ */
+
+#ifndef DLB_MD_EMUL_PWR_H
+#define DLB_MD_EMUL_PWR_H
+
+#include<stddef.h>
+#include<dlb_md_emul_api.h>
+
+#define DLB_MD_EMUL_PWR_FLOOR_DB        (-96.0)
+#define DLB_MD_EMUL_PWR_DEFAULT_WINDOW  4800u   /**< 100 ms at 48 kHz */
+
+typedef enum
+{
+    DLB_MD_EMUL_PWR_OK              =  0
+   ,DLB_MD_EMUL_PWR_INVALID_HANDLE  = -1
+   ,DLB_MD_EMUL_PWR_MEM_ALLOC_ERR   = -2
+   ,DLB_MD_EMUL_PWR_INVALID_PARAM   = -3
+   ,DLB_MD_EMUL_PWR_POINTS_FULL     = -4   /**< more windows completed than points were provided */
+} DLB_MD_EMUL_PWR_STATUS;
+
+typedef struct dlb_md_emul_pwr_s dlb_md_emul_pwr_t;
+
+typedef struct dlb_md_emul_pwr_config_s
+{
+    uint32_t    num_channels;    /**< channels analysed, 1..DLB_MD_EMUL_MAX_CHANS */
+    uint32_t    sample_rate;     /**< used for the time axis */
+    uint32_t    window_frames;   /**< frames per point */
+} dlb_md_emul_pwr_config_t;
+
+/** One point of every channel's curve */
+typedef struct dlb_md_emul_pwr_point_s
+{
+    double      time;                                   /**< window centre in seconds */
+    double      power_db[DLB_MD_EMUL_MAX_CHANS];
+} dlb_md_emul_pwr_point_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int32_t
+dlb_md_emul_pwr_query_mem
+    (const dlb_md_emul_pwr_config_t *p_config      /**< [in] analyser configuration */
+    ,size_t                         *p_mem_size    /**< [out] required memory size in bytes */
+    );
+
+/*
+ * Open the analyser inside externally allocated memory
+ */
+int32_t
+dlb_md_emul_pwr_open
+    (const dlb_md_emul_pwr_config_t *p_config      /**< [in] analyser configuration */
+    ,void                           *p_mem         /**< [in] memory of the size returned by the query call */
+    ,dlb_md_emul_pwr_t             **pp_pwr        /**< [out] analyser handle */
+    );
+
+int32_t
+dlb_md_emul_pwr_close
+    (dlb_md_emul_pwr_t *p_pwr
+    );
+
+/*
+ * Analyse num_frames frames. Frame n of channel c is p_samples[n * stride + c],
+ * so a buffer with more channels than analysed can be passed directly.
+ * Every window completed by this call adds one entry to p_points; at most
+ * num_frames / window_frames + 1 windows complete per call. A trailing
+ * partial window is kept for the next call and never reported.
+ */
+int32_t
+dlb_md_emul_pwr_process
+    (dlb_md_emul_pwr_t         *p_pwr
+    ,const DLB_LFRACT          *p_samples      /**< [in] interleaved audio */
+    ,uint32_t                   stride         /**< [in] DLB_LFRACT between frames, >= num_channels */
+    ,uint32_t                   num_frames
+    ,dlb_md_emul_pwr_point_t   *p_points       /**< [out] completed windows */
+    ,uint32_t                   max_points
+    ,uint32_t                  *p_num_points   /**< [out] entries written to p_points */
+    );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DLB_MD_EMUL_PWR_H */
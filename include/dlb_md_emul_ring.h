@@ -0,0 +1,208 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ *
+ * @defgroup - Metadata emulation ring buffer streaming interface
+ * @{
+ * Decouples a capture thread, the emulator thread and a playout thread.
+ * The ring holds whole DLB_MD_EMUL_BLOCK_SIZE blocks of interleaved audio
+ * and three cursors: the producer fills blocks, the emulator processes
+ * filled blocks in place, the consumer releases processed blocks. Every
+ * cursor has a single writer, so no locks are taken and no audio is copied
+ * between the stages.
+ *
+ * Frames in the ring have DLB_MD_EMUL_MAX_CHANS channel slots, the layout
+ * dlb_md_emul_process() uses for its second output, and the first
+ * num_channels slots carry the audio.
+ * @}
+ */
+
+#ifndef DLB_MD_EMUL_RING_H
+#define DLB_MD_EMUL_RING_H
+
+#include<stddef.h>
+#include<dlb_md_emul_api.h>
+
+typedef enum
+{
+    DLB_MD_EMUL_RING_OK              =  0
+   ,DLB_MD_EMUL_RING_INVALID_HANDLE  = -1
+   ,DLB_MD_EMUL_RING_MEM_ALLOC_ERR   = -2
+   ,DLB_MD_EMUL_RING_INVALID_PARAM   = -3
+   ,DLB_MD_EMUL_RING_EMPTY           = -4   /**< no block available for this stage (underrun) */
+   ,DLB_MD_EMUL_RING_FULL            = -5   /**< no free block for the producer (overrun) */
+} DLB_MD_EMUL_RING_STATUS;
+
+typedef struct dlb_md_emul_ring_s dlb_md_emul_ring_t;
+
+typedef struct dlb_md_emul_ring_config_s
+{
+    uint32_t    num_blocks;      /**< ring capacity in blocks, >= 2 */
+    uint32_t    num_channels;    /**< channels in use per frame, 1..DLB_MD_EMUL_MAX_CHANS */
+    int         num_outputs;     /**< 1, or 2 for an independent second output */
+} dlb_md_emul_ring_config_t;
+
+/**
+ * Processed block handed to the consumer. The spans point into the ring
+ * and stay valid until dlb_md_emul_ring_consumer_release.
+ */
+typedef struct dlb_md_emul_ring_span_s
+{
+    const DLB_LFRACT   *pa_data[DLB_MD_EMUL_MAX_OUTPUTS];
+    uint32_t            num_frames;
+    uint32_t            num_channels;
+    uint32_t            frame_stride;   /**< DLB_LFRACT from one frame to the next, DLB_MD_EMUL_MAX_CHANS */
+    uint64_t            block_index;
+    int32_t             status;      /**< return value of dlb_md_emul_process for this block */
+} dlb_md_emul_ring_span_t;
+
+typedef struct dlb_md_emul_ring_stats_s
+{
+    uint32_t    capacity;            /**< blocks */
+    uint32_t    fill;                /**< blocks produced and not yet released */
+    uint32_t    pending;             /**< blocks produced and not yet processed */
+    uint32_t    ready;               /**< blocks processed and not yet released */
+    uint64_t    blocks_produced;
+    uint64_t    blocks_processed;
+    uint64_t    blocks_consumed;
+    uint64_t    overruns;            /**< producer found the ring full */
+    uint64_t    process_underruns;   /**< emulator found no filled block */
+    uint64_t    consumer_underruns;  /**< consumer found no processed block */
+} dlb_md_emul_ring_stats_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Query the memory size required by dlb_md_emul_ring_open, including the
+ * emulator instance and the audio blocks
+ */
+int32_t
+dlb_md_emul_ring_query_mem
+    (const dlb_md_emul_ring_config_t *p_config     /**< [in] ring configuration */
+    ,size_t                          *p_mem_size   /**< [out] required memory size in bytes */
+    );
+
+/*
+ * Open the ring and its emulator inside externally allocated memory
+ */
+int32_t
+dlb_md_emul_ring_open
+    (const dlb_md_emul_ring_config_t *p_config     /**< [in] ring configuration */
+    ,void                            *p_mem        /**< [in] memory of the size returned by the query call */
+    ,dlb_md_emul_ring_t             **pp_ring      /**< [out] ring handle */
+    );
+
+int32_t
+dlb_md_emul_ring_close
+    (dlb_md_emul_ring_t *p_ring
+    );
+
+/*
+ * Producer thread: get the next free block to fill with
+ * DLB_MD_EMUL_BLOCK_SIZE frames of DLB_MD_EMUL_MAX_CHANS slots. Returns
+ * NULL and counts an overrun when the ring is full.
+ */
+DLB_LFRACT *
+dlb_md_emul_ring_producer_acquire
+    (dlb_md_emul_ring_t *p_ring
+    );
+
+/*
+ * Producer thread: publish the block returned by the last acquire
+ */
+int32_t
+dlb_md_emul_ring_producer_commit
+    (dlb_md_emul_ring_t *p_ring
+    );
+
+/*
+ * Producer thread: copy one block of num_channels interleaved frames in.
+ * Convenience wrapper around acquire/commit, returns
+ * DLB_MD_EMUL_RING_FULL on overrun.
+ */
+int32_t
+dlb_md_emul_ring_write
+    (dlb_md_emul_ring_t *p_ring
+    ,const DLB_LFRACT   *p_frames    /**< [in] DLB_MD_EMUL_BLOCK_SIZE frames of num_channels */
+    );
+
+/*
+ * Emulator thread: process the oldest filled block in place. The buffer
+ * pointers, sample_offset and num_samples of p_config are supplied by the
+ * ring; everything else is taken from the caller. Returns
+ * DLB_MD_EMUL_RING_EMPTY and counts an underrun when nothing is pending,
+ * otherwise the result of dlb_md_emul_process.
+ */
+int32_t
+dlb_md_emul_ring_process
+    (dlb_md_emul_ring_t                 *p_ring
+    ,const dlb_md_emul_process_config_t *p_config
+    );
+
+/*
+ * Consumer thread: borrow the oldest processed block. Returns
+ * DLB_MD_EMUL_RING_EMPTY and counts an underrun when nothing is ready.
+ */
+int32_t
+dlb_md_emul_ring_consumer_acquire
+    (dlb_md_emul_ring_t      *p_ring
+    ,dlb_md_emul_ring_span_t *p_span  /**< [out] zero-copy view of the block */
+    );
+
+/*
+ * Consumer thread: hand the block returned by the last acquire back to the producer
+ */
+int32_t
+dlb_md_emul_ring_consumer_release
+    (dlb_md_emul_ring_t *p_ring
+    );
+
+/*
+ * Any thread: snapshot of the fill levels and counters
+ */
+int32_t
+dlb_md_emul_ring_get_stats
+    (dlb_md_emul_ring_t       *p_ring
+    ,dlb_md_emul_ring_stats_t *p_stats
+    );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DLB_MD_EMUL_RING_H */
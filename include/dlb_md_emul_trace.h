@@ -0,0 +1,133 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ *
+ * @defgroup - Metadata emulation per-block DRC trace
+ * @{
+ * Hands the gain computer of the emulator to a callback once per block:
+ * the level measures the compressor works on, the states of its DRC and
+ * compr loudness filters, gain smoothers, clip protections and holdoff
+ * counters, the dynrng and compr words it emits and the gain applied to
+ * each output. The callback runs on the emulator thread and should only
+ * copy the record.
+ *
+ * The record is also the on-disk format of a trace file: one
+ * dlb_md_emul_trace_file_header_t followed by the records as they were
+ * handed over, in host byte order.
+ * @}
+ */
+
+#ifndef DLB_MD_EMUL_TRACE_H
+#define DLB_MD_EMUL_TRACE_H
+
+#include<dlb_md_emul_api.h>
+
+#define DLB_MD_EMUL_TRACE_MAGIC     0x5254444Du     /**< "MDTR" */
+#define DLB_MD_EMUL_TRACE_VERSION   1
+
+/* Valid fields of a record */
+#define DLB_MD_EMUL_TRACE_DRC_CALC  1u      /**< levels, gain computer states, gains and codes */
+#define DLB_MD_EMUL_TRACE_DECODER   2u      /**< applied_gain */
+
+/**
+ * One block of DLB_MD_EMUL_BLOCK_SIZE samples. Levels and filter states
+ * are in dB on the compressor's scale (-31 dB loudness at the dialogue
+ * level), gains in dB.
+ */
+typedef struct dlb_md_emul_trace_record_s
+{
+    uint64_t    block_index;        /**< blocks since the trace was set */
+    uint32_t    flags;              /**< DLB_MD_EMUL_TRACE_* */
+    uint32_t    num_outputs;
+
+    double      log_loudness_db;    /**< weighted power of the block */
+    double      maxmix_db;          /**< peak of the worst case downmix, 31 - dialnorm dB low */
+
+    double      dyn_state_db;       /**< DRC loudness filter state */
+    double      dyn_gain_db;        /**< DRC gain, the dynrng gain of the block */
+    double      dlim_gain_db;       /**< DRC clip protection gain */
+    double      compr_state_db;     /**< compr loudness filter state */
+    double      compr_gain_db;      /**< compr gain after the block */
+    double      compr_frame_gain_db;/**< compr gain of the frame, the lowest of its blocks */
+    double      clim_gain_db;       /**< compr clip protection gain of the frame */
+
+    int32_t     dyn_hold;           /**< DRC decay holdoff count */
+    int32_t     dlim_hold;          /**< DRC clip protection holdoff count */
+    int32_t     compr_hold;         /**< compr decay holdoff count */
+    int32_t     clim_hold;          /**< compr clip protection holdoff count */
+    int32_t     dynrng_code;        /**< dynrng word emitted for the block */
+    int32_t     compr_code;         /**< compr word emitted for the frame */
+
+    double      applied_gain[DLB_MD_EMUL_MAX_OUTPUTS];  /**< linear windowed gain at the end of the block, dialnorm included */
+} dlb_md_emul_trace_record_t;
+
+typedef struct dlb_md_emul_trace_file_header_s
+{
+    uint32_t    magic;              /**< DLB_MD_EMUL_TRACE_MAGIC */
+    uint32_t    version;            /**< DLB_MD_EMUL_TRACE_VERSION */
+    uint32_t    record_size;        /**< sizeof(dlb_md_emul_trace_record_t) */
+    uint32_t    reserved;
+} dlb_md_emul_trace_file_header_t;
+
+/**
+ * Called on the emulator thread for every processed block
+ */
+typedef void (*dlb_md_emul_trace_fn)
+    (void                               *p_context
+    ,const dlb_md_emul_trace_record_t   *p_record
+    );
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Hand every block processed by the emulator to fn from now on, fn == NULL
+ * stops the trace. The block index starts over at 0. DLB_MD_EMUL_ERR_CAPACITY
+ * if the emulator was sized without DLB_MD_EMUL_TAP_TRACE.
+ */
+int32_t
+dlb_md_emul_set_trace
+    (dlb_md_emul_hdl_t     *p_dlb_md_emul_hdl
+    ,dlb_md_emul_trace_fn   fn
+    ,void                  *p_context
+    );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DLB_MD_EMUL_TRACE_H */
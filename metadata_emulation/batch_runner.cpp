@@ -0,0 +1,621 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Batch processing of many files and configurations in one process
+ *
+ *
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+#include <sndfile.hh>
+
+#include "batch_runner.h"
+#include "md_emul_instance.h"
+
+#define BATCH_CHUNK_BLOCKS      64      /* blocks decoded at a time and shared by a group */
+#define BATCH_SAMPLE_RATE       48000
+#define BATCH_PROGRESS_INTERVAL 1.0     /* seconds */
+
+typedef struct
+{
+    bool            ok;
+    std::string     error;
+    uint64_t        frames;
+} batch_result;
+
+/* Jobs sharing one decode of an input */
+typedef struct
+{
+    std::string         input;
+    std::vector<size_t> jobs;
+} batch_group;
+
+typedef struct
+{
+    const std::vector<batch_job>   *jobs;
+    const std::vector<batch_group> *groups;
+    std::vector<batch_result>      *results;
+    batch_config_fn                 make_config;
+    void                           *context;
+
+    std::atomic<size_t>             next_group;
+    std::atomic<size_t>             jobs_done;
+    std::atomic<uint64_t>           files_decoded;
+
+    std::mutex                      report_lock;
+    std::chrono::steady_clock::time_point last_report;
+} batch_run;
+
+/* One job of the group currently processed by a worker */
+typedef struct
+{
+    size_t                          job;
+    md_emul_instance               *emul;
+    dlb_md_emul_process_config_t    emul_conf;
+    SndfileHandle                   output;
+    bool                            active;
+} batch_slot;
+
+/*
+ * Manifest parsing
+ */
+
+static std::vector<std::string> split_csv_line(const std::string &line)
+{
+    std::vector<std::string> fields(1);
+    bool                     quoted = false;
+
+    for (size_t i = 0; i < line.size(); i++)
+    {
+        char c = line[i];
+
+        if (quoted)
+        {
+            if (c == '"' && i + 1 < line.size() && line[i + 1] == '"')
+            {
+                fields.back() += '"';
+                i++;
+            }
+            else if (c == '"')
+            {
+                quoted = false;
+            }
+            else
+            {
+                fields.back() += c;
+            }
+        }
+        else if (c == '"')
+        {
+            quoted = true;
+        }
+        else if (c == ',')
+        {
+            fields.emplace_back();
+        }
+        else if (c != '\r')
+        {
+            fields.back() += c;
+        }
+    }
+    if (quoted)
+    {
+        throw std::runtime_error("Unterminated quote");
+    }
+
+    for (std::string &f : fields)
+    {
+        size_t first = f.find_first_not_of(" \t");
+        size_t last = f.find_last_not_of(" \t");
+
+        f = (first == std::string::npos) ? "" : f.substr(first, last - first + 1);
+    }
+    return fields;
+}
+
+static void parse_csv_manifest(const std::string &text, std::vector<batch_job> *jobs)
+{
+    std::istringstream lines(text);
+    std::string        line;
+    unsigned int       line_number = 0;
+
+    while (std::getline(lines, line))
+    {
+        std::vector<std::string> fields;
+
+        line_number++;
+        if (line.find_first_not_of(" \t\r") == std::string::npos || line[line.find_first_not_of(" \t")] == '#')
+        {
+            continue;
+        }
+        try
+        {
+            fields = split_csv_line(line);
+        }
+        catch (const std::exception &e)
+        {
+            throw std::runtime_error("Manifest line " + std::to_string(line_number) + ": " + e.what());
+        }
+        if (fields[0] == "input" && fields.size() > 1 && fields[1] == "output")
+        {
+            continue;
+        }
+        if (fields.size() < 2 || fields.size() > 3 || fields[0].empty() || fields[1].empty())
+        {
+            throw std::runtime_error("Manifest line " + std::to_string(line_number) + ": expected input,output[,flags]");
+        }
+        jobs->push_back({ fields[0], fields[1], fields.size() > 2 ? fields[2] : "" });
+    }
+}
+
+/* Just enough JSON for an array of objects holding strings */
+typedef struct
+{
+    const std::string  &text;
+    size_t              pos;
+} json_reader;
+
+static void json_skip_space(json_reader *r)
+{
+    while (r->pos < r->text.size() && strchr(" \t\r\n", r->text[r->pos]))
+    {
+        r->pos++;
+    }
+}
+
+static void json_expect(json_reader *r, char c)
+{
+    json_skip_space(r);
+    if (r->pos >= r->text.size() || r->text[r->pos] != c)
+    {
+        throw std::runtime_error("Manifest: expected '" + std::string(1, c) + "' at offset " + std::to_string(r->pos));
+    }
+    r->pos++;
+}
+
+static bool json_accept(json_reader *r, char c)
+{
+    json_skip_space(r);
+    if (r->pos < r->text.size() && r->text[r->pos] == c)
+    {
+        r->pos++;
+        return true;
+    }
+    return false;
+}
+
+static void json_append_utf8(std::string *s, unsigned long cp)
+{
+    if (cp < 0x80)
+    {
+        *s += (char)cp;
+    }
+    else if (cp < 0x800)
+    {
+        *s += (char)(0xC0 | (cp >> 6));
+        *s += (char)(0x80 | (cp & 0x3F));
+    }
+    else
+    {
+        *s += (char)(0xE0 | (cp >> 12));
+        *s += (char)(0x80 | ((cp >> 6) & 0x3F));
+        *s += (char)(0x80 | (cp & 0x3F));
+    }
+}
+
+static std::string json_string(json_reader *r)
+{
+    std::string s;
+
+    json_expect(r, '"');
+    while (r->pos < r->text.size() && r->text[r->pos] != '"')
+    {
+        char c = r->text[r->pos++];
+
+        if (c == '\\' && r->pos < r->text.size())
+        {
+            c = r->text[r->pos++];
+            switch (c)
+            {
+                case 'n': s += '\n'; break;
+                case 't': s += '\t'; break;
+                case 'r': s += '\r'; break;
+                case 'b': s += '\b'; break;
+                case 'f': s += '\f'; break;
+                case 'u':
+                    if (r->pos + 4 > r->text.size())
+                    {
+                        throw std::runtime_error("Manifest: bad \\u escape");
+                    }
+                    json_append_utf8(&s, std::stoul(r->text.substr(r->pos, 4), nullptr, 16));
+                    r->pos += 4;
+                    break;
+                default:  s += c; break;
+            }
+        }
+        else
+        {
+            s += c;
+        }
+    }
+    json_expect(r, '"');
+    return s;
+}
+
+static void parse_json_manifest(const std::string &text, std::vector<batch_job> *jobs)
+{
+    json_reader r = { text, 0 };
+
+    json_expect(&r, '[');
+    if (json_accept(&r, ']'))
+    {
+        return;
+    }
+    do
+    {
+        batch_job job;
+
+        json_expect(&r, '{');
+        if (!json_accept(&r, '}'))
+        {
+            do
+            {
+                std::string key = json_string(&r);
+                std::string value;
+
+                json_expect(&r, ':');
+                value = json_string(&r);
+                if (key == "input")
+                {
+                    job.input = value;
+                }
+                else if (key == "output")
+                {
+                    job.output = value;
+                }
+                else if (key == "flags")
+                {
+                    job.flags = value;
+                }
+                else
+                {
+                    throw std::runtime_error("Manifest: unknown key \"" + key + "\"");
+                }
+            } while (json_accept(&r, ','));
+            json_expect(&r, '}');
+        }
+        if (job.input.empty() || job.output.empty())
+        {
+            throw std::runtime_error("Manifest: job " + std::to_string(jobs->size() + 1) + " needs input and output");
+        }
+        jobs->push_back(job);
+    } while (json_accept(&r, ','));
+    json_expect(&r, ']');
+}
+
+void batch_load_manifest
+    (const std::string              &manifest_file
+    ,std::vector<batch_job>         *jobs
+    )
+{
+    std::ifstream      in(manifest_file, std::ios::binary);
+    std::ostringstream text;
+    size_t             first;
+
+    if (!in)
+    {
+        throw std::runtime_error("Manifest not opened: " + manifest_file);
+    }
+    text << in.rdbuf();
+
+    first = text.str().find_first_not_of(" \t\r\n");
+    if (first != std::string::npos && text.str()[first] == '[')
+    {
+        parse_json_manifest(text.str(), jobs);
+    }
+    else
+    {
+        parse_csv_manifest(text.str(), jobs);
+    }
+}
+
+/*
+ * Processing
+ */
+
+static void fail_slot(batch_run *run, batch_slot *slot, const std::string &error)
+{
+    (*run->results)[slot->job].ok = false;
+    (*run->results)[slot->job].error = error;
+    slot->active = false;
+    slot->output = SndfileHandle();
+}
+
+static void report_progress(batch_run *run, size_t group_jobs)
+{
+    size_t                                done = run->jobs_done += group_jobs;
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex>           guard(run->report_lock);
+
+    if (done == run->jobs->size() ||
+        std::chrono::duration<double>(now - run->last_report).count() >= BATCH_PROGRESS_INTERVAL)
+    {
+        std::cout << "\rJobs done: " << done << " / " << run->jobs->size() << std::flush;
+        run->last_report = now;
+    }
+}
+
+static void process_group
+    (batch_run                      *run
+    ,const batch_group              &group
+    ,std::vector<md_emul_instance>  &pool
+    )
+{
+    std::vector<batch_slot>  slots(group.jobs.size());
+    std::vector<DLB_LFRACT>  decoded, work;
+    DLB_LFRACT               secondary[DLB_MD_EMUL_MAX_CHANS * DLB_MD_EMUL_BLOCK_SIZE];
+    SndfileHandle            input(group.input.c_str());
+    const sf_count_t         chunk_frames = (sf_count_t)BATCH_CHUNK_BLOCKS * DLB_MD_EMUL_BLOCK_SIZE;
+    sf_count_t               frames;
+    size_t                   active = 0;
+    int                      channels;
+
+    for (size_t i = 0; i < slots.size(); i++)
+    {
+        slots[i].job = group.jobs[i];
+        slots[i].active = false;
+        (*run->results)[group.jobs[i]].frames = 0;
+    }
+
+    if (input.error())
+    {
+        for (batch_slot &slot : slots)
+        {
+            fail_slot(run, &slot, "Input File not opened: " + std::string(input.strError()));
+        }
+        return;
+    }
+    channels = input.channels();
+    run->files_decoded++;
+
+    /* Grow the worker's emulator pool to the group, then set each job up */
+    while (pool.size() < slots.size())
+    {
+        pool.emplace_back();
+        pool.back() = {};
+        md_emul_instance_open(&pool.back());
+    }
+
+    for (size_t i = 0; i < slots.size(); i++)
+    {
+        batch_slot      &slot = slots[i];
+        const batch_job &job = (*run->jobs)[slot.job];
+
+        try
+        {
+            int32_t err;
+
+            slot.emul = &pool[i];
+            err = dlb_md_emul_reset(&slot.emul->hdl);
+            if (err)
+            {
+                throw std::runtime_error("Metadata Emulation Reset Returned Error: " + std::to_string(err));
+            }
+
+            run->make_config(run->context, job.flags, channels, &slot.emul_conf);
+            slot.emul_conf.pa_in_data[1] = secondary;
+
+            slot.output = SndfileHandle(job.output.c_str(), SFM_WRITE, SF_FORMAT_WAV | SF_FORMAT_PCM_16, channels, BATCH_SAMPLE_RATE);
+            if (slot.output.error())
+            {
+                throw std::runtime_error("Output File not opened: " + std::string(slot.output.strError()));
+            }
+            slot.active = true;
+            active++;
+        }
+        catch (const std::exception &e)
+        {
+            fail_slot(run, &slot, e.what());
+        }
+    }
+
+    decoded.resize((size_t)chunk_frames * channels);
+    work.resize(md_emul_block_buffer_size(BATCH_CHUNK_BLOCKS, channels));
+
+    while (active > 0 && (frames = input.readf(decoded.data(), chunk_frames)) > 0)
+    {
+        size_t blocks = (size_t)((frames + DLB_MD_EMUL_BLOCK_SIZE - 1) / DLB_MD_EMUL_BLOCK_SIZE);
+
+        /* pad the final partial block with silence */
+        std::fill(decoded.begin() + (size_t)frames * channels, decoded.begin() + blocks * DLB_MD_EMUL_BLOCK_SIZE * channels, (DLB_LFRACT)0);
+
+        for (batch_slot &slot : slots)
+        {
+            if (!slot.active)
+            {
+                continue;
+            }
+            try
+            {
+                std::copy(decoded.begin(), decoded.begin() + blocks * DLB_MD_EMUL_BLOCK_SIZE * channels, work.begin());
+                for (size_t b = 0; b < blocks; b++)
+                {
+                    slot.emul_conf.pa_in_data[0] = work.data() + b * DLB_MD_EMUL_BLOCK_SIZE * channels;
+                    md_emul_instance_process(slot.emul, &slot.emul_conf, 1);
+                }
+                if (slot.output.writef(work.data(), (sf_count_t)(blocks * DLB_MD_EMUL_BLOCK_SIZE)) != (sf_count_t)(blocks * DLB_MD_EMUL_BLOCK_SIZE))
+                {
+                    throw std::runtime_error("Output File write failed: " + std::string(slot.output.strError()));
+                }
+                (*run->results)[slot.job].frames += blocks * DLB_MD_EMUL_BLOCK_SIZE;
+            }
+            catch (const std::exception &e)
+            {
+                fail_slot(run, &slot, e.what());
+                active--;
+            }
+        }
+    }
+
+    for (batch_slot &slot : slots)
+    {
+        if (slot.active)
+        {
+            (*run->results)[slot.job].ok = true;
+            slot.output = SndfileHandle();      /* closes and finalises the file */
+        }
+    }
+}
+
+static void batch_worker(batch_run *run)
+{
+    std::vector<md_emul_instance> pool;
+    size_t                        g;
+
+    try
+    {
+        while ((g = run->next_group++) < run->groups->size())
+        {
+            const batch_group &group = (*run->groups)[g];
+
+            process_group(run, group, pool);
+            report_progress(run, group.jobs.size());
+        }
+    }
+    catch (const std::exception &e)
+    {
+        /* failing to open an emulator stops this worker, the others carry on */
+        std::lock_guard<std::mutex> guard(run->report_lock);
+        std::cerr << std::endl << "Batch worker stopped: " << e.what() << std::endl;
+    }
+
+    for (md_emul_instance &inst : pool)
+    {
+        md_emul_instance_close(&inst);
+    }
+}
+
+unsigned int run_batch
+    (const std::vector<batch_job>   &jobs
+    ,const batch_options            &options
+    ,batch_config_fn                 make_config
+    ,void                           *context
+    )
+{
+    std::vector<batch_result>             results(jobs.size(), { false, "not run", 0 });
+    std::vector<batch_group>              groups;
+    std::map<std::string, size_t>         open_group;
+    std::vector<std::thread>              workers;
+    batch_run                             run;
+    unsigned int                          num_workers = options.num_workers;
+    unsigned int                          max_group_jobs = options.max_group_jobs ? options.max_group_jobs : 1;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    double                                wall_seconds;
+    uint64_t                              total_frames = 0;
+    unsigned int                          failed = 0;
+
+    /* Group jobs by input, splitting groups that would run too long on one worker */
+    for (size_t j = 0; j < jobs.size(); j++)
+    {
+        std::map<std::string, size_t>::iterator it = open_group.find(jobs[j].input);
+
+        if (it == open_group.end() || groups[it->second].jobs.size() >= max_group_jobs)
+        {
+            groups.push_back({ jobs[j].input, {} });
+            open_group[jobs[j].input] = groups.size() - 1;
+            it = open_group.find(jobs[j].input);
+        }
+        groups[it->second].jobs.push_back(j);
+    }
+
+    if (num_workers == 0)
+    {
+        num_workers = std::max(1u, std::thread::hardware_concurrency());
+    }
+    num_workers = (unsigned int)std::min<size_t>(num_workers, std::max<size_t>(groups.size(), 1));
+
+    run.jobs = &jobs;
+    run.groups = &groups;
+    run.results = &results;
+    run.make_config = make_config;
+    run.context = context;
+    run.next_group = 0;
+    run.jobs_done = 0;
+    run.files_decoded = 0;
+    run.last_report = start;
+
+    std::cout << "Batch: " << jobs.size() << " jobs, " << groups.size() << " input groups, "
+              << num_workers << " workers" << std::endl;
+
+    for (unsigned int w = 0; w < num_workers; w++)
+    {
+        workers.emplace_back(batch_worker, &run);
+    }
+    for (std::thread &worker : workers)
+    {
+        worker.join();
+    }
+    wall_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << std::endl;
+    for (size_t j = 0; j < jobs.size(); j++)
+    {
+        total_frames += results[j].frames;
+        if (!results[j].ok)
+        {
+            failed++;
+            std::cout << "FAILED: " << jobs[j].input << " -> " << jobs[j].output << ": " << results[j].error << std::endl;
+        }
+    }
+
+    std::cout << "Jobs: " << jobs.size() - failed << " ok, " << failed << " failed" << std::endl;
+    std::cout << "Inputs decoded: " << run.files_decoded << std::endl;
+    std::cout << "Audio processed: " << (double)total_frames / BATCH_SAMPLE_RATE << " s in " << wall_seconds << " s wall ("
+              << (wall_seconds > 0.0 ? (double)total_frames / BATCH_SAMPLE_RATE / wall_seconds : 0.0) << "x real time)" << std::endl;
+
+    return failed;
+}
@@ -0,0 +1,97 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Batch processing of many files and configurations in one process
+ *
+ * Jobs come from a manifest (CSV or JSON) naming an input, an output and the
+ * MdEmu flags for that job. Jobs that share an input are grouped so the file
+ * is decoded once and fed to one emulator per job. Groups are spread over a
+ * pool of worker threads, and each worker keeps its emulators open and resets
+ * them between groups instead of allocating and opening new ones.
+ */
+
+#ifndef BATCH_RUNNER_H
+#define BATCH_RUNNER_H
+
+#include <string>
+#include <vector>
+
+#include "dlb_md_emul_api.h"
+
+typedef struct
+{
+    std::string     input;
+    std::string     output;
+    std::string     flags;              /**< MdEmu short options, e.g. "-a7 -dn31 -k1 -c2" */
+} batch_job;
+
+typedef struct
+{
+    unsigned int    num_workers;        /**< 0 uses one worker per core */
+    unsigned int    max_group_jobs;     /**< jobs fed from one decode of an input */
+} batch_options;
+
+/*
+ * Build the process configuration of a job for an input with the given
+ * number of channels. Throws on invalid flags. Called from worker threads.
+ */
+typedef void (*batch_config_fn)
+    (void                           *context
+    ,const std::string              &flags
+    ,int                             channels
+    ,dlb_md_emul_process_config_t   *emul_conf
+    );
+
+/*
+ * Read a manifest. CSV has one "input,output,flags" job per line, fields may
+ * be double quoted, lines starting with # and a header line are skipped. JSON
+ * is an array of objects with "input", "output" and "flags" strings. Throws
+ * on error.
+ */
+void batch_load_manifest
+    (const std::string              &manifest_file
+    ,std::vector<batch_job>         *jobs
+    );
+
+/* Run all jobs and print a summary, returns the number of failed jobs */
+unsigned int run_batch
+    (const std::vector<batch_job>   &jobs
+    ,const batch_options            &options
+    ,batch_config_fn                 make_config
+    ,void                           *context
+    );
+
+#endif /* BATCH_RUNNER_H */
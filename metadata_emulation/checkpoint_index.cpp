@@ -0,0 +1,471 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Checkpoint index sidecar and random-access range rendering
+ *
+ * File layout (native byte order, the index is tied to the library build
+ * that wrote it through the saved state header):
+ *   checkpoint_file_header
+ *   repeated: uint64_t block index, state of checkpoint_file_header.state_size bytes
+ *
+ * The input fields of the header are filled in when the run completes, an
+ * index is only used for the input it was written for.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+#include <sys/stat.h>
+
+#include <sndfile.hh>
+
+#include "checkpoint_index.h"
+#include "md_emul_instance.h"
+
+#define    CHECKPOINT_VERSION       2
+#define    CHECKPOINT_SAMPLE_RATE   48000
+#define    CHECKPOINT_HASH_BLOCKS   188     /* input fingerprint over the first second */
+#define    FNV1A_OFFSET             14695981039346656037ull
+
+static const char checkpoint_magic[8] = { 'M', 'D', 'E', 'M', 'U', 'C', 'K', 'P' };
+
+typedef struct
+{
+    char        magic[8];
+    uint32_t    version;
+    uint32_t    state_size;
+    uint32_t    block_size;
+    uint32_t    interval_blocks;
+    uint32_t    channels;
+    uint32_t    reserved;
+    uint64_t    config_hash;
+    uint64_t    input_blocks;       /* blocks of the input, 0 until the run completes */
+    uint64_t    input_hash;         /* samples of the first CHECKPOINT_HASH_BLOCKS blocks */
+    uint64_t    input_size;         /* bytes of the input file, 0 for a stream */
+    int64_t     input_mtime;        /* modification time of the input file, 0 for a stream */
+} checkpoint_file_header;
+
+/* FNV-1a */
+static uint64_t hash_bytes(uint64_t hash, const void *data, size_t size)
+{
+    const unsigned char *p = (const unsigned char *)data;
+
+    for (size_t i = 0; i < size; i++)
+    {
+        hash ^= p[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+/* Size and modification time of a regular file */
+static bool file_identity(const std::string &file, uint64_t *size, int64_t *mtime)
+{
+    struct stat st;
+
+    if (stat(file.c_str(), &st) != 0 || !S_ISREG(st.st_mode))
+    {
+        return false;
+    }
+    *size = (uint64_t)st.st_size;
+    *mtime = (int64_t)st.st_mtime;
+    return true;
+}
+
+uint64_t checkpoint_config_hash(const dlb_md_emul_process_config_t &emul_conf)
+{
+    dlb_md_emul_process_config_t conf;
+
+    /* padding is zero as long as the configuration was cleared before use */
+    memcpy(&conf, &emul_conf, sizeof(conf));
+    conf.pa_in_data[0] = nullptr;
+    conf.pa_in_data[1] = nullptr;
+
+    return hash_bytes(FNV1A_OFFSET, &conf, sizeof(conf));
+}
+
+void checkpoint_writer_open
+    (checkpoint_writer                  *writer
+    ,const std::string                  &file
+    ,const std::string                  &input_file
+    ,const dlb_md_emul_process_config_t &emul_conf
+    ,int                                 channels
+    ,double                              interval_seconds
+    )
+{
+    checkpoint_file_header header = {};
+
+    writer->interval_blocks = (uint32_t)std::lround(interval_seconds * CHECKPOINT_SAMPLE_RATE / DLB_MD_EMUL_BLOCK_SIZE);
+    if (writer->interval_blocks == 0)
+    {
+        writer->interval_blocks = 1;
+    }
+    writer->channels = channels;
+    writer->input_blocks = 0;
+    writer->input_hash = FNV1A_OFFSET;
+    writer->state.resize(dlb_md_emul_query_state_size());
+
+    writer->fp = fopen(file.c_str(), "wb");
+    if (!writer->fp)
+    {
+        throw std::runtime_error("Checkpoint index not opened: " + file);
+    }
+
+    memcpy(header.magic, checkpoint_magic, sizeof(header.magic));
+    header.version         = CHECKPOINT_VERSION;
+    header.state_size      = (uint32_t)writer->state.size();
+    header.block_size      = DLB_MD_EMUL_BLOCK_SIZE;
+    header.interval_blocks = writer->interval_blocks;
+    header.channels        = channels;
+    header.config_hash     = checkpoint_config_hash(emul_conf);
+    if (!input_file.empty() && !file_identity(input_file, &header.input_size, &header.input_mtime))
+    {
+        throw std::runtime_error("Input File not found: " + input_file);
+    }
+
+    if (fwrite(&header, sizeof(header), 1, writer->fp) != 1)
+    {
+        throw std::runtime_error("Checkpoint index write failed: " + file);
+    }
+}
+
+void checkpoint_writer_update
+    (checkpoint_writer      *writer
+    ,dlb_md_emul_hdl_t      *hdl
+    ,uint64_t                block_index
+    ,const DLB_LFRACT       *block
+    )
+{
+    int32_t err;
+
+    if (!writer->fp)
+    {
+        return;
+    }
+    writer->input_blocks = block_index + 1;
+    if (block_index < CHECKPOINT_HASH_BLOCKS)
+    {
+        writer->input_hash = hash_bytes(writer->input_hash, block, sizeof(DLB_LFRACT) * DLB_MD_EMUL_BLOCK_SIZE * writer->channels);
+    }
+    if ((block_index % writer->interval_blocks) != 0)
+    {
+        return;
+    }
+
+    err = dlb_md_emul_save_state(hdl, writer->state.data(), (uint32_t)writer->state.size());
+    if (err)
+    {
+        throw std::runtime_error("Saving emulator state returned error: " + std::to_string(err));
+    }
+    if (fwrite(&block_index, sizeof(block_index), 1, writer->fp) != 1 ||
+        fwrite(writer->state.data(), writer->state.size(), 1, writer->fp) != 1)
+    {
+        throw std::runtime_error("Checkpoint index write failed");
+    }
+}
+
+void checkpoint_writer_close(checkpoint_writer *writer)
+{
+    bool written;
+
+    if (!writer->fp)
+    {
+        return;
+    }
+    written = fseek(writer->fp, offsetof(checkpoint_file_header, input_blocks), SEEK_SET) == 0 &&
+              fwrite(&writer->input_blocks, sizeof(writer->input_blocks), 1, writer->fp) == 1 &&
+              fwrite(&writer->input_hash, sizeof(writer->input_hash), 1, writer->fp) == 1;
+    written = (fclose(writer->fp) == 0) && written;
+    writer->fp = nullptr;
+    if (!written)
+    {
+        throw std::runtime_error("Checkpoint index write failed");
+    }
+}
+
+/* Block count and fingerprint of an input file as checkpoint_writer_update records them */
+static void input_fingerprint(const std::string &input_file, int channels, uint64_t *blocks, uint64_t *hash)
+{
+    SndfileHandle           input(input_file.c_str());
+    std::vector<DLB_LFRACT> samples((size_t)DLB_MD_EMUL_BLOCK_SIZE * channels);
+
+    *blocks = 0;
+    *hash = FNV1A_OFFSET;
+    if (input.error() || input.channels() != channels)
+    {
+        return;
+    }
+    *blocks = ((uint64_t)input.frames() + DLB_MD_EMUL_BLOCK_SIZE - 1) / DLB_MD_EMUL_BLOCK_SIZE;
+    for (uint64_t b = 0; b < std::min<uint64_t>(*blocks, CHECKPOINT_HASH_BLOCKS); b++)
+    {
+        sf_count_t got = input.read(samples.data(), (sf_count_t)samples.size());
+
+        std::fill(samples.begin() + got, samples.end(), (DLB_LFRACT)0);
+        *hash = hash_bytes(*hash, samples.data(), samples.size() * sizeof(DLB_LFRACT));
+    }
+}
+
+bool checkpoint_index_load
+    (checkpoint_index                   *index
+    ,const std::string                  &file
+    ,const std::string                  &input_file
+    ,const dlb_md_emul_process_config_t &emul_conf
+    ,int                                 channels
+    ,std::string                        *reason
+    )
+{
+    checkpoint_file_header header;
+    uint64_t               block;
+    uint64_t               input_blocks, input_hash, input_size;
+    int64_t                input_mtime;
+    FILE                  *fp = fopen(file.c_str(), "rb");
+
+    index->blocks.clear();
+    index->offsets.clear();
+
+    if (!fp)
+    {
+        *reason = "no checkpoint index " + file;
+        return false;
+    }
+    input_fingerprint(input_file, channels, &input_blocks, &input_hash);
+
+    if (fread(&header, sizeof(header.magic) + sizeof(header.version), 1, fp) != 1 ||
+        memcmp(header.magic, checkpoint_magic, sizeof(header.magic)) != 0)
+    {
+        *reason = file + " is not a checkpoint index";
+    }
+    else if (header.version != CHECKPOINT_VERSION ||
+             fseek(fp, 0, SEEK_SET) != 0 || fread(&header, sizeof(header), 1, fp) != 1 ||
+             header.state_size != dlb_md_emul_query_state_size() || header.block_size != DLB_MD_EMUL_BLOCK_SIZE)
+    {
+        *reason = file + " was written by an incompatible build";
+    }
+    else if (header.channels != (uint32_t)channels || header.config_hash != checkpoint_config_hash(emul_conf))
+    {
+        *reason = file + " was written with different emulation settings";
+    }
+    else if (header.input_blocks == 0)
+    {
+        *reason = file + " was written by a run that did not finish";
+    }
+    else if (header.input_size != 0 &&
+             (!file_identity(input_file, &input_size, &input_mtime) || header.input_size != input_size || header.input_mtime != input_mtime))
+    {
+        *reason = file + " was written for another version of " + input_file;
+    }
+    else if (header.input_blocks != input_blocks || header.input_hash != input_hash)
+    {
+        *reason = file + " was written for other input than " + input_file;
+    }
+    else
+    {
+        while (fread(&block, sizeof(block), 1, fp) == 1)
+        {
+            index->blocks.push_back(block);
+            index->offsets.push_back(ftell(fp));
+            if (fseek(fp, header.state_size, SEEK_CUR) != 0)
+            {
+                break;
+            }
+        }
+        /* drop a truncated last entry */
+        fseek(fp, 0, SEEK_END);
+        if (!index->offsets.empty() && index->offsets.back() + (long)header.state_size > ftell(fp))
+        {
+            index->blocks.pop_back();
+            index->offsets.pop_back();
+        }
+    }
+    fclose(fp);
+
+    if (!reason->empty())
+    {
+        return false;
+    }
+    index->file = file;
+    index->state_size = header.state_size;
+    return true;
+}
+
+/* Load the state of the last checkpoint at or before block, returns the checkpoint block */
+static
+uint64_t
+checkpoint_index_restore
+    (const checkpoint_index *index
+    ,dlb_md_emul_hdl_t      *hdl
+    ,uint64_t                block
+    ,bool                   *found
+    )
+{
+    std::vector<char> state(index->state_size);
+    size_t            i = 0;
+    FILE             *fp;
+    int32_t           err;
+
+    *found = false;
+    while (i < index->blocks.size() && index->blocks[i] <= block)
+    {
+        i++;
+    }
+    if (i == 0)
+    {
+        return 0;
+    }
+    i--;
+
+    fp = fopen(index->file.c_str(), "rb");
+    if (!fp)
+    {
+        throw std::runtime_error("Checkpoint index not opened: " + index->file);
+    }
+    if (fseek(fp, index->offsets[i], SEEK_SET) != 0 || fread(state.data(), state.size(), 1, fp) != 1)
+    {
+        fclose(fp);
+        throw std::runtime_error("Checkpoint index read failed: " + index->file);
+    }
+    fclose(fp);
+
+    err = dlb_md_emul_load_state(hdl, state.data(), (uint32_t)state.size());
+    if (err)
+    {
+        throw std::runtime_error("Loading emulator state returned error: " + std::to_string(err));
+    }
+    *found = true;
+    return index->blocks[i];
+}
+
+void render_range
+    (const std::string                  &input_file
+    ,const std::string                  &output_file
+    ,const dlb_md_emul_process_config_t &emul_template
+    ,uint32_t                            num_outputs
+    ,const checkpoint_index             *index
+    ,double                              preroll_seconds
+    ,double                              start_seconds
+    ,double                              end_seconds
+    )
+{
+    md_emul_instance             inst = {};
+    dlb_md_emul_process_config_t emul_conf = emul_template;
+    std::vector<DLB_LFRACT>      primary_io_samples(DLB_MD_EMUL_MAX_CHANS * DLB_MD_EMUL_BLOCK_SIZE);
+    std::vector<DLB_LFRACT>      secondary_op_samples(DLB_MD_EMUL_MAX_CHANS * DLB_MD_EMUL_BLOCK_SIZE);
+    SndfileHandle                input_wav_file(input_file.c_str());
+    SndfileHandle                output_wav_file;
+    uint64_t                     first_frame, end_frame, first_block, end_block, block;
+    bool                         from_checkpoint = false;
+    int                          channels;
+
+    if (input_wav_file.error())
+    {
+        throw std::runtime_error("Input File not opened: " + std::string(input_wav_file.strError()));
+    }
+    channels = input_wav_file.channels();
+
+    first_frame = (uint64_t)std::llround(start_seconds * CHECKPOINT_SAMPLE_RATE);
+    end_frame = (end_seconds < 0.0) ? (uint64_t)input_wav_file.frames()
+                                    : (uint64_t)std::llround(end_seconds * CHECKPOINT_SAMPLE_RATE);
+    if (end_frame > (uint64_t)input_wav_file.frames())
+    {
+        end_frame = (uint64_t)input_wav_file.frames();
+    }
+    if (first_frame >= end_frame)
+    {
+        throw std::runtime_error("Empty range");
+    }
+    first_block = first_frame / DLB_MD_EMUL_BLOCK_SIZE;
+    end_block   = (end_frame + DLB_MD_EMUL_BLOCK_SIZE - 1) / DLB_MD_EMUL_BLOCK_SIZE;
+
+    md_emul_instance_open(&inst);
+
+    if (index)
+    {
+        block = checkpoint_index_restore(index, &inst.hdl, first_block, &from_checkpoint);
+    }
+    if (from_checkpoint)
+    {
+        std::cout << "Starting from checkpoint at " << (double)block * DLB_MD_EMUL_BLOCK_SIZE / CHECKPOINT_SAMPLE_RATE << " s" << std::endl;
+    }
+    else
+    {
+        uint64_t preroll_blocks = (uint64_t)std::ceil(preroll_seconds * CHECKPOINT_SAMPLE_RATE / DLB_MD_EMUL_BLOCK_SIZE);
+
+        block = (first_block > preroll_blocks) ? first_block - preroll_blocks : 0;
+        std::cout << "Starting " << (double)(first_block - block) * DLB_MD_EMUL_BLOCK_SIZE / CHECKPOINT_SAMPLE_RATE << " s early without checkpoint" << std::endl;
+    }
+
+    if (input_wav_file.seek((sf_count_t)block * DLB_MD_EMUL_BLOCK_SIZE, SEEK_SET) < 0)
+    {
+        md_emul_instance_close(&inst);
+        throw std::runtime_error("Seek in input file failed");
+    }
+
+    output_wav_file = SndfileHandle(output_file.c_str(), SFM_WRITE, SF_FORMAT_WAV | SF_FORMAT_PCM_16, channels, CHECKPOINT_SAMPLE_RATE);
+    if (output_wav_file.error())
+    {
+        md_emul_instance_close(&inst);
+        throw std::runtime_error("Output File not opened: " + std::string(output_wav_file.strError()));
+    }
+
+    emul_conf.pa_in_data[0] = primary_io_samples.data();
+    emul_conf.pa_in_data[1] = secondary_op_samples.data();
+
+    for (; block < end_block; block++)
+    {
+        uint64_t block_frame = block * DLB_MD_EMUL_BLOCK_SIZE;
+
+        sf_count_t got = input_wav_file.read(primary_io_samples.data(), channels * DLB_MD_EMUL_BLOCK_SIZE);
+
+        /* pad the final partial block with silence, as the sequential run does */
+        std::fill(primary_io_samples.begin() + got, primary_io_samples.begin() + channels * DLB_MD_EMUL_BLOCK_SIZE, (DLB_LFRACT)0);
+        md_emul_instance_process(&inst, &emul_conf, num_outputs);
+
+        if (block >= first_block)
+        {
+            uint64_t from = (first_frame > block_frame) ? first_frame - block_frame : 0;
+            uint64_t to = (end_frame < block_frame + DLB_MD_EMUL_BLOCK_SIZE) ? end_frame - block_frame : DLB_MD_EMUL_BLOCK_SIZE;
+
+            output_wav_file.writef(primary_io_samples.data() + from * channels, (sf_count_t)(to - from));
+        }
+    }
+
+    md_emul_instance_close(&inst);
+    std::cout << "Wrote: " << end_frame - first_frame << " frames" << std::endl;
+}
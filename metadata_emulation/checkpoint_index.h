@@ -0,0 +1,133 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Checkpoint index sidecar and random-access range rendering
+ *
+ * A checkpoint index holds the saved emulator state at regular block
+ * intervals of a normal run. Rendering a range then only has to process
+ * from the nearest checkpoint instead of from the start of the file.
+ */
+
+#ifndef CHECKPOINT_INDEX_H
+#define CHECKPOINT_INDEX_H
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "dlb_md_emul_api.h"
+
+typedef struct
+{
+    FILE                   *fp;
+    uint32_t                interval_blocks;
+    int                     channels;
+    uint64_t                input_blocks;   /**< blocks seen so far */
+    uint64_t                input_hash;     /**< hash of the samples of the first blocks */
+    std::vector<char>       state;
+} checkpoint_writer;
+
+typedef struct
+{
+    std::string             file;
+    uint32_t                state_size;
+    std::vector<uint64_t>   blocks;          /**< block index of each checkpoint, ascending */
+    std::vector<long>       offsets;         /**< file offset of each state */
+} checkpoint_index;
+
+/* Hash of everything in the process configuration except the buffer pointers */
+uint64_t checkpoint_config_hash(const dlb_md_emul_process_config_t &emul_conf);
+
+/*
+ * Create the index file, throws on error. input_file is the file the run
+ * reads, whose size and modification time go into the index; empty for a
+ * stream.
+ */
+void checkpoint_writer_open
+    (checkpoint_writer                  *writer
+    ,const std::string                  &file
+    ,const std::string                  &input_file
+    ,const dlb_md_emul_process_config_t &emul_conf
+    ,int                                 channels
+    ,double                              interval_seconds
+    );
+
+/*
+ * Save the state if block_index is on the checkpoint interval; call for every
+ * block, in order and before processing it. block holds the input samples of
+ * the block.
+ */
+void checkpoint_writer_update
+    (checkpoint_writer      *writer
+    ,dlb_md_emul_hdl_t      *hdl
+    ,uint64_t                block_index
+    ,const DLB_LFRACT       *block
+    );
+
+/* Record the length and fingerprint of the input and close the file, throws on error */
+void checkpoint_writer_close(checkpoint_writer *writer);
+
+/*
+ * Read the index of an earlier run. Returns false and sets reason when the
+ * file is missing, was written with different settings, by a run that did not
+ * finish, or for another input than input_file.
+ */
+bool checkpoint_index_load
+    (checkpoint_index                   *index
+    ,const std::string                  &file
+    ,const std::string                  &input_file
+    ,const dlb_md_emul_process_config_t &emul_conf
+    ,int                                 channels
+    ,std::string                        *reason
+    );
+
+/*
+ * Render the frames [start_seconds, end_seconds) of the input. Starts from the
+ * nearest checkpoint at or before the range when index is given, otherwise
+ * preroll_seconds early from a fresh emulator. end_seconds < 0 renders to the end.
+ */
+void render_range
+    (const std::string                  &input_file
+    ,const std::string                  &output_file
+    ,const dlb_md_emul_process_config_t &emul_conf
+    ,uint32_t                            num_outputs
+    ,const checkpoint_index             *index
+    ,double                              preroll_seconds
+    ,double                              start_seconds
+    ,double                              end_seconds
+    );
+
+#endif /* CHECKPOINT_INDEX_H */
@@ -0,0 +1,675 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Local emulation service on a UNIX domain socket
+ *
+ *
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "emul_service.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <csignal>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <sndfile.hh>
+
+#include "md_emul_instance.h"
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+#define SERVICE_CHUNK_BLOCKS        64
+#define SERVICE_SAMPLE_RATE         48000
+#define SERVICE_PROGRESS_INTERVAL   0.5     /* seconds */
+#define SERVICE_POLL_MS             200
+#define SERVICE_MAX_LINE            4096
+
+typedef struct
+{
+    int                 fd;
+    std::mutex          send_lock;
+    bool                broken;             /**< peer went away, replies are dropped */
+} service_connection;
+
+typedef struct
+{
+    uint64_t                            id;
+    bool                                shm;
+    std::string                         input;
+    std::string                         output;
+    std::string                         shm_name;
+    int                                 channels;
+    uint64_t                            frames;
+    std::string                         flags;
+    std::shared_ptr<service_connection> conn;
+} service_job;
+
+/* Reader thread of one client */
+typedef struct
+{
+    std::thread                         thread;
+    std::shared_ptr<service_connection> conn;
+    std::atomic<bool>                   finished;
+} service_client;
+
+typedef struct
+{
+    batch_config_fn                     make_config;
+    void                               *context;
+    unsigned int                        num_workers;
+
+    std::mutex                          lock;
+    std::condition_variable             ready;
+    std::deque<service_job>             queue;
+    bool                                draining;   /**< workers exit once the queue is empty */
+    unsigned int                        running;
+    double                              busy_seconds;
+
+    std::atomic<bool>                   shutdown;
+    std::atomic<uint64_t>               next_id;
+    std::atomic<uint64_t>               jobs_done;
+    std::atomic<uint64_t>               jobs_failed;
+    std::atomic<uint64_t>               frames_done;
+    std::chrono::steady_clock::time_point start;
+} service;
+
+static volatile sig_atomic_t service_signalled = 0;
+
+static void service_signal_handler(int sig)
+{
+    (void)sig;
+    service_signalled = 1;
+}
+
+static void connection_close(service_connection *conn)
+{
+    close(conn->fd);
+    delete conn;
+}
+
+static void send_line(service_connection *conn, const std::string &line)
+{
+    std::lock_guard<std::mutex> guard(conn->send_lock);
+    std::string                 data = line + "\n";
+    size_t                      sent = 0;
+
+    while (!conn->broken && sent < data.size())
+    {
+        ssize_t n = send(conn->fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+
+        if (n <= 0)
+        {
+            conn->broken = true;
+        }
+        else
+        {
+            sent += (size_t)n;
+        }
+    }
+}
+
+/*
+ * Job processing
+ */
+
+/* Throttles PROGRESS replies of one job */
+typedef struct
+{
+    service_connection                    *conn;
+    uint64_t                               id;
+    std::chrono::steady_clock::time_point  last;
+} progress_reporter;
+
+static void report_progress(progress_reporter *p, uint64_t frames)
+{
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+    if (std::chrono::duration<double>(now - p->last).count() >= SERVICE_PROGRESS_INTERVAL)
+    {
+        send_line(p->conn, "PROGRESS\t" + std::to_string(p->id) + "\t" + std::to_string(frames));
+        p->last = now;
+    }
+}
+
+static uint64_t run_file_job(service *svc, const service_job &job, md_emul_instance *emul)
+{
+    dlb_md_emul_process_config_t emul_conf;
+    SndfileHandle                input(job.input.c_str());
+    SndfileHandle                output;
+    std::vector<DLB_LFRACT>      samples;
+    DLB_LFRACT                   secondary[DLB_MD_EMUL_MAX_CHANS * DLB_MD_EMUL_BLOCK_SIZE];
+    const sf_count_t             chunk_frames = (sf_count_t)SERVICE_CHUNK_BLOCKS * DLB_MD_EMUL_BLOCK_SIZE;
+    progress_reporter            progress = { job.conn.get(), job.id, std::chrono::steady_clock::now() };
+    sf_count_t                   frames;
+    uint64_t                     total = 0;
+    int                          channels;
+
+    if (input.error())
+    {
+        throw std::runtime_error("Input File not opened: " + std::string(input.strError()));
+    }
+    channels = input.channels();
+    svc->make_config(svc->context, job.flags, channels, &emul_conf);
+    emul_conf.pa_in_data[1] = secondary;
+
+    output = SndfileHandle(job.output.c_str(), SFM_WRITE, SF_FORMAT_WAV | SF_FORMAT_PCM_16, channels, SERVICE_SAMPLE_RATE);
+    if (output.error())
+    {
+        throw std::runtime_error("Output File not opened: " + std::string(output.strError()));
+    }
+
+    samples.resize(md_emul_block_buffer_size(SERVICE_CHUNK_BLOCKS, channels));
+    while ((frames = input.readf(samples.data(), chunk_frames)) > 0)
+    {
+        size_t blocks = (size_t)((frames + DLB_MD_EMUL_BLOCK_SIZE - 1) / DLB_MD_EMUL_BLOCK_SIZE);
+
+        std::fill(samples.begin() + (size_t)frames * channels, samples.begin() + blocks * DLB_MD_EMUL_BLOCK_SIZE * channels, (DLB_LFRACT)0);
+        for (size_t b = 0; b < blocks; b++)
+        {
+            emul_conf.pa_in_data[0] = samples.data() + b * DLB_MD_EMUL_BLOCK_SIZE * channels;
+            md_emul_instance_process(emul, &emul_conf, 1);
+        }
+        if (output.writef(samples.data(), (sf_count_t)(blocks * DLB_MD_EMUL_BLOCK_SIZE)) != (sf_count_t)(blocks * DLB_MD_EMUL_BLOCK_SIZE))
+        {
+            throw std::runtime_error("Output File write failed: " + std::string(output.strError()));
+        }
+        total += blocks * DLB_MD_EMUL_BLOCK_SIZE;
+        report_progress(&progress, total);
+    }
+    return total;
+}
+
+static uint64_t run_shm_job(service *svc, const service_job &job, md_emul_instance *emul)
+{
+    dlb_md_emul_process_config_t emul_conf;
+    DLB_LFRACT                   block[DLB_MD_EMUL_MAX_CHANS * DLB_MD_EMUL_BLOCK_SIZE];
+    DLB_LFRACT                   secondary[DLB_MD_EMUL_MAX_CHANS * DLB_MD_EMUL_BLOCK_SIZE];
+    progress_reporter            progress = { job.conn.get(), job.id, std::chrono::steady_clock::now() };
+    size_t                       size = (size_t)job.frames * job.channels * sizeof(double);
+    struct stat                  st;
+    double                      *data;
+    void                        *map;
+    int                          fd;
+
+    if (job.channels <= 0 || job.channels > DLB_MD_EMUL_MAX_CHANS || job.frames == 0)
+    {
+        throw std::runtime_error("Invalid channels or frames");
+    }
+    svc->make_config(svc->context, job.flags, job.channels, &emul_conf);
+    emul_conf.pa_in_data[1] = secondary;
+
+    fd = shm_open(job.shm_name.c_str(), O_RDWR, 0);
+    if (fd < 0)
+    {
+        throw std::runtime_error("Shared memory not opened: " + job.shm_name);
+    }
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < size)
+    {
+        close(fd);
+        throw std::runtime_error("Shared memory smaller than channels * frames doubles");
+    }
+    map = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+    {
+        throw std::runtime_error("Shared memory not mapped: " + job.shm_name);
+    }
+    data = (double *)map;
+
+    emul_conf.pa_in_data[0] = block;
+    for (uint64_t first = 0; first < job.frames; first += DLB_MD_EMUL_BLOCK_SIZE)
+    {
+        size_t count = (size_t)std::min<uint64_t>(DLB_MD_EMUL_BLOCK_SIZE, job.frames - first) * job.channels;
+        double *src = data + first * job.channels;
+
+        for (size_t i = 0; i < count; i++)
+        {
+            block[i] = (DLB_LFRACT)src[i];
+        }
+        std::fill(block + count, block + (size_t)DLB_MD_EMUL_BLOCK_SIZE * job.channels, (DLB_LFRACT)0);
+
+        try
+        {
+            md_emul_instance_process(emul, &emul_conf, 1);
+        }
+        catch (...)
+        {
+            munmap(map, size);
+            throw;
+        }
+
+        for (size_t i = 0; i < count; i++)
+        {
+            src[i] = (double)block[i];
+        }
+        report_progress(&progress, first + count / job.channels);
+    }
+    munmap(map, size);
+    return job.frames;
+}
+
+static void service_worker(service *svc)
+{
+    md_emul_instance emul = {};
+
+    try
+    {
+        md_emul_instance_open(&emul);
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Service worker not started: " << e.what() << std::endl;
+        return;
+    }
+
+    for (;;)
+    {
+        service_job                           job;
+        std::chrono::steady_clock::time_point start;
+        double                                seconds;
+        std::string                           reply;
+
+        {
+            std::unique_lock<std::mutex> guard(svc->lock);
+
+            svc->ready.wait(guard, [svc] { return !svc->queue.empty() || svc->draining; });
+            if (svc->queue.empty())
+            {
+                break;
+            }
+            job = std::move(svc->queue.front());
+            svc->queue.pop_front();
+            svc->running++;
+        }
+
+        start = std::chrono::steady_clock::now();
+        try
+        {
+            int32_t  err = dlb_md_emul_reset(&emul.hdl);
+            uint64_t frames;
+
+            if (err)
+            {
+                throw std::runtime_error("Metadata Emulation Reset Returned Error: " + std::to_string(err));
+            }
+            frames = job.shm ? run_shm_job(svc, job, &emul) : run_file_job(svc, job, &emul);
+            seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            svc->jobs_done++;
+            svc->frames_done += frames;
+            reply = "DONE\t" + std::to_string(job.id) + "\t" + std::to_string(frames) + "\t" + std::to_string(seconds);
+        }
+        catch (const std::exception &e)
+        {
+            seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            svc->jobs_failed++;
+            reply = "ERROR\t" + std::to_string(job.id) + "\t" + e.what();
+        }
+
+        /* count the job as finished before the client can ask for STATS */
+        {
+            std::lock_guard<std::mutex> guard(svc->lock);
+
+            svc->running--;
+            svc->busy_seconds += seconds;
+        }
+        send_line(job.conn.get(), reply);
+        job.conn.reset();
+    }
+
+    md_emul_instance_close(&emul);
+}
+
+/*
+ * Requests
+ */
+
+static std::string stats_line(service *svc)
+{
+    std::ostringstream line;
+    double             audio_seconds = (double)svc->frames_done / SERVICE_SAMPLE_RATE;
+    double             uptime = std::chrono::duration<double>(std::chrono::steady_clock::now() - svc->start).count();
+    size_t             queued;
+    unsigned int       running;
+    double             busy;
+
+    {
+        std::lock_guard<std::mutex> guard(svc->lock);
+
+        queued = svc->queue.size();
+        running = svc->running;
+        busy = svc->busy_seconds;
+    }
+
+    line << "STATS"
+         << "\tjobs_done=" << svc->jobs_done
+         << "\tjobs_failed=" << svc->jobs_failed
+         << "\trunning=" << running
+         << "\tqueued=" << queued
+         << "\tworkers=" << svc->num_workers
+         << "\taudio_seconds=" << audio_seconds
+         << "\tbusy_seconds=" << busy
+         << "\trealtime_factor=" << (busy > 0.0 ? audio_seconds / busy : 0.0)
+         << "\tuptime=" << uptime;
+    return line.str();
+}
+
+static void handle_request(service *svc, const std::shared_ptr<service_connection> &conn, const std::string &line)
+{
+    std::vector<std::string> fields;
+    std::istringstream       split(line);
+    std::string              field;
+    service_job              job;
+
+    while (std::getline(split, field, '\t'))
+    {
+        fields.push_back(field);
+    }
+    if (fields.empty())
+    {
+        return;
+    }
+
+    if (fields[0] == "STATS")
+    {
+        send_line(conn.get(), stats_line(svc));
+        return;
+    }
+    if (fields[0] == "SHUTDOWN")
+    {
+        svc->shutdown = true;
+        send_line(conn.get(), "OK");
+        return;
+    }
+    if (fields[0] != "RUN" && fields[0] != "RUNSHM")
+    {
+        send_line(conn.get(), "ERROR\t0\tUnknown request: " + fields[0]);
+        return;
+    }
+
+    job.id = ++svc->next_id;
+    job.shm = (fields[0] == "RUNSHM");
+    job.channels = 0;
+    job.frames = 0;
+    job.conn = conn;
+    try
+    {
+        for (size_t i = 1; i < fields.size(); i++)
+        {
+            size_t      eq = fields[i].find('=');
+            std::string key = fields[i].substr(0, eq);
+            std::string value = (eq == std::string::npos) ? "" : fields[i].substr(eq + 1);
+
+            if (key == "input")         job.input = value;
+            else if (key == "output")   job.output = value;
+            else if (key == "flags")    job.flags = value;
+            else if (key == "shm")      job.shm_name = value;
+            else if (key == "channels") job.channels = std::stoi(value);
+            else if (key == "frames")   job.frames = std::stoull(value);
+            else throw std::runtime_error("Unknown field: " + key);
+        }
+        if (job.shm ? job.shm_name.empty() : (job.input.empty() || job.output.empty()))
+        {
+            throw std::runtime_error(job.shm ? "RUNSHM needs shm, channels and frames" : "RUN needs input and output");
+        }
+    }
+    catch (const std::exception &e)
+    {
+        svc->jobs_failed++;
+        send_line(conn.get(), "ERROR\t" + std::to_string(job.id) + "\t" + e.what());
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(svc->lock);
+
+        if (svc->draining)
+        {
+            send_line(conn.get(), "ERROR\t" + std::to_string(job.id) + "\tService is shutting down");
+            return;
+        }
+        send_line(conn.get(), "QUEUED\t" + std::to_string(job.id));
+        svc->queue.push_back(std::move(job));
+    }
+    svc->ready.notify_one();
+}
+
+static void client_thread(service *svc, service_client *client)
+{
+    std::string pending;
+    char        buf[1024];
+    ssize_t     n;
+
+    while ((n = recv(client->conn->fd, buf, sizeof(buf), 0)) > 0)
+    {
+        size_t nl;
+
+        pending.append(buf, (size_t)n);
+        while ((nl = pending.find('\n')) != std::string::npos)
+        {
+            std::string line = pending.substr(0, nl);
+
+            pending.erase(0, nl + 1);
+            if (!line.empty() && line.back() == '\r')
+            {
+                line.pop_back();
+            }
+            handle_request(svc, client->conn, line);
+        }
+        if (pending.size() > SERVICE_MAX_LINE)
+        {
+            send_line(client->conn.get(), "ERROR\t0\tRequest too long");
+            break;
+        }
+    }
+    /* the connection stays open until the client is reaped and its queued jobs have replied */
+    client->finished = true;
+}
+
+static int open_listen_socket(const std::string &path)
+{
+    struct sockaddr_un addr;
+    int                fd;
+
+    if (path.size() >= sizeof(addr.sun_path))
+    {
+        throw std::runtime_error("Socket path too long: " + path);
+    }
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    memcpy(addr.sun_path, path.c_str(), path.size());
+
+    /* replace a stale socket, but not a live service */
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd >= 0 && connect(fd, (struct sockaddr *)&addr, sizeof(addr)) == 0)
+    {
+        close(fd);
+        throw std::runtime_error("A service is already listening on " + path);
+    }
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+    unlink(path.c_str());
+
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || bind(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0 || listen(fd, 64) != 0)
+    {
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+        throw std::runtime_error("Cannot listen on " + path + ": " + strerror(errno));
+    }
+    return fd;
+}
+
+void run_service
+    (const service_options  &options
+    ,batch_config_fn         make_config
+    ,void                   *context
+    )
+{
+    service                    svc;
+    std::vector<std::thread>   workers;
+    std::list<service_client>  clients;
+    int                        listen_fd = open_listen_socket(options.socket_path);
+
+    svc.make_config = make_config;
+    svc.context = context;
+    svc.num_workers = options.num_workers ? options.num_workers : std::max(1u, std::thread::hardware_concurrency());
+    svc.draining = false;
+    svc.running = 0;
+    svc.busy_seconds = 0.0;
+    svc.shutdown = false;
+    svc.next_id = 0;
+    svc.jobs_done = 0;
+    svc.jobs_failed = 0;
+    svc.frames_done = 0;
+    svc.start = std::chrono::steady_clock::now();
+
+    signal(SIGINT, service_signal_handler);
+    signal(SIGTERM, service_signal_handler);
+    signal(SIGPIPE, SIG_IGN);
+
+    for (unsigned int w = 0; w < svc.num_workers; w++)
+    {
+        workers.emplace_back(service_worker, &svc);
+    }
+    std::cout << "Serving on " << options.socket_path << " with " << svc.num_workers << " emulators" << std::endl;
+
+    while (!svc.shutdown && !service_signalled)
+    {
+        struct pollfd pfd = { listen_fd, POLLIN, 0 };
+
+        /* reap clients that have disconnected */
+        for (std::list<service_client>::iterator it = clients.begin(); it != clients.end();)
+        {
+            if (it->finished)
+            {
+                it->thread.join();
+                it = clients.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        if (poll(&pfd, 1, SERVICE_POLL_MS) > 0 && (pfd.revents & POLLIN))
+        {
+            int fd = accept(listen_fd, nullptr, nullptr);
+
+            if (fd >= 0)
+            {
+                service_connection *conn = new service_connection;
+
+                conn->fd = fd;
+                conn->broken = false;
+                clients.emplace_back();
+                clients.back().conn = std::shared_ptr<service_connection>(conn, connection_close);
+                clients.back().finished = false;
+                clients.back().thread = std::thread(client_thread, &svc, &clients.back());
+            }
+        }
+    }
+
+    close(listen_fd);
+    unlink(options.socket_path.c_str());
+    std::cout << "Shutting down, finishing queued jobs" << std::endl;
+
+    /* finish everything queued, then stop reading from the clients */
+    {
+        std::lock_guard<std::mutex> guard(svc.lock);
+
+        svc.draining = true;
+    }
+    svc.ready.notify_all();
+    for (std::thread &worker : workers)
+    {
+        worker.join();
+    }
+    for (service_client &client : clients)
+    {
+        shutdown(client.conn->fd, SHUT_RDWR);
+    }
+    for (service_client &client : clients)
+    {
+        client.thread.join();
+    }
+    std::cout << stats_line(&svc) << std::endl;
+}
+
+#else
+
+void run_service
+    (const service_options  &options
+    ,batch_config_fn         make_config
+    ,void                   *context
+    )
+{
+    (void)options;
+    (void)make_config;
+    (void)context;
+    throw std::runtime_error("--serve needs UNIX domain sockets");
+}
+
+#endif
@@ -0,0 +1,76 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Local emulation service on a UNIX domain socket
+ *
+ * Requests and replies are single tab separated lines:
+ *
+ *   RUN     input=PATH  output=PATH  [flags=OPTIONS]
+ *   RUNSHM  shm=NAME  channels=N  frames=N  [flags=OPTIONS]
+ *   STATS
+ *   SHUTDOWN
+ *
+ * RUN and RUNSHM answer "QUEUED id", then "PROGRESS id frames" while the job
+ * runs and "DONE id frames seconds" or "ERROR id message" at the end. A
+ * RUNSHM job processes POSIX shared memory holding interleaved doubles in
+ * place. A connection may have several jobs in flight; replies carry the
+ * job id. STATS answers with one "STATS key=value ..." line.
+ */
+
+#ifndef EMUL_SERVICE_H
+#define EMUL_SERVICE_H
+
+#include <string>
+
+#include "batch_runner.h"
+
+typedef struct
+{
+    std::string     socket_path;
+    unsigned int    num_workers;        /**< emulators kept open, 0 uses one per core */
+} service_options;
+
+/*
+ * Serve until SHUTDOWN, SIGINT or SIGTERM. make_config turns the flags of a
+ * request into a process configuration as for batch jobs. Throws on error.
+ */
+void run_service
+    (const service_options  &options
+    ,batch_config_fn         make_config
+    ,void                   *context
+    );
+
+#endif /* EMUL_SERVICE_H */
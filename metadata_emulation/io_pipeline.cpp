@@ -0,0 +1,273 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Threaded reader / emulator / writer pipeline for the command line application
+ *
+ *
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "io_pipeline.h"
+#include "md_emul_instance.h"
+
+typedef struct
+{
+    std::vector<DLB_LFRACT> samples;
+    uint64_t                first_block;
+    sf_count_t              frames;         /**< frames of input in this chunk */
+    uint32_t                blocks;         /**< blocks to process and write, the last one may be padded */
+} io_chunk;
+
+/* Bounded by construction: it never holds more than the chunks allocated up front */
+typedef struct
+{
+    std::mutex              lock;
+    std::condition_variable ready;
+    std::deque<io_chunk *>  items;
+    bool                    closed;
+} chunk_queue;
+
+static void chunk_queue_push(chunk_queue *q, io_chunk *chunk)
+{
+    {
+        std::lock_guard<std::mutex> guard(q->lock);
+        q->items.push_back(chunk);
+    }
+    q->ready.notify_one();
+}
+
+/* Returns nullptr once the queue is closed and empty */
+static io_chunk *chunk_queue_pop(chunk_queue *q)
+{
+    std::unique_lock<std::mutex> guard(q->lock);
+    io_chunk                    *chunk;
+
+    q->ready.wait(guard, [q] { return !q->items.empty() || q->closed; });
+    if (q->items.empty())
+    {
+        return nullptr;
+    }
+    chunk = q->items.front();
+    q->items.pop_front();
+    return chunk;
+}
+
+static void chunk_queue_close(chunk_queue *q)
+{
+    {
+        std::lock_guard<std::mutex> guard(q->lock);
+        q->closed = true;
+    }
+    q->ready.notify_all();
+}
+
+typedef struct
+{
+    SndfileHandle          *input;
+    SndfileHandle          *output;
+    int                     channels;
+    uint32_t                chunk_blocks;
+    double                  progress_interval;
+
+    chunk_queue             free_chunks;
+    chunk_queue             read_chunks;
+    chunk_queue             processed_chunks;
+
+    std::mutex              error_lock;
+    std::exception_ptr      error;
+
+    uint64_t                frames_written;
+} io_pipeline;
+
+/* Record the first error and unblock every stage */
+static void io_pipeline_abort(io_pipeline *p, std::exception_ptr error)
+{
+    {
+        std::lock_guard<std::mutex> guard(p->error_lock);
+        if (!p->error)
+        {
+            p->error = error;
+        }
+    }
+    chunk_queue_close(&p->free_chunks);
+    chunk_queue_close(&p->read_chunks);
+    chunk_queue_close(&p->processed_chunks);
+}
+
+static void reader_thread(io_pipeline *p)
+{
+    const sf_count_t chunk_frames = (sf_count_t)p->chunk_blocks * DLB_MD_EMUL_BLOCK_SIZE;
+    uint64_t         next_block = 0;
+    io_chunk        *chunk;
+
+    try
+    {
+        while ((chunk = chunk_queue_pop(&p->free_chunks)) != nullptr)
+        {
+            chunk->frames = p->input->readf(chunk->samples.data(), chunk_frames);
+            if (chunk->frames <= 0)
+            {
+                break;
+            }
+            chunk->first_block = next_block;
+            chunk->blocks = (uint32_t)((chunk->frames + DLB_MD_EMUL_BLOCK_SIZE - 1) / DLB_MD_EMUL_BLOCK_SIZE);
+            if (chunk->frames < (sf_count_t)chunk->blocks * DLB_MD_EMUL_BLOCK_SIZE)
+            {
+                memset(chunk->samples.data() + chunk->frames * p->channels, 0,
+                       (size_t)((sf_count_t)chunk->blocks * DLB_MD_EMUL_BLOCK_SIZE - chunk->frames) * p->channels * sizeof(DLB_LFRACT));
+            }
+            next_block += chunk->blocks;
+            chunk_queue_push(&p->read_chunks, chunk);
+        }
+        chunk_queue_close(&p->read_chunks);
+    }
+    catch (...)
+    {
+        io_pipeline_abort(p, std::current_exception());
+    }
+}
+
+static void writer_thread(io_pipeline *p)
+{
+    std::chrono::steady_clock::time_point last_report = std::chrono::steady_clock::now();
+    io_chunk                             *chunk;
+
+    try
+    {
+        while ((chunk = chunk_queue_pop(&p->processed_chunks)) != nullptr)
+        {
+            sf_count_t frames = (sf_count_t)chunk->blocks * DLB_MD_EMUL_BLOCK_SIZE;
+
+            if (p->output->writef(chunk->samples.data(), frames) != frames)
+            {
+                throw std::runtime_error("Output File write failed: " + std::string(p->output->strError()));
+            }
+            p->frames_written += frames;
+            chunk_queue_push(&p->free_chunks, chunk);
+
+            if (p->progress_interval > 0.0)
+            {
+                std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+                if (std::chrono::duration<double>(now - last_report).count() >= p->progress_interval)
+                {
+                    std::cout << "\rWrote: " << p->frames_written << " frames" << std::flush;
+                    last_report = now;
+                }
+            }
+        }
+    }
+    catch (...)
+    {
+        io_pipeline_abort(p, std::current_exception());
+    }
+}
+
+uint64_t run_io_pipeline
+    (SndfileHandle              &input
+    ,SndfileHandle              &output
+    ,const io_pipeline_options  &options
+    ,io_pipeline_block_fn        process_block
+    ,void                       *context
+    )
+{
+    io_pipeline             p;
+    std::vector<io_chunk>   chunks(options.num_chunks < 3 ? 3 : options.num_chunks);
+    std::thread             reader, writer;
+    io_chunk               *chunk;
+
+    p.input = &input;
+    p.output = &output;
+    p.channels = input.channels();
+    p.chunk_blocks = options.chunk_blocks ? options.chunk_blocks : 1;
+    p.progress_interval = options.progress_interval;
+    p.free_chunks.closed = false;
+    p.read_chunks.closed = false;
+    p.processed_chunks.closed = false;
+    p.frames_written = 0;
+
+    for (io_chunk &c : chunks)
+    {
+        c.samples.resize(md_emul_block_buffer_size(p.chunk_blocks, p.channels));
+        p.free_chunks.items.push_back(&c);
+    }
+
+    reader = std::thread(reader_thread, &p);
+    writer = std::thread(writer_thread, &p);
+
+    try
+    {
+        while ((chunk = chunk_queue_pop(&p.read_chunks)) != nullptr)
+        {
+            for (uint32_t b = 0; b < chunk->blocks; b++)
+            {
+                process_block(context, chunk->samples.data() + (size_t)b * DLB_MD_EMUL_BLOCK_SIZE * p.channels,
+                              chunk->first_block + b);
+            }
+            chunk_queue_push(&p.processed_chunks, chunk);
+        }
+        chunk_queue_close(&p.processed_chunks);
+    }
+    catch (...)
+    {
+        io_pipeline_abort(&p, std::current_exception());
+    }
+
+    writer.join();
+    /* the reader may still be waiting for a chunk the writer has no reason to return */
+    chunk_queue_close(&p.free_chunks);
+    reader.join();
+
+    if (p.error)
+    {
+        std::rethrow_exception(p.error);
+    }
+    if (p.progress_interval > 0.0)
+    {
+        std::cout << "\rWrote: " << p.frames_written << " frames" << std::flush;
+    }
+    return p.frames_written;
+}
@@ -0,0 +1,83 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Threaded reader / emulator / writer pipeline for the command line application
+ *
+ * The reader thread reads large chunks of frames, the calling thread runs
+ * the emulator over each chunk block by block, and the writer thread writes
+ * the processed chunk. Chunks travel between the stages through bounded
+ * queues and are reused, so no memory is allocated once the pipeline runs.
+ */
+
+#ifndef IO_PIPELINE_H
+#define IO_PIPELINE_H
+
+#include <sndfile.hh>
+
+#include "dlb_md_emul_api.h"
+
+typedef struct
+{
+    uint32_t    chunk_blocks;           /**< blocks per read and write */
+    uint32_t    num_chunks;             /**< chunks in flight, at least 3 keeps all stages busy */
+    double      progress_interval;      /**< seconds between progress lines, 0 disables them */
+} io_pipeline_options;
+
+/*
+ * Called on the emulator thread for every block. block holds
+ * DLB_MD_EMUL_BLOCK_SIZE interleaved frames and is processed in place.
+ * May throw, which stops the pipeline.
+ */
+typedef void (*io_pipeline_block_fn)
+    (void               *context
+    ,DLB_LFRACT         *block
+    ,uint64_t            block_index
+    );
+
+/*
+ * Run input through process_block into output, returns the frames written.
+ * A final partial block is padded with silence and written in full, so the
+ * output is always a whole number of blocks. Throws on error.
+ */
+uint64_t run_io_pipeline
+    (SndfileHandle              &input
+    ,SndfileHandle              &output
+    ,const io_pipeline_options  &options
+    ,io_pipeline_block_fn        process_block
+    ,void                       *context
+    );
+
+#endif /* IO_PIPELINE_H */
@@ -0,0 +1,164 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Emulator instance owned by the command line application
+ *
+ *
+ */
+
+#include <stdexcept>
+#include <string>
+
+#include "md_emul_instance.h"
+
+void md_emul_instance_open(md_emul_instance *inst)
+{
+    dlb_md_emul_size_t dlb_md_emul_size;
+    int32_t            err;
+
+    err = dlb_md_emul_query_mem(&dlb_md_emul_size);
+    if (err)
+    {
+        throw std::runtime_error("Failed to query memory");
+    }
+
+    inst->static_mem  = new char[  dlb_md_emul_size.emul_static_mem_size
+                                 + dlb_md_emul_size.compr_static_mem_size
+                                 + dlb_md_emul_size.compr_ext_static_mem_size];
+
+    inst->dynamic_mem = new char[  dlb_md_emul_size.emul_dynamic_mem_size
+                                 + dlb_md_emul_size.compr_dynamic_mem_size];
+
+    err = dlb_md_emul_open(&dlb_md_emul_size, &inst->hdl, inst->static_mem, inst->dynamic_mem);
+    if (err)
+    {
+        md_emul_instance_close(inst);
+        throw std::runtime_error("Metadata Emulation Open Returned Error: " + std::to_string(err));
+    }
+}
+
+void md_emul_instance_close(md_emul_instance *inst)
+{
+    if (inst->static_mem)
+    {
+        dlb_md_emul_close(&inst->hdl);
+    }
+    delete[] inst->static_mem;
+    delete[] inst->dynamic_mem;
+    inst->static_mem = nullptr;
+    inst->dynamic_mem = nullptr;
+}
+
+void md_emul_instance_process
+    (md_emul_instance               *inst
+    ,dlb_md_emul_process_config_t   *emul_conf
+    ,uint32_t                        num_outputs
+    )
+{
+    int32_t err = dlb_md_emul_process(&inst->hdl, emul_conf, num_outputs);
+
+    if (err)
+    {
+        throw std::runtime_error("Metadata Emulation Process Returned Error: " + std::to_string(err));
+    }
+}
+
+void md_emul_instance_print_stats(md_emul_instance *inst, FILE *out)
+{
+    static const double     edges[] = DLB_MD_EMUL_STATS_GR_EDGES_DB;
+    static const char      *stages[DLB_MD_EMUL_NUM_STAGES] = { "encoder", "drc_calc", "drc_apply" };
+    dlb_md_emul_stats_t     stats;
+    uint64_t                total_ns = 0;
+    int                     i, output;
+
+    if (dlb_md_emul_get_stats(&inst->hdl, &stats, 0))
+    {
+        fprintf(out, "Runtime statistics not available (library built without them)\n");
+        return;
+    }
+
+    fprintf(out, "Blocks processed      %llu\n", (unsigned long long)stats.blocks_processed);
+    fprintf(out, "Compressor re-opens   %u\n", stats.compr_reopens);
+    fprintf(out, "DRC clip protection   %llu updates  %llu attacks  %llu holds  gain min %.2f dB  mean %.2f dB\n",
+            (unsigned long long)stats.dlim_updates, (unsigned long long)stats.dlim_attacks,
+            (unsigned long long)stats.dlim_holds, stats.dlim_gain_min_db, stats.dlim_gain_mean_db);
+    fprintf(out, "compr clip protection %llu updates  %llu attacks  %llu holds  gain min %.2f dB  mean %.2f dB\n",
+            (unsigned long long)stats.clim_updates, (unsigned long long)stats.clim_attacks,
+            (unsigned long long)stats.clim_holds, stats.clim_gain_min_db, stats.clim_gain_mean_db);
+
+    fprintf(out, "Gain reduction (dB)  ");
+    for (i = 0; i < DLB_MD_EMUL_STATS_GR_BINS; i++)
+    {
+        char label[16];
+
+        if (i < DLB_MD_EMUL_STATS_GR_BINS - 1)
+        {
+            snprintf(label, sizeof(label), "<%g", edges[i]);
+        }
+        else
+        {
+            snprintf(label, sizeof(label), ">=%g", edges[i - 1]);
+        }
+        fprintf(out, " %10s", label);
+    }
+    fprintf(out, "\n");
+    for (output = 0; output < DLB_MD_EMUL_MAX_OUTPUTS; output++)
+    {
+        fprintf(out, "  output %d           ", output);
+        for (i = 0; i < DLB_MD_EMUL_STATS_GR_BINS; i++)
+        {
+            fprintf(out, " %10llu", (unsigned long long)stats.gain_reduction_hist[output][i]);
+        }
+        fprintf(out, "\n");
+    }
+
+    for (i = 0; i < DLB_MD_EMUL_NUM_STAGES; i++)
+    {
+        total_ns += stats.stage_time_ns[i];
+    }
+    for (i = 0; i < DLB_MD_EMUL_NUM_STAGES; i++)
+    {
+        fprintf(out, "Stage %-10s      %10.3f ms  %5.1f%%\n", stages[i], stats.stage_time_ns[i] / 1e6,
+                total_ns ? 100.0 * stats.stage_time_ns[i] / total_ns : 0.0);
+    }
+}
+
+size_t md_emul_block_buffer_size(size_t blocks, int channels)
+{
+    size_t last = (size_t)DLB_MD_EMUL_BLOCK_SIZE * (channels > DLB_MD_EMUL_MAX_CHANS ? channels : DLB_MD_EMUL_MAX_CHANS);
+
+    return blocks ? (blocks - 1) * DLB_MD_EMUL_BLOCK_SIZE * channels + last : 0;
+}
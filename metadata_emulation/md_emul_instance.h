@@ -0,0 +1,79 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Emulator instance owned by the command line application
+ *
+ *
+ */
+
+#ifndef MD_EMUL_INSTANCE_H
+#define MD_EMUL_INSTANCE_H
+
+#include <stdio.h>
+
+#include "dlb_md_emul_api.h"
+
+typedef struct
+{
+    dlb_md_emul_hdl_t      hdl;
+    char                  *static_mem;
+    char                  *dynamic_mem;
+} md_emul_instance;
+
+/* Allocate the memory for one emulator and open it, throws on failure */
+void md_emul_instance_open(md_emul_instance *inst);
+
+void md_emul_instance_close(md_emul_instance *inst);
+
+/* Process one block, throws on failure */
+void md_emul_instance_process
+    (md_emul_instance               *inst
+    ,dlb_md_emul_process_config_t   *emul_conf
+    ,uint32_t                        num_outputs
+    );
+
+/* Print the runtime statistics of the instance (dlb_md_emul_get_stats) */
+void md_emul_instance_print_stats(md_emul_instance *inst, FILE *out);
+
+/*
+ * Samples to allocate for consecutive blocks of interleaved frames. The
+ * emulator addresses DLB_MD_EMUL_MAX_CHANS channel slots of every frame
+ * whatever the file holds, so the last block keeps room for a full
+ * DLB_MD_EMUL_MAX_CHANS * DLB_MD_EMUL_BLOCK_SIZE buffer.
+ */
+size_t md_emul_block_buffer_size(size_t blocks, int channels);
+
+#endif /* MD_EMUL_INSTANCE_H */
@@ -41,14 +41,33 @@
 
 #include <vector>
 #include <iostream>
+#include <cstring>
+#include <sstream>
 
 #include <sndfile.hh>
 #include "dlb_md_emul_api.h"
+#include "md_emul_instance.h"
+#include "segment_parallel.h"
+#include "checkpoint_index.h"
+#include "io_pipeline.h"
+#include "wav_mmap.h"
+#include "pipe_io.h"
+#include "batch_runner.h"
+#include "emul_service.h"
+#include "pwr_res.h"
+#include "meter_shm.h"
+#include "trace_writer.h"
 
 
 #define    SAMPLES_PER_BLOCK = (DLB_MD_EMUL_BLOCK_SIZE / 2)
 #define    AGG_ACMOD_71 21
 
+#define    IO_CHUNK_BLOCKS      1024    /* 262144 frames per read and write */
+#define    IO_CHUNKS            4
+#define    IO_STREAM_CHUNK_BLOCKS   16  /* keeps the latency of piped input low */
+#define    PROGRESS_INTERVAL    0.5     /* seconds */
+#define    BATCH_GROUP_JOBS     8
+
 #define    MAJOR_VERSION 1
 #define    MINOR_VERSION 0
 #define    FUNC_VERSION 0
@@ -96,10 +115,7 @@ typedef struct
     DLB_LFRACT             custom_boost[2];
     DLB_LFRACT             custom_cut[2];
 
-    dlb_md_emul_hdl_t      emul_hdl;
-
-    void                   *emul_static_mem;
-    void                   *emul_dynamic_mem;
+    md_emul_instance       emul;
 
     uint16_t                 prog_remap_enable;
     DLB_MD_EMUL_CHANNEL_MODE channel_mode;
@@ -111,6 +127,25 @@ typedef struct
 
 } metadata_emulation_state;
 
+typedef struct
+{
+    segment_options     segments;
+    std::string         checkpoint_file;        /**< Empty selects <infile>.mdckpt */
+    double              checkpoint_interval;    /**< Seconds between checkpoints, 0 writes no index */
+    bool                range;
+    double              range_start;            /**< Seconds */
+    double              range_end;              /**< Seconds, negative renders to the end */
+    bool                no_mmap;                /**< Always read and write through libsndfile */
+    pipe_format         pipe;                   /**< Format of stdin / stdout streams */
+    std::string         batch_manifest;         /**< Run the jobs of this manifest instead of one file */
+    batch_options       batch;
+    std::string         serve_socket;           /**< Serve jobs on this UNIX socket */
+    std::string         pwr_res_stem;           /**< Write the output power curves to <stem>.<channel>.res */
+    bool                stats;                  /**< Print the runtime statistics of the emulator at the end */
+    std::string         meter_name;             /**< Publish every block to this shared memory meter */
+    std::string         trace_file;             /**< Write the DRC trace of every block to this file */
+} long_options;
+
 #define MAX_PROG_CFG    26
 #define MAX_PROGRAMS    8
 
@@ -173,6 +208,28 @@ static std::string program_config_str[MAX_PROG_CFG] = {
    ,  " Other "};
 
 
+/* Emulator stage of the I/O pipeline */
+typedef struct
+{
+    md_emul_instance               *emul;
+    dlb_md_emul_process_config_t   *emul_conf;
+    uint32_t                        num_outputs;
+    checkpoint_writer              *ckpt_writer;
+    pwr_res_writer                 *pwr_writer;
+} emulation_stage;
+
+static void process_block(void *context, DLB_LFRACT *block, uint64_t block_index)
+{
+    emulation_stage *stage = (emulation_stage *)context;
+
+    checkpoint_writer_update(stage->ckpt_writer, &stage->emul->hdl, block_index, block);
+
+    stage->emul_conf->pa_in_data[0] = block;
+    md_emul_instance_process(stage->emul, stage->emul_conf, stage->num_outputs);
+
+    pwr_res_writer_update(stage->pwr_writer, block);
+}
+
 static std::string compression_mode_string[DLB_MD_EMUL_CM_RF + 1];
 
 static void populate_debug_strings(void)
@@ -377,6 +434,307 @@ setup_emulation_params
     emul_conf->use_bitstream_gainwords[1] = 0u;
 }
 
+/* Complete process configuration for a file, only the buffer pointers are left to the caller */
+static
+void
+prepare_process_config
+    (metadata_emulation_state       *md_emul    /**< [in]  State */
+    ,int                             channels   /**< [in]  Interleaved channels in the file */
+    ,dlb_md_emul_process_config_t   *emul_conf  /**< [out] Emulation configuration */
+    )
+{
+    memset(emul_conf, 0, sizeof(*emul_conf));
+
+    limit_channel_mode(md_emul, emul_conf);
+
+    /* Save channel mode for prepare_output() */
+    md_emul->channel_mode = emul_conf->channel_mode;
+
+    emul_conf->lfe_on = md_emul->lfeon;
+
+    init_channel_map(emul_conf);
+
+    /* Set audio metadata */
+    emul_conf->sample_offset = channels;
+    emul_conf->num_samples = DLB_MD_EMUL_BLOCK_SIZE;
+    emul_conf->sample_rate = 48000u;
+
+    setup_emulation_params(md_emul, emul_conf);
+}
+
+static void show_usage(void);
+
+static
+void
+set_default_state
+    (metadata_emulation_state       *md_emul    /**< [out] State */
+    )
+{
+    memset(md_emul, 0, sizeof(*md_emul));
+
+    /* default values  as per ddpe / ddcd */
+    md_emul->program_config = 0; //5.1 + 2
+    md_emul->program_select = 0; //5.1
+    md_emul->params.compression_mode_main = DLB_MD_EMUL_CM_LINE; // Line Mode
+    md_emul->acmod = 7;
+    md_emul->dialnorm = 27;
+    md_emul->lfeon = 1;
+    md_emul->compre = 0;
+    md_emul->compr = 0;
+    md_emul->dynrnge = 0;
+    md_emul->dynrng = 0;
+    md_emul->sur90on = 0;
+    md_emul->suratton = 0;
+    md_emul->hpfon = 0;
+    md_emul->bwlpfon = 0;
+    md_emul->lfelpfon = 1;
+}
+
+/* Single dash options, arg is the option as given on the command line */
+static
+void
+parse_short_option
+    (std::string                     arg        /**< [in]  Option */
+    ,metadata_emulation_state       *md_emul    /**< [out] State */
+    )
+{
+    char c;
+
+    arg.erase(0, arg.find_first_not_of("-"));
+    c = arg[0];
+    arg.erase(arg.begin());
+    switch(c)
+    {
+    case 'a':
+        md_emul->acmod = std::stoi(arg);
+        break;
+    case 'd':
+        if (arg[0] == 'n')
+        {
+            arg.erase(arg.begin());
+            md_emul->dialnorm = std::stoi(arg);                    
+        }
+        break;
+    case 'c':
+        switch(std::stoi(arg))
+        {
+        case 0: 
+            md_emul->params.compression_mode_main = DLB_MD_EMUL_CM_NONE;
+            break;
+        case 1:
+            md_emul->params.compression_mode_main = DLB_MD_EMUL_CM_CUSTOM;
+            break;
+        case 2:
+            md_emul->params.compression_mode_main = DLB_MD_EMUL_CM_LINE;
+            break;
+        case 3:
+            md_emul->params.compression_mode_main = DLB_MD_EMUL_CM_RF;
+            break;
+        default:
+            throw std::runtime_error("Invalid compression mode");
+        }
+
+    case 'g':
+        md_emul->lfelpfon = std::stoi(arg);
+        break;
+    case 'h':
+        show_usage();
+        exit(0);
+    case 'j':
+        md_emul->hpfon = std::stoi(arg);
+        break;
+    case 'k':
+        c = arg[0];
+        arg.erase(arg.begin());
+        switch (c)
+        {
+        case 'c':
+            md_emul->compr = std::stoi(arg);
+            break;
+        case 'd':
+            md_emul->dynrng = std::stoi(arg);
+            break;
+        default:
+            md_emul->compr = md_emul->dynrng = c - '0';
+        }
+        break;
+    case 'l':
+        md_emul->bwlpfon = std::stoi(arg);
+        break;
+    case '9':
+        md_emul->sur90on = std::stoi(arg);
+        break;
+    case '$':
+        md_emul->suratton = std::stoi(arg);
+        break;
+    case 'p':
+        md_emul->program_config = std::stoi(arg);
+        break;
+    case 's':
+        md_emul->program_select = std::stoi(arg);
+        break;
+    }
+}
+
+/* Options of the form --name=value */
+static
+void
+parse_long_option
+    (const std::string  &arg        /**< [in]  Option without the leading dashes */
+    ,long_options       *opts       /**< [out] Long options */
+    )
+{
+    size_t      eq = arg.find('=');
+    std::string name = arg.substr(0, eq);
+    std::string value = (eq == std::string::npos) ? "" : arg.substr(eq + 1);
+
+    if (name == "segments")
+    {
+        opts->segments.num_segments = std::stoi(value);
+    }
+    else if (name == "preroll")
+    {
+        opts->segments.preroll_seconds = std::stod(value);
+        if (opts->segments.preroll_seconds < 0.0)
+        {
+            throw std::runtime_error("Pre-roll must not be negative");
+        }
+    }
+    else if (name == "seam-report")
+    {
+        opts->segments.seam_report = true;
+    }
+    else if (name == "checkpoint-interval")
+    {
+        opts->checkpoint_interval = std::stod(value);
+        if (opts->checkpoint_interval <= 0.0)
+        {
+            throw std::runtime_error("Checkpoint interval must be positive");
+        }
+    }
+    else if (name == "checkpoints")
+    {
+        opts->checkpoint_file = value;
+    }
+    else if (name == "range")
+    {
+        size_t colon = value.find(':');
+
+        opts->range = true;
+        opts->range_start = std::stod(value.substr(0, colon));
+        opts->range_end = -1.0;
+        if (colon != std::string::npos && colon + 1 < value.size())
+        {
+            opts->range_end = std::stod(value.substr(colon + 1));
+        }
+        if (opts->range_start < 0.0 || (opts->range_end >= 0.0 && opts->range_end <= opts->range_start))
+        {
+            throw std::runtime_error("Invalid range: " + value);
+        }
+    }
+    else if (name == "channels")
+    {
+        opts->pipe.channels = std::stoi(value);
+        if (opts->pipe.channels <= 0 || opts->pipe.channels > DLB_MD_EMUL_MAX_CHANS)
+        {
+            throw std::runtime_error("Invalid channel count: " + value);
+        }
+    }
+    else if (name == "rate")
+    {
+        opts->pipe.sample_rate = std::stoi(value);
+    }
+    else if (name == "format")
+    {
+        if (!pipe_format_parse_subtype(value, &opts->pipe.subtype))
+        {
+            throw std::runtime_error("Unknown sample format: " + value);
+        }
+        opts->pipe.raw = true;
+    }
+    else if (name == "batch")
+    {
+        opts->batch_manifest = value;
+    }
+    else if (name == "serve")
+    {
+        opts->serve_socket = value.empty() ? "/tmp/mdemu.sock" : value;
+    }
+    else if (name == "jobs")
+    {
+        opts->batch.num_workers = std::stoi(value);
+    }
+    else if (name == "group-size")
+    {
+        opts->batch.max_group_jobs = std::stoi(value);
+        if (opts->batch.max_group_jobs == 0)
+        {
+            throw std::runtime_error("Group size must be at least 1");
+        }
+    }
+    else if (name == "pwr-res")
+    {
+        if (value.empty())
+        {
+            throw std::runtime_error("--pwr-res needs a file name stem");
+        }
+        opts->pwr_res_stem = value;
+    }
+    else if (name == "no-mmap")
+    {
+        opts->no_mmap = true;
+    }
+    else if (name == "stats")
+    {
+        opts->stats = true;
+    }
+    else if (name == "meter")
+    {
+        opts->meter_name = value.empty() ? "/mdemu_meter" : value;
+        if (opts->meter_name[0] != '/')
+        {
+            opts->meter_name = "/" + opts->meter_name;
+        }
+    }
+    else if (name == "trace")
+    {
+        if (value.empty())
+        {
+            throw std::runtime_error("--trace needs a file name");
+        }
+        opts->trace_file = value;
+    }
+    else
+    {
+        throw std::runtime_error("Unknown option: --" + name);
+    }
+}
+
+/* Configuration of one batch job: the command line state with the job's flags applied */
+static
+void
+batch_job_config
+    (void                           *context    /**< [in]  Command line state */
+    ,const std::string              &flags      /**< [in]  Short options of the job */
+    ,int                             channels   /**< [in]  Interleaved channels in the input */
+    ,dlb_md_emul_process_config_t   *emul_conf  /**< [out] Emulation configuration */
+    )
+{
+    metadata_emulation_state md_emul = *(const metadata_emulation_state *)context;
+    std::istringstream       words(flags);
+    std::string              word;
+
+    while (words >> word)
+    {
+        if (word.size() < 2 || word[0] != '-' || word[1] == '-' || word[1] == 'h')
+        {
+            throw std::runtime_error("Unsupported job flag: " + word);
+        }
+        parse_short_option(word, &md_emul);
+    }
+    prepare_process_config(&md_emul, channels, emul_conf);
+}
+
 static void show_usage(void)
 {
     std::cout << "Dolby AC-3 & EC-3 Metadata Emulation, Version " << MAJOR_VERSION << "." << MINOR_VERSION << "." << FUNC_VERSION << std::endl;
@@ -429,7 +787,34 @@ static void show_usage(void)
 "                15 = 2+2+1+1        16 = 2+1+1+1+1        17 = 1+1+1+1+1+1" << std::endl <<
 "                18 = 4              19 = 2+2  20 = 2+1+1  21 = 1+1+1+1" << std::endl <<
 "                22 = 7.1            23 = 7.1 Screen" << std::endl <<
-"        -s      Program selection (0..7) [-s0 = first program]" << std::endl;
+"        -s      Program selection (0..7) [-s0 = first program]" << std::endl <<
+"        --segments=N   Process the file in N parallel segments [--segments=1]" << std::endl <<
+"        --preroll=S    Seconds of warm-up before each segment [--preroll=10]" << std::endl <<
+"        --seam-report  Compare the segment seams against a sequential run" << std::endl <<
+"        --checkpoint-interval=S  Save the emulator state every S seconds to the checkpoint index" << std::endl <<
+"        --checkpoints=PATH       Checkpoint index file [infile.mdckpt]" << std::endl <<
+"        --range=T0:T1  Render only seconds T0 to T1 (T1 omitted = end of file)," << std::endl <<
+"                       starting from the checkpoint index if it matches," << std::endl <<
+"                       otherwise --preroll seconds early" << std::endl <<
+"        --no-mmap      Read and write through libsndfile even for PCM WAV, RF64 and W64 files" << std::endl <<
+"        -              As infile or outfile streams from stdin or to stdout (WAV of unknown length)" << std::endl <<
+"        --format=F     Headerless stdin / stdout samples: s16, s24, s32, f32 or f64" << std::endl <<
+"        --channels=N   Channels of headerless input" << std::endl <<
+"        --rate=R       Sample rate of headerless input [--rate=48000]" << std::endl <<
+"        --batch=FILE   Run the input,output,flags jobs of a CSV or JSON manifest; options" << std::endl <<
+"                       given on the command line are the defaults for every job" << std::endl <<
+"        --jobs=N       Batch worker threads or service emulators [one per core]" << std::endl <<
+"        --group-size=N Batch jobs sharing one decode of an input [--group-size=8]" << std::endl <<
+"        --serve[=PATH] Serve jobs on a UNIX socket with warm emulators [/tmp/mdemu.sock]," << std::endl <<
+"                       see tools/src/mdemu_client.c" << std::endl <<
+"        --pwr-res=STEM Write the power versus time of each output channel to STEM.<channel>.res," << std::endl <<
+"                       as SATS pwr_vs_time -s does" << std::endl <<
+"        --stats        Print the runtime statistics of the emulator (clip protection, gain" << std::endl <<
+"                       reduction, stage times) at the end" << std::endl <<
+"        --meter[=NAME] Publish the peaks, levels and gains of every block to the shared memory" << std::endl <<
+"                       meter NAME [/mdemu_meter], see tools/src/mdemu_meter.c" << std::endl <<
+"        --trace=FILE   Write the levels, gain computer states, gains and codes of every block" << std::endl <<
+"                       to FILE, see tools/src/mdemu_trace2csv.c" << std::endl;
 
 }
 
@@ -437,124 +822,42 @@ int main(int argc, char *argv[])
 {
 	std::vector<std::string>              args(argv + 1, argv + argc);
 	metadata_emulation_state	md_emul;
-	dlb_md_emul_size_t          dlb_md_emul_size;
-    int32_t                     err;
-    size_t                      static_memory_sz;
-    size_t                      dynamic_memory_sz;
-    char                        *static_memory;
-    char						*dynamic_memory;
     dlb_md_emul_process_config_t emul_conf;
+    long_options                opts = { { 1, 10.0, false }, "", 0.0, false, 0.0, -1.0, false, { false, 0, 48000, SF_FORMAT_PCM_16 }, "", { 0, BATCH_GROUP_JOBS }, "", "", false, "", "" };
+    checkpoint_writer           ckpt_writer = { nullptr, 0, {} };
+    pwr_res_writer              pwr_writer = {};
+    meter_shm                   meter = {};
+    trace_writer                tracer = {};
+    emulation_stage             stage;
+    io_pipeline_options         io_opts = { IO_CHUNK_BLOCKS, IO_CHUNKS, PROGRESS_INTERVAL };
+    wav_mmap_reader             mapped_input;
+    wav_mmap_writer             mapped_output;
+    std::string                 mmap_reason;
+    bool                        input_is_pipe;
+    bool                        output_is_pipe;
     std::string					input_wav_file_str;
     std::string					output_wav_file_str;
     SndfileHandle               input_wav_file;
     SndfileHandle               output_wav_file;
     sf_count_t                  input_file_size;
-    sf_count_t                  input_frames_read;
-    DLB_LFRACT                  primary_io_samples[DLB_MD_EMUL_MAX_CHANS * DLB_MD_EMUL_BLOCK_SIZE];
     DLB_LFRACT                  secondary_op_samples[DLB_MD_EMUL_MAX_CHANS * DLB_MD_EMUL_BLOCK_SIZE];
-    DLB_LFRACT                  *input_data[DLB_MD_EMUL_MAX_OUTPUTS];
 
     input_wav_file_str.clear();
     output_wav_file_str.clear();
 
     populate_debug_strings();
 
-    /* default values  as per ddpe / ddcd */
-    md_emul.program_config = 0; //5.1 + 2
-    md_emul.program_select = 0; //5.1
-    md_emul.params.compression_mode_main = DLB_MD_EMUL_CM_LINE; // Line Mode
-    md_emul.acmod = 7;
-    md_emul.dialnorm = 27;
-    md_emul.lfeon = 1;
-    md_emul.compre = 0;
-    md_emul.compr = 0;
-    md_emul.dynrnge = 0;
-    md_emul.dynrng = 0;
-    md_emul.sur90on = 0;
-    md_emul.suratton = 0;
-    md_emul.hpfon = 0;
-    md_emul.bwlpfon = 0;
-    md_emul.lfelpfon = 1;
+    set_default_state(&md_emul);
 
-    char c;
     for (std::string arg : args)
     {
-        if (arg[0] == '-')
+        if (arg.compare(0, 2, "--") == 0)
         {
-            arg.erase(0, arg.find_first_not_of("-"));
-            c = arg[0];
-            arg.erase(arg.begin());
-            switch(c)
-            {
-            case 'a':
-                md_emul.acmod = std::stoi(arg);
-                break;
-            case 'd':
-                if (arg[0] == 'n')
-                {
-                    arg.erase(arg.begin());
-                    md_emul.dialnorm = std::stoi(arg);                    
-                }
-                break;
-            case 'c':
-                switch(std::stoi(arg))
-                {
-                case 0: 
-                    md_emul.params.compression_mode_main = DLB_MD_EMUL_CM_NONE;
-                    break;
-                case 1:
-                    md_emul.params.compression_mode_main = DLB_MD_EMUL_CM_CUSTOM;
-                    break;
-                case 2:
-                    md_emul.params.compression_mode_main = DLB_MD_EMUL_CM_LINE;
-                    break;
-                case 3:
-                    md_emul.params.compression_mode_main = DLB_MD_EMUL_CM_RF;
-                    break;
-                default:
-                    throw std::runtime_error("Invalid compression mode");
-                }
-
-            case 'g':
-                md_emul.lfelpfon = std::stoi(arg);
-                break;
-            case 'h':
-                show_usage();
-                exit(0);
-            case 'j':
-                md_emul.hpfon = std::stoi(arg);
-                break;
-            case 'k':
-                c = arg[0];
-                arg.erase(arg.begin());
-                switch (c)
-                {
-                case 'c':
-                    md_emul.compr = std::stoi(arg);
-                    break;
-                case 'd':
-                    md_emul.dynrng = std::stoi(arg);
-                    break;
-                default:
-                    md_emul.compr = md_emul.dynrng = c - '0';
-                }
-                break;
-            case 'l':
-                md_emul.bwlpfon = std::stoi(arg);
-                break;
-            case '9':
-                md_emul.sur90on = std::stoi(arg);
-                break;
-            case '$':
-                md_emul.suratton = std::stoi(arg);
-                break;
-            case 'p':
-                md_emul.program_config = std::stoi(arg);
-                break;
-            case 's':
-                md_emul.program_select = std::stoi(arg);
-                break;
-            }
+            parse_long_option(arg.substr(2), &opts);
+        }
+        else if (arg[0] == '-' && arg != PIPE_FILE_NAME)
+        {
+            parse_short_option(arg, &md_emul);
         }
         else
         {
@@ -576,52 +879,81 @@ int main(int argc, char *argv[])
         }
     }
 
-    if (args.size() < 2)
+    if (!opts.pwr_res_stem.empty() && (!opts.serve_socket.empty() || !opts.batch_manifest.empty()))
     {
-        throw std::runtime_error("Insufficient arguments, must specify at least input and output file");
-        show_usage();
-        exit(-1);
+        throw std::runtime_error("--pwr-res only applies to a single input file");
+    }
+    if (opts.stats && (!opts.serve_socket.empty() || !opts.batch_manifest.empty()))
+    {
+        throw std::runtime_error("--stats only applies to a single input file");
+    }
+    if (!opts.meter_name.empty() && (!opts.serve_socket.empty() || !opts.batch_manifest.empty()))
+    {
+        throw std::runtime_error("--meter only applies to a single input file");
+    }
+    if (!opts.trace_file.empty() && (!opts.serve_socket.empty() || !opts.batch_manifest.empty()))
+    {
+        throw std::runtime_error("--trace only applies to a single input file");
     }
 
-	err = dlb_md_emul_query_mem(&dlb_md_emul_size);
-	if (err)
-	{
-		throw std::runtime_error("Failed to query memory");
-		exit(-1);
-	}
+    if (!opts.serve_socket.empty())
+    {
+        service_options service = { opts.serve_socket, opts.batch.num_workers };
 
-	static_memory_sz  = (  dlb_md_emul_size.emul_static_mem_size
-                         + dlb_md_emul_size.compr_static_mem_size
-                         + dlb_md_emul_size.compr_ext_static_mem_size);
+        if (!input_wav_file_str.empty() || !opts.batch_manifest.empty())
+        {
+            throw std::runtime_error("--serve takes its files from the requests");
+        }
+        md_emul.num_outputs = 1;
+        run_service(service, batch_job_config, &md_emul);
+        return 0;
+    }
 
-    dynamic_memory_sz = (  dlb_md_emul_size.emul_dynamic_mem_size
-                         + dlb_md_emul_size.compr_dynamic_mem_size);
+    if (!opts.batch_manifest.empty())
+    {
+        std::vector<batch_job> jobs;
 
-    static_memory = new char[static_memory_sz];
+        if (!input_wav_file_str.empty())
+        {
+            throw std::runtime_error("--batch takes its files from the manifest");
+        }
+        batch_load_manifest(opts.batch_manifest, &jobs);
+        md_emul.num_outputs = 1;
+        return run_batch(jobs, opts.batch, batch_job_config, &md_emul) ? 1 : 0;
+    }
 
-    dynamic_memory = new char[dynamic_memory_sz];
-    md_emul.emul_static_mem = static_memory;
-    md_emul.emul_dynamic_mem = dynamic_memory;
+    if (args.size() < 2)
+    {
+        throw std::runtime_error("Insufficient arguments, must specify at least input and output file");
+        show_usage();
+        exit(-1);
+    }
 
-//    std::cout << "md_emul.emul_static_mem: " << std::hex << md_emul.emul_static_mem << " - " << (void *)(static_memory + static_memory_sz - 1) << std::endl;
-//    std::cout << "md_emul.emul_dynamic_mem: " << std::hex << md_emul.emul_dynamic_mem << " - " << (void *)(dynamic_memory + dynamic_memory_sz - 1) << std::endl;
+    input_is_pipe = (input_wav_file_str == PIPE_FILE_NAME);
+    output_is_pipe = (output_wav_file_str == PIPE_FILE_NAME);
 
-    if ((static_memory == nullptr) || (dynamic_memory == nullptr))
+    if (output_is_pipe)
     {
-    	throw std::runtime_error("Memory Allocation Failed");
+        /* stdout carries the audio, report on stderr */
+        std::cout.rdbuf(std::cerr.rdbuf());
     }
-    err = dlb_md_emul_open(&dlb_md_emul_size,
-                        &md_emul.emul_hdl,
-                        md_emul.emul_static_mem,
-                        md_emul.emul_dynamic_mem);
-
-    if (err)
+    if (opts.pipe.raw && !input_is_pipe && !output_is_pipe)
     {
-        throw std::runtime_error("Metadata Emulation Open Returned Error: " + std::to_string(err));
+        throw std::runtime_error("--format only applies to stdin and stdout streams");
+    }
+    if ((input_is_pipe || output_is_pipe) && (opts.segments.num_segments > 1 || opts.range))
+    {
+        throw std::runtime_error("--segments and --range need input and output files");
     }
 
-
-    input_wav_file = SndfileHandle(input_wav_file_str.c_str());
+    if (input_is_pipe)
+    {
+        input_wav_file = pipe_open_input(opts.pipe);
+    }
+    else
+    {
+        input_wav_file = SndfileHandle(input_wav_file_str.c_str());
+    }
 
     if (input_wav_file.error())
     {
@@ -637,23 +969,20 @@ int main(int argc, char *argv[])
 */
 
     input_file_size = input_wav_file.frames();
-    input_frames_read = 0;
-    input_data[0] = primary_io_samples;
-    input_data[1] = secondary_op_samples;
 
     md_emul.num_outputs = 1; // Only using main output for now
 
-    output_wav_file = SndfileHandle(output_wav_file_str.c_str(), SFM_WRITE, SF_FORMAT_WAV | SF_FORMAT_PCM_16, input_wav_file.channels(), 48000);
-
-    if (output_wav_file.error())
-    {
-        throw std::runtime_error("Output File not opened: " + std::string(output_wav_file.strError()));
-    }
-
 
     std::cout << "Input File: " << input_wav_file_str << std::endl;
     std::cout << "Output File: " << output_wav_file_str << std::endl;
-    std::cout << "Frames to read: " << input_file_size << std::endl;
+    if (input_is_pipe)
+    {
+        std::cout << "Frames to read: until end of stream" << std::endl;
+    }
+    else
+    {
+        std::cout << "Frames to read: " << input_file_size << std::endl;
+    }
     std::cout << "Program Configuration: " << program_config_str[md_emul.program_config] << std::endl;
     std::cout << "Program Selection: " << md_emul.program_select << std::endl;
     std::cout << "Compression Mode: " << compression_mode_string[md_emul.params.compression_mode_main] << std::endl;
@@ -670,40 +999,156 @@ int main(int argc, char *argv[])
     std::cout << "bwlpfon: " << md_emul.bwlpfon << std::endl;
     std::cout << "lfelpfon: " << md_emul.lfelpfon << std::endl << std::endl;
 
-    while(input_frames_read < input_file_size)
+    prepare_process_config(&md_emul, input_wav_file.channels(), &emul_conf);
+
+    if (opts.checkpoint_file.empty() && input_is_pipe && opts.checkpoint_interval > 0.0)
     {
-        input_wav_file.read(primary_io_samples, input_wav_file.channels() * DLB_MD_EMUL_BLOCK_SIZE);
-        input_frames_read += DLB_MD_EMUL_BLOCK_SIZE;
+        throw std::runtime_error("--checkpoint-interval on stdin needs --checkpoints=PATH");
+    }
+    if (opts.checkpoint_file.empty())
+    {
+        opts.checkpoint_file = input_wav_file_str + ".mdckpt";
+    }
 
-    	limit_channel_mode(&md_emul, &emul_conf);
+    if (opts.segments.num_segments > 1 && (opts.checkpoint_interval > 0.0 || opts.range))
+    {
+        throw std::runtime_error("--segments cannot be combined with --checkpoint-interval or --range");
+    }
+    if (!opts.pwr_res_stem.empty() && (opts.segments.num_segments > 1 || opts.range))
+    {
+        throw std::runtime_error("--pwr-res cannot be combined with --segments or --range");
+    }
+    if (opts.stats && (opts.segments.num_segments > 1 || opts.range))
+    {
+        throw std::runtime_error("--stats cannot be combined with --segments or --range");
+    }
+    if (!opts.meter_name.empty() && (opts.segments.num_segments > 1 || opts.range))
+    {
+        throw std::runtime_error("--meter cannot be combined with --segments or --range");
+    }
+    if (!opts.trace_file.empty() && (opts.segments.num_segments > 1 || opts.range))
+    {
+        throw std::runtime_error("--trace cannot be combined with --segments or --range");
+    }
 
-	    /* Save channel mode for prepare_output() */
-	    md_emul.channel_mode = emul_conf.channel_mode;
+    if (opts.range)
+    {
+        checkpoint_index ckpt_index;
+        std::string      reason;
+        bool             have_index;
 
-	    emul_conf.pa_in_data[0] = primary_io_samples;
-        emul_conf.pa_in_data[1] = secondary_op_samples;
+        have_index = checkpoint_index_load(&ckpt_index, opts.checkpoint_file, input_wav_file_str, emul_conf, input_wav_file.channels(), &reason);
+        if (!have_index)
+        {
+            std::cout << "Not using checkpoints: " << reason << std::endl;
+        }
+        render_range(input_wav_file_str, output_wav_file_str, emul_conf, md_emul.num_outputs,
+                     have_index ? &ckpt_index : nullptr, opts.segments.preroll_seconds, opts.range_start, opts.range_end);
+        std::cout << "Metadata Emulation Process Complete" << std::endl;
+        return 0;
+    }
 
-	    emul_conf.lfe_on = md_emul.lfeon;
+    if (opts.segments.num_segments > 1)
+    {
+        run_segment_parallel(input_wav_file_str, output_wav_file_str, emul_conf, md_emul.num_outputs, opts.segments);
+        std::cout << "Metadata Emulation Process Complete" << std::endl;
+        return 0;
+    }
 
-	    init_channel_map(&emul_conf);
+    if (opts.checkpoint_interval > 0.0)
+    {
+        checkpoint_writer_open(&ckpt_writer, opts.checkpoint_file, input_is_pipe ? std::string() : input_wav_file_str, emul_conf, input_wav_file.channels(), opts.checkpoint_interval);
+    }
+    if (!opts.pwr_res_stem.empty())
+    {
+        pwr_res_writer_open(&pwr_writer, opts.pwr_res_stem, input_wav_file.channels(), 48000,
+                            input_is_pipe ? UINT64_MAX : (uint64_t)input_file_size);
+    }
 
-	    /* Set audio metadata */
-	    emul_conf.sample_offset = input_wav_file.channels();
-	    emul_conf.num_samples = DLB_MD_EMUL_BLOCK_SIZE; 
-	    emul_conf.sample_rate = 48000u;
+    md_emul.emul = {};
+    md_emul_instance_open(&md_emul.emul);
+    DLB_INSTRUMENT_OPEN();
+    if (!opts.meter_name.empty())
+    {
+        meter_shm_open(&meter, opts.meter_name, METER_SHM_DEFAULT_CAPACITY);
+        dlb_md_emul_set_meter(&md_emul.emul.hdl, meter.meter);
+        std::cout << "Meter: " << opts.meter_name << std::endl;
+    }
+    if (!opts.trace_file.empty())
+    {
+        trace_writer_open(&tracer, opts.trace_file, TRACE_WRITER_BUFFER_RECORDS, TRACE_WRITER_BUFFERS);
+        dlb_md_emul_set_trace(&md_emul.emul.hdl, trace_writer_record, &tracer);
+        std::cout << "Trace: " << opts.trace_file << std::endl;
+    }
+
+    emul_conf.pa_in_data[1] = secondary_op_samples;
+
+    stage.emul = &md_emul.emul;
+    stage.emul_conf = &emul_conf;
+    stage.num_outputs = md_emul.num_outputs;
+    stage.ckpt_writer = &ckpt_writer;
+    stage.pwr_writer = &pwr_writer;
+
+    if (!opts.no_mmap && !input_is_pipe && !output_is_pipe && wav_mmap_open_read(&mapped_input, input_wav_file_str, &mmap_reason))
+    {
+        uint64_t num_blocks = (mapped_input.frames + DLB_MD_EMUL_BLOCK_SIZE - 1) / DLB_MD_EMUL_BLOCK_SIZE;
 
-	    setup_emulation_params(&md_emul, &emul_conf);
+        std::cout << "I/O: memory mapped" << std::endl;
+        wav_mmap_open_write(&mapped_output, output_wav_file_str, mapped_input.channels, 48000, num_blocks * DLB_MD_EMUL_BLOCK_SIZE);
+        run_mmap_pipeline(mapped_input, mapped_output, PROGRESS_INTERVAL, process_block, &stage);
+        wav_mmap_close_write(&mapped_output);
+        wav_mmap_close_read(&mapped_input);
+    }
+    else
+    {
+        std::cout << "I/O: libsndfile" << (mmap_reason.empty() ? "" : " (" + mmap_reason + ")") << std::endl;
+        if (output_is_pipe)
+        {
+            output_wav_file = pipe_open_output(opts.pipe, input_wav_file.channels(), 48000);
+        }
+        else
+        {
+            output_wav_file = SndfileHandle(output_wav_file_str.c_str(), SFM_WRITE, SF_FORMAT_WAV | SF_FORMAT_PCM_16, input_wav_file.channels(), 48000);
+        }
 
-    	err = dlb_md_emul_process(&md_emul.emul_hdl, &emul_conf, md_emul.num_outputs);
+        if (output_wav_file.error())
+        {
+            throw std::runtime_error("Output File not opened: " + std::string(output_wav_file.strError()));
+        }
 
-        if (err)
+        if (input_is_pipe)
         {
-            throw std::runtime_error("Metadata Emulation Process Returned Error: " + std::to_string(err));
+            io_opts.chunk_blocks = IO_STREAM_CHUNK_BLOCKS;
         }
+        run_io_pipeline(input_wav_file, output_wav_file, io_opts, process_block, &stage);
+    }
+
+    if (opts.stats)
+    {
+        std::cerr << std::endl;
+        md_emul_instance_print_stats(&md_emul.emul, stderr);
+    }
+    md_emul_instance_close(&md_emul.emul);
+    meter_shm_close(&meter);
+    trace_writer_close(&tracer);
+    checkpoint_writer_close(&ckpt_writer);
+    pwr_res_writer_close(&pwr_writer);
+
+#ifdef DLB_INSTRUMENT_PROFILER
+    {
+        const dlb_instrument_profiler_report_t *report = DLB_INSTRUMENT_REPORT();
 
-        output_wav_file.write(primary_io_samples, input_wav_file.channels() * DLB_MD_EMUL_BLOCK_SIZE);
-        std::cout << "\rWrote: " << input_frames_read << " frames" << std::flush;
+        /* One frame is one process call of num_samples sample frames */
+        std::cerr << std::endl;
+        dlb_instrument_profiler_print(stderr, report, report->frames * emul_conf.num_samples);
     }
+#endif
+#ifdef DLB_INSTRUMENT_COUNT
+    /* One frame is one process call of num_samples sample frames at 48 kHz */
+    std::cerr << std::endl;
+    dlb_instrument_count_print(stderr, DLB_INSTRUMENT_REPORT(), 48000.0 / emul_conf.num_samples);
+#endif
+    DLB_INSTRUMENT_CLOSE();
 
     std::cout << std::endl << "Metadata Emulation Process Complete" << std::endl;
 }
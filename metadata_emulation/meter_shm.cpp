@@ -0,0 +1,114 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Live metering tap of MdEmu in POSIX shared memory
+ */
+
+#include <stdexcept>
+
+#include "meter_shm.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+void meter_shm_open
+    (meter_shm             *shm
+    ,const std::string     &name
+    ,uint32_t               capacity
+    )
+{
+    size_t size;
+    void *map;
+    int fd;
+
+    if (dlb_md_emul_meter_query_mem(capacity, &size) != DLB_MD_EMUL_METER_OK)
+    {
+        throw std::runtime_error("Meter capacity must be at least 2 blocks");
+    }
+
+    fd = shm_open(name.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd < 0)
+    {
+        throw std::runtime_error("Shared memory not created: " + name);
+    }
+    if (ftruncate(fd, (off_t)size) != 0)
+    {
+        close(fd);
+        shm_unlink(name.c_str());
+        throw std::runtime_error("Shared memory not sized: " + name);
+    }
+    map = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+    {
+        shm_unlink(name.c_str());
+        throw std::runtime_error("Shared memory not mapped: " + name);
+    }
+
+    dlb_md_emul_meter_init(map, size, capacity, &shm->meter);
+    shm->map  = map;
+    shm->size = size;
+    shm->name = name;
+}
+
+void meter_shm_close(meter_shm *shm)
+{
+    if (shm->meter)
+    {
+        munmap(shm->map, shm->size);
+        shm_unlink(shm->name.c_str());
+        shm->meter = nullptr;
+    }
+}
+
+#else
+
+void meter_shm_open
+    (meter_shm             *
+    ,const std::string     &
+    ,uint32_t
+    )
+{
+    throw std::runtime_error("--meter needs POSIX shared memory");
+}
+
+void meter_shm_close(meter_shm *)
+{
+}
+
+#endif
@@ -0,0 +1,71 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Live metering tap of MdEmu in POSIX shared memory
+ *
+ * Creates the shared memory object, lays out a dlb_md_emul_meter in it and
+ * attaches it to the emulator, so tools/src/mdemu_meter.c or any other
+ * monitor can follow the blocks as they are processed.
+ */
+
+#ifndef METER_SHM_H
+#define METER_SHM_H
+
+#include <string>
+
+#include "dlb_md_emul_meter.h"
+
+#define METER_SHM_DEFAULT_CAPACITY  4096    /**< records, about 22 s of blocks at 48 kHz */
+
+typedef struct
+{
+    dlb_md_emul_meter_t    *meter;      /**< nullptr when no meter is published */
+    void                   *map;
+    size_t                  size;
+    std::string             name;
+} meter_shm;
+
+/* Create (or replace) the shared memory object name and lay out an empty meter, throws on error */
+void meter_shm_open
+    (meter_shm             *shm
+    ,const std::string     &name
+    ,uint32_t               capacity
+    );
+
+/* Unmap and remove the object, readers that have it mapped keep their view */
+void meter_shm_close(meter_shm *shm);
+
+#endif /* METER_SHM_H */
@@ -0,0 +1,206 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Streaming input and output on stdin / stdout for the command line application
+ *
+ *
+ */
+
+#include <cstdio>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "pipe_io.h"
+
+#define STDIN_FD    0
+#define STDOUT_FD   1
+
+static void set_binary_mode(int fd)
+{
+#ifdef _WIN32
+    _setmode(fd, _O_BINARY);
+#else
+    (void)fd;
+#endif
+}
+
+static void write_all(int fd, const unsigned char *data, size_t size)
+{
+    while (size > 0)
+    {
+#ifdef _WIN32
+        int written = _write(fd, data, (unsigned int)size);
+#else
+        ssize_t written = write(fd, data, size);
+#endif
+        if (written <= 0)
+        {
+            throw std::runtime_error("Output stream write failed");
+        }
+        data += written;
+        size -= (size_t)written;
+    }
+}
+
+/* Redirected to a file rather than a pipe, so libsndfile can write and finish a normal header */
+static bool is_seekable(int fd)
+{
+#ifdef _WIN32
+    return _lseeki64(fd, 0, SEEK_CUR) >= 0;
+#else
+    return lseek(fd, 0, SEEK_CUR) >= 0;
+#endif
+}
+
+static void put16(unsigned char *p, unsigned int v)
+{
+    p[0] = (unsigned char)v;
+    p[1] = (unsigned char)(v >> 8);
+}
+
+static void put32(unsigned char *p, unsigned long v)
+{
+    put16(p, (unsigned int)(v & 0xFFFF));
+    put16(p + 2, (unsigned int)((v >> 16) & 0xFFFF));
+}
+
+bool pipe_format_parse_subtype(const std::string &name, int *subtype)
+{
+    if (name == "s16")
+    {
+        *subtype = SF_FORMAT_PCM_16;
+    }
+    else if (name == "s24")
+    {
+        *subtype = SF_FORMAT_PCM_24;
+    }
+    else if (name == "s32")
+    {
+        *subtype = SF_FORMAT_PCM_32;
+    }
+    else if (name == "f32")
+    {
+        *subtype = SF_FORMAT_FLOAT;
+    }
+    else if (name == "f64")
+    {
+        *subtype = SF_FORMAT_DOUBLE;
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+SndfileHandle pipe_open_input(const pipe_format &format)
+{
+    SndfileHandle input;
+
+    set_binary_mode(STDIN_FD);
+
+    if (format.raw)
+    {
+        if (format.channels <= 0)
+        {
+            throw std::runtime_error("--channels is required for raw input");
+        }
+        input = SndfileHandle(STDIN_FD, false, SFM_READ, SF_FORMAT_RAW | format.subtype | SF_ENDIAN_LITTLE,
+                              format.channels, format.sample_rate);
+    }
+    else
+    {
+        input = SndfileHandle(STDIN_FD, false, SFM_READ);
+    }
+
+    if (input.error())
+    {
+        throw std::runtime_error("Input stream not opened: " + std::string(input.strError()));
+    }
+    return input;
+}
+
+SndfileHandle pipe_open_output(const pipe_format &format, int channels, int sample_rate)
+{
+    SndfileHandle output;
+
+    set_binary_mode(STDOUT_FD);
+
+    if (format.raw)
+    {
+        output = SndfileHandle(STDOUT_FD, false, SFM_WRITE, SF_FORMAT_RAW | format.subtype | SF_ENDIAN_LITTLE,
+                               channels, sample_rate);
+    }
+    else if (is_seekable(STDOUT_FD))
+    {
+        output = SndfileHandle(STDOUT_FD, false, SFM_WRITE, SF_FORMAT_WAV | SF_FORMAT_PCM_16, channels, sample_rate);
+    }
+    else
+    {
+        unsigned char header[44];
+
+        /* RIFF and data sizes of 0xFFFFFFFF mark a stream of unknown length */
+        put32(header, 0x46464952ul);                    /* "RIFF" */
+        put32(header + 4, 0xFFFFFFFFul);
+        put32(header + 8, 0x45564157ul);                /* "WAVE" */
+        put32(header + 12, 0x20746D66ul);               /* "fmt " */
+        put32(header + 16, 16);
+        put16(header + 20, 1);                          /* PCM */
+        put16(header + 22, (unsigned int)channels);
+        put32(header + 24, (unsigned long)sample_rate);
+        put32(header + 28, (unsigned long)sample_rate * 2 * channels);
+        put16(header + 32, (unsigned int)(2 * channels));
+        put16(header + 34, 16);
+        put32(header + 36, 0x61746164ul);               /* "data" */
+        put32(header + 40, 0xFFFFFFFFul);
+        write_all(STDOUT_FD, header, sizeof(header));
+
+        output = SndfileHandle(STDOUT_FD, false, SFM_WRITE, SF_FORMAT_RAW | SF_FORMAT_PCM_16 | SF_ENDIAN_LITTLE,
+                               channels, sample_rate);
+    }
+
+    if (output.error())
+    {
+        throw std::runtime_error("Output stream not opened: " + std::string(output.strError()));
+    }
+    return output;
+}
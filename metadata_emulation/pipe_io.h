@@ -0,0 +1,71 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Streaming input and output on stdin / stdout for the command line application
+ *
+ * Either side can be a WAV (or any other format libsndfile reads from a pipe)
+ * of unknown length, or headerless PCM described by --channels, --rate and
+ * --format. libsndfile cannot write WAV to a pipe, so WAV output is a header
+ * with unknown sizes followed by raw little-endian 16 bit PCM.
+ */
+
+#ifndef PIPE_IO_H
+#define PIPE_IO_H
+
+#include <string>
+
+#include <sndfile.hh>
+
+typedef struct
+{
+    bool    raw;                /**< headerless PCM on stdin and stdout */
+    int     channels;
+    int     sample_rate;
+    int     subtype;            /**< SF_FORMAT_PCM_16 etc. */
+} pipe_format;
+
+#define PIPE_FILE_NAME  "-"
+
+/* Map s16, s24, s32, f32 or f64 to a libsndfile subtype, returns false if unknown */
+bool pipe_format_parse_subtype(const std::string &name, int *subtype);
+
+/* Open stdin for reading, throws on error */
+SndfileHandle pipe_open_input(const pipe_format &format);
+
+/* Open stdout for writing channels of audio, throws on error */
+SndfileHandle pipe_open_output(const pipe_format &format, int channels, int sample_rate);
+
+#endif /* PIPE_IO_H */
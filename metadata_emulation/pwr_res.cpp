@@ -0,0 +1,140 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Power versus time curves of the emulator output
+ */
+
+#include <cmath>
+#include <stdexcept>
+
+#include "pwr_res.h"
+
+#define PWR_RES_WINDOW_SECONDS  0.1
+
+void pwr_res_writer_open
+    (pwr_res_writer        *writer
+    ,const std::string     &stem
+    ,int                    channels
+    ,int                    sample_rate
+    ,uint64_t               frames
+    )
+{
+    dlb_md_emul_pwr_config_t config;
+    size_t                   mem_size;
+
+    config.num_channels  = (uint32_t)channels;
+    config.sample_rate   = (uint32_t)sample_rate;
+    config.window_frames = (uint32_t)std::lround(PWR_RES_WINDOW_SECONDS * sample_rate);
+    if (dlb_md_emul_pwr_query_mem(&config, &mem_size) != DLB_MD_EMUL_PWR_OK)
+    {
+        throw std::runtime_error("Power analyser does not support " + std::to_string(channels) + " channels");
+    }
+    writer->pwr_mem.resize(mem_size);
+    dlb_md_emul_pwr_open(&config, writer->pwr_mem.data(), &writer->pwr);
+
+    writer->channels    = channels;
+    writer->frames_left = frames;
+    writer->pcm.resize((size_t)channels * DLB_MD_EMUL_BLOCK_SIZE);
+    writer->points.resize(DLB_MD_EMUL_BLOCK_SIZE / config.window_frames + 1);
+
+    for (int c = 0; c < DLB_MD_EMUL_MAX_CHANS; c++)
+    {
+        writer->fp[c] = nullptr;
+    }
+    for (int c = 0; c < channels; c++)
+    {
+        std::string file = stem + "." + std::to_string(c) + ".res";
+
+        writer->fp[c] = fopen(file.c_str(), "w");
+        if (!writer->fp[c])
+        {
+            pwr_res_writer_close(writer);
+            throw std::runtime_error("Power curve not opened: " + file);
+        }
+    }
+}
+
+void pwr_res_writer_update
+    (pwr_res_writer        *writer
+    ,const DLB_LFRACT      *block
+    )
+{
+    uint32_t frames = DLB_MD_EMUL_BLOCK_SIZE;
+    uint32_t num_points;
+
+    if (!writer->pwr || writer->frames_left == 0)
+    {
+        return;
+    }
+    if (writer->frames_left < frames)
+    {
+        frames = (uint32_t)writer->frames_left;
+    }
+    writer->frames_left -= frames;
+
+    /* Same rounding as the output file and the same scaling as reading it back */
+    for (size_t i = 0; i < (size_t)frames * writer->channels; i++)
+    {
+        writer->pcm[i] = (int16_t)lrint((double)block[i] * 0x7FFF) / (double)0x8000;
+    }
+
+    dlb_md_emul_pwr_process(writer->pwr, writer->pcm.data(), (uint32_t)writer->channels, frames,
+                            writer->points.data(), (uint32_t)writer->points.size(), &num_points);
+    for (uint32_t p = 0; p < num_points; p++)
+    {
+        for (int c = 0; c < writer->channels; c++)
+        {
+            fprintf(writer->fp[c], "%f,\t%.2f\n", writer->points[p].time, writer->points[p].power_db[c]);
+        }
+    }
+}
+
+void pwr_res_writer_close(pwr_res_writer *writer)
+{
+    if (!writer->pwr)
+    {
+        return;
+    }
+    for (int c = 0; c < writer->channels; c++)
+    {
+        if (writer->fp[c])
+        {
+            fclose(writer->fp[c]);
+        }
+    }
+    dlb_md_emul_pwr_close(writer->pwr);
+    writer->pwr = nullptr;
+}
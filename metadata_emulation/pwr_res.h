@@ -0,0 +1,82 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Power versus time curves of the emulator output
+ *
+ * Measures every output channel while the file is processed and writes one
+ * .res file per channel in the format of SATS pwr_vs_time, so the DRC
+ * regression needs no second pass over the output.
+ */
+
+#ifndef PWR_RES_H
+#define PWR_RES_H
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "dlb_md_emul_api.h"
+#include "dlb_md_emul_pwr.h"
+
+typedef struct
+{
+    dlb_md_emul_pwr_t                      *pwr;        /**< nullptr when no curves are written */
+    std::vector<char>                       pwr_mem;
+    int                                     channels;
+    uint64_t                                frames_left;
+    FILE                                   *fp[DLB_MD_EMUL_MAX_CHANS];
+    std::vector<DLB_LFRACT>                 pcm;
+    std::vector<dlb_md_emul_pwr_point_t>    points;
+} pwr_res_writer;
+
+/* Create stem.<channel>.res for every channel, throws on error */
+void pwr_res_writer_open
+    (pwr_res_writer        *writer
+    ,const std::string     &stem
+    ,int                    channels
+    ,int                    sample_rate
+    ,uint64_t               frames      /**< frames of the input, the zero padding of the last block is not measured */
+    );
+
+/* Measure one processed block as it is written to the 16 bit output file */
+void pwr_res_writer_update
+    (pwr_res_writer        *writer
+    ,const DLB_LFRACT      *block
+    );
+
+void pwr_res_writer_close(pwr_res_writer *writer);
+
+#endif /* PWR_RES_H */
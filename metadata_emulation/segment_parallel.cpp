@@ -0,0 +1,419 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Segment-parallel processing of a single input file
+ *
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <sndfile.hh>
+
+#include "md_emul_instance.h"
+#include "segment_parallel.h"
+
+#define    SEGMENT_SAMPLE_RATE      48000
+#define    SEAM_REPORT_SECONDS      10.0
+#define    STITCH_FRAMES            (64 * DLB_MD_EMUL_BLOCK_SIZE)
+
+typedef struct
+{
+    uint64_t                first_block;      /**< first block written to the output */
+    uint64_t                end_block;        /**< one past the last block */
+    uint64_t                preroll_block;    /**< first block processed */
+    std::string             tmp_file;
+    std::vector<DLB_LFRACT> seam_capture;     /**< output of the first report window blocks */
+    std::string             error;
+} segment_job;
+
+typedef struct
+{
+    std::vector<std::vector<DLB_LFRACT>> capture;   /**< per seam, sequential output */
+    std::string                          error;
+} seam_reference;
+
+static
+void
+capture_block
+    (std::vector<DLB_LFRACT>   *capture
+    ,const DLB_LFRACT          *samples
+    ,int                        channels
+    )
+{
+    capture->insert(capture->end(), samples, samples + channels * DLB_MD_EMUL_BLOCK_SIZE);
+}
+
+static
+void
+process_segment
+    (const std::string                  *input_file
+    ,const dlb_md_emul_process_config_t *emul_template
+    ,uint32_t                            num_outputs
+    ,uint64_t                            window_blocks
+    ,segment_job                        *job
+    )
+{
+    md_emul_instance             inst = {};
+    dlb_md_emul_process_config_t emul_conf = *emul_template;
+    std::vector<DLB_LFRACT>      primary_io_samples(DLB_MD_EMUL_MAX_CHANS * DLB_MD_EMUL_BLOCK_SIZE);
+    std::vector<DLB_LFRACT>      secondary_op_samples(DLB_MD_EMUL_MAX_CHANS * DLB_MD_EMUL_BLOCK_SIZE);
+
+    try
+    {
+        SndfileHandle input_wav_file(input_file->c_str());
+        if (input_wav_file.error())
+        {
+            throw std::runtime_error("Input File not opened: " + std::string(input_wav_file.strError()));
+        }
+        int channels = input_wav_file.channels();
+
+        SndfileHandle output_wav_file(job->tmp_file.c_str(), SFM_WRITE, SF_FORMAT_WAV | SF_FORMAT_PCM_16, channels, SEGMENT_SAMPLE_RATE);
+        if (output_wav_file.error())
+        {
+            throw std::runtime_error("Segment File not opened: " + std::string(output_wav_file.strError()));
+        }
+
+        if (input_wav_file.seek((sf_count_t)job->preroll_block * DLB_MD_EMUL_BLOCK_SIZE, SEEK_SET) < 0)
+        {
+            throw std::runtime_error("Seek in input file failed");
+        }
+
+        md_emul_instance_open(&inst);
+        emul_conf.pa_in_data[0] = primary_io_samples.data();
+        emul_conf.pa_in_data[1] = secondary_op_samples.data();
+
+        for (uint64_t block = job->preroll_block; block < job->end_block; block++)
+        {
+            sf_count_t got = input_wav_file.read(primary_io_samples.data(), channels * DLB_MD_EMUL_BLOCK_SIZE);
+
+            /* pad the final partial block with silence, as the sequential run does */
+            std::fill(primary_io_samples.begin() + got, primary_io_samples.begin() + channels * DLB_MD_EMUL_BLOCK_SIZE, (DLB_LFRACT)0);
+            md_emul_instance_process(&inst, &emul_conf, num_outputs);
+
+            if (block >= job->first_block)
+            {
+                output_wav_file.write(primary_io_samples.data(), channels * DLB_MD_EMUL_BLOCK_SIZE);
+                if (job->first_block > 0 && block - job->first_block < window_blocks)
+                {
+                    capture_block(&job->seam_capture, primary_io_samples.data(), channels);
+                }
+            }
+        }
+    }
+    catch (const std::exception &e)
+    {
+        job->error = e.what();
+    }
+    md_emul_instance_close(&inst);
+}
+
+/* Sequential pass over the whole input keeping only the blocks right after each seam */
+static
+void
+process_reference
+    (const std::string                  *input_file
+    ,const dlb_md_emul_process_config_t *emul_template
+    ,uint32_t                            num_outputs
+    ,uint64_t                            window_blocks
+    ,const std::vector<segment_job>     *jobs
+    ,seam_reference                     *ref
+    )
+{
+    md_emul_instance             inst = {};
+    dlb_md_emul_process_config_t emul_conf = *emul_template;
+    std::vector<DLB_LFRACT>      primary_io_samples(DLB_MD_EMUL_MAX_CHANS * DLB_MD_EMUL_BLOCK_SIZE);
+    std::vector<DLB_LFRACT>      secondary_op_samples(DLB_MD_EMUL_MAX_CHANS * DLB_MD_EMUL_BLOCK_SIZE);
+    size_t                       seam = 1;
+
+    try
+    {
+        SndfileHandle input_wav_file(input_file->c_str());
+        if (input_wav_file.error())
+        {
+            throw std::runtime_error("Input File not opened: " + std::string(input_wav_file.strError()));
+        }
+        int channels = input_wav_file.channels();
+        uint64_t end_block = jobs->back().end_block;
+
+        md_emul_instance_open(&inst);
+        emul_conf.pa_in_data[0] = primary_io_samples.data();
+        emul_conf.pa_in_data[1] = secondary_op_samples.data();
+        ref->capture.resize(jobs->size());
+
+        for (uint64_t block = 0; block < end_block; block++)
+        {
+            sf_count_t got = input_wav_file.read(primary_io_samples.data(), channels * DLB_MD_EMUL_BLOCK_SIZE);
+
+            /* pad the final partial block with silence, as the sequential run does */
+            std::fill(primary_io_samples.begin() + got, primary_io_samples.begin() + channels * DLB_MD_EMUL_BLOCK_SIZE, (DLB_LFRACT)0);
+            md_emul_instance_process(&inst, &emul_conf, num_outputs);
+
+            while (seam < jobs->size() && block >= (*jobs)[seam].first_block + window_blocks)
+            {
+                seam++;
+            }
+            if (seam < jobs->size() && block >= (*jobs)[seam].first_block)
+            {
+                capture_block(&ref->capture[seam], primary_io_samples.data(), channels);
+            }
+        }
+    }
+    catch (const std::exception &e)
+    {
+        ref->error = e.what();
+    }
+    md_emul_instance_close(&inst);
+}
+
+static
+void
+stitch_segments
+    (const std::string              &output_file
+    ,int                             channels
+    ,const std::vector<segment_job> &jobs
+    )
+{
+    SndfileHandle      output_wav_file(output_file.c_str(), SFM_WRITE, SF_FORMAT_WAV | SF_FORMAT_PCM_16, channels, SEGMENT_SAMPLE_RATE);
+    std::vector<short> pcm(STITCH_FRAMES * channels);
+
+    if (output_wav_file.error())
+    {
+        throw std::runtime_error("Output File not opened: " + std::string(output_wav_file.strError()));
+    }
+
+    for (const segment_job &job : jobs)
+    {
+        SndfileHandle segment_wav_file(job.tmp_file.c_str());
+        sf_count_t    frames;
+
+        if (segment_wav_file.error())
+        {
+            throw std::runtime_error("Segment File not opened: " + std::string(segment_wav_file.strError()));
+        }
+        /* 16 bit in, 16 bit out: the copy is lossless */
+        while ((frames = segment_wav_file.readf(pcm.data(), STITCH_FRAMES)) > 0)
+        {
+            output_wav_file.writef(pcm.data(), frames);
+        }
+    }
+}
+
+static
+void
+report_seams
+    (const std::vector<segment_job> &jobs
+    ,const seam_reference           &ref
+    ,int                             channels
+    )
+{
+    const double lsb = 1.0 / 32768.0;
+    double       overall = 0.0;
+
+    std::cout << "Seam deviation against sequential run (first " << SEAM_REPORT_SECONDS << " s after each seam):" << std::endl;
+
+    for (size_t seam = 1; seam < jobs.size(); seam++)
+    {
+        const std::vector<DLB_LFRACT> &par = jobs[seam].seam_capture;
+        const std::vector<DLB_LFRACT> &seq = ref.capture[seam];
+        size_t n = std::min(par.size(), seq.size());
+        size_t last_over_lsb = 0;
+        bool   over_lsb = false;
+        double max_dev = 0.0;
+
+        for (size_t i = 0; i < n; i++)
+        {
+            double dev = std::fabs((double)par[i] - (double)seq[i]);
+
+            if (dev > max_dev)
+            {
+                max_dev = dev;
+            }
+            if (dev > lsb)
+            {
+                last_over_lsb = i;
+                over_lsb = true;
+            }
+        }
+        if (max_dev > overall)
+        {
+            overall = max_dev;
+        }
+
+        double seam_time = (double)jobs[seam].first_block * DLB_MD_EMUL_BLOCK_SIZE / SEGMENT_SAMPLE_RATE;
+        std::cout << "  Seam " << seam << " at " << std::fixed << std::setprecision(3) << seam_time << " s: ";
+        if (max_dev == 0.0)
+        {
+            std::cout << "bit-exact" << std::endl;
+        }
+        else
+        {
+            double settle = (double)(last_over_lsb / channels + 1) / SEGMENT_SAMPLE_RATE;
+            std::cout << "max deviation " << std::setprecision(2) << 20.0 * std::log10(max_dev) << " dBFS";
+            if (over_lsb)
+            {
+                std::cout << ", within 1 LSB (16 bit) after " << std::setprecision(3) << settle << " s";
+            }
+            else
+            {
+                std::cout << ", within 1 LSB (16 bit) throughout";
+            }
+            std::cout << std::endl;
+        }
+    }
+
+    std::cout << "Maximum seam deviation: ";
+    if (overall == 0.0)
+    {
+        std::cout << "bit-exact" << std::endl;
+    }
+    else
+    {
+        std::cout << std::setprecision(2) << 20.0 * std::log10(overall) << " dBFS" << std::endl;
+    }
+    std::cout.unsetf(std::ios::floatfield);
+}
+
+void run_segment_parallel
+    (const std::string                  &input_file
+    ,const std::string                  &output_file
+    ,const dlb_md_emul_process_config_t &emul_conf
+    ,uint32_t                            num_outputs
+    ,const segment_options              &options
+    )
+{
+    std::vector<segment_job>  jobs(options.num_segments);
+    std::vector<std::thread>  workers;
+    seam_reference            ref;
+    uint64_t                  num_blocks;
+    uint64_t                  preroll_blocks;
+    uint64_t                  window_blocks = 0;
+    int                       channels;
+
+    {
+        SndfileHandle input_wav_file(input_file.c_str());
+        if (input_wav_file.error())
+        {
+            throw std::runtime_error("Input File not opened: " + std::string(input_wav_file.strError()));
+        }
+        channels = input_wav_file.channels();
+        num_blocks = ((uint64_t)input_wav_file.frames() + DLB_MD_EMUL_BLOCK_SIZE - 1) / DLB_MD_EMUL_BLOCK_SIZE;
+    }
+
+    if (num_blocks < options.num_segments)
+    {
+        throw std::runtime_error("Input too short for " + std::to_string(options.num_segments) + " segments");
+    }
+
+    preroll_blocks = (uint64_t)std::ceil(options.preroll_seconds * SEGMENT_SAMPLE_RATE / DLB_MD_EMUL_BLOCK_SIZE);
+    if (options.seam_report)
+    {
+        window_blocks = (uint64_t)std::ceil(SEAM_REPORT_SECONDS * SEGMENT_SAMPLE_RATE / DLB_MD_EMUL_BLOCK_SIZE);
+    }
+
+    for (unsigned int i = 0; i < options.num_segments; i++)
+    {
+        jobs[i].first_block   = num_blocks * i / options.num_segments;
+        jobs[i].end_block     = num_blocks * (i + 1) / options.num_segments;
+        jobs[i].preroll_block = (jobs[i].first_block > preroll_blocks) ? jobs[i].first_block - preroll_blocks : 0;
+        jobs[i].tmp_file      = output_file + ".seg" + std::to_string(i) + ".tmp";
+    }
+
+    std::cout << "Segments: " << options.num_segments << ", pre-roll: " << preroll_blocks << " blocks" << std::endl;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (segment_job &job : jobs)
+    {
+        workers.emplace_back(process_segment, &input_file, &emul_conf, num_outputs, window_blocks, &job);
+    }
+    if (options.seam_report)
+    {
+        workers.emplace_back(process_reference, &input_file, &emul_conf, num_outputs, window_blocks, &jobs, &ref);
+    }
+    for (std::thread &worker : workers)
+    {
+        worker.join();
+    }
+
+    std::string error;
+    for (const segment_job &job : jobs)
+    {
+        if (error.empty() && !job.error.empty())
+        {
+            error = job.error;
+        }
+    }
+    if (error.empty() && !ref.error.empty())
+    {
+        error = ref.error;
+    }
+    if (error.empty())
+    {
+        try
+        {
+            stitch_segments(output_file, channels, jobs);
+        }
+        catch (const std::exception &e)
+        {
+            error = e.what();
+        }
+    }
+    for (const segment_job &job : jobs)
+    {
+        std::remove(job.tmp_file.c_str());
+    }
+    if (!error.empty())
+    {
+        throw std::runtime_error(error);
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << "Wrote: " << num_blocks * DLB_MD_EMUL_BLOCK_SIZE << " frames in " << elapsed.count() << " s" << std::endl;
+
+    if (options.seam_report)
+    {
+        report_seams(jobs, ref, channels);
+    }
+}
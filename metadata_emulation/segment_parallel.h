@@ -0,0 +1,72 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Segment-parallel processing of a single input file
+ *
+ * The input is cut into N runs of whole blocks. Each run is processed by
+ * its own emulator on its own thread, starting pre-roll blocks early so
+ * that the compressor and filter state has converged by the time the
+ * segment starts. Pre-roll output is discarded, each segment is written
+ * to a temporary file and the temporaries are stitched into the output.
+ */
+
+#ifndef SEGMENT_PARALLEL_H
+#define SEGMENT_PARALLEL_H
+
+#include <string>
+
+#include "dlb_md_emul_api.h"
+
+typedef struct
+{
+    unsigned int    num_segments;       /**< 0 or 1 selects the sequential path */
+    double          preroll_seconds;    /**< warm-up before each segment boundary */
+    bool            seam_report;        /**< compare the seams against a sequential run */
+} segment_options;
+
+/*
+ * Process input_file into output_file in num_segments parallel segments.
+ * emul_conf carries everything except the buffer pointers. Throws on error.
+ */
+void run_segment_parallel
+    (const std::string                  &input_file
+    ,const std::string                  &output_file
+    ,const dlb_md_emul_process_config_t &emul_conf
+    ,uint32_t                            num_outputs
+    ,const segment_options              &options
+    );
+
+#endif /* SEGMENT_PARALLEL_H */
@@ -0,0 +1,233 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Buffered asynchronous per-block DRC trace file of MdEmu
+ */
+
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "trace_writer.h"
+
+typedef struct
+{
+    std::vector<dlb_md_emul_trace_record_t> records;
+    uint32_t                                used;
+} trace_buffer;
+
+/* Bounded by construction: it never holds more than the buffers allocated up front */
+typedef struct
+{
+    std::mutex                  lock;
+    std::condition_variable     ready;
+    std::deque<trace_buffer *>  items;
+    bool                        closed;
+} buffer_queue;
+
+struct trace_writer_state
+{
+    FILE                       *file;
+    std::string                 path;
+    std::vector<trace_buffer>   buffers;
+    buffer_queue                free_buffers;
+    buffer_queue                full_buffers;
+    trace_buffer               *current;        /**< filled by the emulator thread */
+    std::thread                 thread;
+    bool                        write_error;    /**< set by the writer thread, read after the join */
+    uint64_t                    records;
+};
+
+static void buffer_queue_push(buffer_queue *q, trace_buffer *buffer)
+{
+    {
+        std::lock_guard<std::mutex> guard(q->lock);
+        q->items.push_back(buffer);
+    }
+    q->ready.notify_one();
+}
+
+/* Returns nullptr once the queue is closed and empty */
+static trace_buffer *buffer_queue_pop(buffer_queue *q)
+{
+    std::unique_lock<std::mutex> guard(q->lock);
+    trace_buffer                *buffer;
+
+    q->ready.wait(guard, [q] { return !q->items.empty() || q->closed; });
+    if (q->items.empty())
+    {
+        return nullptr;
+    }
+    buffer = q->items.front();
+    q->items.pop_front();
+    return buffer;
+}
+
+static void buffer_queue_close(buffer_queue *q)
+{
+    {
+        std::lock_guard<std::mutex> guard(q->lock);
+        q->closed = true;
+    }
+    q->ready.notify_all();
+}
+
+/* After an error the buffers are still recycled, so the emulator never blocks on a dead disk */
+static void writer_thread(trace_writer_state *s)
+{
+    trace_buffer *buffer;
+
+    while ((buffer = buffer_queue_pop(&s->full_buffers)) != nullptr)
+    {
+        if (!s->write_error)
+        {
+            if (fwrite(buffer->records.data(), sizeof(dlb_md_emul_trace_record_t), buffer->used, s->file) != buffer->used)
+            {
+                s->write_error = true;
+            }
+            s->records += buffer->used;
+        }
+        buffer->used = 0;
+        buffer_queue_push(&s->free_buffers, buffer);
+    }
+}
+
+void trace_writer_open
+    (trace_writer          *writer
+    ,const std::string     &path
+    ,uint32_t               buffer_records
+    ,uint32_t               num_buffers
+    )
+{
+    dlb_md_emul_trace_file_header_t header;
+    trace_writer_state *s;
+
+    if (buffer_records < 1 || num_buffers < 2)
+    {
+        throw std::runtime_error("Trace writer needs at least 2 buffers of 1 record");
+    }
+
+    s = new trace_writer_state();
+    s->path = path;
+    s->file = fopen(path.c_str(), "wb");
+    if (!s->file)
+    {
+        delete s;
+        throw std::runtime_error("Trace file not created: " + path);
+    }
+
+    memset(&header, 0, sizeof(header));
+    header.magic       = DLB_MD_EMUL_TRACE_MAGIC;
+    header.version     = DLB_MD_EMUL_TRACE_VERSION;
+    header.record_size = sizeof(dlb_md_emul_trace_record_t);
+    if (fwrite(&header, sizeof(header), 1, s->file) != 1)
+    {
+        fclose(s->file);
+        delete s;
+        throw std::runtime_error("Trace file not written: " + path);
+    }
+
+    s->buffers.resize(num_buffers);
+    for (trace_buffer &buffer : s->buffers)
+    {
+        buffer.records.resize(buffer_records);
+        buffer.used = 0;
+    }
+    s->free_buffers.closed = false;
+    s->full_buffers.closed = false;
+    for (uint32_t i = 1; i < num_buffers; i++)
+    {
+        s->free_buffers.items.push_back(&s->buffers[i]);
+    }
+    s->current = &s->buffers[0];
+    s->write_error = false;
+    s->records = 0;
+    s->thread = std::thread(writer_thread, s);
+
+    writer->state = s;
+    writer->records = 0;
+}
+
+void trace_writer_record
+    (void                               *context
+    ,const dlb_md_emul_trace_record_t   *record
+    )
+{
+    trace_writer_state *s = ((trace_writer *)context)->state;
+    trace_buffer *buffer = s->current;
+
+    buffer->records[buffer->used++] = *record;
+    if (buffer->used == buffer->records.size())
+    {
+        buffer_queue_push(&s->full_buffers, buffer);
+        s->current = buffer_queue_pop(&s->free_buffers);
+    }
+}
+
+void trace_writer_close(trace_writer *writer)
+{
+    trace_writer_state *s = writer->state;
+    bool failed;
+    std::string path;
+
+    if (!s)
+    {
+        return;
+    }
+    writer->state = nullptr;
+
+    if (s->current->used)
+    {
+        buffer_queue_push(&s->full_buffers, s->current);
+    }
+    buffer_queue_close(&s->full_buffers);
+    s->thread.join();
+
+    failed = s->write_error;
+    failed |= (fclose(s->file) != 0);
+    writer->records = s->records;
+    path = s->path;
+    delete s;
+    if (failed)
+    {
+        throw std::runtime_error("Trace file not written: " + path);
+    }
+}
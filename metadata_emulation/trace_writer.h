@@ -0,0 +1,80 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Buffered asynchronous per-block DRC trace file of MdEmu
+ *
+ * The trace callback copies each record into a buffer on the emulator
+ * thread; full buffers go to a writer thread that appends them to the file.
+ * Buffers are allocated up front and reused, and the callback only waits
+ * when the disk falls behind all of them, so no record is ever dropped.
+ */
+
+#ifndef TRACE_WRITER_H
+#define TRACE_WRITER_H
+
+#include <string>
+
+#include "dlb_md_emul_trace.h"
+
+#define TRACE_WRITER_BUFFER_RECORDS 2048    /**< records per write, about 11 s of blocks at 48 kHz */
+#define TRACE_WRITER_BUFFERS        4
+
+struct trace_writer_state;
+
+typedef struct
+{
+    trace_writer_state     *state;      /**< nullptr when no trace is written */
+    uint64_t                records;    /**< records written by trace_writer_close */
+} trace_writer;
+
+/* Create path, write the file header and start the writer thread, throws on error */
+void trace_writer_open
+    (trace_writer          *writer
+    ,const std::string     &path
+    ,uint32_t               buffer_records
+    ,uint32_t               num_buffers
+    );
+
+/* dlb_md_emul_trace_fn, context is the trace_writer */
+void trace_writer_record
+    (void                               *context
+    ,const dlb_md_emul_trace_record_t   *record
+    );
+
+/* Write the records still buffered, stop the thread and close the file, throws on a write error */
+void trace_writer_close(trace_writer *writer);
+
+#endif /* TRACE_WRITER_H */
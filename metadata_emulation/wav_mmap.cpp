@@ -0,0 +1,584 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Memory-mapped WAV / RF64 / W64 input and output for the command line application
+ *
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define WAV_MMAP_SUPPORTED
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "wav_mmap.h"
+#include "md_emul_instance.h"
+
+#define WAV_FORMAT_PCM          0x0001
+#define WAV_FORMAT_IEEE_FLOAT   0x0003
+#define WAV_FORMAT_EXTENSIBLE   0xFFFE
+
+#define WAV_HEADER_SIZE         44
+#define RF64_HEADER_SIZE        80
+
+/* Sony Wave64 chunk GUIDs */
+static const unsigned char w64_riff_guid[16] = { 'r', 'i', 'f', 'f', 0x2E, 0x91, 0xCF, 0x11, 0xA5, 0xD6, 0x28, 0xDB, 0x04, 0xC1, 0x00, 0x00 };
+static const unsigned char w64_wave_guid[16] = { 'w', 'a', 'v', 'e', 0xF3, 0xAC, 0xD3, 0x11, 0x8C, 0xD1, 0x00, 0xC0, 0x4F, 0x8E, 0xDB, 0x8A };
+static const unsigned char w64_fmt_guid[16]  = { 'f', 'm', 't', ' ', 0xF3, 0xAC, 0xD3, 0x11, 0x8C, 0xD1, 0x00, 0xC0, 0x4F, 0x8E, 0xDB, 0x8A };
+static const unsigned char w64_data_guid[16] = { 'd', 'a', 't', 'a', 0xF3, 0xAC, 0xD3, 0x11, 0x8C, 0xD1, 0x00, 0xC0, 0x4F, 0x8E, 0xDB, 0x8A };
+
+static uint16_t rd16(const unsigned char *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t rd32(const unsigned char *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint64_t rd64(const unsigned char *p)
+{
+    return (uint64_t)rd32(p) | ((uint64_t)rd32(p + 4) << 32);
+}
+
+static void wr16(unsigned char *p, uint16_t v)
+{
+    p[0] = (unsigned char)v;
+    p[1] = (unsigned char)(v >> 8);
+}
+
+static void wr32(unsigned char *p, uint32_t v)
+{
+    wr16(p, (uint16_t)v);
+    wr16(p + 2, (uint16_t)(v >> 16));
+}
+
+static void wr64(unsigned char *p, uint64_t v)
+{
+    wr32(p, (uint32_t)v);
+    wr32(p + 4, (uint32_t)(v >> 32));
+}
+
+/* Check a fmt chunk body, returns false with the reason set if it is not supported */
+static bool parse_fmt
+    (wav_mmap_reader        *reader
+    ,const unsigned char    *fmt
+    ,uint64_t                size
+    ,std::string            *reason
+    )
+{
+    uint16_t tag, block_align, bits;
+
+    if (size < 16)
+    {
+        *reason = "truncated fmt chunk";
+        return false;
+    }
+    tag                 = rd16(fmt);
+    reader->channels    = rd16(fmt + 2);
+    reader->sample_rate = rd32(fmt + 4);
+    block_align         = rd16(fmt + 12);
+    bits                = rd16(fmt + 14);
+    if (tag == WAV_FORMAT_EXTENSIBLE && size >= 40)
+    {
+        tag = rd16(fmt + 24);           /* first two bytes of the sub-format GUID */
+    }
+
+    if (reader->channels == 0 || block_align != reader->channels * (bits / 8))
+    {
+        *reason = "unsupported sample layout";
+        return false;
+    }
+    reader->bytes_per_sample = bits / 8;
+
+    if (tag == WAV_FORMAT_PCM && (bits == 16 || bits == 24 || bits == 32))
+    {
+        reader->encoding = WAV_MMAP_PCM;
+    }
+    else if (tag == WAV_FORMAT_IEEE_FLOAT && (bits == 32 || bits == 64))
+    {
+        reader->encoding = WAV_MMAP_FLOAT;
+    }
+    else
+    {
+        *reason = "unsupported encoding " + std::to_string(tag) + "/" + std::to_string(bits);
+        return false;
+    }
+    return true;
+}
+
+/* RIFF and RF64 / BW64 */
+static bool parse_riff
+    (wav_mmap_reader        *reader
+    ,const unsigned char    *base
+    ,uint64_t                size
+    ,bool                    is_rf64
+    ,std::string            *reason
+    )
+{
+    uint64_t pos = 12;
+    uint64_t ds64_data_size = 0;
+    bool     have_fmt = false;
+
+    while (pos + 8 <= size)
+    {
+        const unsigned char *id = base + pos;
+        uint64_t             chunk_size = rd32(id + 4);
+        uint64_t             body = pos + 8;
+
+        if (memcmp(id, "ds64", 4) == 0 && chunk_size >= 16 && body + 16 <= size)
+        {
+            ds64_data_size = rd64(base + body + 8);
+        }
+        else if (memcmp(id, "fmt ", 4) == 0)
+        {
+            if (body + chunk_size > size || !parse_fmt(reader, base + body, chunk_size, reason))
+            {
+                if (reason->empty())
+                {
+                    *reason = "truncated fmt chunk";
+                }
+                return false;
+            }
+            have_fmt = true;
+        }
+        else if (memcmp(id, "data", 4) == 0)
+        {
+            if (!have_fmt)
+            {
+                *reason = "data before fmt chunk";
+                return false;
+            }
+            if (is_rf64 && chunk_size == 0xFFFFFFFFu)
+            {
+                chunk_size = ds64_data_size;
+            }
+            /* files still being written or with a bogus size end at the end of the file */
+            if (chunk_size == 0 || body + chunk_size > size)
+            {
+                chunk_size = size - body;
+            }
+            reader->data = base + body;
+            reader->frames = chunk_size / (reader->channels * reader->bytes_per_sample);
+            return true;
+        }
+        pos = body + chunk_size + (chunk_size & 1);
+    }
+    *reason = "no data chunk";
+    return false;
+}
+
+static bool parse_w64
+    (wav_mmap_reader        *reader
+    ,const unsigned char    *base
+    ,uint64_t                size
+    ,std::string            *reason
+    )
+{
+    uint64_t pos = 40;
+    bool     have_fmt = false;
+
+    while (pos + 24 <= size)
+    {
+        const unsigned char *guid = base + pos;
+        uint64_t             chunk_size = rd64(guid + 16);      /* includes the 24 byte header */
+        uint64_t             body = pos + 24;
+
+        if (chunk_size < 24)
+        {
+            break;
+        }
+        if (memcmp(guid, w64_fmt_guid, 16) == 0)
+        {
+            if (pos + chunk_size > size || !parse_fmt(reader, base + body, chunk_size - 24, reason))
+            {
+                if (reason->empty())
+                {
+                    *reason = "truncated fmt chunk";
+                }
+                return false;
+            }
+            have_fmt = true;
+        }
+        else if (memcmp(guid, w64_data_guid, 16) == 0)
+        {
+            if (!have_fmt)
+            {
+                *reason = "data before fmt chunk";
+                return false;
+            }
+            if (pos + chunk_size > size)
+            {
+                chunk_size = size - pos;
+            }
+            reader->data = base + body;
+            reader->frames = (chunk_size - 24) / (reader->channels * reader->bytes_per_sample);
+            return true;
+        }
+        pos += (chunk_size + 7) & ~(uint64_t)7;
+    }
+    *reason = "no data chunk";
+    return false;
+}
+
+bool wav_mmap_open_read
+    (wav_mmap_reader        *reader
+    ,const std::string      &input_file
+    ,std::string            *reason
+    )
+{
+    memset(reader, 0, sizeof(*reader));
+    reason->clear();
+
+#ifdef WAV_MMAP_SUPPORTED
+    const unsigned char *base;
+    struct stat          st;
+    bool                 ok;
+    int                  fd = open(input_file.c_str(), O_RDONLY);
+
+    if (fd < 0)
+    {
+        *reason = "cannot open " + input_file;
+        return false;
+    }
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size < WAV_HEADER_SIZE)
+    {
+        close(fd);
+        *reason = "not a regular WAV sized file";
+        return false;
+    }
+    reader->map_size = (size_t)st.st_size;
+    reader->map = mmap(nullptr, reader->map_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (reader->map == MAP_FAILED)
+    {
+        reader->map = nullptr;
+        *reason = "mmap failed";
+        return false;
+    }
+    madvise(reader->map, reader->map_size, MADV_SEQUENTIAL);
+
+    base = (const unsigned char *)reader->map;
+    if (memcmp(base, "RIFF", 4) == 0 && memcmp(base + 8, "WAVE", 4) == 0)
+    {
+        ok = parse_riff(reader, base, reader->map_size, false, reason);
+    }
+    else if ((memcmp(base, "RF64", 4) == 0 || memcmp(base, "BW64", 4) == 0) && memcmp(base + 8, "WAVE", 4) == 0)
+    {
+        ok = parse_riff(reader, base, reader->map_size, true, reason);
+    }
+    else if (reader->map_size >= 40 && memcmp(base, w64_riff_guid, 16) == 0 && memcmp(base + 24, w64_wave_guid, 16) == 0)
+    {
+        ok = parse_w64(reader, base, reader->map_size, reason);
+    }
+    else
+    {
+        *reason = "not a WAV, RF64 or W64 file";
+        ok = false;
+    }
+
+    if (!ok)
+    {
+        wav_mmap_close_read(reader);
+    }
+    return ok;
+#else
+    (void)input_file;
+    *reason = "memory mapping not supported on this platform";
+    return false;
+#endif
+}
+
+void wav_mmap_close_read(wav_mmap_reader *reader)
+{
+#ifdef WAV_MMAP_SUPPORTED
+    if (reader->map)
+    {
+        munmap(reader->map, reader->map_size);
+    }
+#endif
+    reader->map = nullptr;
+    reader->data = nullptr;
+}
+
+/* Header as libsndfile writes it for SF_FORMAT_WAV | SF_FORMAT_PCM_16, RF64 when it does not fit */
+static size_t write_header
+    (unsigned char  *p
+    ,int             channels
+    ,uint32_t        sample_rate
+    ,uint64_t        data_size
+    )
+{
+    bool    rf64 = data_size > 0xFFFFFFFFull - (WAV_HEADER_SIZE - 8);
+    size_t  pos = 0;
+
+    memcpy(p, rf64 ? "RF64" : "RIFF", 4);
+    wr32(p + 4, rf64 ? 0xFFFFFFFFu : (uint32_t)(data_size + WAV_HEADER_SIZE - 8));
+    memcpy(p + 8, "WAVE", 4);
+    pos = 12;
+
+    if (rf64)
+    {
+        memcpy(p + pos, "ds64", 4);
+        wr32(p + pos + 4, 28);
+        wr64(p + pos + 8, data_size + RF64_HEADER_SIZE - 8);
+        wr64(p + pos + 16, data_size);
+        wr64(p + pos + 24, data_size / (2 * channels));
+        wr32(p + pos + 32, 0);
+        pos += 36;
+    }
+
+    memcpy(p + pos, "fmt ", 4);
+    wr32(p + pos + 4, 16);
+    wr16(p + pos + 8, WAV_FORMAT_PCM);
+    wr16(p + pos + 10, (uint16_t)channels);
+    wr32(p + pos + 12, sample_rate);
+    wr32(p + pos + 16, sample_rate * 2 * channels);
+    wr16(p + pos + 20, (uint16_t)(2 * channels));
+    wr16(p + pos + 22, 16);
+    pos += 24;
+
+    memcpy(p + pos, "data", 4);
+    wr32(p + pos + 4, rf64 ? 0xFFFFFFFFu : (uint32_t)data_size);
+    return pos + 8;
+}
+
+void wav_mmap_open_write
+    (wav_mmap_writer        *writer
+    ,const std::string      &output_file
+    ,int                     channels
+    ,uint32_t                sample_rate
+    ,uint64_t                frames
+    )
+{
+    memset(writer, 0, sizeof(*writer));
+
+#ifdef WAV_MMAP_SUPPORTED
+    unsigned char   header[RF64_HEADER_SIZE];
+    uint64_t        data_size = frames * channels * 2;
+    size_t          header_size = write_header(header, channels, sample_rate, data_size);
+    int             fd = open(output_file.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0666);
+
+    if (fd < 0)
+    {
+        throw std::runtime_error("Output File not opened: " + output_file);
+    }
+    writer->map_size = (size_t)(header_size + data_size);
+    if (ftruncate(fd, (off_t)writer->map_size) != 0)
+    {
+        close(fd);
+        throw std::runtime_error("Output File could not be sized: " + output_file);
+    }
+    writer->map = mmap(nullptr, writer->map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (writer->map == MAP_FAILED)
+    {
+        writer->map = nullptr;
+        throw std::runtime_error("Output File could not be mapped: " + output_file);
+    }
+    madvise(writer->map, writer->map_size, MADV_SEQUENTIAL);
+
+    memcpy(writer->map, header, header_size);
+    writer->data = (unsigned char *)writer->map + header_size;
+    writer->frames = frames;
+    writer->channels = channels;
+#else
+    (void)output_file;
+    (void)channels;
+    (void)sample_rate;
+    (void)frames;
+    throw std::runtime_error("Memory mapped output not supported on this platform");
+#endif
+}
+
+void wav_mmap_close_write(wav_mmap_writer *writer)
+{
+#ifdef WAV_MMAP_SUPPORTED
+    if (writer->map)
+    {
+        munmap(writer->map, writer->map_size);
+    }
+#endif
+    writer->map = nullptr;
+    writer->data = nullptr;
+}
+
+/* Same scaling as libsndfile's normalised reads */
+static void decode_frames
+    (const wav_mmap_reader  &reader
+    ,uint64_t                first_frame
+    ,uint32_t                frames
+    ,DLB_LFRACT             *dst
+    )
+{
+    const size_t         count = (size_t)frames * reader.channels;
+    const unsigned char *src = reader.data + first_frame * reader.channels * reader.bytes_per_sample;
+    size_t               i;
+
+    if (reader.encoding == WAV_MMAP_FLOAT)
+    {
+        if (reader.bytes_per_sample == 4)
+        {
+            for (i = 0; i < count; i++)
+            {
+                uint32_t bits = rd32(src + 4 * i);
+                float    f;
+
+                memcpy(&f, &bits, sizeof(f));
+                dst[i] = (DLB_LFRACT)f;
+            }
+        }
+        else
+        {
+            for (i = 0; i < count; i++)
+            {
+                uint64_t bits = rd64(src + 8 * i);
+                double   d;
+
+                memcpy(&d, &bits, sizeof(d));
+                dst[i] = (DLB_LFRACT)d;
+            }
+        }
+        return;
+    }
+
+    switch (reader.bytes_per_sample)
+    {
+        case 2:
+            for (i = 0; i < count; i++)
+            {
+                dst[i] = (DLB_LFRACT)((int16_t)rd16(src + 2 * i) * (1.0 / 0x8000));
+            }
+            break;
+
+        case 3:
+            for (i = 0; i < count; i++)
+            {
+                const unsigned char *s = src + 3 * i;
+                int32_t              v = (int32_t)(((uint32_t)s[0] << 8) | ((uint32_t)s[1] << 16) | ((uint32_t)s[2] << 24));
+
+                dst[i] = (DLB_LFRACT)(v * (1.0 / 0x80000000u));
+            }
+            break;
+
+        default:
+            for (i = 0; i < count; i++)
+            {
+                dst[i] = (DLB_LFRACT)((int32_t)rd32(src + 4 * i) * (1.0 / 0x80000000u));
+            }
+            break;
+    }
+}
+
+/* Same rounding as libsndfile's normalised 16 bit writes without clipping */
+static void encode_frames
+    (wav_mmap_writer        &writer
+    ,uint64_t                first_frame
+    ,uint32_t                frames
+    ,const DLB_LFRACT       *src
+    )
+{
+    const size_t   count = (size_t)frames * writer.channels;
+    unsigned char *dst = writer.data + first_frame * writer.channels * 2;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        wr16(dst + 2 * i, (uint16_t)(int16_t)lrint((double)src[i] * 0x7FFF));
+    }
+}
+
+uint64_t run_mmap_pipeline
+    (const wav_mmap_reader  &reader
+    ,wav_mmap_writer        &writer
+    ,double                  progress_interval
+    ,io_pipeline_block_fn    process_block
+    ,void                   *context
+    )
+{
+    std::vector<DLB_LFRACT>               block(md_emul_block_buffer_size(1, reader.channels));
+    std::chrono::steady_clock::time_point last_report = std::chrono::steady_clock::now();
+    uint64_t                              num_blocks = (reader.frames + DLB_MD_EMUL_BLOCK_SIZE - 1) / DLB_MD_EMUL_BLOCK_SIZE;
+    uint64_t                              b;
+
+    if (writer.channels != reader.channels || writer.frames < num_blocks * DLB_MD_EMUL_BLOCK_SIZE)
+    {
+        throw std::runtime_error("Mapped output does not fit the input");
+    }
+
+    for (b = 0; b < num_blocks; b++)
+    {
+        uint64_t first_frame = b * DLB_MD_EMUL_BLOCK_SIZE;
+        uint32_t frames = DLB_MD_EMUL_BLOCK_SIZE;
+
+        if (first_frame + frames > reader.frames)
+        {
+            frames = (uint32_t)(reader.frames - first_frame);
+            std::fill(block.begin() + (size_t)frames * reader.channels, block.begin() + (size_t)DLB_MD_EMUL_BLOCK_SIZE * reader.channels, (DLB_LFRACT)0);
+        }
+        decode_frames(reader, first_frame, frames, block.data());
+        process_block(context, block.data(), b);
+        encode_frames(writer, first_frame, DLB_MD_EMUL_BLOCK_SIZE, block.data());
+
+        if (progress_interval > 0.0 && (b & 255) == 0)
+        {
+            std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+            if (std::chrono::duration<double>(now - last_report).count() >= progress_interval)
+            {
+                std::cout << "\rWrote: " << first_frame + DLB_MD_EMUL_BLOCK_SIZE << " frames" << std::flush;
+                last_report = now;
+            }
+        }
+    }
+
+    if (progress_interval > 0.0)
+    {
+        std::cout << "\rWrote: " << num_blocks * DLB_MD_EMUL_BLOCK_SIZE << " frames" << std::flush;
+    }
+    return num_blocks * DLB_MD_EMUL_BLOCK_SIZE;
+}
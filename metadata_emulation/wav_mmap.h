@@ -0,0 +1,117 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Memory-mapped WAV / RF64 / W64 input and output for the command line application
+ *
+ * Only uncompressed little-endian PCM (16, 24, 32 bit) and IEEE float (32,
+ * 64 bit) input is handled; anything else is left to libsndfile. Output is
+ * always 16 bit PCM, written as WAV or as RF64 once the data exceeds 4 GB.
+ * Sample conversion matches libsndfile, so both paths produce identical files.
+ */
+
+#ifndef WAV_MMAP_H
+#define WAV_MMAP_H
+
+#include <cstddef>
+#include <string>
+
+#include "dlb_md_emul_api.h"
+#include "io_pipeline.h"
+
+typedef enum
+{
+    WAV_MMAP_PCM,
+    WAV_MMAP_FLOAT
+} wav_mmap_encoding;
+
+typedef struct
+{
+    void                   *map;
+    size_t                  map_size;
+    const unsigned char    *data;               /**< first byte of the first frame */
+    uint64_t                frames;
+    int                     channels;
+    uint32_t                sample_rate;
+    wav_mmap_encoding       encoding;
+    uint32_t                bytes_per_sample;
+} wav_mmap_reader;
+
+typedef struct
+{
+    void                   *map;
+    size_t                  map_size;
+    unsigned char          *data;
+    uint64_t                frames;
+    int                     channels;
+} wav_mmap_writer;
+
+/*
+ * Map input_file if it is a supported WAV, RF64 or W64 file. Returns false
+ * with the reason set when the caller should fall back to libsndfile.
+ */
+bool wav_mmap_open_read
+    (wav_mmap_reader        *reader
+    ,const std::string      &input_file
+    ,std::string            *reason
+    );
+
+void wav_mmap_close_read(wav_mmap_reader *reader);
+
+/* Create output_file pre-sized for frames of 16 bit PCM and map it, throws on error */
+void wav_mmap_open_write
+    (wav_mmap_writer        *writer
+    ,const std::string      &output_file
+    ,int                     channels
+    ,uint32_t                sample_rate
+    ,uint64_t                frames
+    );
+
+void wav_mmap_close_write(wav_mmap_writer *writer);
+
+/*
+ * Run every block of reader through process_block into writer. A final
+ * partial block is padded with silence, so writer must hold the input rounded
+ * up to whole blocks. Returns the frames written, throws on error.
+ */
+uint64_t run_mmap_pipeline
+    (const wav_mmap_reader  &reader
+    ,wav_mmap_writer        &writer
+    ,double                  progress_interval
+    ,io_pipeline_block_fn    process_block
+    ,void                   *context
+    );
+
+#endif /* WAV_MMAP_H */
@@ -46,7 +46,45 @@
 #include "dd_emulation.h"
 #include "drc_applier.h"
 #include "emul_filters.h"
-#include <string.h> /* for memset */
+#include <string.h> /* for memset, memcpy */
+#ifndef MD_EMUL_NO_STATS
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+#endif
+
+#ifndef MD_EMUL_NO_STATS
+/* Runtime statistics, behind the emulator struct */
+typedef struct
+{
+    dd_emu_stats stats;
+    COMPR_STATS  compr_stats;
+    uint64_t     stage_start;
+} dd_emu_stats_data;
+#endif
+
+/* Values kept for the taps while one is set, behind the emulator struct when the capacity has taps */
+typedef struct
+{
+    uint64_t      blocks[DD_EMU_TAP_SLOTS];
+    COMPR_TRACE   compr_trace;
+    DLB_LFRACT    gain_drc[DD_EMU_MAX_BLOCKS];
+    DLB_LFRACT    gain_compr;
+    DLB_LFRACT    applied_gain[DD_EMU_MAX_OUTPUTS][DD_EMU_MAX_BLOCKS];
+} dd_emu_tap_data;
+
+/* Context storage of one tap slot */
+typedef struct
+{
+    union
+    {
+        void       *p;
+        void      (*fn)(void);
+        double      d;
+    }             word[DD_EMU_TAP_STORAGE_SIZE / 8];
+} dd_emu_tap_storage;
 
 typedef struct
 {
@@ -67,26 +105,151 @@ typedef struct
     /* Gain window */
     DLB_LFRACT last_gain[DD_EMU_MAX_OUTPUTS];
 
-    /* Filter states */
-    DLB_LFRACT hpf_history[DD_EMU_MAX_CHANS];
-    DLB_LFRACT lpf_history[DD_EMU_MAX_CHANS][BWLIMORDER * BQHISTORY];
-    DLB_LFRACT lfe_history[DD_EMU_MAX_CHANS][LFEORDER * BQHISTORY];
-    DLB_LFRACT psf_history[DD_EMU_MAX_CHANS][MPHSTAGES * BQCOEFFS];
-    DLB_LFRACT psf_surr_history[DD_EMU_MAX_CHANS][SPHSTAGES * BQCOEFFS];
+    /* What the memory was sized for, and the compressor's share of it */
+    dd_emu_capacity capacity;
+    uint32_t compr_static_mem_size;
+    uint32_t compr_dynamic_mem_size;
+    uint32_t compr_ext_static_mem_size;
+
+    /* Filter states, [capacity.num_chans] behind this struct, NULL for filters not in capacity.filters */
+    DLB_LFRACT  *hpf_history;
+    DLB_LFRACT (*lpf_history)[BWLIMORDER * BQHISTORY];
+    DLB_LFRACT (*lfe_history)[LFEORDER * BQHISTORY];
+    DLB_LFRACT (*psf_history)[MPHSTAGES * BQCOEFFS];
+    DLB_LFRACT (*psf_surr_history)[SPHSTAGES * BQCOEFFS];
+
+#ifndef MD_EMUL_NO_STATS
+    /* Runtime statistics, behind the filter histories */
+    dd_emu_stats_data *p_stats;
+#endif
+
+    /* Per-block taps, the gains and gain computer states are kept while one is set.
+       Behind the statistics for the slots in capacity.taps, NULL without */
+    int                 tap_active;
+    dd_emu_tap_fn       tap_fn[DD_EMU_TAP_SLOTS];
+    void               *tap_context[DD_EMU_TAP_SLOTS];
+    dd_emu_tap_data    *p_tap;
+    dd_emu_tap_storage *tap_storage[DD_EMU_TAP_SLOTS];
 
 } dd_emu_internal_data;
 
+/* Persistent emulator state as saved in a checkpoint, no pointers */
+typedef struct
+{
+    int32_t     channel_mode;
+    int32_t     lfe_on;
+    int32_t     emu_blk_size;
+    int32_t     sample_rate;
+    int32_t     num_blocks;
+
+    DLB_LFRACT  last_gain[DD_EMU_MAX_OUTPUTS];
+
+    DLB_LFRACT  hpf_history[DD_EMU_MAX_CHANS];
+    DLB_LFRACT  lpf_history[DD_EMU_MAX_CHANS][BWLIMORDER * BQHISTORY];
+    DLB_LFRACT  lfe_history[DD_EMU_MAX_CHANS][LFEORDER * BQHISTORY];
+    DLB_LFRACT  psf_history[DD_EMU_MAX_CHANS][MPHSTAGES * BQCOEFFS];
+    DLB_LFRACT  psf_surr_history[DD_EMU_MAX_CHANS][SPHSTAGES * BQCOEFFS];
+
+    COMPR_STATE compr;
+} dd_emu_state;
+
+/* One filter history of the emulator and its place in a saved state */
+typedef struct
+{
+    DLB_LFRACT *p_emul;         /* NULL when the filter is not in the capacity */
+    DLB_LFRACT *p_state;
+    int         kept;           /* values the emulator holds, the first of the state's */
+    int         total;          /* values in the state */
+} history_map;
+
+#define NUM_HISTORIES   5
+
 /* Mapping channel mode -> channel count, no LFE included */
 static const int channel_number[DD_EMU_CHMOD_LAST] = {2, 1, 2, 3, 3, 4, 4, 5, 6, 7};
 
 /* Mapping channel mode -> channel count, LFE included */
 static const int channel_number_lfe[DD_EMU_CHMOD_LAST] = {2, 1, 2, 3, 3, 4, 4, 6, 7, 8};
 
+/* History of each filter per channel, in DLB_LFRACT */
+#define HPF_HISTORY         1
+#define LPF_HISTORY         (BWLIMORDER * BQHISTORY)
+#define LFE_HISTORY         (LFEORDER * BQHISTORY)
+#define PSF_HISTORY         (MPHSTAGES * BQCOEFFS)
+#define PSF_SURR_HISTORY    (SPHSTAGES * BQCOEFFS)
+
+/* The compressor memory follows the emulator's, kept aligned for its pointer tables */
+#define EMUL_STATIC_ALIGN   16u
+#define EMUL_ALIGN(size)    (((size) + EMUL_STATIC_ALIGN - 1) & ~(EMUL_STATIC_ALIGN - 1))
+
+/* Capacity of dd_emulation_get_required_mem_size(NULL, ...), fits every configuration */
+static const dd_emu_capacity capacity_all =
+{
+    DD_EMU_CHMODE_3_4, DD_EMU_MAX_BLOCKS, DD_EMU_MAX_CHANS, DD_EMU_FILTER_ALL, DD_EMU_MAX_OUTPUTS, DD_EMU_TAPS_ALL
+};
+
+
+#ifndef MD_EMUL_NO_STATS
+/* Monotonic time in ns for the stage times of the statistics */
+static inline
+uint64_t
+stats_clock
+    (void)
+{
+#ifdef _WIN32
+    LARGE_INTEGER counter, frequency;
+
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return (uint64_t)((double)counter.QuadPart * 1e9 / (double)frequency.QuadPart);
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+/* Histogram bin of a DRC gain as apply_drc() returns it, linear with 4 bits of headroom */
+static inline
+int
+gain_reduction_bin
+    (DLB_LFRACT gain
+    )
+{
+    /* DD_EMU_STATS_GR_EDGES_DB as linear gains, 10^(-dB/20) / 16 */
+    static const DLB_LFRACT edges[DD_EMU_STATS_GR_BINS - 1] =
+    {
+        DLB_LcF(0.891250938 / 16.0), DLB_LcF(0.794328235 / 16.0), DLB_LcF(0.630957344 / 16.0),
+        DLB_LcF(0.501187234 / 16.0), DLB_LcF(0.316227766 / 16.0), DLB_LcF(0.177827941 / 16.0),
+        DLB_LcF(0.1 / 16.0)
+    };
+    int bin = 0;
+
+    while (bin < DD_EMU_STATS_GR_BINS - 1 && DLB_IltLL(gain, edges[bin]))
+    {
+        bin++;
+    }
+    return bin;
+}
+
+#define STATS_COUNT(p, counter, n)      ((p)->p_stats->stats.counter += (n))
+#define STATS_ENTER_STAGE(p)            ((p)->p_stats->stage_start = stats_clock())
+#define STATS_LEAVE_STAGE(p, stage)     ((p)->p_stats->stats.stage_time_ns[stage] += stats_clock() - (p)->p_stats->stage_start)
+#else
+#define STATS_COUNT(p, counter, n)
+#define STATS_ENTER_STAGE(p)
+#define STATS_LEAVE_STAGE(p, stage)
+#endif
 
 /*
  * Private Functions
  */
 static void initialize_filters(dd_emu_internal_data* p_dd_emul_data);
+static DD_EMU_STATUS open_compressor(dd_emu_internal_data* p_dd_emul_data);
+static int compr_fits(const dd_emu_internal_data* p_dd_emul_data, COMPR_CHMODE channel_mode, int num_blocks);
+static uint32_t filter_history_size(const dd_emu_capacity *p_capacity);
+static uint32_t feature_size(const dd_emu_capacity *p_capacity);
+static void map_histories(dd_emu_internal_data* p_dd_emul_data, dd_emu_state *p_state, history_map *p_map);
 static 
 void 
 clear_channels
@@ -94,6 +257,24 @@ clear_channels
     ,dd_emu_process_config  *p_buf_config
     );
 
+#ifdef MD_EMUL_FAST_MATH
+static
+void
+clip_outputs
+    (const dd_emu_process_config *p_buf_config
+    ,int                          num_outputs
+    ,int                          num_samples
+    );
+#endif
+
+static
+void
+tap_blocks
+    (dd_emu_internal_data        *p_dd_emul_data
+    ,const dd_emu_process_config *p_buf_config
+    ,int                          num_outputs
+    );
+
 /* encoder */
 static 
 void 
@@ -110,7 +291,7 @@ decoder_emulation
      ,int                    num_outputs
      );
 
-#if !defined(DLB_UT)
+#if !defined(DLB_UT) && !defined(MD_EMUL_KERNEL_BENCH)
 static
 #endif
 void
@@ -127,10 +308,66 @@ attenuate_surrounds
 /*
  * Public Functions
  */
+void
+dd_emulation_get_capacity
+    (
+      const dd_emu_process_config *p_buf_config
+     ,int                          num_outputs
+     ,dd_emu_capacity             *p_capacity
+    )
+{
+    int chan;
+    DD_EMU_CHAN_MAP channel;
+
+    p_capacity->channel_mode = p_buf_config->channel_mode;
+    p_capacity->num_blocks   = p_buf_config->num_samples / p_buf_config->emu_blk_size;
+    p_capacity->num_chans    = 0;
+    p_capacity->filters      = 0;
+    p_capacity->num_outputs  = num_outputs;
+    p_capacity->taps         = 0;
+
+    if(!(p_buf_config->control & DD_EMU_CONTROL_ENCODER_ENABLE))
+    {
+        return;
+    }
+
+    /* Filters keep a history in the buffer channel they run on, see encoder_emulation */
+    for(chan = 0; chan < DD_EMU_MAX_CHANS; chan++)
+    {
+        channel = p_buf_config->a_chan_map[chan];
+        if(channel == DD_EMU_CHAN_NONE)
+        {
+            continue;
+        }
+        p_capacity->num_chans = chan + 1;
+        if(p_buf_config->hpfon)
+        {
+            p_capacity->filters |= DD_EMU_FILTER_HPF;
+        }
+        if(channel != DD_EMU_CHAN_LFE && p_buf_config->bwlpfon)
+        {
+            p_capacity->filters |= DD_EMU_FILTER_BWLPF;
+        }
+        if(channel == DD_EMU_CHAN_LFE && p_buf_config->lfelpfon)
+        {
+            p_capacity->filters |= DD_EMU_FILTER_LFELPF;
+        }
+        if(p_buf_config->sur90on)
+        {
+            p_capacity->filters |= DD_EMU_FILTER_PSF;
+        }
+    }
+    if(!p_capacity->filters)
+    {
+        p_capacity->num_chans = 0;
+    }
+}
+
 int32_t
 dd_emulation_get_required_mem_size
     (
-      uint32_t   *p_emul_static_mem_size
+      const dd_emu_capacity *p_capacity
+     ,uint32_t   *p_emul_static_mem_size
      ,uint32_t   *p_emul_dynamic_mem_size
      ,uint32_t   *p_compr_static_mem_size
      ,uint32_t   *p_compr_dynamic_mem_size
@@ -140,24 +377,37 @@ dd_emulation_get_required_mem_size
 {
     int32_t err;
 
-    /* get the required memory size for the 'worst' case */
-    err = md_ComprGetRequiredBufferSize(COMPR_CHMODE_3_4
-                                       ,DD_EMU_MAX_BLOCKS
+    if(NULL == p_capacity)
+    {
+        p_capacity = &capacity_all;
+    }
+    if(p_capacity->num_blocks < DD_EMU_MIN_BLOCKS || p_capacity->num_blocks > DD_EMU_MAX_BLOCKS ||
+       p_capacity->num_chans < 0 || p_capacity->num_chans > DD_EMU_MAX_CHANS ||
+       p_capacity->num_outputs < 1 || p_capacity->num_outputs > DD_EMU_MAX_OUTPUTS ||
+       (p_capacity->taps & ~DD_EMU_TAPS_ALL))
+    {
+        return DD_EMU_STATUS_INVALID_PARAM_ERR;
+    }
+
+    err = md_ComprGetRequiredBufferSize((COMPR_CHMODE)p_capacity->channel_mode
+                                       ,(uint16_t)p_capacity->num_blocks
                                        ,p_compr_static_mem_size
                                        ,p_compr_dynamic_mem_size
                                        ,p_compr_ext_static_mem_size
                                        ,DD_EMU_COMPR_BUFFER_SIZE
                                        );
 
-    *p_emul_static_mem_size  = sizeof(dd_emu_internal_data);
+    *p_emul_static_mem_size  = EMUL_ALIGN(sizeof(dd_emu_internal_data) + filter_history_size(p_capacity)) + feature_size(p_capacity);
     *p_emul_dynamic_mem_size  = 0;
 
+    (void)emu_blk_size;
     return err;
 }
 
 int32_t dd_emulation_open
     (
-     void *p_static_mem
+     const dd_emu_capacity *p_capacity
+    ,void *p_static_mem
     ,void *p_dynamic_mem
     ,uint32_t emul_static_mem_size
     ,uint32_t emul_dynamic_mem_size
@@ -168,6 +418,10 @@ int32_t dd_emulation_open
     )
 {
     int32_t err = DD_EMU_STATUS_OK;
+    uint32_t required[5];
+    DLB_LFRACT *p_history;
+    uint8_t *p_feature;
+    int num_chans, slot;
 
     dd_emu_internal_data* p_dd_emul_data;
 
@@ -175,9 +429,85 @@ int32_t dd_emulation_open
     {
         return DD_EMU_STATUS_MEM_ALLOC_ERR;
     }
+    if(NULL == p_capacity)
+    {
+        p_capacity = &capacity_all;
+    }
+
+    /* Refuse memory smaller than the capacity needs */
+    err = dd_emulation_get_required_mem_size(p_capacity, &required[0], &required[1], &required[2], &required[3], &required[4], emul_blk_size);
+    if(err)
+    {
+        return err;
+    }
+    if(emul_static_mem_size < required[0] || emul_dynamic_mem_size < required[1] ||
+       compr_static_mem_size < required[2] || compr_dynamic_mem_size < required[3] || compr_ext_static_mem_size < required[4])
+    {
+        return DD_EMU_STATUS_MEM_ALLOC_ERR;
+    }
 
     p_dd_emul_data = (dd_emu_internal_data*)p_static_mem;
 
+    p_dd_emul_data->capacity                  = *p_capacity;
+    p_dd_emul_data->compr_static_mem_size     = compr_static_mem_size;
+    p_dd_emul_data->compr_dynamic_mem_size    = compr_dynamic_mem_size;
+    p_dd_emul_data->compr_ext_static_mem_size = compr_ext_static_mem_size;
+
+    /* Filter histories of the channels and filters the capacity holds */
+    num_chans = p_capacity->num_chans;
+    p_history = (DLB_LFRACT*)(p_dd_emul_data + 1);
+    p_dd_emul_data->hpf_history      = NULL;
+    p_dd_emul_data->lpf_history      = NULL;
+    p_dd_emul_data->lfe_history      = NULL;
+    p_dd_emul_data->psf_history      = NULL;
+    p_dd_emul_data->psf_surr_history = NULL;
+    if(p_capacity->filters & DD_EMU_FILTER_HPF)
+    {
+        p_dd_emul_data->hpf_history = p_history;
+        p_history += num_chans * HPF_HISTORY;
+    }
+    if(p_capacity->filters & DD_EMU_FILTER_BWLPF)
+    {
+        p_dd_emul_data->lpf_history = (DLB_LFRACT (*)[LPF_HISTORY])p_history;
+        p_history += num_chans * LPF_HISTORY;
+    }
+    if(p_capacity->filters & DD_EMU_FILTER_LFELPF)
+    {
+        p_dd_emul_data->lfe_history = (DLB_LFRACT (*)[LFE_HISTORY])p_history;
+        p_history += num_chans * LFE_HISTORY;
+    }
+    if(p_capacity->filters & DD_EMU_FILTER_PSF)
+    {
+        p_dd_emul_data->psf_history = (DLB_LFRACT (*)[PSF_HISTORY])p_history;
+        p_history += num_chans * PSF_HISTORY;
+        p_dd_emul_data->psf_surr_history = (DLB_LFRACT (*)[PSF_SURR_HISTORY])p_history;
+    }
+
+    /* Statistics and the storage of the taps the capacity holds follow the histories */
+    p_feature = (uint8_t*)p_dd_emul_data + EMUL_ALIGN(sizeof(dd_emu_internal_data) + filter_history_size(p_capacity));
+#ifndef MD_EMUL_NO_STATS
+    p_dd_emul_data->p_stats = (dd_emu_stats_data*)p_feature;
+    p_feature += EMUL_ALIGN(sizeof(dd_emu_stats_data));
+    memset(p_dd_emul_data->p_stats, 0, sizeof(dd_emu_stats_data));
+#endif
+    p_dd_emul_data->p_tap = NULL;
+    if(p_capacity->taps)
+    {
+        p_dd_emul_data->p_tap = (dd_emu_tap_data*)p_feature;
+        p_feature += EMUL_ALIGN(sizeof(dd_emu_tap_data));
+    }
+    for(slot = 0; slot < DD_EMU_TAP_SLOTS; slot++)
+    {
+        p_dd_emul_data->tap_storage[slot] = NULL;
+        if(p_capacity->taps & (1u << slot))
+        {
+            p_dd_emul_data->tap_storage[slot] = (dd_emu_tap_storage*)p_feature;
+            p_feature += EMUL_ALIGN(sizeof(dd_emu_tap_storage));
+        }
+    }
+    p_dd_emul_data->tap_active = 0;
+    memset(p_dd_emul_data->tap_fn, 0, sizeof(p_dd_emul_data->tap_fn));
+
    /*initialize drc pointers to externally allocated space */
 /*    p_dd_emul_data->comp_static_internal  = (uint32_t*)((uint32_t)p_dd_emul_data + emul_static_mem_size);
     p_dd_emul_data->comp_static_external  = (uint32_t*)((uint32_t)(p_dd_emul_data->comp_static_internal) + compr_static_mem_size); */
@@ -207,11 +537,11 @@ int32_t dd_emulation_reset(void *const p_dd_emul_hdl, uint32_t emul_blk_size)
 
     p_dd_emul_data = (dd_emu_internal_data*)p_dd_emul_hdl;
 
-    p_dd_emul_data->channel_mode = COMPR_CHMODE_3_4;
+    p_dd_emul_data->channel_mode = (COMPR_CHMODE)p_dd_emul_data->capacity.channel_mode;
     p_dd_emul_data->lfe_on       = 1;
     p_dd_emul_data->emu_blk_size = emul_blk_size;
     p_dd_emul_data->sample_rate  = 48000;
-    p_dd_emul_data->num_blocks   = DD_EMU_MAX_BLOCKS;
+    p_dd_emul_data->num_blocks   = (uint16_t)p_dd_emul_data->capacity.num_blocks;
 
     /* Initialize last gain */
     p_dd_emul_data->last_gain[0] = DLB_LcF(1.0/16.0);
@@ -221,22 +551,207 @@ int32_t dd_emulation_reset(void *const p_dd_emul_hdl, uint32_t emul_blk_size)
     initialize_filters(p_dd_emul_data);
 
     /* Initialize compression module (calculates DRC) */
-    p_dd_emul_data->compr_handle = md_ComprOpen
-            (p_dd_emul_data->comp_static_internal
-            ,p_dd_emul_data->comp_dynamic_internal
-            ,p_dd_emul_data->comp_static_external
-            ,p_dd_emul_data->channel_mode
-            ,p_dd_emul_data->lfe_on
-            ,p_dd_emul_data->num_blocks
-            ,p_dd_emul_data->sample_rate
-            ,DD_EMU_COMPR_BUFFER_SIZE
-            );
-    if(p_dd_emul_data->compr_handle == NULL)
+    return open_compressor(p_dd_emul_data);
+}
+
+uint32_t dd_emulation_get_state_size(void)
+{
+    return sizeof(dd_emu_state);
+}
+
+int32_t dd_emulation_get_state(void *const p_dd_emul_hdl, void *p_state)
+{
+    dd_emu_internal_data* p_dd_emul_data = (dd_emu_internal_data*)p_dd_emul_hdl;
+    dd_emu_state* p_out = (dd_emu_state*)p_state;
+    history_map histories[NUM_HISTORIES];
+    int i;
+
+    if(NULL == p_dd_emul_data)
     {
-       return DD_EMU_STATUS_INVALID_PARAM_ERR;
+        return DD_EMU_STATUS_INVALID_HANDLE;
+    }
+    if(NULL == p_out)
+    {
+        return DD_EMU_STATUS_INVALID_PARAM_ERR;
+    }
+
+    memset(p_out, 0, sizeof(dd_emu_state));
+
+    p_out->channel_mode = p_dd_emul_data->channel_mode;
+    p_out->lfe_on       = p_dd_emul_data->lfe_on;
+    p_out->emu_blk_size = p_dd_emul_data->emu_blk_size;
+    p_out->sample_rate  = p_dd_emul_data->sample_rate;
+    p_out->num_blocks   = p_dd_emul_data->num_blocks;
+
+    memcpy(p_out->last_gain, p_dd_emul_data->last_gain, sizeof(p_out->last_gain));
+    map_histories(p_dd_emul_data, p_out, histories);
+    for(i = 0; i < NUM_HISTORIES; i++)
+    {
+        if(histories[i].p_emul)
+        {
+            memcpy(histories[i].p_state, histories[i].p_emul, histories[i].kept * sizeof(DLB_LFRACT));
+        }
+    }
+
+    if(md_ComprGetState(p_dd_emul_data->compr_handle, &p_out->compr) != COMPR_OK)
+    {
+        return DD_EMU_STATUS_INVALID_HANDLE;
+    }
+
+    return DD_EMU_STATUS_OK;
+}
+
+int32_t dd_emulation_set_state(void *const p_dd_emul_hdl, const void *p_state)
+{
+    dd_emu_internal_data* p_dd_emul_data = (dd_emu_internal_data*)p_dd_emul_hdl;
+    const dd_emu_state* p_in = (const dd_emu_state*)p_state;
+    history_map histories[NUM_HISTORIES];
+    int i, j;
+
+    if(NULL == p_dd_emul_data)
+    {
+        return DD_EMU_STATUS_INVALID_HANDLE;
+    }
+    if(NULL == p_in ||
+       p_in->num_blocks < DD_EMU_MIN_BLOCKS || p_in->num_blocks > DD_EMU_MAX_BLOCKS ||
+       p_in->channel_mode < COMPR_CHMODE_MONO || p_in->channel_mode > COMPR_CHMODE_3_4)
+    {
+        return DD_EMU_STATUS_INVALID_PARAM_ERR;
+    }
+
+    /* Refuse a state that does not fit, histories beyond the capacity must be silent */
+    if(!compr_fits(p_dd_emul_data, (COMPR_CHMODE)p_in->channel_mode, p_in->num_blocks))
+    {
+        return DD_EMU_STATUS_CAPACITY_ERR;
+    }
+    map_histories(p_dd_emul_data, (dd_emu_state*)p_in, histories);
+    for(i = 0; i < NUM_HISTORIES; i++)
+    {
+        for(j = histories[i].kept; j < histories[i].total; j++)
+        {
+            if(histories[i].p_state[j] != 0)
+            {
+                return DD_EMU_STATUS_CAPACITY_ERR;
+            }
+        }
+    }
+
+    /* Re-open the compressor with the configuration the state was taken with */
+    p_dd_emul_data->channel_mode = (COMPR_CHMODE)p_in->channel_mode;
+    p_dd_emul_data->lfe_on       = (uint16_t)p_in->lfe_on;
+    p_dd_emul_data->emu_blk_size = p_in->emu_blk_size;
+    p_dd_emul_data->sample_rate  = (uint16_t)p_in->sample_rate;
+    p_dd_emul_data->num_blocks   = (uint16_t)p_in->num_blocks;
+
+    if(open_compressor(p_dd_emul_data) != DD_EMU_STATUS_OK)
+    {
+        return DD_EMU_STATUS_INVALID_PARAM_ERR;
+    }
+    md_ComprSetState(p_dd_emul_data->compr_handle, &p_in->compr);
+
+    memcpy(p_dd_emul_data->last_gain, p_in->last_gain, sizeof(p_in->last_gain));
+    for(i = 0; i < NUM_HISTORIES; i++)
+    {
+        if(histories[i].p_emul)
+        {
+            memcpy(histories[i].p_emul, histories[i].p_state, histories[i].kept * sizeof(DLB_LFRACT));
+        }
+    }
+
+    return DD_EMU_STATUS_OK;
+}
+
+int32_t dd_emulation_get_stats(void *const p_dd_emul_hdl, dd_emu_stats *p_stats, int reset)
+{
+#ifndef MD_EMUL_NO_STATS
+    dd_emu_internal_data* p_dd_emul_data = (dd_emu_internal_data*)p_dd_emul_hdl;
+    const COMPR_CLIP_STATS *p_clip[2];
+    dd_emu_clip_stats *p_out[2];
+    int i;
+
+    if(NULL == p_dd_emul_data)
+    {
+        return DD_EMU_STATUS_INVALID_HANDLE;
+    }
+    if(NULL == p_stats)
+    {
+        return DD_EMU_STATUS_INVALID_PARAM_ERR;
+    }
+
+    *p_stats = p_dd_emul_data->p_stats->stats;
+
+    p_clip[0] = &p_dd_emul_data->p_stats->compr_stats.dlim;
+    p_clip[1] = &p_dd_emul_data->p_stats->compr_stats.clim;
+    p_out[0]  = &p_stats->dlim;
+    p_out[1]  = &p_stats->clim;
+    for (i = 0; i < 2; i++)
+    {
+        p_out[i]->updates     = p_clip[i]->updates;
+        p_out[i]->attacks     = p_clip[i]->attacks;
+        p_out[i]->holds       = p_clip[i]->holds;
+        p_out[i]->gain_min_db = p_clip[i]->gainMinDb;
+        p_out[i]->gain_sum_db = p_clip[i]->gainSumDb;
     }
 
+    if (reset)
+    {
+        memset(&p_dd_emul_data->p_stats->stats, 0, sizeof(p_dd_emul_data->p_stats->stats));
+        memset(&p_dd_emul_data->p_stats->compr_stats, 0, sizeof(p_dd_emul_data->p_stats->compr_stats));
+    }
     return DD_EMU_STATUS_OK;
+#else
+    (void)p_dd_emul_hdl;
+    (void)reset;
+    if (p_stats)
+    {
+        memset(p_stats, 0, sizeof(dd_emu_stats));
+    }
+    return DD_EMU_STATUS_INVALID_PARAM_ERR;   /* built without statistics */
+#endif
+}
+
+int32_t dd_emulation_set_tap(void *const p_dd_emul_hdl, DD_EMU_TAP_SLOT slot, dd_emu_tap_fn fn, void *p_context)
+{
+    dd_emu_internal_data* p_dd_emul_data = (dd_emu_internal_data*)p_dd_emul_hdl;
+    int i;
+
+    if(NULL == p_dd_emul_data)
+    {
+        return DD_EMU_STATUS_INVALID_HANDLE;
+    }
+    if(slot < 0 || slot >= DD_EMU_TAP_SLOTS)
+    {
+        return DD_EMU_STATUS_INVALID_PARAM_ERR;
+    }
+    if(!(p_dd_emul_data->capacity.taps & (1u << slot)))
+    {
+        /* Nothing to remove from a slot without storage */
+        return fn ? DD_EMU_STATUS_CAPACITY_ERR : DD_EMU_STATUS_OK;
+    }
+
+    p_dd_emul_data->tap_fn[slot]      = fn;
+    p_dd_emul_data->tap_context[slot] = p_context;
+    p_dd_emul_data->p_tap->blocks[slot] = 0;
+
+    p_dd_emul_data->tap_active = 0;
+    for (i = 0; i < DD_EMU_TAP_SLOTS; i++)
+    {
+        p_dd_emul_data->tap_active |= (p_dd_emul_data->tap_fn[i] != NULL);
+    }
+    md_ComprSetTrace(p_dd_emul_data->compr_handle, p_dd_emul_data->tap_active ? &p_dd_emul_data->p_tap->compr_trace : NULL);
+
+    return DD_EMU_STATUS_OK;
+}
+
+void *dd_emulation_get_tap_storage(void *const p_dd_emul_hdl, DD_EMU_TAP_SLOT slot, uint32_t size)
+{
+    dd_emu_internal_data* p_dd_emul_data = (dd_emu_internal_data*)p_dd_emul_hdl;
+
+    if(NULL == p_dd_emul_data || slot < 0 || slot >= DD_EMU_TAP_SLOTS || size > DD_EMU_TAP_STORAGE_SIZE)
+    {
+        return NULL;
+    }
+    return p_dd_emul_data->tap_storage[slot];   /* NULL for a slot not in the capacity */
 }
 
 int32_t dd_emulation_close(void *p_dd_emul_hdl)
@@ -261,6 +776,7 @@ dd_emulation_process
     int i, j;
     int num_samples;
     int num_chans;
+    int reopen;
     DD_EMU_STATUS ret = DD_EMU_STATUS_OK;
 
     if(NULL == p_dd_emu_handle)
@@ -281,11 +797,36 @@ dd_emulation_process
     num_blocks = p_buf_config->num_samples / p_buf_config->emu_blk_size;
 
     /* Check to see if compr needs to be reinitialized */
-    if(p_dd_emul_data->channel_mode != (COMPR_CHMODE)p_buf_config->channel_mode ||
+    reopen = p_dd_emul_data->channel_mode != (COMPR_CHMODE)p_buf_config->channel_mode ||
             p_dd_emul_data->lfe_on != p_buf_config->lfe_on ||
             p_dd_emul_data->emu_blk_size != p_buf_config->emu_blk_size ||
             p_dd_emul_data->sample_rate != p_buf_config->sample_rate ||
-            p_dd_emul_data->num_blocks != num_blocks)
+            p_dd_emul_data->num_blocks != num_blocks;
+
+    /* Refuse a configuration the memory was not sized for before anything changes */
+    if(num_outputs > p_dd_emul_data->capacity.num_outputs)
+    {
+        return DD_EMU_STATUS_CAPACITY_ERR;
+    }
+    if(p_buf_config->control & DD_EMU_CONTROL_ENCODER_ENABLE)
+    {
+        dd_emu_capacity needed;
+
+        dd_emulation_get_capacity(p_buf_config, num_outputs, &needed);
+        if((needed.filters & ~p_dd_emul_data->capacity.filters) || needed.num_chans > p_dd_emul_data->capacity.num_chans)
+        {
+            return DD_EMU_STATUS_CAPACITY_ERR;
+        }
+    }
+    if(reopen && !compr_fits(p_dd_emul_data, (COMPR_CHMODE)p_buf_config->channel_mode, num_blocks))
+    {
+        return DD_EMU_STATUS_CAPACITY_ERR;
+    }
+
+    /* A refused call is not a processed frame */
+    DLB_INSTRUMENT_ENTER_FRAME;
+
+    if(reopen)
     {
         p_dd_emul_data->channel_mode = (COMPR_CHMODE)p_buf_config->channel_mode;
         p_dd_emul_data->lfe_on = p_buf_config->lfe_on;
@@ -293,34 +834,32 @@ dd_emulation_process
         p_dd_emul_data->sample_rate = p_buf_config->sample_rate;
         p_dd_emul_data->num_blocks = num_blocks;
 
-        p_dd_emul_data->compr_handle = md_ComprOpen
-                                          (p_dd_emul_data->comp_static_internal
-                                          ,p_dd_emul_data->comp_dynamic_internal
-                                          ,p_dd_emul_data->comp_static_external
-                                          ,p_dd_emul_data->channel_mode
-                                          ,p_dd_emul_data->lfe_on
-                                          ,p_dd_emul_data->num_blocks
-                                          ,p_dd_emul_data->sample_rate
-                                          ,DD_EMU_COMPR_BUFFER_SIZE
-                                          );
-
-        if(p_dd_emul_data->compr_handle == 0)
+        if(open_compressor(p_dd_emul_data) != DD_EMU_STATUS_OK)
         {
             return DD_EMU_STATUS_INVALID_PARAM_ERR;
         }
+        STATS_COUNT(p_dd_emul_data, compr_reopens, 1);
     }
 
+    STATS_COUNT(p_dd_emul_data, blocks, num_blocks);
+    STATS_ENTER_STAGE(p_dd_emul_data);
+
     if( p_buf_config->control & DD_EMU_CONTROL_DECODER_ENABLE || p_buf_config->control & DD_EMU_CONTROL_ENCODER_ENABLE)
     {
         /* Zero out channels that are not specified in channel config */
-       clear_channels(p_dd_emul_data, p_buf_config);
+        DLB_INSTRUMENT_ENTER_PUNIT("clear_channels");
+        clear_channels(p_dd_emul_data, p_buf_config);
+        DLB_INSTRUMENT_LEAVE_PUNIT("clear_channels");
     }
 
     if(p_buf_config->control & DD_EMU_CONTROL_ENCODER_ENABLE)
     {
         /* Run encoder emulation filters */
+        DLB_INSTRUMENT_ENTER_PUNIT("encoder_emulation");
         encoder_emulation(p_dd_emul_data, p_buf_config);
+        DLB_INSTRUMENT_LEAVE_PUNIT("encoder_emulation");
     }
+    STATS_LEAVE_STAGE(p_dd_emul_data, DD_EMU_STAGE_ENCODER);
 
     /* Make a copy of the processed data for decoder emulation on secondary output */
     if (num_outputs == 2)
@@ -333,6 +872,8 @@ dd_emulation_process
 
         num_samples = p_dd_emul_data->num_blocks * p_dd_emul_data->emu_blk_size;
 
+        STATS_ENTER_STAGE(p_dd_emul_data);
+        DLB_INSTRUMENT_ENTER_PUNIT("aux_copy");
         for(i = 0u; i < num_samples; i++)
         {
             for(j = 0u; j < num_chans; j++)
@@ -343,12 +884,28 @@ dd_emulation_process
             p_aux += DD_EMU_MAX_CHANS;
             p_main += DD_EMU_MAX_CHANS;
         }
+        DLB_INSTRUMENT_LEAVE_PUNIT("aux_copy");
+        STATS_LEAVE_STAGE(p_dd_emul_data, DD_EMU_STAGE_DRC_APPLY);
     }
 
     if( p_buf_config->control & DD_EMU_CONTROL_DECODER_ENABLE )
     {
         /* Run decoder emulation - DRC calculation and apply compression */
+        DLB_INSTRUMENT_ENTER_PUNIT("decoder_emulation");
         ret = (DD_EMU_STATUS) decoder_emulation(p_dd_emul_data, p_buf_config, num_outputs);
+        DLB_INSTRUMENT_LEAVE_PUNIT("decoder_emulation");
+    }
+
+#ifdef MD_EMUL_FAST_MATH
+    /* Nothing saturates inside a fast-math build, the outputs are clipped here once */
+    DLB_INSTRUMENT_ENTER_PUNIT("clip_outputs");
+    clip_outputs(p_buf_config, num_outputs, p_dd_emul_data->num_blocks * p_dd_emul_data->emu_blk_size);
+    DLB_INSTRUMENT_LEAVE_PUNIT("clip_outputs");
+#endif
+
+    if (p_dd_emul_data->tap_active && ret == DD_EMU_STATUS_OK)
+    {
+        tap_blocks(p_dd_emul_data, p_buf_config, num_outputs);
     }
 
     return ret;
@@ -371,6 +928,7 @@ decoder_emulation
     int output;
     int i, j;
     int16_t perform_boost_cut = 0;
+    DLB_LFRACT drc_gain;
 
     /* Output gains */
     DLB_LFRACT gain_drc[DD_EMU_MAX_BLOCKS] = {0};
@@ -386,6 +944,8 @@ decoder_emulation
     if(p_buf_config->control & DD_EMU_CONTROL_DRC_CALC_ENABLE )
     {
         /* Compute DRC values from profile, and worst-case downmix */
+        STATS_ENTER_STAGE(p_dd_emul_data);
+        DLB_INSTRUMENT_ENTER_PUNIT("md_ComprProcess");
         compr_status = md_ComprProcess(p_dd_emul_data->compr_handle
                                       ,gain_dlnrm
                                       ,(COMPR_PROFILE_TYPE)p_buf_config->drc_profile
@@ -398,14 +958,22 @@ decoder_emulation
                                       ,&gain_compr
                                       ,DD_EMU_COMPR_BUFFER_SIZE
                                       ,p_buf_config->sample_offset);
+        DLB_INSTRUMENT_LEAVE_PUNIT("md_ComprProcess");
+        STATS_LEAVE_STAGE(p_dd_emul_data, DD_EMU_STAGE_DRC_CALC);
 
         if(compr_status != COMPR_OK) 
         {
             return DD_EMU_STATUS_EMULATION_ERROR;
         }
+        if (p_dd_emul_data->tap_active)
+        {
+            memcpy(p_dd_emul_data->p_tap->gain_drc, gain_drc, sizeof(gain_drc));
+            p_dd_emul_data->p_tap->gain_compr = gain_compr;
+        }
     }
 
     /* Apply DRC/dialnorm independently for up to 2 outputs */
+    STATS_ENTER_STAGE(p_dd_emul_data);
     for (output = 0; output < num_outputs; output++)
     {
         for(block = 0; block < p_dd_emul_data->num_blocks; block++)
@@ -487,7 +1055,8 @@ decoder_emulation
                 }
 
                 /* Apply gain */
-                apply_drc(p_buf_config->comp_mode[output] == DD_EMU_CM_RF
+                DLB_INSTRUMENT_ENTER_PUNIT("apply_drc");
+                drc_gain = apply_drc(p_buf_config->comp_mode[output] == DD_EMU_CM_RF
                          ,drc
                          ,&p_dd_emul_data->last_gain[output]
                          ,dialnorm
@@ -500,9 +1069,21 @@ decoder_emulation
                          p_buf_config->custom_boost[output],
                          p_buf_config->custom_cut[output]
                          );
+                DLB_INSTRUMENT_LEAVE_PUNIT("apply_drc");
+                STATS_COUNT(p_dd_emul_data, gain_reduction_hist[output][gain_reduction_bin(drc_gain)], 1);
+            }
+            if (p_dd_emul_data->tap_active)
+            {
+                p_dd_emul_data->p_tap->applied_gain[output][block] = p_buf_config->comp_mode[output] != DD_EMU_CM_NONE
+                                                                ? p_dd_emul_data->last_gain[output]
+                                                                : DLB_LcF(1.0/16.0);
             }
         }
     }
+    STATS_LEAVE_STAGE(p_dd_emul_data, DD_EMU_STAGE_DRC_APPLY);
+#ifdef MD_EMUL_NO_STATS
+    (void)drc_gain;
+#endif
 
     return DD_EMU_STATUS_OK;
 }
@@ -510,8 +1091,8 @@ decoder_emulation
 
 /* New functions */
 
-/* For unit testing this function can't be static */
-#if !defined(DLB_UT)
+/* For unit testing and the kernel benchmark this function can't be static */
+#if !defined(DLB_UT) && !defined(MD_EMUL_KERNEL_BENCH)
 static
 #endif
 void
@@ -535,39 +1116,135 @@ attenuate_surrounds
 }
 
 
-static void initialize_filters(dd_emu_internal_data* p_dd_emul_data)
+/* (Re-)open the compressor for the current configuration */
+static DD_EMU_STATUS open_compressor(dd_emu_internal_data* p_dd_emul_data)
 {
-   int i, j;
+    p_dd_emul_data->compr_handle = md_ComprOpen
+            (p_dd_emul_data->comp_static_internal
+            ,p_dd_emul_data->comp_dynamic_internal
+            ,p_dd_emul_data->comp_static_external
+            ,p_dd_emul_data->channel_mode
+            ,p_dd_emul_data->lfe_on
+            ,p_dd_emul_data->num_blocks
+            ,p_dd_emul_data->sample_rate
+            ,DD_EMU_COMPR_BUFFER_SIZE
+            );
+    if(p_dd_emul_data->compr_handle == NULL)
+    {
+       return DD_EMU_STATUS_INVALID_PARAM_ERR;
+    }
+#ifndef MD_EMUL_NO_STATS
+    md_ComprSetStats(p_dd_emul_data->compr_handle, &p_dd_emul_data->p_stats->compr_stats);
+#endif
+    if (p_dd_emul_data->tap_active)
+    {
+        md_ComprSetTrace(p_dd_emul_data->compr_handle, &p_dd_emul_data->p_tap->compr_trace);
+    }
 
-   /* Init the highpass filter state */
-   for (i = 0; i < DD_EMU_MAX_CHANS; i++)
-   {
-       p_dd_emul_data->hpf_history[i] = 0;
-   }
+    return DD_EMU_STATUS_OK;
+}
 
-   /* Init the bandwidth-limiting lowpass filter state */
-   for (i = 0; i < DD_EMU_MAX_CHANS; i++)
-   {
-       for (j = 0; j < BWLIMORDER * BQHISTORY; j++)
-       {
-           p_dd_emul_data->lpf_history[i][j] = 0;
-       }
+/* Nonzero if the compressor memory given to open holds channel_mode with num_blocks */
+static int compr_fits(const dd_emu_internal_data* p_dd_emul_data, COMPR_CHMODE channel_mode, int num_blocks)
+{
+    uint32_t static_size, dynamic_size, ext_static_size;
 
-       for (j = 0; j < SPHSTAGES * BQCOEFFS; j++)
-       {
-           p_dd_emul_data->psf_surr_history[i][j] = 0;
-       }
-       for (j = 0; j < MPHSTAGES * BQCOEFFS; j++)
-       {
-           p_dd_emul_data->psf_history[i][j] = 0;
-       }
+    if(num_blocks > DD_EMU_MAX_BLOCKS)
+    {
+        return 0;
+    }
+    if(md_ComprGetRequiredBufferSize(channel_mode, (uint16_t)num_blocks, &static_size, &dynamic_size, &ext_static_size, DD_EMU_COMPR_BUFFER_SIZE) != COMPR_OK)
+    {
+        return 1;   /* not a channel mode, md_ComprOpen refuses it */
+    }
 
-       for (j = 0; j < LFEORDER * BQHISTORY; j++)
-       {
-           p_dd_emul_data->lfe_history[i][j] = 0;
-       }
+    return static_size <= p_dd_emul_data->compr_static_mem_size &&
+           dynamic_size <= p_dd_emul_data->compr_dynamic_mem_size &&
+           ext_static_size <= p_dd_emul_data->compr_ext_static_mem_size;
+}
+
+/* Bytes of filter history behind dd_emu_internal_data */
+static uint32_t filter_history_size(const dd_emu_capacity *p_capacity)
+{
+    uint32_t per_chan = 0;
+
+    if(p_capacity->filters & DD_EMU_FILTER_HPF)
+    {
+        per_chan += HPF_HISTORY;
+    }
+    if(p_capacity->filters & DD_EMU_FILTER_BWLPF)
+    {
+        per_chan += LPF_HISTORY;
+    }
+    if(p_capacity->filters & DD_EMU_FILTER_LFELPF)
+    {
+        per_chan += LFE_HISTORY;
+    }
+    if(p_capacity->filters & DD_EMU_FILTER_PSF)
+    {
+        per_chan += PSF_HISTORY + PSF_SURR_HISTORY;
+    }
 
-   }
+    return per_chan * (uint32_t)p_capacity->num_chans * sizeof(DLB_LFRACT);
+}
+
+/* Bytes of the statistics and of the taps in the capacity, behind the filter histories */
+static uint32_t feature_size(const dd_emu_capacity *p_capacity)
+{
+    uint32_t size = 0;
+    int slot;
+
+#ifndef MD_EMUL_NO_STATS
+    size += EMUL_ALIGN(sizeof(dd_emu_stats_data));
+#endif
+    if(p_capacity->taps)
+    {
+        size += EMUL_ALIGN(sizeof(dd_emu_tap_data));
+    }
+    for(slot = 0; slot < DD_EMU_TAP_SLOTS; slot++)
+    {
+        if(p_capacity->taps & (1u << slot))
+        {
+            size += EMUL_ALIGN(sizeof(dd_emu_tap_storage));
+        }
+    }
+    return size;
+}
+
+static void map_histories(dd_emu_internal_data* p_dd_emul_data, dd_emu_state *p_state, history_map *p_map)
+{
+    int num_chans = p_dd_emul_data->capacity.num_chans;
+
+    p_map[0].p_emul  = p_dd_emul_data->hpf_history;
+    p_map[0].p_state = p_state->hpf_history;
+    p_map[0].total   = DD_EMU_MAX_CHANS * HPF_HISTORY;
+    p_map[0].kept    = p_map[0].p_emul ? num_chans * HPF_HISTORY : 0;
+
+    p_map[1].p_emul  = p_dd_emul_data->lpf_history ? p_dd_emul_data->lpf_history[0] : NULL;
+    p_map[1].p_state = p_state->lpf_history[0];
+    p_map[1].total   = DD_EMU_MAX_CHANS * LPF_HISTORY;
+    p_map[1].kept    = p_map[1].p_emul ? num_chans * LPF_HISTORY : 0;
+
+    p_map[2].p_emul  = p_dd_emul_data->lfe_history ? p_dd_emul_data->lfe_history[0] : NULL;
+    p_map[2].p_state = p_state->lfe_history[0];
+    p_map[2].total   = DD_EMU_MAX_CHANS * LFE_HISTORY;
+    p_map[2].kept    = p_map[2].p_emul ? num_chans * LFE_HISTORY : 0;
+
+    p_map[3].p_emul  = p_dd_emul_data->psf_history ? p_dd_emul_data->psf_history[0] : NULL;
+    p_map[3].p_state = p_state->psf_history[0];
+    p_map[3].total   = DD_EMU_MAX_CHANS * PSF_HISTORY;
+    p_map[3].kept    = p_map[3].p_emul ? num_chans * PSF_HISTORY : 0;
+
+    p_map[4].p_emul  = p_dd_emul_data->psf_surr_history ? p_dd_emul_data->psf_surr_history[0] : NULL;
+    p_map[4].p_state = p_state->psf_surr_history[0];
+    p_map[4].total   = DD_EMU_MAX_CHANS * PSF_SURR_HISTORY;
+    p_map[4].kept    = p_map[4].p_emul ? num_chans * PSF_SURR_HISTORY : 0;
+}
+
+static void initialize_filters(dd_emu_internal_data* p_dd_emul_data)
+{
+   /* The histories of all filters in the capacity follow each other behind the struct */
+   memset(p_dd_emul_data + 1, 0, filter_history_size(&p_dd_emul_data->capacity));
 }
 
 /* Zero out channels that are not specified */
@@ -609,6 +1286,151 @@ clear_channels
     }
 }
 
+#ifdef MD_EMUL_FAST_MATH
+/* Clip the mapped channels of every output to [-1, 1] */
+static
+void
+clip_outputs
+    (const dd_emu_process_config *p_buf_config
+    ,int                          num_outputs
+    ,int                          num_samples
+    )
+{
+    int output, chan, i;
+
+    for (output = 0; output < num_outputs; output++)
+    {
+        for (chan = 0; chan < DD_EMU_MAX_CHANS; chan++)
+        {
+            DLB_LFRACT *p_pcm = p_buf_config->pa_app_data[output] + chan;
+
+            if (DD_EMU_CHAN_NONE == p_buf_config->a_chan_map[chan])
+            {
+                continue;
+            }
+
+            for (i = 0; i < num_samples; i++, p_pcm += p_buf_config->sample_offset)
+            {
+                *p_pcm = DLB_LclipLLL(*p_pcm, DLB_LcF(-1.0), DLB_LcF(1.0));
+            }
+        }
+    }
+}
+#endif
+
+/* Peaks of the processed blocks and the values kept by decoder_emulation, one tap call per block */
+static
+void
+tap_blocks
+    (dd_emu_internal_data        *p_dd_emul_data
+    ,const dd_emu_process_config *p_buf_config
+    ,int                          num_outputs
+    )
+{
+    const COMPR_TRACE *p_trace = &p_dd_emul_data->p_tap->compr_trace;
+    dd_emu_tap_block tap;
+    double loudness_db[DD_EMU_MAX_BLOCKS] = {0};
+    double maxmix_db[DD_EMU_MAX_BLOCKS] = {0};
+    int block, output, chan, slot, i;
+
+    tap.flags = 0;
+    if (p_buf_config->control & DD_EMU_CONTROL_DECODER_ENABLE)
+    {
+        tap.flags |= DD_EMU_TAP_DECODER;
+        if (p_buf_config->control & DD_EMU_CONTROL_DRC_CALC_ENABLE)
+        {
+            tap.flags |= DD_EMU_TAP_DRC_CALC;
+            md_ComprGetBlockLevels(p_dd_emul_data->compr_handle, loudness_db, maxmix_db);
+        }
+    }
+    tap.num_outputs = num_outputs;
+    tap.channel_mask = 0;
+    for (chan = 0; chan < DD_EMU_MAX_CHANS; chan++)
+    {
+        if (DD_EMU_CHAN_NONE != p_buf_config->a_chan_map[chan])
+        {
+            tap.channel_mask |= 1u << chan;
+        }
+    }
+
+    for (block = 0; block < p_dd_emul_data->num_blocks; block++)
+    {
+        memset(tap.peak, 0, sizeof(tap.peak));
+        for (output = 0; output < num_outputs; output++)
+        {
+            for (chan = 0; chan < DD_EMU_MAX_CHANS; chan++)
+            {
+                const DLB_LFRACT *p_pcm = p_buf_config->pa_app_data[output]
+                                        + block * p_buf_config->emu_blk_size * p_buf_config->sample_offset + chan;
+                DLB_LFRACT peak = DLB_L00;
+
+                if (!(tap.channel_mask & (1u << chan)))
+                {
+                    continue;
+                }
+                for (i = 0; i < p_buf_config->emu_blk_size; i++, p_pcm += p_buf_config->sample_offset)
+                {
+                    peak = DLB_LmaxLL(peak, DLB_LabsL(*p_pcm));
+                }
+                tap.peak[output][chan] = DLB_F_L(peak);
+            }
+        }
+
+        tap.log_loudness_db = loudness_db[block];
+        tap.maxmix_db       = maxmix_db[block];
+        if (tap.flags & DD_EMU_TAP_DRC_CALC)
+        {
+            /* Q7.24 dB */
+            tap.drc_gain_db         = DLB_F_L(p_dd_emul_data->p_tap->gain_drc[block]) * 128.0;
+            tap.compr_gain_db       = DLB_F_L(p_dd_emul_data->p_tap->gain_compr) * 128.0;
+            tap.dynrng_code         = convCompressorGainToDD(p_dd_emul_data->p_tap->gain_drc[block], 1);
+            tap.compr_code          = convCompressorGainToDD(p_dd_emul_data->p_tap->gain_compr, 0);
+            tap.dyn_state_db        = p_trace->block[block].dynStateDb;
+            tap.dyn_gain_db         = p_trace->block[block].dynGainDb;
+            tap.dlim_gain_db        = p_trace->block[block].dlimGainDb;
+            tap.compr_state_db      = p_trace->block[block].comprStateDb;
+            tap.compr_block_gain_db = p_trace->block[block].comprGainDb;
+            tap.clim_gain_db        = p_trace->climGainDb;
+            tap.dyn_hold            = p_trace->block[block].dynHold;
+            tap.dlim_hold           = p_trace->block[block].dlimHold;
+            tap.compr_hold          = p_trace->block[block].comprHold;
+            tap.clim_hold           = p_trace->climHold;
+        }
+        else
+        {
+            tap.drc_gain_db         = 0.0;
+            tap.compr_gain_db       = 0.0;
+            tap.dynrng_code         = DYNRNG_UNITY;
+            tap.compr_code          = COMPR_UNITY;
+            tap.dyn_state_db        = 0.0;
+            tap.dyn_gain_db         = 0.0;
+            tap.dlim_gain_db        = 0.0;
+            tap.compr_state_db      = 0.0;
+            tap.compr_block_gain_db = 0.0;
+            tap.clim_gain_db        = 0.0;
+            tap.dyn_hold            = 0;
+            tap.dlim_hold           = 0;
+            tap.compr_hold          = 0;
+            tap.clim_hold           = 0;
+        }
+        for (output = 0; output < DD_EMU_MAX_OUTPUTS; output++)
+        {
+            tap.applied_gain[output] = (tap.flags & DD_EMU_TAP_DECODER) && output < num_outputs
+                                     ? DLB_F_L(p_dd_emul_data->p_tap->applied_gain[output][block]) * 16.0
+                                     : 1.0;
+        }
+
+        for (slot = 0; slot < DD_EMU_TAP_SLOTS; slot++)
+        {
+            if (p_dd_emul_data->tap_fn[slot])
+            {
+                tap.block_index = p_dd_emul_data->p_tap->blocks[slot]++;
+                p_dd_emul_data->tap_fn[slot](p_dd_emul_data->tap_context[slot], &tap);
+            }
+        }
+    }
+}
+
 static
 void 
 encoder_emulation
@@ -631,22 +1453,26 @@ encoder_emulation
             /* Attenuate surrounds */
             if (p_buf_config->suratton)
             {
+                DLB_INSTRUMENT_ENTER_PUNIT("attenuate_surrounds");
                 attenuate_surrounds(p_buf_config->pa_app_data[MASTER_BUF] + (block * p_buf_config->emu_blk_size * p_buf_config->sample_offset) + chan
                                    ,p_buf_config->sample_offset
                                    ,channel
                                    ,p_buf_config->channel_mode
                                    ,p_buf_config->emu_blk_size
                                    );
+                DLB_INSTRUMENT_LEAVE_PUNIT("attenuate_surrounds");
             }
 
             /* DC blocking (high-pass) filter */
             if (p_buf_config->hpfon)
             {
+                DLB_INSTRUMENT_ENTER_PUNIT("emul_hpf");
                 emul_hpf(p_buf_config->pa_app_data[MASTER_BUF] + (block * p_buf_config->emu_blk_size * p_buf_config->sample_offset) + chan
                         ,p_buf_config->sample_offset
                         ,&p_dd_emul_data->hpf_history[chan]
                         ,p_buf_config->emu_blk_size
                         );
+                DLB_INSTRUMENT_LEAVE_PUNIT("emul_hpf");
             }
 
             /* lowpass filter - both band-limiting and LFE */
@@ -654,23 +1480,27 @@ encoder_emulation
             {
                 if (p_buf_config->bwlpfon) 
                 {
+                    DLB_INSTRUMENT_ENTER_PUNIT("emul_lpf_bwlimit");
                     emul_lpf_bwlimit(p_buf_config->pa_app_data[MASTER_BUF] + (block * p_buf_config->emu_blk_size * p_buf_config->sample_offset) + chan
                                     ,p_buf_config->sample_offset
                                     ,p_buf_config->channel_mode
                                     ,p_dd_emul_data->lpf_history[chan]
                                     ,p_buf_config->emu_blk_size
                                     );
+                    DLB_INSTRUMENT_LEAVE_PUNIT("emul_lpf_bwlimit");
                 }
             }
             else
             {
                 if (p_buf_config->lfelpfon)
                 {
+                    DLB_INSTRUMENT_ENTER_PUNIT("emul_lpf_lfe");
                     emul_lpf_lfe(p_buf_config->pa_app_data[MASTER_BUF] + (block * p_buf_config->emu_blk_size * p_buf_config->sample_offset) + chan
                                 ,p_buf_config->sample_offset
                                 ,p_dd_emul_data->lfe_history[chan]
                                 ,p_buf_config->emu_blk_size
                                 );
+                    DLB_INSTRUMENT_LEAVE_PUNIT("emul_lpf_lfe");
                 }
             }
 
@@ -679,19 +1509,23 @@ encoder_emulation
             {
                 if (channel == DD_EMU_CHAN_LSUR || channel == DD_EMU_CHAN_RSUR)
                 {
+                    DLB_INSTRUMENT_ENTER_PUNIT("emul_psf_surr");
                     emul_psf_surr(p_buf_config->pa_app_data[MASTER_BUF] + (block * p_buf_config->emu_blk_size * p_buf_config->sample_offset) + chan
                                  ,p_buf_config->sample_offset
                                  ,p_dd_emul_data->psf_surr_history[chan]
                                  ,p_buf_config->emu_blk_size
                                  );
+                    DLB_INSTRUMENT_LEAVE_PUNIT("emul_psf_surr");
                 }
                 else
                 {
+                    DLB_INSTRUMENT_ENTER_PUNIT("emul_psf_main");
                     emul_psf_main(p_buf_config->pa_app_data[MASTER_BUF] + (block * p_buf_config->emu_blk_size * p_buf_config->sample_offset) + chan
                                  ,p_buf_config->sample_offset
                                  ,p_dd_emul_data->psf_history[chan]
                                  ,p_buf_config->emu_blk_size
                                  );
+                    DLB_INSTRUMENT_LEAVE_PUNIT("emul_psf_main");
                 }
             }
         }
@@ -70,7 +70,8 @@ typedef enum
     DD_EMU_STATUS_MEM_ALLOC_ERR     = -2,
     DD_EMU_STATUS_INVALID_PARAM_ERR = -3,
     DD_EMU_STATUS_NOT_ENOUGH_DATA   = -4,
-    DD_EMU_STATUS_EMULATION_ERROR   = -5 
+    DD_EMU_STATUS_EMULATION_ERROR   = -5,
+    DD_EMU_STATUS_CAPACITY_ERR      = -6   /* configuration needs more memory than the emulator was opened with */
 
 } DD_EMU_STATUS;
 
@@ -168,18 +169,130 @@ typedef struct
 
 } dd_emu_process_config;
 
+/* Encoder filters that keep a history per channel, bits of dd_emu_capacity.filters */
+#define DD_EMU_FILTER_HPF       1u
+#define DD_EMU_FILTER_BWLPF     2u
+#define DD_EMU_FILTER_LFELPF    4u
+#define DD_EMU_FILTER_PSF       8u      /* main and surround phase shift */
+#define DD_EMU_FILTER_ALL       15u
+
+/* What the memory of an emulator holds */
+typedef struct
+{
+    DD_EMU_CHANNEL_MODE         channel_mode;       /* compressor channel mode, and the one it is first opened with */
+    int                         num_blocks;         /* compressor blocks per call */
+    int                         num_chans;          /* buffer channels with filter histories, 0 without filters */
+    unsigned int                filters;            /* DD_EMU_FILTER_* with histories */
+    int                         num_outputs;
+    unsigned int                taps;               /* bit 1u << DD_EMU_TAP_* per tap slot with storage */
+} dd_emu_capacity;
+
+/* Upper edges of the gain reduction histogram bins in dB, the last bin is open */
+#define DD_EMU_STATS_GR_EDGES_DB    {1.0, 2.0, 4.0, 6.0, 10.0, 15.0, 20.0}
+#define DD_EMU_STATS_GR_BINS        8
+
+/* Processing stages timed by the statistics */
+typedef enum
+{
+    DD_EMU_STAGE_ENCODER   = 0,    /* clear_channels and encoder emulation */
+    DD_EMU_STAGE_DRC_CALC  = 1,    /* compressor (DRC and compr gains) */
+    DD_EMU_STAGE_DRC_APPLY = 2,    /* aux copy and gain application */
+    DD_EMU_STAGE_LAST
+} DD_EMU_STAGE;
+
+/* Clip protection activity, see COMPR_CLIP_STATS */
+typedef struct
+{
+    uint64_t    updates;
+    uint64_t    attacks;
+    uint64_t    holds;
+    double      gain_min_db;
+    double      gain_sum_db;
+} dd_emu_clip_stats;
+
+/* Runtime statistics of an emulator, accumulated since open or the last reset of the statistics */
+typedef struct
+{
+    uint64_t            blocks;                                                 /* blocks through dd_emulation_process */
+    uint32_t            compr_reopens;                                          /* compressor re-opens on a change of the configuration */
+    dd_emu_clip_stats   dlim;                                                   /* DRC clip protection, per block */
+    dd_emu_clip_stats   clim;                                                   /* compr clip protection, per frame */
+    uint64_t            gain_reduction_hist[DD_EMU_MAX_OUTPUTS][DD_EMU_STATS_GR_BINS];  /* blocks per DRC gain reduction */
+    uint64_t            stage_time_ns[DD_EMU_STAGE_LAST];                       /* time spent per stage */
+} dd_emu_stats;
+
+/* Consumers of the per-block tap, each with its own callback */
+typedef enum
+{
+    DD_EMU_TAP_METER = 0,
+    DD_EMU_TAP_TRACE = 1,
+    DD_EMU_TAP_SLOTS
+} DD_EMU_TAP_SLOT;
+
+#define DD_EMU_TAPS_ALL         ((1u << DD_EMU_TAP_SLOTS) - 1)
+
+/* Valid parts of a dd_emu_tap_block */
+#define DD_EMU_TAP_DRC_CALC     1u      /* loudness, maxmix and the DRC/compr gains */
+#define DD_EMU_TAP_DECODER      2u      /* applied gains */
+
+/* Values of one block handed to the tap after dd_emulation_process */
+typedef struct
+{
+    uint64_t    block_index;                                    /* blocks since the tap of this slot was set */
+    uint32_t    flags;                                          /* DD_EMU_TAP_* */
+    int         num_outputs;
+    uint32_t    channel_mask;                                   /* bit per mapped buffer channel */
+    double      peak[DD_EMU_MAX_OUTPUTS][DD_EMU_MAX_CHANS];     /* linear peak of each buffer channel of the processed block, 0 when unmapped */
+    double      log_loudness_db;                                /* see md_ComprGetBlockLevels */
+    double      maxmix_db;
+    double      drc_gain_db;                                    /* line mode gain of the block */
+    double      compr_gain_db;                                  /* RF mode gain of the frame */
+    /* Gain computer states after the block, see COMPR_TRACE */
+    double      dyn_state_db;
+    double      dyn_gain_db;
+    double      dlim_gain_db;
+    double      compr_state_db;
+    double      compr_block_gain_db;
+    double      clim_gain_db;
+    int         dyn_hold;
+    int         dlim_hold;
+    int         compr_hold;
+    int         clim_hold;
+    int         dynrng_code;                                    /* dynrng word of drc_gain_db */
+    int         compr_code;                                     /* compr word of compr_gain_db */
+    double      applied_gain[DD_EMU_MAX_OUTPUTS];               /* linear gain window at the end of the block, dialnorm included */
+} dd_emu_tap_block;
+
+/* Called once per block from dd_emulation_process, must not block */
+typedef void (*dd_emu_tap_fn)(void *p_context, const dd_emu_tap_block *p_block);
+
+#define DD_EMU_TAP_STORAGE_SIZE 32
+
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 /*
- * Query the memory size required by the open call
+ * Capacity an emulator needs to process p_buf_config with num_outputs, without taps
+ */
+void
+dd_emulation_get_capacity
+    (
+      const dd_emu_process_config *p_buf_config
+     ,int                          num_outputs
+     ,dd_emu_capacity             *p_capacity
+    );
+
+/*
+ * Query the memory size required by the open call, p_capacity NULL sizes
+ * for every configuration
  */
 int32_t
 dd_emulation_get_required_mem_size
     (
-      uint32_t   *p_emul_static_mem_size
+      const dd_emu_capacity *p_capacity
+     ,uint32_t   *p_emul_static_mem_size
      ,uint32_t   *p_emul_dynamic_mem_size
      ,uint32_t   *p_compr_static_mem_size
      ,uint32_t   *p_compr_dynamic_mem_size
@@ -192,7 +305,8 @@ dd_emulation_get_required_mem_size
 
 int32_t dd_emulation_open
     (
-     void *p_static_mem
+     const dd_emu_capacity *p_capacity
+    ,void *p_static_mem
     ,void *p_dynamic_mem
     ,uint32_t emul_static_mem_size
     ,uint32_t emul_dynamic_mem_size
@@ -206,11 +320,50 @@ int32_t dd_emulation_open
  */
 int32_t dd_emulation_reset(void *const p_dd_emul_hdl, uint32_t emu_blk_size);
 
+/*
+ * Size of the persistent state blob used by get/set state
+ */
+uint32_t dd_emulation_get_state_size(void);
+
+/*
+ * Copy the filter histories, gain windows and compressor state
+ */
+int32_t dd_emulation_get_state(void *const p_dd_emul_hdl, void *p_state);
+
+/*
+ * Restore a state taken with dd_emulation_get_state
+ */
+int32_t dd_emulation_set_state(void *const p_dd_emul_hdl, const void *p_state);
+
+/*
+ * Copy the runtime statistics and optionally start them over
+ */
+int32_t dd_emulation_get_stats(void *const p_dd_emul_hdl, dd_emu_stats *p_stats, int reset);
+
+/*
+ * Hand every processed block to fn, fn == NULL removes the tap of the slot,
+ * DD_EMU_STATUS_CAPACITY_ERR if the capacity has no tap storage for the slot
+ */
+int32_t dd_emulation_set_tap(void *const p_dd_emul_hdl, DD_EMU_TAP_SLOT slot, dd_emu_tap_fn fn, void *p_context);
+
+/*
+ * Storage of size bytes kept with the handle for the context of a slot's tap,
+ * NULL if size exceeds DD_EMU_TAP_STORAGE_SIZE or the capacity has no tap storage for the slot
+ */
+void *dd_emulation_get_tap_storage(void *const p_dd_emul_hdl, DD_EMU_TAP_SLOT slot, uint32_t size);
+
 /*
  * Close emulator and return memory block
  */
 int32_t  dd_emulation_close(void *p_dd_emul_hdl);
 
+#ifdef MD_EMUL_KERNEL_BENCH
+/*
+ * Kernel benchmark entry point, only built into the benchmark's copy of the library
+ */
+void attenuate_surrounds(DLB_LFRACT *pcmptr, int16_t sample_offset, int16_t chan, int16_t acmod, int emu_blk_size);
+#endif
+
 /*
  * Perform the DD encode emulation
  *
@@ -43,10 +43,23 @@
 
 #include<dlb_md_emul_api.h>
 #include"dlb_md_emul_pvt.h"
+#include <string.h>  /* for memset */
 
 
 static const uint32_t EMUL_BLK_SIZE = DLB_MD_EMUL_BLOCK_SIZE;
 
+#define MD_EMUL_STATE_MAGIC  0x5345444Du   /* "MDES" */
+
+/* Header in front of a saved state, identifies layout and numeric format */
+typedef struct md_emul_state_header_s
+{
+    uint32_t    magic;
+    uint16_t    version;
+    uint16_t    lfract_size;
+    uint32_t    payload_size;
+    uint32_t    reserved;
+} md_emul_state_header_t;
+
 /** < API Version definition structure */
 static const dlb_md_emul_version_info_t v =
 {
@@ -136,6 +149,156 @@ dlb_md_emul_query_latency
    return latency;
 }
 
+/*
+ * Built-in complexity model: mdemu_calibrate on an AVX-512 Xeon, Release
+ * build of the float64 backend with the x86 SIMD kernels, time stamp
+ * counter cycles
+ */
+static const dlb_md_emul_complexity_model_t default_complexity_model =
+{
+    15.15, 68.04, 95.30, 47.80, 46.88, 1.51,    /* hpf, bwlpf, lfelpf, psf_main, psf_surr, suratt */
+    64.93,                                      /* loudness */
+    { 17.97, 19.46, 29.22, 28.74, 19.96 },      /* downmix */
+    17058.0, 16.42, 12.07, 0.0                  /* gain_calc, gain_apply, aux_copy, call */
+};
+
+/* Channels the compressor measures (without LFE) and the decoder scales and copies, by channel mode */
+static const int complexity_compr_chans[DLB_MD_EMUL_MAX_CHAN_MODE] = {1, 2, 4, 5, 7};
+static const int complexity_apply_chans[DLB_MD_EMUL_MAX_CHAN_MODE] = {1, 2, 4, 6, 8};
+
+/**
+ *  @brief Estimate the cycles per sample frame of each stage.
+ *  @return Error code.
+ */
+int32_t
+dlb_md_emul_query_complexity
+    (
+     const dlb_md_emul_process_config_t    *p_md_emul_conf
+    ,int                                    num_outputs
+    ,const dlb_md_emul_complexity_model_t  *p_model
+    ,dlb_md_emul_complexity_t              *p_complexity
+    )
+{
+    const dlb_md_emul_complexity_model_t *m = p_model ? p_model : &default_complexity_model;
+    double samples;
+    int mode, chan, output, dmx;
+    int compr_chans;
+    DLB_MD_EMUL_CHANNEL_MAP channel;
+
+    if (!p_md_emul_conf || !p_complexity || num_outputs < 1 || num_outputs > DLB_MD_EMUL_MAX_OUTPUTS)
+    {
+        return DD_EMU_STATUS_INVALID_PARAM_ERR;
+    }
+    if (p_md_emul_conf->num_samples < EMUL_BLK_SIZE)
+    {
+        return DD_EMU_STATUS_NOT_ENOUGH_DATA;
+    }
+    memset(p_complexity, 0, sizeof(*p_complexity));
+    if (!(p_md_emul_conf->control & (DLB_MD_EMUL_CONTROL_DECODER_ENABLE | DLB_MD_EMUL_CONTROL_ENCODER_ENABLE)))
+    {
+        return DD_EMU_STATUS_OK;
+    }
+
+    /* Unknown channel modes run as 3/2, as in dlb_md_emul_to_dd_emu */
+    mode = (int)p_md_emul_conf->channel_mode;
+    if (mode < 0 || mode >= DLB_MD_EMUL_MAX_CHAN_MODE)
+    {
+        mode = DLB_MD_EMUL_CHMOD_3_2_1;
+    }
+    samples = (double)(p_md_emul_conf->num_samples / EMUL_BLK_SIZE * EMUL_BLK_SIZE);
+
+    /* encoder_emulation: the LFE slot takes the LFE filter, whatever the channel mode */
+    if (p_md_emul_conf->control & DLB_MD_EMUL_CONTROL_ENCODER_ENABLE)
+    {
+        for (chan = 0; chan < DLB_MD_EMUL_MAX_CHANS; chan++)
+        {
+            double cost = 0.0;
+            int surround;
+
+            channel = p_md_emul_conf->a_chan_map[chan];
+            if (channel == DLB_MD_EMUL_CHAN_NONE)
+            {
+                continue;
+            }
+            surround = (channel == DLB_MD_EMUL_CHAN_LSUR || channel == DLB_MD_EMUL_CHAN_RSUR);
+
+            if (p_md_emul_conf->suratton && surround && mode >= DLB_MD_EMUL_CHMOD_3_1_0)
+            {
+                cost += m->suratt;
+            }
+            if (p_md_emul_conf->hpfon)
+            {
+                cost += m->hpf;
+            }
+            if (channel != DLB_MD_EMUL_CHAN_LFE)
+            {
+                cost += p_md_emul_conf->bwlpfon ? m->bwlpf : 0.0;
+            }
+            else
+            {
+                cost += p_md_emul_conf->lfelpfon ? m->lfelpf : 0.0;
+            }
+            if (p_md_emul_conf->sur90on)
+            {
+                cost += surround ? m->psf_surr : m->psf_main;
+            }
+            p_complexity->encoder_filters[chan] = cost;
+        }
+    }
+
+    /* decoder_emulation */
+    if (p_md_emul_conf->control & DLB_MD_EMUL_CONTROL_DECODER_ENABLE)
+    {
+        if (p_md_emul_conf->control & DLB_MD_EMUL_CONTROL_DRC_CALC_ENABLE)
+        {
+            compr_chans = complexity_compr_chans[mode] + (p_md_emul_conf->lfe_on && mode >= DLB_MD_EMUL_CHMOD_3_2_1);
+            p_complexity->loudness = m->loudness * compr_chans;
+            if (mode >= DLB_MD_EMUL_CHMOD_3_1_0)
+            {
+                for (dmx = 0; dmx < DLB_MD_EMUL_DMX_TYPES; dmx++)
+                {
+                    p_complexity->downmix[dmx] = m->downmix[dmx] * compr_chans;
+                }
+            }
+            p_complexity->gain_calc = m->gain_calc / EMUL_BLK_SIZE;
+        }
+        for (output = 0; output < num_outputs; output++)
+        {
+            if (p_md_emul_conf->comp_mode[output] != DLB_MD_EMUL_CM_NONE)
+            {
+                p_complexity->gain_apply[output] = m->gain_apply * complexity_apply_chans[mode];
+            }
+        }
+    }
+    if (num_outputs == 2)
+    {
+        p_complexity->gain_apply[1] += m->aux_copy * complexity_apply_chans[mode];
+    }
+    p_complexity->call = m->call / samples;
+
+    for (chan = 0; chan < DLB_MD_EMUL_MAX_CHANS; chan++)
+    {
+        p_complexity->total += p_complexity->encoder_filters[chan];
+    }
+    for (dmx = 0; dmx < DLB_MD_EMUL_DMX_TYPES; dmx++)
+    {
+        p_complexity->total += p_complexity->downmix[dmx];
+    }
+    for (output = 0; output < DLB_MD_EMUL_MAX_OUTPUTS; output++)
+    {
+        p_complexity->total += p_complexity->gain_apply[output];
+    }
+    p_complexity->total += p_complexity->loudness + p_complexity->gain_calc + p_complexity->call;
+
+    return DD_EMU_STATUS_OK;
+}
+
+const dlb_md_emul_complexity_model_t *
+dlb_md_emul_get_complexity_model(void)
+{
+    return &default_complexity_model;
+}
+
 /**
  *  @brief Query the memory size required by the open call.
  *  @return Error code.
@@ -151,7 +314,8 @@ dlb_md_emul_query_mem
 
   err = dd_emulation_get_required_mem_size
             (
-             &p_md_emul_size->emul_static_mem_size
+             NULL
+            ,&p_md_emul_size->emul_static_mem_size
             ,&p_md_emul_size->emul_dynamic_mem_size
             ,&p_md_emul_size->compr_static_mem_size
             ,&p_md_emul_size->compr_dynamic_mem_size
@@ -162,6 +326,73 @@ dlb_md_emul_query_mem
   {
      return err;
   }
+  p_md_emul_size->channel_mode = DD_EMU_CHMODE_3_4;
+  p_md_emul_size->num_blocks   = DD_EMU_MAX_BLOCKS;
+  p_md_emul_size->num_chans    = DD_EMU_MAX_CHANS;
+  p_md_emul_size->filters      = DD_EMU_FILTER_ALL;
+  p_md_emul_size->num_outputs  = DD_EMU_MAX_OUTPUTS;
+  p_md_emul_size->taps         = DLB_MD_EMUL_TAP_METER | DLB_MD_EMUL_TAP_TRACE;
+  return 0;
+}
+
+/* DLB_MD_EMUL_TAP_* as tap slots of the capacity */
+static unsigned int capacity_taps(uint32_t taps)
+{
+  return ((taps & DLB_MD_EMUL_TAP_METER) ? 1u << DD_EMU_TAP_METER : 0u) |
+         ((taps & DLB_MD_EMUL_TAP_TRACE) ? 1u << DD_EMU_TAP_TRACE : 0u);
+}
+
+/**
+ *  @brief Query the memory of an emulator sized for one configuration.
+ *  @return Error code.
+ */
+int32_t
+dlb_md_emul_query_mem_config
+    (
+     const dlb_md_emul_process_config_t *p_md_emul_conf
+    ,int                                 num_outputs
+    ,uint32_t                            taps
+    ,dlb_md_emul_size_t                 *p_md_emul_size
+    )
+{
+  md_emul_trans_config_t trans_config;
+  dd_emu_capacity capacity;
+  int32_t err;
+
+  if (!p_md_emul_conf || !p_md_emul_size || num_outputs < 1 || num_outputs > DLB_MD_EMUL_MAX_OUTPUTS ||
+      (taps & ~(DLB_MD_EMUL_TAP_METER | DLB_MD_EMUL_TAP_TRACE)))
+  {
+     return DD_EMU_STATUS_INVALID_PARAM_ERR;
+  }
+  if (p_md_emul_conf->num_samples < EMUL_BLK_SIZE)
+  {
+     return DD_EMU_STATUS_NOT_ENOUGH_DATA;
+  }
+
+  dlb_md_emul_to_dd_emu(p_md_emul_conf, &trans_config.emul_process_config);
+  dd_emulation_get_capacity(&trans_config.emul_process_config, num_outputs, &capacity);
+  capacity.taps = capacity_taps(taps);
+
+  err = dd_emulation_get_required_mem_size
+            (
+             &capacity
+            ,&p_md_emul_size->emul_static_mem_size
+            ,&p_md_emul_size->emul_dynamic_mem_size
+            ,&p_md_emul_size->compr_static_mem_size
+            ,&p_md_emul_size->compr_dynamic_mem_size
+            ,&p_md_emul_size->compr_ext_static_mem_size
+            ,EMUL_BLK_SIZE
+            );
+  if(err)
+  {
+     return err;
+  }
+  p_md_emul_size->channel_mode = capacity.channel_mode;
+  p_md_emul_size->num_blocks   = (uint32_t)capacity.num_blocks;
+  p_md_emul_size->num_chans    = (uint32_t)capacity.num_chans;
+  p_md_emul_size->filters      = capacity.filters;
+  p_md_emul_size->num_outputs  = (uint32_t)capacity.num_outputs;
+  p_md_emul_size->taps         = taps;
   return 0;
 }
 
@@ -179,11 +410,20 @@ dlb_md_emul_open
     )
 {
   int32_t err = 0;
+  dd_emu_capacity capacity;
+
+  capacity.channel_mode = (DD_EMU_CHANNEL_MODE)p_dlb_md_emul_size->channel_mode;
+  capacity.num_blocks   = (int)p_dlb_md_emul_size->num_blocks;
+  capacity.num_chans    = (int)p_dlb_md_emul_size->num_chans;
+  capacity.filters      = p_dlb_md_emul_size->filters;
+  capacity.num_outputs  = (int)p_dlb_md_emul_size->num_outputs;
+  capacity.taps         = capacity_taps(p_dlb_md_emul_size->taps);
 
   p_dlb_md_emul_hdl->p_emul_hdl = p_static_mem;
 
   err = dd_emulation_open(
-                          p_static_mem
+                          p_dlb_md_emul_size->num_blocks ? &capacity : NULL
+                         ,p_static_mem
                          ,p_dynamic_mem
                          ,p_dlb_md_emul_size->emul_static_mem_size
                          ,p_dlb_md_emul_size->emul_dynamic_mem_size
@@ -214,6 +454,161 @@ dlb_md_emul_close
 
 }
 
+/*
+ * Return the emulator to its freshly opened state
+ */
+int32_t
+dlb_md_emul_reset
+    (
+     dlb_md_emul_hdl_t *p_dlb_md_emul_hdl
+    )
+{
+  if (!p_dlb_md_emul_hdl)
+  {
+     return DD_EMU_STATUS_INVALID_HANDLE;
+  }
+  return dd_emulation_reset(p_dlb_md_emul_hdl->p_emul_hdl, EMUL_BLK_SIZE);
+}
+
+/*
+ * Query the size of a saved emulator state
+ */
+uint32_t
+dlb_md_emul_query_state_size(void)
+{
+  return sizeof(md_emul_state_header_t) + dd_emulation_get_state_size();
+}
+
+/*
+ * Save emulator state
+ */
+int32_t
+dlb_md_emul_save_state
+    (
+     dlb_md_emul_hdl_t    *p_dlb_md_emul_hdl
+    ,void                 *p_state
+    ,uint32_t              state_size
+    )
+{
+  md_emul_state_header_t *p_header = (md_emul_state_header_t *)p_state;
+
+  if (!p_dlb_md_emul_hdl)
+  {
+     return DD_EMU_STATUS_INVALID_HANDLE;
+  }
+  if (!p_state || state_size < dlb_md_emul_query_state_size())
+  {
+     return DD_EMU_STATUS_INVALID_PARAM_ERR;
+  }
+
+  p_header->magic        = MD_EMUL_STATE_MAGIC;
+  p_header->version      = DLB_MD_EMUL_STATE_VERSION;
+  p_header->lfract_size  = (uint16_t)sizeof(DLB_LFRACT);
+  p_header->payload_size = dd_emulation_get_state_size();
+  p_header->reserved     = 0;
+
+  return dd_emulation_get_state(p_dlb_md_emul_hdl->p_emul_hdl, p_header + 1);
+}
+
+/*
+ * Load emulator state
+ */
+int32_t
+dlb_md_emul_load_state
+    (
+     dlb_md_emul_hdl_t    *p_dlb_md_emul_hdl
+    ,const void           *p_state
+    ,uint32_t              state_size
+    )
+{
+  const md_emul_state_header_t *p_header = (const md_emul_state_header_t *)p_state;
+
+  if (!p_dlb_md_emul_hdl)
+  {
+     return DD_EMU_STATUS_INVALID_HANDLE;
+  }
+  if (!p_state || state_size < dlb_md_emul_query_state_size())
+  {
+     return DD_EMU_STATUS_INVALID_PARAM_ERR;
+  }
+  /* refuse states from another library version or numeric backend */
+  if (p_header->magic != MD_EMUL_STATE_MAGIC ||
+      p_header->version != DLB_MD_EMUL_STATE_VERSION ||
+      p_header->lfract_size != sizeof(DLB_LFRACT) ||
+      p_header->payload_size != dd_emulation_get_state_size())
+  {
+     return DD_EMU_STATUS_INVALID_PARAM_ERR;
+  }
+
+  return dd_emulation_set_state(p_dlb_md_emul_hdl->p_emul_hdl, p_header + 1);
+}
+
+/*
+ * Get runtime statistics
+ */
+int32_t
+dlb_md_emul_get_stats
+    (
+     dlb_md_emul_hdl_t    *p_dlb_md_emul_hdl
+    ,dlb_md_emul_stats_t  *p_stats
+    ,int                   reset
+    )
+{
+  dd_emu_stats stats;
+  int32_t err;
+  int i, j;
+
+  if (!p_dlb_md_emul_hdl)
+  {
+     return DD_EMU_STATUS_INVALID_HANDLE;
+  }
+  if (!p_stats)
+  {
+     return DD_EMU_STATUS_INVALID_PARAM_ERR;
+  }
+
+  memset(p_stats, 0, sizeof(*p_stats));
+  err = dd_emulation_get_stats(p_dlb_md_emul_hdl->p_emul_hdl, &stats, reset);
+  if (err)
+  {
+     return err;
+  }
+
+  p_stats->blocks_processed = stats.blocks;
+  p_stats->compr_reopens    = stats.compr_reopens;
+
+  p_stats->dlim_updates = stats.dlim.updates;
+  p_stats->dlim_attacks = stats.dlim.attacks;
+  p_stats->dlim_holds   = stats.dlim.holds;
+  if (stats.dlim.updates)
+  {
+     p_stats->dlim_gain_min_db  = stats.dlim.gain_min_db;
+     p_stats->dlim_gain_mean_db = stats.dlim.gain_sum_db / (double)stats.dlim.updates;
+  }
+
+  p_stats->clim_updates = stats.clim.updates;
+  p_stats->clim_attacks = stats.clim.attacks;
+  p_stats->clim_holds   = stats.clim.holds;
+  if (stats.clim.updates)
+  {
+     p_stats->clim_gain_min_db  = stats.clim.gain_min_db;
+     p_stats->clim_gain_mean_db = stats.clim.gain_sum_db / (double)stats.clim.updates;
+  }
+
+  for (i = 0; i < DLB_MD_EMUL_MAX_OUTPUTS; i++)
+  {
+     for (j = 0; j < DLB_MD_EMUL_STATS_GR_BINS; j++)
+     {
+        p_stats->gain_reduction_hist[i][j] = stats.gain_reduction_hist[i][j];
+     }
+  }
+  p_stats->stage_time_ns[DLB_MD_EMUL_STAGE_ENCODER]   = stats.stage_time_ns[DD_EMU_STAGE_ENCODER];
+  p_stats->stage_time_ns[DLB_MD_EMUL_STAGE_DRC_CALC]  = stats.stage_time_ns[DD_EMU_STAGE_DRC_CALC];
+  p_stats->stage_time_ns[DLB_MD_EMUL_STAGE_DRC_APPLY] = stats.stage_time_ns[DD_EMU_STAGE_DRC_APPLY];
+
+  return 0;
+}
+
 /*
  * Perform the encode emulation
  *
@@ -235,14 +630,25 @@ dlb_md_emul_process
 
    if (p_config->control & (DLB_MD_EMUL_CONTROL_DECODER_ENABLE | DLB_MD_EMUL_CONTROL_ENCODER_ENABLE))
    {
+#ifdef MD_EMUL_FLUSH_DENORMALS
+       md_emul_fpenv_t fpenv;
+#endif
        dlb_md_emul_to_dd_emu(p_config, &trans_config.emul_process_config);
 
+#ifdef MD_EMUL_FLUSH_DENORMALS
+       fpenv = md_emul_flush_denormals();
+#endif
+       DLB_INSTRUMENT_ENTER_PUNIT("dlb_md_emul_process");
        err = dd_emulation_process
                   (
                    p_dlb_md_emul_hdl->p_emul_hdl
                   ,&trans_config.emul_process_config
                   ,num_outputs
                   );
+       DLB_INSTRUMENT_LEAVE_PUNIT("dlb_md_emul_process");
+#ifdef MD_EMUL_FLUSH_DENORMALS
+       md_emul_restore_fpenv(fpenv);
+#endif
        if (err)
        {
           return err;
@@ -257,7 +663,7 @@ static
 void
 dlb_md_emul_to_dd_emu
     (
-     dlb_md_emul_process_config_t   *p_config      /**< [in/out] pointer to metadata emulation process control structure */
+     const dlb_md_emul_process_config_t *p_config      /**< [in/out] pointer to metadata emulation process control structure */
     ,dd_emu_process_config          *p_dd_emu_process_config
     )
 {
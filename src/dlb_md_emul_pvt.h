@@ -48,6 +48,45 @@
 
 #include"dd_emulation.h" /* for dd_emu_process_config definition */
 
+#ifdef MD_EMUL_FLUSH_DENORMALS
+/* Flush-to-zero and denormals-are-zero for the duration of a processing call (fast-math builds) */
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define MD_EMUL_MXCSR_FTZ_DAZ   0x8040u     /* MXCSR bit 15 flush-to-zero, bit 6 denormals-are-zero */
+typedef unsigned int md_emul_fpenv_t;
+static inline md_emul_fpenv_t md_emul_flush_denormals(void)
+{
+    unsigned int csr = _mm_getcsr();
+
+    _mm_setcsr(csr | MD_EMUL_MXCSR_FTZ_DAZ);
+    return csr;
+}
+static inline void md_emul_restore_fpenv(md_emul_fpenv_t env)
+{
+    _mm_setcsr(env);
+}
+#elif defined(__aarch64__)
+#define MD_EMUL_FPCR_FZ         (1u << 24)  /* FPCR flush-to-zero, covers inputs and results */
+typedef unsigned long md_emul_fpenv_t;
+static inline md_emul_fpenv_t md_emul_flush_denormals(void)
+{
+    unsigned long fpcr;
+
+    __asm__ __volatile__("mrs %0, fpcr" : "=r"(fpcr));
+    __asm__ __volatile__("msr fpcr, %0" : : "r"(fpcr | MD_EMUL_FPCR_FZ));
+    return fpcr;
+}
+static inline void md_emul_restore_fpenv(md_emul_fpenv_t env)
+{
+    __asm__ __volatile__("msr fpcr, %0" : : "r"(env));
+}
+#else
+typedef int md_emul_fpenv_t;
+static inline md_emul_fpenv_t md_emul_flush_denormals(void) { return 0; }
+static inline void md_emul_restore_fpenv(md_emul_fpenv_t env) { (void)env; }
+#endif
+#endif /* MD_EMUL_FLUSH_DENORMALS */
+
 typedef struct md_emul_trans_config_s
 {
   dd_emu_process_config emul_process_config;
@@ -59,7 +98,7 @@ static
 void
 dlb_md_emul_to_dd_emu
     (
-     dlb_md_emul_process_config_t  *p_config      /**< [in/out] pointer to metadata emulation process control structure */
+     const dlb_md_emul_process_config_t *p_config  /**< [in] pointer to metadata emulation process control structure */
     ,dd_emu_process_config         *p_dd_emu_process_config
     );
 #endif /* DLB_MD_EMUL_PVT_H */
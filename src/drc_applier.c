@@ -284,6 +284,8 @@ DLB_LFRACT dynrng_to_gain(int16_t dynrng)
   perform_boost_cut     - (I) 1 = perform boost/cut, 0 = don't
   boost                 - (I) the boost value
   cut                   - (I) the cut value
+
+  return the DRC gain without dialnorm, linear with 4 bits of headroom
 */
 /* for some reason Visual Studio doesn't know what int8_t is, even
  * though it has no problem with int16_t or int32_t */
@@ -291,7 +293,7 @@ DLB_LFRACT dynrng_to_gain(int16_t dynrng)
 #define int8_t signed char
 #endif
 
-void apply_drc(int16_t drc_type,
+DLB_LFRACT apply_drc(int16_t drc_type,
                int16_t drc_value,
                DLB_LFRACT *history,
                int dialnorm,
@@ -306,6 +308,7 @@ void apply_drc(int16_t drc_type,
                )
 {
     DLB_LFRACT gainValue;
+    DLB_LFRACT drcGain;
 
     /* convert the DRC value to a gain according to its type */
     if (drc_type)
@@ -336,6 +339,8 @@ void apply_drc(int16_t drc_type,
         gainValue = dynrng_to_gain(drc_value);
     }
 
+    drcGain = gainValue;
+
     if(dialnorm > 0 && dialnorm <= MAX_DIALNORM)
     {
         gainValue = DLB_LsmpyLL(gainValue, dialnormtab[dialnorm]);
@@ -347,6 +352,8 @@ void apply_drc(int16_t drc_type,
 
     /* save the gain for next time */
     *history = gainValue;
+
+    return drcGain;
 }
 
 #ifdef WIN32
@@ -105,8 +105,10 @@ DLB_LFRACT dynrng_to_gain(int16_t dynrng);
   perform_boost_cut     - (I) 1 = perform boost/cut, 0 = don't
   boost                 - (I) the boost value
   cut                   - (I) the cut value
+
+  return the DRC gain without dialnorm, linear with 4 bits of headroom
 */
-void apply_drc(int16_t drc_type,
+DLB_LFRACT apply_drc(int16_t drc_type,
                int16_t drc_value,
                DLB_LFRACT *history,
                int dialnorm,
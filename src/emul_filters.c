@@ -313,7 +313,7 @@ emul_biquad
     const DLB_SFRACT *coef = coefptr;
     DLB_ACCU accum;
     DLB_LFRACT insamp;
-#if defined (DLB_METHOD_IS_FLOAT)
+#if defined (DLB_METHOD_IS_FLOAT) && !defined (MD_EMUL_FAST_MATH)
     const DLB_LFRACT denorm_guard = DLB_LcF(1e-20);
 #endif
 
@@ -323,7 +323,7 @@ emul_biquad
         {
             insamp = *iptr;
 
-            #if defined (DLB_METHOD_IS_FLOAT)
+            #if defined (DLB_METHOD_IS_FLOAT) && !defined (MD_EMUL_FAST_MATH)    /* fast math flushes denormals instead */
             if (0 == i)                                             /* first stage only */
             {
                 insamp = DLB_LsaddLL(insamp, denorm_guard);           /* Adding -400dB to prevent Intel denorm of near zero values */
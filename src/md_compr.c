@@ -41,7 +41,7 @@
 #include "md_compr.h"
 
 
-#define MAX_DMX_TYPES   5                               /*< max # of possible downmix types */
+#define MAX_DMX_TYPES   COMPR_MAX_DMX_TYPES             /*< max # of possible downmix types */
 #define NSAMPRATES      3                               /*< # of sample rates */
 #define NCHANS          COMPR_MAX_CHANNELS          /*< max # of channels including lfe */
 
@@ -85,32 +85,27 @@ static const DLB_LFRACT LOGCLIPSCL = DLB_LcF((CLIPSHFT)/48.0);
 static const DLB_LFRACT PLUS11DB = DLB_LcF(-0.03819444443971);
 #define MAXLOG      48
 
+/* Powers normalised by this many bits are taken as silence by DSPlog(). On float backends it is
+   the range of the log: beyond MAXLOG bits the exponent term overflows its Q31 product. */
+#ifdef DLB_METHOD_IS_FLOAT
+#define LOG_SILENCE_NORM    MAXLOG
+#else
+#define LOG_SILENCE_NORM    (DLB_LFRACT_MANTBITS-1)
+#endif
+
+
+/* dB per unit of the log gains of calcClipGain() and calcDrcGain() */
+#define LOG_GAIN_DB     (8.0 * 6.020599913)
+
+/* dB per unit of the DSPlog() level measures, of a power (log_loudness) and of an amplitude (maxmix) */
+#define LOG_POWER_DB    (MAXLOG * 3.010299957)
+#define LOG_AMPL_DB     (MAXLOG * 6.020599913)
 
 static const DLB_LFRACT  ONE_OVER_SIX_DB = DLB_LcF(1.0 / 6.0206 );
 static const DLB_SFRACT  SIX_DB = DLB_ScF(6.0206 / 8.0 );  /* Q3.12 */
 static const DLB_LFRACT  SIX_DB_2 = DLB_LcF(6.020599913 / 16.0 );  /* Q3.12 */
 
 
-static inline
-DLB_LFRACT
-DLB_vec_Labs_maxLU_2
-(const DLB_LFRACT *a
- ,int16_t sample_offset
- ,unsigned int n
-	)
-{
-	unsigned int i;
-	DLB_LFRACT min = a[0];
-	DLB_LFRACT max = a[0];
-	for (i = 1; i < n; i++)
-	{
-		max = DLB_LmaxLL(max, a[i*sample_offset]);
-		min = DLB_LminLL(min, a[i*sample_offset]);
-	}
-	return DLB_LmaxLL(max, DLB_LsnegL(min));
-}
-
-
 /*
   \brief Channel ordering equates
 */
@@ -182,6 +177,11 @@ typedef struct COMPR
 
   DLB_LFRACT *dmixLeft;                     /* [compr_blk_len], holds downmix of left channel for N samples */
   DLB_LFRACT *dmixRight;                    /* [compr_blk_len], holds downmix of right channel for N samples */
+
+#ifndef MD_EMUL_NO_STATS
+  COMPR_STATS *pStats;                      /* clip protection activity, 0 if not collected */
+#endif
+  COMPR_TRACE *pTrace;                      /* gain computer states of the last frame, 0 if not recorded */
 } COMPR;
 
 
@@ -537,7 +537,14 @@ static DLB_LFRACT calcRfLev(DLB_LFRACT mixval[], /*< in: max pcm value for each
                             int16_t   nBlocks    /*< number of blocks to process */
                             );
 
-static void calcClipGain(DLB_LFRACT mixval,      /* in: max pcm value */
+/* What an update of calcClipGain() did to the gain */
+typedef enum {
+  CLIP_DECAY  = 0,   /* gain released (or unchanged) */
+  CLIP_ATTACK = 1,   /* gain lowered, hold restarted */
+  CLIP_HOLD   = 2    /* gain held during holdoff */
+} CLIP_EVENT;
+
+static CLIP_EVENT calcClipGain(DLB_LFRACT mixval,      /* in: max pcm value */
                          DLB_LFRACT *clipgain_state, /* i/o: clip protection gain */
                          int16_t *limholdcnt,        /* i/o: decay holdoff count */
                          DLB_LFRACT clipbias,        /* in: limit offset */
@@ -563,6 +570,14 @@ static void biquad_lwf(DLB_LFRACT *iptr,                         /*< [in]     da
                        void *hCompr );
 
 
+#ifndef MD_EMUL_NO_STATS
+static void comprClipStats(COMPR_CLIP_STATS *pStats,   /* i/o: statistics of one clip protection */
+                           CLIP_EVENT event,           /* in: what the update did */
+                           DLB_LFRACT clipgain         /* in: clip protection gain after the update */
+                           );
+#endif
+
+
 /*
   Documentation for public functions resides _only_ in compr.h
   to avoid confusion of doxygen
@@ -587,17 +602,19 @@ int16_t md_ComprGetRequiredBufferSize(COMPR_CHMODE cm,
   }
 
 
-  *internStaticSize  = numChannels * ((sizeof(DLB_LFRACT*) + sizeof(DLB_LFRACT)-1) / sizeof(DLB_LFRACT))*4 + 3 * sizeof(DLB_LFRACT) * numChannels;     /* lwfstate[numChannel][3] */
+  *internStaticSize  = numChannels * ((sizeof(DLB_LFRACT*) + sizeof(DLB_LFRACT)-1) / sizeof(DLB_LFRACT))*sizeof(DLB_LFRACT) + 3 * sizeof(DLB_LFRACT) * numChannels;     /* lwfstate[numChannel][3] */
 
   /* dynamic */
-  *internDynamicSize  = 2*compr_blk_len * sizeof(DLB_LFRACT);  /* dmixLeft[N], dmixRight[compr_blk_len] */
+  *internDynamicSize  = 0;
+  if(cm >= COMPR_CHMODE_3_0)                                     /* only multichannel modes are downmixed */
+    *internDynamicSize += 2*compr_blk_len * sizeof(DLB_LFRACT);  /* dmixLeft[N], dmixRight[compr_blk_len] */
   *internDynamicSize +=   compr_blk_len * sizeof(DLB_LFRACT);  /* lwfPCM[compr_blk_len] */
   *internDynamicSize += numBlocksPerFrame * sizeof(DLB_LFRACT);  /* maxmix[numBlocksPerFrame] */
   *internDynamicSize += numBlocksPerFrame * sizeof(DLB_LFRACT);  /* log_loudness[numBlocksPerFrame] */
 
-  *externStaticSize  = ((sizeof(COMPR) + sizeof(DLB_LFRACT)-1) / sizeof(DLB_LFRACT)) * 4;            /* COMPR struct */
+  *externStaticSize  = ((sizeof(COMPR) + sizeof(DLB_LFRACT)-1) / sizeof(DLB_LFRACT)) * sizeof(DLB_LFRACT);            /* COMPR struct */
   *externStaticSize += numChannels * sizeof(DLB_LFRACT);         /* lastmaxpcm[numChannels] */
-  *externStaticSize += ((sizeof(DMX) + sizeof(DLB_LFRACT)-1) / sizeof(DLB_LFRACT)) * MAX_DMX_TYPES * 4 + MAX_DMX_TYPES * ((sizeof(HANDLE_DMX) + sizeof(DLB_LFRACT)-1) / sizeof(DLB_LFRACT)) * 4;
+  *externStaticSize += ((sizeof(DMX) + sizeof(DLB_LFRACT)-1) / sizeof(DLB_LFRACT)) * MAX_DMX_TYPES * sizeof(DLB_LFRACT) + MAX_DMX_TYPES * ((sizeof(HANDLE_DMX) + sizeof(DLB_LFRACT)-1) / sizeof(DLB_LFRACT)) * sizeof(DLB_LFRACT);
 
   return COMPR_OK;
 }
@@ -690,6 +707,7 @@ HANDLE_COMPR md_ComprOpen( void * pInternStatic,
   pExternStaticMem += ((sizeof(HANDLE_DMX*) + sizeof(DLB_LFRACT)-1) / sizeof(DLB_LFRACT)) * MAX_DMX_TYPES * sizeof(DLB_LFRACT);
   for(i=0; i<MAX_DMX_TYPES; i++){
     hCompr->hDmx[i] = (HANDLE_DMX)pExternStaticMem;
+    memset(hCompr->hDmx[i], 0, sizeof(DMX));  /* maxVal is only computed for modes with a downmix */
     pExternStaticMem += ((sizeof(DMX) + sizeof(DLB_LFRACT)-1) / sizeof(DLB_LFRACT)) * sizeof(DLB_LFRACT);
   }
 
@@ -735,10 +753,14 @@ HANDLE_COMPR md_ComprOpen( void * pInternStatic,
   hCompr->maxmix = (DLB_LFRACT*)(pInternDynamicMem);
   pInternDynamicMem += sizeof(DLB_LFRACT) * numBlocksPerFrame;
 
-  hCompr->dmixLeft = (DLB_LFRACT*)(pInternDynamicMem);
-  pInternDynamicMem += sizeof(DLB_LFRACT) * compr_blk_len;
-  hCompr->dmixRight = (DLB_LFRACT*)(pInternDynamicMem);
-  pInternDynamicMem += sizeof(DLB_LFRACT) * compr_blk_len;
+  hCompr->dmixLeft = NULL;
+  hCompr->dmixRight = NULL;
+  if(cm >= COMPR_CHMODE_3_0){
+    hCompr->dmixLeft = (DLB_LFRACT*)(pInternDynamicMem);
+    pInternDynamicMem += sizeof(DLB_LFRACT) * compr_blk_len;
+    hCompr->dmixRight = (DLB_LFRACT*)(pInternDynamicMem);
+    pInternDynamicMem += sizeof(DLB_LFRACT) * compr_blk_len;
+  }
 
   hCompr->lwfPCM = (DLB_LFRACT*)(pInternDynamicMem);
   pInternDynamicMem += sizeof(DLB_LFRACT) * compr_blk_len;
@@ -814,7 +836,9 @@ int16_t md_ComprProcess(HANDLE_COMPR hCompr,
   for ( blknum = 0; blknum < hCompr->numBlocksPerFrame; blknum++ ) 
   {
     /* Calculate the loudness of the input signal for each block */
+    DLB_INSTRUMENT_ENTER_PUNIT("comprLoudnessCalc");
     comprLoudnessCalc(pcmIn, sample_offset, hCompr, blknum, prl, compr_blk_len);
+    DLB_INSTRUMENT_LEAVE_PUNIT("comprLoudnessCalc");
 
     if (hCompr->channelMode >= COMPR_CHMODE_3_0) 
 	{
@@ -826,22 +850,176 @@ int16_t md_ComprProcess(HANDLE_COMPR hCompr,
 			hDmix->maxVal = DLB_L00;
 			if(hDmix->bitMaskVal & activeDmxBitmask)
 			{
+				DLB_INSTRUMENT_ENTER_PUNIT("comprDmxCalc");
 				comprDmxCalc( pcmIn, sample_offset, hCompr, blknum, hDmix, compr_blk_len);
+				DLB_INSTRUMENT_LEAVE_PUNIT("comprDmxCalc");
 			}
 		}
     }
 
+    DLB_INSTRUMENT_ENTER_PUNIT("comprDrcCalc");
     comprDrcCalc( hCompr, blknum);
+    DLB_INSTRUMENT_LEAVE_PUNIT("comprDrcCalc");
   }
 
   /* Calculates gain values depending on the compressor profile and the
      ensures that possible downmixes will not clip                      */
+  DLB_INSTRUMENT_ENTER_PUNIT("comprE");
   comprE( hCompr, pProfileDRC, pProfileCompr, prl, gainDRC, gainCompr);
+  DLB_INSTRUMENT_LEAVE_PUNIT("comprE");
+
+  return COMPR_OK;
+}
+
+
+/*
+  Documentation for public functions resides _only_ in compr.h
+  to avoid confusion of doxygen
+*/
+int16_t md_ComprGetState(const HANDLE_COMPR hCompr,
+                         COMPR_STATE *pState)
+{
+  int16_t i;
+
+  if((hCompr == 0) || (pState == 0))
+    return COMPR_INVALID_PTR;
+
+  memset(pState, 0, sizeof(COMPR_STATE));
+
+  pState->dyn_gain    = hCompr->dyn_gain;
+  pState->dyn_state   = hCompr->dyn_state;
+  pState->dyn_hold    = hCompr->dyn_hold;
+  pState->compr_gain  = hCompr->compr_gain;
+  pState->compr_state = hCompr->compr_state;
+  pState->compr_hold  = hCompr->compr_hold;
+  pState->dlim_gain   = hCompr->dlim_gain;
+  pState->dlim_hold   = hCompr->dlim_hold;
+  pState->clim_gain   = hCompr->clim_gain;
+  pState->clim_hold   = hCompr->clim_hold;
+  pState->lastmaxmix  = hCompr->lastmaxmix;
+
+  for(i=0; i<hCompr->nchans; i++){
+    pState->lastmaxpcm[i]  = hCompr->lastmaxpcm[i];
+    pState->lwfstate[i][0] = hCompr->lwfstate[i][0];
+    pState->lwfstate[i][1] = hCompr->lwfstate[i][1];
+    pState->lwfstate[i][2] = hCompr->lwfstate[i][2];
+  }
+
+  for(i=0; i<MAX_DMX_TYPES; i++){
+    pState->dmx[i] = *hCompr->hDmx[i];
+  }
+
+  return COMPR_OK;
+}
+
+
+int16_t md_ComprSetState(HANDLE_COMPR hCompr,
+                         const COMPR_STATE *pState)
+{
+  int16_t i;
+
+  if((hCompr == 0) || (pState == 0))
+    return COMPR_INVALID_PTR;
+
+  hCompr->dyn_gain    = pState->dyn_gain;
+  hCompr->dyn_state   = pState->dyn_state;
+  hCompr->dyn_hold    = pState->dyn_hold;
+  hCompr->compr_gain  = pState->compr_gain;
+  hCompr->compr_state = pState->compr_state;
+  hCompr->compr_hold  = pState->compr_hold;
+  hCompr->dlim_gain   = pState->dlim_gain;
+  hCompr->dlim_hold   = pState->dlim_hold;
+  hCompr->clim_gain   = pState->clim_gain;
+  hCompr->clim_hold   = pState->clim_hold;
+  hCompr->lastmaxmix  = pState->lastmaxmix;
+
+  for(i=0; i<hCompr->nchans; i++){
+    hCompr->lastmaxpcm[i]  = pState->lastmaxpcm[i];
+    hCompr->lwfstate[i][0] = pState->lwfstate[i][0];
+    hCompr->lwfstate[i][1] = pState->lwfstate[i][1];
+    hCompr->lwfstate[i][2] = pState->lwfstate[i][2];
+  }
+
+  for(i=0; i<MAX_DMX_TYPES; i++){
+    *hCompr->hDmx[i] = pState->dmx[i];
+  }
+
+  return COMPR_OK;
+}
+
+
+/*
+  Documentation for public functions resides _only_ in compr.h
+  to avoid confusion of doxygen
+*/
+int16_t md_ComprSetTrace(HANDLE_COMPR hCompr,
+                         COMPR_TRACE *pTrace)
+{
+  if(hCompr == 0)
+    return COMPR_INVALID_PTR;
+
+  hCompr->pTrace = pTrace;
 
   return COMPR_OK;
 }
 
 
+int16_t md_ComprGetBlockLevels(const HANDLE_COMPR hCompr,
+                               double *pLoudnessDb,
+                               double *pMaxmixDb)
+{
+  int blknum;
+
+  if(hCompr == 0)
+    return COMPR_INVALID_PTR;
+
+  for (blknum = 0; blknum < hCompr->numBlocksPerFrame; blknum++) {
+    pLoudnessDb[blknum] = -DLB_F_L(hCompr->log_loudness[blknum]) * LOG_POWER_DB;
+    /* maxmix is measured CLIPSHFT bits down, as calcClipGain() takes it */
+    pMaxmixDb[blknum]   = -(DLB_F_L(hCompr->maxmix[blknum]) - DLB_F_L(LOGCLIPSCL)) * LOG_AMPL_DB;
+  }
+
+  return COMPR_OK;
+}
+
+
+#ifndef MD_EMUL_NO_STATS
+/*
+  Documentation for public functions resides _only_ in compr.h
+  to avoid confusion of doxygen
+*/
+int16_t md_ComprSetStats(HANDLE_COMPR hCompr,
+                         COMPR_STATS *pStats)
+{
+  if(hCompr == 0)
+    return COMPR_INVALID_PTR;
+
+  hCompr->pStats = pStats;
+
+  return COMPR_OK;
+}
+
+
+/*
+  \brief  Adds one clip protection update to its statistics
+*/
+static void comprClipStats(COMPR_CLIP_STATS *pStats,
+                           CLIP_EVENT event,
+                           DLB_LFRACT clipgain
+                           )
+{
+  double gainDb = DLB_F_L(clipgain) * LOG_GAIN_DB;
+
+  if (pStats->updates == 0 || gainDb < pStats->gainMinDb)
+    pStats->gainMinDb = gainDb;
+  pStats->gainSumDb += gainDb;
+  pStats->updates++;
+  pStats->attacks += (event == CLIP_ATTACK);
+  pStats->holds   += (event == CLIP_HOLD);
+}
+#endif
+
+
 /*
   \brief  Calculates gain values depending on the compressor profile and the
           ensures that possible downmixes will not clip
@@ -863,6 +1041,7 @@ static void comprE(HANDLE_COMPR hCompr,               /*< In/Out: Dynamic range
                    )
 {
   int blknum;
+  CLIP_EVENT event;
   DLB_LFRACT mincomprgain = DLB_L10;
   DLB_LFRACT comprGainInc = CGAININC;
   int16_t comprMaxHold = CMAXHOLD;
@@ -877,8 +1056,12 @@ static void comprE(HANDLE_COMPR hCompr,               /*< In/Out: Dynamic range
     hCompr->maxmix[blknum] = DLB_LsaddLL(hCompr->maxmix[blknum], DLB_LshrLU(prl, 1));
 
     /* Calculate clip protection gain */
-    calcClipGain(hCompr->maxmix[blknum], &hCompr->dlim_gain, &hCompr->dlim_hold,
-                 DYNBIAS, DGAININC, DMAXHOLD);
+    event = calcClipGain(hCompr->maxmix[blknum], &hCompr->dlim_gain, &hCompr->dlim_hold,
+                         DYNBIAS, DGAININC, DMAXHOLD);
+#ifndef MD_EMUL_NO_STATS
+    if (hCompr->pStats)
+      comprClipStats(&hCompr->pStats->dlim, event, hCompr->dlim_gain);
+#endif
 
     /* calc "artistic" compression gain, and limit by clip gain */
     calcDrcGain(hCompr->log_loudness[blknum],
@@ -889,6 +1072,16 @@ static void comprE(HANDLE_COMPR hCompr,               /*< In/Out: Dynamic range
                 &hCompr->dyn_gain);
 
     gainDRC[blknum] = DLB_LmpyLL(hCompr->dyn_gain, SIX_DB_2);
+
+    if (hCompr->pTrace) {
+      COMPR_TRACE_BLOCK *pBlock = &hCompr->pTrace->block[blknum];
+
+      pBlock->dynStateDb = -DLB_F_L(hCompr->dyn_state) * LOG_POWER_DB;
+      pBlock->dynGainDb  = DLB_F_L(hCompr->dyn_gain) * LOG_GAIN_DB;
+      pBlock->dlimGainDb = DLB_F_L(hCompr->dlim_gain) * LOG_GAIN_DB;
+      pBlock->dynHold    = hCompr->dyn_hold;
+      pBlock->dlimHold   = hCompr->dlim_hold;
+    }
   } /* end for (blknum) */
 
   switch(hCompr->numBlocksPerFrame){
@@ -909,12 +1102,18 @@ static void comprE(HANDLE_COMPR hCompr,               /*< In/Out: Dynamic range
   /*  Compute compr gain word(s) */
   /*  Calculate clip protection gain */
 
-  calcClipGain(calcRfLev(hCompr->maxmix, hCompr->numBlocksPerFrame),
-               &hCompr->clim_gain,
-               &hCompr->clim_hold,
-               CMPBIAS,
-               comprGainInc,
-               comprMaxHold);
+  event = calcClipGain(calcRfLev(hCompr->maxmix, hCompr->numBlocksPerFrame),
+                       &hCompr->clim_gain,
+                       &hCompr->clim_hold,
+                       CMPBIAS,
+                       comprGainInc,
+                       comprMaxHold);
+#ifndef MD_EMUL_NO_STATS
+  if (hCompr->pStats)
+    comprClipStats(&hCompr->pStats->clim, event, hCompr->clim_gain);
+#else
+  (void)event;
+#endif
 
   /*  Limit compr_gain to clip protection value (clim_gain) */
 
@@ -928,6 +1127,18 @@ static void comprE(HANDLE_COMPR hCompr,               /*< In/Out: Dynamic range
                 &hCompr->compr_hold,
                 &hCompr->compr_gain);
     mincomprgain = DLB_LminLL(hCompr->compr_gain, mincomprgain);
+
+    if (hCompr->pTrace) {
+      COMPR_TRACE_BLOCK *pBlock = &hCompr->pTrace->block[blknum];
+
+      pBlock->comprStateDb = -DLB_F_L(hCompr->compr_state) * LOG_POWER_DB;
+      pBlock->comprGainDb  = DLB_F_L(hCompr->compr_gain) * LOG_GAIN_DB;
+      pBlock->comprHold    = hCompr->compr_hold;
+    }
+  }
+  if (hCompr->pTrace) {
+    hCompr->pTrace->climGainDb = DLB_F_L(hCompr->clim_gain) * LOG_GAIN_DB;
+    hCompr->pTrace->climHold   = hCompr->clim_hold;
   }
 
   gainCompr[0] = DLB_LmpyLL(mincomprgain, SIX_DB_2);
@@ -967,7 +1178,7 @@ static void comprLoudnessCalc(PCM_TYPE *pcmptr,    /*< pointer to pcm data */
 
     pCurrPcmBlock = pcmptr + (compr_blk_len * blknum * sample_offset) + chan; 
 
-    maxsamp = DLB_vec_Labs_maxLU_2(pCurrPcmBlock, sample_offset, compr_blk_len); /* Compensate for scale in hpf() */
+    maxsamp = DLB_vec_Labs_max_strideLUU(pCurrPcmBlock, (unsigned int)sample_offset, compr_blk_len); /* Compensate for scale in hpf() */
 
     headroom = DLB_UnormL(maxsamp);                            /* save headroom for meansquare */
 
@@ -1179,7 +1390,7 @@ static DLB_LFRACT DSPlog(DLB_LFRACT logarg)    /* log argument */
   /* Normalize power measure */
 
   powexp = DLB_UnormL(logarg);
-  if (powexp >= (DLB_LFRACT_MANTBITS-1)) {
+  if (powexp >= LOG_SILENCE_NORM) {
     return DLB_L10;
   }
   else {
@@ -1234,7 +1445,7 @@ static DLB_LFRACT DSPmeansq(DLB_LFRACT *iptr,  /*< input data */
 
   \return
 */
-static void calcClipGain(DLB_LFRACT mixval,        /* in: max pcm value (signal and downmix) */
+static CLIP_EVENT calcClipGain(DLB_LFRACT mixval,        /* in: max pcm value (signal and downmix) */
                          DLB_LFRACT *clipgain_state,   /* i/o: clip protection gain */
                          int16_t *limholdcnt,         /* i/o: decay holdoff count */
                          DLB_LFRACT clipbias,          /* in: limit offset */
@@ -1243,6 +1454,7 @@ static void calcClipGain(DLB_LFRACT mixval,        /* in: max pcm value (signal
                          )
 {
   DLB_LFRACT clipgain;
+  CLIP_EVENT event = CLIP_DECAY;
 
   /* Calc (clip level)/(max pcm sample) */
 
@@ -1260,11 +1472,13 @@ static void calcClipGain(DLB_LFRACT mixval,        /* in: max pcm value (signal
 
   if (DLB_IltLL(clipgain, DLB_LsaddLL(*clipgain_state, gaininc))) { /* attack */
     *limholdcnt = maxhold; /* reset hold count */
+    event = CLIP_ATTACK;
   }
   else { /* decay */
     if (*limholdcnt) { /* hold current gain */
       clipgain = *clipgain_state;
       *limholdcnt -= 1;
+      event = CLIP_HOLD;
     }
     else { /* slowly increase allowable gain */
       clipgain = DLB_LsaddLL(*clipgain_state, gaininc);
@@ -1273,6 +1487,7 @@ static void calcClipGain(DLB_LFRACT mixval,        /* in: max pcm value (signal
 
   *clipgain_state = clipgain; /* save gain state */
 
+  return event;
 } /* calcClipGain */
 
 
@@ -1541,3 +1756,46 @@ uint16_t convCompressorGainToDD(const DLB_LFRACT x,
       return (((exponent<<4) & 0x000000F0) + ((j>>1) & 0x0000000F));
   }
 }
+
+
+#ifdef MD_EMUL_KERNEL_BENCH
+/*
+  Kernel benchmark entry points, see md_compr.h
+*/
+void md_ComprBenchLoudness(HANDLE_COMPR hCompr, PCM_TYPE *pcmIn, uint32_t sample_offset, uint32_t compr_blk_len)
+{
+  int16_t blknum;
+
+  for ( blknum = 0; blknum < hCompr->numBlocksPerFrame; blknum++ )
+    comprLoudnessCalc(pcmIn, (int16_t)sample_offset, hCompr, blknum, DLB_L00, compr_blk_len);
+}
+
+void md_ComprBenchDmx(HANDLE_COMPR hCompr, PCM_TYPE *pcmIn, uint32_t sample_offset, uint32_t compr_blk_len, uint16_t activeDmxBitmask)
+{
+  int16_t blknum, dmx;
+
+  /* Only multichannel modes have downmix buffers, as in md_ComprProcess */
+  if (hCompr->channelMode < COMPR_CHMODE_3_0)
+    return;
+
+  for ( blknum = 0; blknum < hCompr->numBlocksPerFrame; blknum++ )
+  {
+    for ( dmx = 0; dmx < MAX_DMX_TYPES; dmx++ )
+    {
+      hCompr->hDmx[dmx]->maxVal = DLB_L00;
+      if(hCompr->hDmx[dmx]->bitMaskVal & activeDmxBitmask)
+        comprDmxCalc(pcmIn, (int16_t)sample_offset, hCompr, blknum, hCompr->hDmx[dmx], compr_blk_len);
+    }
+  }
+}
+
+DLB_LFRACT md_ComprBenchDrcGain(HANDLE_COMPR hCompr, COMPR_PROFILE_TYPE profile)
+{
+  const COMPR_PROFILE *pProfile = profile ? &comprPreset[profile-1] : 0;
+  int16_t blknum;
+
+  for ( blknum = 0; blknum < hCompr->numBlocksPerFrame; blknum++ )
+    calcDrcGain(hCompr->log_loudness[blknum], pProfile, DLB_L10, &hCompr->dyn_state, &hCompr->dyn_hold, &hCompr->dyn_gain);
+  return hCompr->dyn_gain;
+}
+#endif
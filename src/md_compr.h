@@ -103,6 +103,8 @@ extern "C" {
 #define COMPR_BLOCK_LEN       32                       /*!< # of samples per compressor time block */
 #endif
 #define COMPR_MAX_CHANNELS      8                       /*!< # of possible channels */
+#define COMPR_MAX_DMX_TYPES     5                       /*!< # of possible downmix types */
+#define COMPR_MAX_BLOCKS        8                       /*!< most blocks per frame */
 
 /*!
   \name ORable flags for activeDmxBitmask
@@ -215,6 +217,77 @@ typedef struct {
 */
 typedef struct COMPR *HANDLE_COMPR;
 
+/*!
+  \brief Persistent state of one compressor instance, plain values only
+
+  Holds everything that carries over from one md_ComprProcess() call to the next.
+  Channel mode, LFE flag, block count and sample rate are not part of it; they are
+  given to md_ComprOpen() and must match when the state is restored.
+*/
+typedef struct {
+  DLB_LFRACT dyn_gain;
+  DLB_LFRACT dyn_state;
+  int16_t    dyn_hold;
+  DLB_LFRACT compr_gain;
+  DLB_LFRACT compr_state;
+  int16_t    compr_hold;
+  DLB_LFRACT dlim_gain;
+  int16_t    dlim_hold;
+  DLB_LFRACT clim_gain;
+  int16_t    clim_hold;
+  DLB_LFRACT lastmaxmix;
+  DLB_LFRACT lastmaxpcm[COMPR_MAX_CHANNELS];
+  DLB_LFRACT lwfstate[COMPR_MAX_CHANNELS][3];
+  DMX        dmx[COMPR_MAX_DMX_TYPES];
+} COMPR_STATE;
+
+
+/*!
+  \brief Activity of one clip protection (calcClipGain) instance, accumulated over its updates
+
+  Gains are those of the clip protection state after each update, in dB.
+*/
+typedef struct {
+  uint64_t   updates;      /*!< number of updates (blocks for DRC, frames for compr) */
+  uint64_t   attacks;      /*!< updates that lowered the gain and restarted the hold */
+  uint64_t   holds;        /*!< updates that held the gain during the holdoff */
+  double     gainMinDb;    /*!< lowest gain */
+  double     gainSumDb;    /*!< sum of the gains, for the mean */
+} COMPR_CLIP_STATS;
+
+/*!
+  \brief Clip protection activity of a compressor instance
+*/
+typedef struct {
+  COMPR_CLIP_STATS dlim;   /*!< DRC clip protection (dlim_gain, once per block) */
+  COMPR_CLIP_STATS clim;   /*!< compr clip protection (clim_gain, once per frame) */
+} COMPR_STATS;
+
+/*!
+  \brief Gain computer state of one block after its update
+
+  Filter states are on the scale of md_ComprGetBlockLevels(), gains in dB.
+*/
+typedef struct {
+  double     dynStateDb;   /*!< DRC loudness filter state */
+  double     dynGainDb;    /*!< DRC gain, limited by dlimGainDb */
+  double     dlimGainDb;   /*!< DRC clip protection gain */
+  double     comprStateDb; /*!< compr loudness filter state */
+  double     comprGainDb;  /*!< compr gain, limited by the clip protection of the frame */
+  int16_t    dynHold;      /*!< DRC decay holdoff count */
+  int16_t    dlimHold;     /*!< DRC clip protection holdoff count */
+  int16_t    comprHold;    /*!< compr decay holdoff count */
+} COMPR_TRACE_BLOCK;
+
+/*!
+  \brief Gain computer states of the last md_ComprProcess() call
+*/
+typedef struct {
+  COMPR_TRACE_BLOCK block[COMPR_MAX_BLOCKS];
+  double     climGainDb;   /*!< compr clip protection gain of the frame */
+  int16_t    climHold;     /*!< compr clip protection holdoff count */
+} COMPR_TRACE;
+
 
 /*!
   \name Interface Functions
@@ -224,6 +297,10 @@ typedef struct COMPR *HANDLE_COMPR;
 /*!
   \brief Get memory requirements for compressor instance
 
+  The sizes grow with the channels of cm, its downmixes and numBlocksPerFrame,
+  memory sized for one channel mode and block count holds any other that needs
+  no more of each.
+
   \return COMPR_OK if successful
 */
   int16_t md_ComprGetRequiredBufferSize(COMPR_CHMODE cm,             /*!< IN Channel mode */
@@ -267,6 +344,62 @@ typedef struct COMPR *HANDLE_COMPR;
                             uint32_t sample_offset );        /*!< IN Stride of PCM input buffer */
 
 
+/*!
+  \brief Copies the persistent state of a compressor instance
+
+  \return COMPR_OK if successful
+*/
+  int16_t md_ComprGetState(const HANDLE_COMPR hCompr,      /*!< IN Handle to one compressor instance */
+                           COMPR_STATE *pState             /*!< OUT State */
+                           );
+
+/*!
+  \brief Restores a state taken with md_ComprGetState() into an instance opened with the same parameters
+
+  \return COMPR_OK if successful
+*/
+  int16_t md_ComprSetState(HANDLE_COMPR hCompr,            /*!< IN/OUT Handle to one compressor instance */
+                           const COMPR_STATE *pState       /*!< IN State */
+                           );
+
+#ifndef MD_EMUL_NO_STATS
+/*!
+  \brief Accumulates the clip protection activity of an instance into pStats from now on
+
+  The pointer is cleared by md_ComprOpen(), 0 stops the accumulation.
+
+  \return COMPR_OK if successful
+*/
+  int16_t md_ComprSetStats(HANDLE_COMPR hCompr,            /*!< IN/OUT Handle to one compressor instance */
+                           COMPR_STATS *pStats             /*!< IN Statistics to add to, or 0 */
+                           );
+#endif
+
+/*!
+  \brief Records the gain computer states of every md_ComprProcess() call into pTrace from now on
+
+  The pointer is cleared by md_ComprOpen(), 0 stops the recording.
+
+  \return COMPR_OK if successful
+*/
+  int16_t md_ComprSetTrace(HANDLE_COMPR hCompr,            /*!< IN/OUT Handle to one compressor instance */
+                           COMPR_TRACE *pTrace             /*!< IN States to overwrite, or 0 */
+                           );
+
+/*!
+  \brief Returns the level measures of every block of the last md_ComprProcess() call in dB
+
+  Both carry the dialnorm shift of the compressor, which refers every programme to a dialnorm
+  of -31: a block at the dialogue level has a loudness of -31 dB, and maxmix, the peak of the
+  worst case downmix in dBFS, reads 31 - dialnorm dB low.
+
+  \return COMPR_OK if successful
+*/
+  int16_t md_ComprGetBlockLevels(const HANDLE_COMPR hCompr,   /*!< IN Handle to one compressor instance */
+                                 double *pLoudnessDb,         /*!< OUT log_loudness of each block */
+                                 double *pMaxmixDb            /*!< OUT maxmix of each block */
+                                 );
+
 /*!
   \brief Converts Q7.24 dB gains to DD bitstream format for dynrange and compr
 
@@ -290,6 +423,19 @@ typedef struct COMPR *HANDLE_COMPR;
                                    );
 /*@}*/
 
+#ifdef MD_EMUL_KERNEL_BENCH
+/*!
+  \name Kernel benchmark entry points
+  Only built into the benchmark's copy of the library (MD_EMUL_KERNEL_BENCH).
+  Each runs one internal kernel over all blocks of a frame as md_ComprProcess() does.
+*/
+/*@{*/
+  void md_ComprBenchLoudness(HANDLE_COMPR hCompr, PCM_TYPE *pcmIn, uint32_t sample_offset, uint32_t compr_blk_len);
+  void md_ComprBenchDmx(HANDLE_COMPR hCompr, PCM_TYPE *pcmIn, uint32_t sample_offset, uint32_t compr_blk_len, uint16_t activeDmxBitmask);
+  DLB_LFRACT md_ComprBenchDrcGain(HANDLE_COMPR hCompr, COMPR_PROFILE_TYPE profile);
+/*@}*/
+#endif
+
 
 #ifdef __cplusplus
 }
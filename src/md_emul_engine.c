@@ -0,0 +1,869 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ *
+ * @defgroup - Metadata emulation multi-stream engine
+ * @{
+ * Fixed worker pool with one Chase-Lev work-stealing deque per worker.
+ *
+ * A stream is the unit of scheduling: it is "queued" (in exactly one deque
+ * or inbox, or running on exactly one worker) or "idle". The submitting
+ * thread feeds each stream through a single-producer/single-consumer ring
+ * of block descriptors, so neither submission nor processing of a block
+ * takes a lock. Streams submitted from outside the pool are handed to their
+ * home worker through a lock-free inbox list; idle workers steal queued
+ * streams from the top of other workers' deques.
+ * @}
+ */
+
+#define _GNU_SOURCE     /* pthread_setaffinity_np */
+
+#include<dlb_md_emul_engine.h>
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <time.h>
+
+#define ENGINE_ALIGN            64
+#define ENGINE_ALIGN_UP(x)      (((x) + (ENGINE_ALIGN - 1)) & ~(size_t)(ENGINE_ALIGN - 1))
+#define ENGINE_IDLE_SPINS       64
+
+enum
+{
+    STREAM_IDLE   = 0,
+    STREAM_QUEUED = 1
+};
+
+typedef struct md_emul_engine_slot_s
+{
+    dlb_md_emul_process_config_t   config;
+    uint64_t                       submit_us;
+} md_emul_engine_slot_t;
+
+typedef struct md_emul_engine_stream_s
+{
+    struct md_emul_engine_stream_s *_Atomic p_next;  /* inbox link, valid while in an inbox */
+    atomic_int                     sched_state;
+    atomic_int                     in_use;
+    uint32_t                       id;
+    uint32_t                       home_worker;
+
+    dlb_md_emul_stream_config_t    config;
+    dlb_md_emul_hdl_t              emul_hdl;
+    void                          *p_static_mem;
+    void                          *p_dynamic_mem;
+
+    /* SPSC block ring: head is written by the submitter, tail by the owning worker */
+    md_emul_engine_slot_t         *p_slots;
+    _Atomic uint64_t               head;
+    _Atomic uint64_t               tail;
+
+    /* statistics, written only by the worker currently owning the stream */
+    _Atomic uint64_t               processed;
+    _Atomic uint64_t               failed;
+    _Atomic uint64_t               deadline_misses;
+    _Atomic uint64_t               max_latency_us;
+    _Atomic uint64_t               total_latency_us;
+    _Atomic uint64_t               latency_hist[DLB_MD_EMUL_ENGINE_HIST_BUCKETS];
+} md_emul_engine_stream_t;
+
+typedef struct md_emul_engine_worker_s
+{
+    dlb_md_emul_engine_t                      *p_engine;
+    uint32_t                                   index;
+    uint32_t                                   steal_seed;
+    pthread_t                                  thread;
+    int                                        started;
+
+    /* Chase-Lev deque, capacity is a power of two >= max_streams so it never overflows */
+    _Atomic int64_t                            top;
+    _Atomic int64_t                            bottom;
+    _Atomic(md_emul_engine_stream_t *)        *p_buf;
+
+    /* streams made ready by threads outside the pool */
+    _Atomic(md_emul_engine_stream_t *)         inbox;
+} md_emul_engine_worker_t;
+
+struct dlb_md_emul_engine_s
+{
+    dlb_md_emul_engine_config_t    config;
+    dlb_md_emul_size_t             emul_size;
+    int64_t                        deque_mask;
+
+    md_emul_engine_worker_t       *p_workers;
+    md_emul_engine_stream_t       *p_streams;
+
+    atomic_int                     shutdown;
+    atomic_int                     sleepers;
+    uint64_t                       wake_seq;     /* protected by wake_lock */
+    pthread_mutex_t                wake_lock;
+    pthread_cond_t                 wake_cond;
+};
+
+/*
+ * Private Functions
+ */
+static uint64_t engine_now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000u + (uint64_t)ts.tv_nsec / 1000u;
+}
+
+static size_t engine_deque_capacity(uint32_t max_streams)
+{
+    size_t cap = 2;
+    while (cap < max_streams)
+    {
+        cap <<= 1;
+    }
+    return cap;
+}
+
+static void engine_emul_mem_sizes(const dlb_md_emul_size_t *p_size, size_t *p_static, size_t *p_dynamic)
+{
+    *p_static  = ENGINE_ALIGN_UP((size_t)p_size->emul_static_mem_size
+                               + p_size->compr_static_mem_size
+                               + p_size->compr_ext_static_mem_size);
+    *p_dynamic = ENGINE_ALIGN_UP((size_t)p_size->emul_dynamic_mem_size
+                               + p_size->compr_dynamic_mem_size);
+}
+
+/* Owner only: push a stream to the bottom of the worker's deque */
+static void deque_push(md_emul_engine_worker_t *p_worker, md_emul_engine_stream_t *p_stream)
+{
+    int64_t b = atomic_load_explicit(&p_worker->bottom, memory_order_relaxed);
+
+    atomic_store_explicit(&p_worker->p_buf[b & p_worker->p_engine->deque_mask], p_stream, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&p_worker->bottom, b + 1, memory_order_relaxed);
+}
+
+/* Owner only: take a stream from the bottom of the worker's deque */
+static md_emul_engine_stream_t *deque_take(md_emul_engine_worker_t *p_worker)
+{
+    int64_t b = atomic_load_explicit(&p_worker->bottom, memory_order_relaxed) - 1;
+    int64_t t;
+    md_emul_engine_stream_t *p_stream = NULL;
+
+    atomic_store_explicit(&p_worker->bottom, b, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    t = atomic_load_explicit(&p_worker->top, memory_order_relaxed);
+
+    if (t <= b)
+    {
+        p_stream = atomic_load_explicit(&p_worker->p_buf[b & p_worker->p_engine->deque_mask], memory_order_relaxed);
+        if (t == b)
+        {
+            /* last element, race against thieves */
+            if (!atomic_compare_exchange_strong_explicit(&p_worker->top, &t, t + 1,
+                                                         memory_order_seq_cst, memory_order_relaxed))
+            {
+                p_stream = NULL;
+            }
+            atomic_store_explicit(&p_worker->bottom, b + 1, memory_order_relaxed);
+        }
+    }
+    else
+    {
+        atomic_store_explicit(&p_worker->bottom, b + 1, memory_order_relaxed);
+    }
+    return p_stream;
+}
+
+/* Any thread: steal a stream from the top of another worker's deque */
+static md_emul_engine_stream_t *deque_steal(md_emul_engine_worker_t *p_victim)
+{
+    int64_t t = atomic_load_explicit(&p_victim->top, memory_order_acquire);
+    int64_t b;
+    md_emul_engine_stream_t *p_stream;
+
+    atomic_thread_fence(memory_order_seq_cst);
+    b = atomic_load_explicit(&p_victim->bottom, memory_order_acquire);
+    if (t >= b)
+    {
+        return NULL;
+    }
+
+    p_stream = atomic_load_explicit(&p_victim->p_buf[t & p_victim->p_engine->deque_mask], memory_order_relaxed);
+    if (!atomic_compare_exchange_strong_explicit(&p_victim->top, &t, t + 1,
+                                                 memory_order_seq_cst, memory_order_relaxed))
+    {
+        return NULL;
+    }
+    return p_stream;
+}
+
+static void inbox_push(md_emul_engine_worker_t *p_worker, md_emul_engine_stream_t *p_stream)
+{
+    md_emul_engine_stream_t *p_old = atomic_load_explicit(&p_worker->inbox, memory_order_relaxed);
+
+    do
+    {
+        atomic_store_explicit(&p_stream->p_next, p_old, memory_order_relaxed);
+    } while (!atomic_compare_exchange_weak_explicit(&p_worker->inbox, &p_old, p_stream,
+                                                    memory_order_seq_cst, memory_order_relaxed));
+}
+
+/* Move everything in the inbox to the own deque, oldest first */
+static void inbox_drain(md_emul_engine_worker_t *p_worker)
+{
+    md_emul_engine_stream_t *p_list = atomic_exchange_explicit(&p_worker->inbox, NULL, memory_order_acquire);
+    md_emul_engine_stream_t *p_rev = NULL;
+    md_emul_engine_stream_t *p_next;
+
+    while (p_list)
+    {
+        p_next = atomic_load_explicit(&p_list->p_next, memory_order_relaxed);
+        atomic_store_explicit(&p_list->p_next, p_rev, memory_order_relaxed);
+        p_rev = p_list;
+        p_list = p_next;
+    }
+    while (p_rev)
+    {
+        p_next = atomic_load_explicit(&p_rev->p_next, memory_order_relaxed);
+        deque_push(p_worker, p_rev);
+        p_rev = p_next;
+    }
+}
+
+static int engine_work_available(dlb_md_emul_engine_t *p_engine)
+{
+    uint32_t i;
+
+    for (i = 0; i < p_engine->config.num_workers; i++)
+    {
+        md_emul_engine_worker_t *p_worker = &p_engine->p_workers[i];
+
+        if (atomic_load(&p_worker->inbox) != NULL ||
+            atomic_load(&p_worker->bottom) > atomic_load(&p_worker->top))
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void engine_wake_one(dlb_md_emul_engine_t *p_engine)
+{
+    if (atomic_load(&p_engine->sleepers) > 0)
+    {
+        pthread_mutex_lock(&p_engine->wake_lock);
+        p_engine->wake_seq++;
+        pthread_cond_signal(&p_engine->wake_cond);
+        pthread_mutex_unlock(&p_engine->wake_lock);
+    }
+}
+
+static void engine_sleep(dlb_md_emul_engine_t *p_engine)
+{
+    uint64_t seen;
+
+    pthread_mutex_lock(&p_engine->wake_lock);
+    seen = p_engine->wake_seq;
+    atomic_fetch_add(&p_engine->sleepers, 1);
+    while (!atomic_load(&p_engine->shutdown) &&
+           seen == p_engine->wake_seq &&
+           !engine_work_available(p_engine))
+    {
+        pthread_cond_wait(&p_engine->wake_cond, &p_engine->wake_lock);
+    }
+    atomic_fetch_sub(&p_engine->sleepers, 1);
+    pthread_mutex_unlock(&p_engine->wake_lock);
+}
+
+static void stream_account(md_emul_engine_stream_t *p_stream, uint64_t latency_us, int32_t status)
+{
+    uint32_t bucket = 0;
+    uint64_t v = latency_us;
+
+    while (v)
+    {
+        bucket++;
+        v >>= 1;
+    }
+    if (bucket >= DLB_MD_EMUL_ENGINE_HIST_BUCKETS)
+    {
+        bucket = DLB_MD_EMUL_ENGINE_HIST_BUCKETS - 1;
+    }
+
+    /* single writer, relaxed read-modify-write is sufficient */
+#define STREAM_STAT_ADD(field, n) \
+    atomic_store_explicit(&(field), atomic_load_explicit(&(field), memory_order_relaxed) + (n), memory_order_relaxed)
+
+    STREAM_STAT_ADD(p_stream->processed, 1);
+    STREAM_STAT_ADD(p_stream->total_latency_us, latency_us);
+    STREAM_STAT_ADD(p_stream->latency_hist[bucket], 1);
+    if (status)
+    {
+        STREAM_STAT_ADD(p_stream->failed, 1);
+    }
+    if (p_stream->config.deadline_us && latency_us > p_stream->config.deadline_us)
+    {
+        STREAM_STAT_ADD(p_stream->deadline_misses, 1);
+    }
+    if (latency_us > atomic_load_explicit(&p_stream->max_latency_us, memory_order_relaxed))
+    {
+        atomic_store_explicit(&p_stream->max_latency_us, latency_us, memory_order_relaxed);
+    }
+#undef STREAM_STAT_ADD
+}
+
+/* Process every pending block of a stream in order, then release or requeue it */
+static void stream_run(md_emul_engine_worker_t *p_worker, md_emul_engine_stream_t *p_stream)
+{
+    uint32_t depth = p_worker->p_engine->config.queue_depth;
+    uint64_t tail = atomic_load_explicit(&p_stream->tail, memory_order_relaxed);
+    uint64_t head = atomic_load_explicit(&p_stream->head, memory_order_acquire);
+    int expected;
+
+    while (tail != head)
+    {
+        md_emul_engine_slot_t *p_slot = &p_stream->p_slots[tail % depth];
+        int32_t status;
+
+        status = dlb_md_emul_process(&p_stream->emul_hdl, &p_slot->config, p_stream->config.num_outputs);
+        stream_account(p_stream, engine_now_us() - p_slot->submit_us, status);
+
+        if (p_stream->config.done_cb)
+        {
+            p_stream->config.done_cb(p_stream->config.p_user, p_stream->id, tail, &p_slot->config, status);
+        }
+
+        tail++;
+        atomic_store_explicit(&p_stream->tail, tail, memory_order_release);
+    }
+
+    atomic_store(&p_stream->sched_state, STREAM_IDLE);
+    if (atomic_load(&p_stream->head) == tail)
+    {
+        return;
+    }
+
+    /* A block arrived after the last check; reclaim the stream unless the submitter already did */
+    expected = STREAM_IDLE;
+    if (atomic_compare_exchange_strong(&p_stream->sched_state, &expected, STREAM_QUEUED))
+    {
+        deque_push(p_worker, p_stream);
+    }
+}
+
+static md_emul_engine_stream_t *worker_find_stream(md_emul_engine_worker_t *p_worker)
+{
+    dlb_md_emul_engine_t *p_engine = p_worker->p_engine;
+    md_emul_engine_stream_t *p_stream;
+    uint32_t n = p_engine->config.num_workers;
+    uint32_t start, i;
+
+    p_stream = deque_take(p_worker);
+    if (p_stream)
+    {
+        return p_stream;
+    }
+
+    if (atomic_load_explicit(&p_worker->inbox, memory_order_relaxed))
+    {
+        inbox_drain(p_worker);
+        p_stream = deque_take(p_worker);
+        if (p_stream)
+        {
+            return p_stream;
+        }
+    }
+
+    /* xorshift32 to pick the first victim */
+    p_worker->steal_seed ^= p_worker->steal_seed << 13;
+    p_worker->steal_seed ^= p_worker->steal_seed >> 17;
+    p_worker->steal_seed ^= p_worker->steal_seed << 5;
+    start = p_worker->steal_seed % n;
+
+    for (i = 0; i < n; i++)
+    {
+        md_emul_engine_worker_t *p_victim = &p_engine->p_workers[(start + i) % n];
+
+        if (p_victim == p_worker)
+        {
+            continue;
+        }
+        p_stream = deque_steal(p_victim);
+        if (p_stream)
+        {
+            return p_stream;
+        }
+    }
+    return NULL;
+}
+
+static void *worker_main(void *p_arg)
+{
+    md_emul_engine_worker_t *p_worker = (md_emul_engine_worker_t *)p_arg;
+    dlb_md_emul_engine_t *p_engine = p_worker->p_engine;
+    int idle_spins = 0;
+
+#if defined(__linux__)
+    if (p_engine->config.pin_workers)
+    {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET((int)(p_engine->config.first_cpu + p_worker->index), &cpus);
+        pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+    }
+#endif
+
+    while (!atomic_load_explicit(&p_engine->shutdown, memory_order_relaxed))
+    {
+        md_emul_engine_stream_t *p_stream = worker_find_stream(p_worker);
+
+        if (p_stream)
+        {
+            idle_spins = 0;
+            stream_run(p_worker, p_stream);
+        }
+        else if (++idle_spins < ENGINE_IDLE_SPINS)
+        {
+            sched_yield();
+        }
+        else
+        {
+            idle_spins = 0;
+            engine_sleep(p_engine);
+        }
+    }
+    return NULL;
+}
+
+static md_emul_engine_stream_t *engine_get_stream(dlb_md_emul_engine_t *p_engine, uint32_t stream_id)
+{
+    if (!p_engine || stream_id >= p_engine->config.max_streams)
+    {
+        return NULL;
+    }
+    if (!atomic_load(&p_engine->p_streams[stream_id].in_use))
+    {
+        return NULL;
+    }
+    return &p_engine->p_streams[stream_id];
+}
+
+/* Lay out the engine memory; with p_mem == NULL only the size is computed */
+static size_t engine_layout
+    (const dlb_md_emul_engine_config_t *p_config
+    ,const dlb_md_emul_size_t          *p_emul_size
+    ,uint8_t                           *p_mem
+    )
+{
+    size_t offset = 0;
+    size_t cap = engine_deque_capacity(p_config->max_streams);
+    size_t static_sz, dynamic_sz;
+    dlb_md_emul_engine_t *p_engine = (dlb_md_emul_engine_t *)p_mem;
+    uint32_t i;
+
+    engine_emul_mem_sizes(p_emul_size, &static_sz, &dynamic_sz);
+
+    offset += ENGINE_ALIGN_UP(sizeof(dlb_md_emul_engine_t));
+    if (p_mem)
+    {
+        p_engine->p_workers = (md_emul_engine_worker_t *)(p_mem + offset);
+    }
+    offset += ENGINE_ALIGN_UP(sizeof(md_emul_engine_worker_t) * p_config->num_workers);
+
+    for (i = 0; i < p_config->num_workers; i++)
+    {
+        if (p_mem)
+        {
+            p_engine->p_workers[i].p_buf = (void *)(p_mem + offset);
+        }
+        offset += ENGINE_ALIGN_UP(sizeof(md_emul_engine_stream_t *) * cap);
+    }
+
+    if (p_mem)
+    {
+        p_engine->p_streams = (md_emul_engine_stream_t *)(p_mem + offset);
+    }
+    offset += ENGINE_ALIGN_UP(sizeof(md_emul_engine_stream_t) * p_config->max_streams);
+
+    for (i = 0; i < p_config->max_streams; i++)
+    {
+        if (p_mem)
+        {
+            p_engine->p_streams[i].p_slots = (md_emul_engine_slot_t *)(p_mem + offset);
+        }
+        offset += ENGINE_ALIGN_UP(sizeof(md_emul_engine_slot_t) * p_config->queue_depth);
+
+        if (p_mem)
+        {
+            p_engine->p_streams[i].p_static_mem = p_mem + offset;
+        }
+        offset += static_sz;
+
+        if (p_mem)
+        {
+            p_engine->p_streams[i].p_dynamic_mem = p_mem + offset;
+        }
+        offset += dynamic_sz;
+    }
+
+    return offset;
+}
+
+static int engine_config_valid(const dlb_md_emul_engine_config_t *p_config)
+{
+    return p_config
+        && p_config->num_workers >= 1
+        && p_config->num_workers <= DLB_MD_EMUL_ENGINE_MAX_WORKERS
+        && p_config->max_streams >= 1
+        && p_config->queue_depth >= 1;
+}
+
+
+/*
+ * Public Functions
+ */
+int32_t
+dlb_md_emul_engine_query_mem
+    (const dlb_md_emul_engine_config_t *p_config
+    ,size_t                            *p_mem_size
+    )
+{
+    dlb_md_emul_size_t emul_size;
+    int32_t err;
+
+    if (!engine_config_valid(p_config) || !p_mem_size)
+    {
+        return DLB_MD_EMUL_ENGINE_INVALID_PARAM;
+    }
+
+    err = dlb_md_emul_query_mem(&emul_size);
+    if (err)
+    {
+        return err;
+    }
+
+    /* leave room to align the caller's block */
+    *p_mem_size = engine_layout(p_config, &emul_size, NULL) + ENGINE_ALIGN;
+    return DLB_MD_EMUL_ENGINE_OK;
+}
+
+int32_t
+dlb_md_emul_engine_open
+    (const dlb_md_emul_engine_config_t *p_config
+    ,void                              *p_mem
+    ,dlb_md_emul_engine_t             **pp_engine
+    )
+{
+    dlb_md_emul_size_t emul_size;
+    dlb_md_emul_engine_t *p_engine;
+    size_t mem_size;
+    uint8_t *p_base;
+    uint32_t i;
+    int32_t err;
+
+    if (!engine_config_valid(p_config) || !pp_engine)
+    {
+        return DLB_MD_EMUL_ENGINE_INVALID_PARAM;
+    }
+    if (!p_mem)
+    {
+        return DLB_MD_EMUL_ENGINE_MEM_ALLOC_ERR;
+    }
+
+    err = dlb_md_emul_query_mem(&emul_size);
+    if (err)
+    {
+        return err;
+    }
+
+    p_base = (uint8_t *)ENGINE_ALIGN_UP((size_t)p_mem);
+    mem_size = engine_layout(p_config, &emul_size, NULL);
+    memset(p_base, 0, mem_size);
+    engine_layout(p_config, &emul_size, p_base);
+
+    p_engine = (dlb_md_emul_engine_t *)p_base;
+    p_engine->config = *p_config;
+    p_engine->emul_size = emul_size;
+    p_engine->deque_mask = (int64_t)engine_deque_capacity(p_config->max_streams) - 1;
+
+    for (i = 0; i < p_config->max_streams; i++)
+    {
+        p_engine->p_streams[i].id = i;
+        p_engine->p_streams[i].home_worker = i % p_config->num_workers;
+    }
+
+    pthread_mutex_init(&p_engine->wake_lock, NULL);
+    pthread_cond_init(&p_engine->wake_cond, NULL);
+
+    for (i = 0; i < p_config->num_workers; i++)
+    {
+        md_emul_engine_worker_t *p_worker = &p_engine->p_workers[i];
+
+        p_worker->p_engine = p_engine;
+        p_worker->index = i;
+        p_worker->steal_seed = 0x9E3779B9u ^ (i * 0x85EBCA6Bu) ^ 1u;
+    }
+
+    for (i = 0; i < p_config->num_workers; i++)
+    {
+        md_emul_engine_worker_t *p_worker = &p_engine->p_workers[i];
+
+        if (pthread_create(&p_worker->thread, NULL, worker_main, p_worker))
+        {
+            dlb_md_emul_engine_close(p_engine);
+            return DLB_MD_EMUL_ENGINE_THREAD_ERR;
+        }
+        p_worker->started = 1;
+    }
+
+    *pp_engine = p_engine;
+    return DLB_MD_EMUL_ENGINE_OK;
+}
+
+int32_t
+dlb_md_emul_engine_close
+    (dlb_md_emul_engine_t *p_engine
+    )
+{
+    uint32_t i;
+
+    if (!p_engine)
+    {
+        return DLB_MD_EMUL_ENGINE_INVALID_HANDLE;
+    }
+
+    pthread_mutex_lock(&p_engine->wake_lock);
+    atomic_store(&p_engine->shutdown, 1);
+    pthread_cond_broadcast(&p_engine->wake_cond);
+    pthread_mutex_unlock(&p_engine->wake_lock);
+
+    for (i = 0; i < p_engine->config.num_workers; i++)
+    {
+        if (p_engine->p_workers[i].started)
+        {
+            pthread_join(p_engine->p_workers[i].thread, NULL);
+            p_engine->p_workers[i].started = 0;
+        }
+    }
+
+    for (i = 0; i < p_engine->config.max_streams; i++)
+    {
+        if (atomic_load(&p_engine->p_streams[i].in_use))
+        {
+            dlb_md_emul_close(&p_engine->p_streams[i].emul_hdl);
+            atomic_store(&p_engine->p_streams[i].in_use, 0);
+        }
+    }
+
+    pthread_cond_destroy(&p_engine->wake_cond);
+    pthread_mutex_destroy(&p_engine->wake_lock);
+    return DLB_MD_EMUL_ENGINE_OK;
+}
+
+int32_t
+dlb_md_emul_engine_add_stream
+    (dlb_md_emul_engine_t              *p_engine
+    ,const dlb_md_emul_stream_config_t *p_stream_config
+    ,uint32_t                          *p_stream_id
+    )
+{
+    uint32_t i;
+    int32_t err;
+
+    if (!p_engine)
+    {
+        return DLB_MD_EMUL_ENGINE_INVALID_HANDLE;
+    }
+    if (!p_stream_config || !p_stream_id ||
+        p_stream_config->num_outputs < 1 || p_stream_config->num_outputs > DLB_MD_EMUL_MAX_OUTPUTS)
+    {
+        return DLB_MD_EMUL_ENGINE_INVALID_PARAM;
+    }
+
+    for (i = 0; i < p_engine->config.max_streams; i++)
+    {
+        md_emul_engine_stream_t *p_stream = &p_engine->p_streams[i];
+        int expected = 0;
+
+        if (!atomic_compare_exchange_strong(&p_stream->in_use, &expected, 1))
+        {
+            continue;
+        }
+
+        err = dlb_md_emul_open(&p_engine->emul_size, &p_stream->emul_hdl, p_stream->p_static_mem, p_stream->p_dynamic_mem);
+        if (err)
+        {
+            atomic_store(&p_stream->in_use, 0);
+            return err;
+        }
+
+        p_stream->config = *p_stream_config;
+        atomic_store(&p_stream->sched_state, STREAM_IDLE);
+        atomic_store(&p_stream->head, 0);
+        atomic_store(&p_stream->tail, 0);
+        atomic_store(&p_stream->processed, 0);
+        atomic_store(&p_stream->failed, 0);
+        atomic_store(&p_stream->deadline_misses, 0);
+        atomic_store(&p_stream->max_latency_us, 0);
+        atomic_store(&p_stream->total_latency_us, 0);
+        memset((void *)p_stream->latency_hist, 0, sizeof(p_stream->latency_hist));
+
+        *p_stream_id = i;
+        return DLB_MD_EMUL_ENGINE_OK;
+    }
+
+    return DLB_MD_EMUL_ENGINE_NO_FREE_STREAM;
+}
+
+int32_t
+dlb_md_emul_engine_remove_stream
+    (dlb_md_emul_engine_t *p_engine
+    ,uint32_t              stream_id
+    )
+{
+    md_emul_engine_stream_t *p_stream = engine_get_stream(p_engine, stream_id);
+    int32_t err;
+
+    if (!p_stream)
+    {
+        return p_engine ? DLB_MD_EMUL_ENGINE_INVALID_PARAM : DLB_MD_EMUL_ENGINE_INVALID_HANDLE;
+    }
+
+    err = dlb_md_emul_engine_drain(p_engine, stream_id);
+    if (err)
+    {
+        return err;
+    }
+
+    /* the last worker may still be between its final tail update and going idle */
+    while (atomic_load(&p_stream->sched_state) != STREAM_IDLE)
+    {
+        sched_yield();
+    }
+
+    dlb_md_emul_close(&p_stream->emul_hdl);
+    atomic_store(&p_stream->in_use, 0);
+    return DLB_MD_EMUL_ENGINE_OK;
+}
+
+int32_t
+dlb_md_emul_engine_submit
+    (dlb_md_emul_engine_t               *p_engine
+    ,uint32_t                            stream_id
+    ,const dlb_md_emul_process_config_t *p_config
+    )
+{
+    md_emul_engine_stream_t *p_stream = engine_get_stream(p_engine, stream_id);
+    md_emul_engine_slot_t *p_slot;
+    uint64_t head, tail;
+
+    if (!p_stream || !p_config)
+    {
+        return p_engine ? DLB_MD_EMUL_ENGINE_INVALID_PARAM : DLB_MD_EMUL_ENGINE_INVALID_HANDLE;
+    }
+
+    head = atomic_load_explicit(&p_stream->head, memory_order_relaxed);
+    tail = atomic_load_explicit(&p_stream->tail, memory_order_acquire);
+    if (head - tail >= p_engine->config.queue_depth)
+    {
+        return DLB_MD_EMUL_ENGINE_QUEUE_FULL;
+    }
+
+    p_slot = &p_stream->p_slots[head % p_engine->config.queue_depth];
+    p_slot->config = *p_config;
+    p_slot->submit_us = engine_now_us();
+    atomic_store(&p_stream->head, head + 1);
+
+    if (atomic_exchange(&p_stream->sched_state, STREAM_QUEUED) == STREAM_IDLE)
+    {
+        inbox_push(&p_engine->p_workers[p_stream->home_worker], p_stream);
+        engine_wake_one(p_engine);
+    }
+    return DLB_MD_EMUL_ENGINE_OK;
+}
+
+int32_t
+dlb_md_emul_engine_drain
+    (dlb_md_emul_engine_t *p_engine
+    ,uint32_t              stream_id
+    )
+{
+    md_emul_engine_stream_t *p_stream = engine_get_stream(p_engine, stream_id);
+    uint64_t head;
+
+    if (!p_stream)
+    {
+        return p_engine ? DLB_MD_EMUL_ENGINE_INVALID_PARAM : DLB_MD_EMUL_ENGINE_INVALID_HANDLE;
+    }
+
+    head = atomic_load_explicit(&p_stream->head, memory_order_relaxed);
+    while (atomic_load_explicit(&p_stream->tail, memory_order_acquire) != head)
+    {
+        if (atomic_load(&p_engine->shutdown))
+        {
+            return DLB_MD_EMUL_ENGINE_INVALID_HANDLE;
+        }
+        sched_yield();
+    }
+    return DLB_MD_EMUL_ENGINE_OK;
+}
+
+int32_t
+dlb_md_emul_engine_get_stream_stats
+    (dlb_md_emul_engine_t       *p_engine
+    ,uint32_t                    stream_id
+    ,dlb_md_emul_stream_stats_t *p_stats
+    )
+{
+    md_emul_engine_stream_t *p_stream = engine_get_stream(p_engine, stream_id);
+    int i;
+
+    if (!p_stream || !p_stats)
+    {
+        return p_engine ? DLB_MD_EMUL_ENGINE_INVALID_PARAM : DLB_MD_EMUL_ENGINE_INVALID_HANDLE;
+    }
+
+    p_stats->blocks_submitted = atomic_load_explicit(&p_stream->head, memory_order_relaxed);
+    p_stats->blocks_processed = atomic_load_explicit(&p_stream->processed, memory_order_relaxed);
+    p_stats->blocks_failed    = atomic_load_explicit(&p_stream->failed, memory_order_relaxed);
+    p_stats->deadline_misses  = atomic_load_explicit(&p_stream->deadline_misses, memory_order_relaxed);
+    p_stats->max_latency_us   = atomic_load_explicit(&p_stream->max_latency_us, memory_order_relaxed);
+    p_stats->total_latency_us = atomic_load_explicit(&p_stream->total_latency_us, memory_order_relaxed);
+    for (i = 0; i < DLB_MD_EMUL_ENGINE_HIST_BUCKETS; i++)
+    {
+        p_stats->latency_hist[i] = atomic_load_explicit(&p_stream->latency_hist[i], memory_order_relaxed);
+    }
+    return DLB_MD_EMUL_ENGINE_OK;
+}
@@ -0,0 +1,347 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ *
+ * @defgroup - Metadata emulation live metering tap
+ * @{
+ * Memory layout, all offsets from the start of the meter:
+ *   header  - magic, version, record size, capacity and the head cursor
+ *   slots   - capacity times { sequence, record }
+ * The head counts the records published. Record n sits in slot
+ * n % capacity, whose sequence is 2n + 1 while it is written and 2n + 2
+ * once it is complete. The writer bumps the sequence, copies the record,
+ * completes the sequence and then publishes the head, all with release
+ * semantics; a reader checks the sequence before and after its copy.
+ * @}
+ */
+
+#include<dlb_md_emul_meter.h>
+#include<dlb_intrinsics.h>
+#include"dd_emulation.h"
+
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <string.h>
+
+/* The cursors are shared between processes, which only works for lock-free atomics */
+#if ATOMIC_LLONG_LOCK_FREE != 2
+#error "dlb_md_emul_meter needs lock-free 64 bit atomics"
+#endif
+
+#define METER_ALIGN          64
+#define METER_ALIGN_UP(x)    (((x) + (METER_ALIGN - 1)) & ~(size_t)(METER_ALIGN - 1))
+
+struct dlb_md_emul_meter_s
+{
+    _Atomic uint32_t            magic;          /* written last by init */
+    uint32_t                    version;
+    uint32_t                    record_size;
+    uint32_t                    capacity;
+
+    alignas(METER_ALIGN) _Atomic uint64_t head;
+};
+
+typedef struct
+{
+    _Atomic uint64_t            seq;
+    dlb_md_emul_meter_record_t  record;
+} meter_slot;
+
+/*
+ * Private Functions
+ */
+static size_t meter_size(uint32_t capacity)
+{
+    return METER_ALIGN_UP(sizeof(dlb_md_emul_meter_t)) + (size_t)capacity * sizeof(meter_slot);
+}
+
+static meter_slot *meter_slots(const dlb_md_emul_meter_t *p_meter)
+{
+    return (meter_slot *)((uint8_t *)p_meter + METER_ALIGN_UP(sizeof(dlb_md_emul_meter_t)));
+}
+
+/* dd_emulation tap, runs on the emulator thread */
+static void meter_tap(void *p_context, const dd_emu_tap_block *p_block)
+{
+    dlb_md_emul_meter_record_t record;
+    int output, chan;
+
+    record.block_index     = p_block->block_index;
+    record.flags           = 0;
+    record.num_outputs     = (uint32_t)p_block->num_outputs;
+    record.channel_mask    = p_block->channel_mask;
+    record.reserved        = 0;
+    for (output = 0; output < DLB_MD_EMUL_MAX_OUTPUTS; output++)
+    {
+        for (chan = 0; chan < DLB_MD_EMUL_MAX_CHANS; chan++)
+        {
+            record.peak[output][chan] = p_block->peak[output][chan];
+        }
+        record.applied_gain[output] = p_block->applied_gain[output];
+    }
+    if (p_block->flags & DD_EMU_TAP_DRC_CALC)
+    {
+        record.flags |= DLB_MD_EMUL_METER_DRC_CALC;
+    }
+    if (p_block->flags & DD_EMU_TAP_DECODER)
+    {
+        record.flags |= DLB_MD_EMUL_METER_DECODER;
+    }
+    record.log_loudness_db = p_block->log_loudness_db;
+    record.maxmix_db       = p_block->maxmix_db;
+    record.drc_gain_db     = p_block->drc_gain_db;
+    record.compr_gain_db   = p_block->compr_gain_db;
+
+    dlb_md_emul_meter_publish((dlb_md_emul_meter_t *)p_context, &record);
+}
+
+/*
+ * Public Functions
+ */
+int32_t
+dlb_md_emul_meter_query_mem
+    (uint32_t    capacity
+    ,size_t     *p_mem_size
+    )
+{
+    if (capacity < 2 || !p_mem_size)
+    {
+        return DLB_MD_EMUL_METER_INVALID_PARAM;
+    }
+    *p_mem_size = meter_size(capacity);
+    return DLB_MD_EMUL_METER_OK;
+}
+
+int32_t
+dlb_md_emul_meter_init
+    (void                   *p_mem
+    ,size_t                  mem_size
+    ,uint32_t                capacity
+    ,dlb_md_emul_meter_t   **pp_meter
+    )
+{
+    dlb_md_emul_meter_t *p_meter = (dlb_md_emul_meter_t *)p_mem;
+    meter_slot *p_slots;
+    uint32_t i;
+
+    if (!p_mem || !pp_meter || capacity < 2 || ((uintptr_t)p_mem % METER_ALIGN) != 0)
+    {
+        return DLB_MD_EMUL_METER_INVALID_PARAM;
+    }
+    if (mem_size < meter_size(capacity))
+    {
+        return DLB_MD_EMUL_METER_MEM_ALLOC_ERR;
+    }
+
+    /* A reader attaching meanwhile sees no magic and backs off */
+    atomic_store_explicit(&p_meter->magic, 0, memory_order_relaxed);
+    p_meter->version     = DLB_MD_EMUL_METER_VERSION;
+    p_meter->record_size = (uint32_t)sizeof(dlb_md_emul_meter_record_t);
+    p_meter->capacity    = capacity;
+    atomic_store_explicit(&p_meter->head, 0, memory_order_relaxed);
+
+    p_slots = meter_slots(p_meter);
+    for (i = 0; i < capacity; i++)
+    {
+        atomic_store_explicit(&p_slots[i].seq, 0, memory_order_relaxed);
+        memset(&p_slots[i].record, 0, sizeof(p_slots[i].record));
+    }
+    atomic_store_explicit(&p_meter->magic, DLB_MD_EMUL_METER_MAGIC, memory_order_release);
+
+    *pp_meter = p_meter;
+    return DLB_MD_EMUL_METER_OK;
+}
+
+int32_t
+dlb_md_emul_meter_attach
+    (void                   *p_mem
+    ,size_t                  mem_size
+    ,dlb_md_emul_meter_t   **pp_meter
+    )
+{
+    dlb_md_emul_meter_t *p_meter = (dlb_md_emul_meter_t *)p_mem;
+
+    if (!p_mem || !pp_meter)
+    {
+        return DLB_MD_EMUL_METER_INVALID_PARAM;
+    }
+    if (mem_size < METER_ALIGN_UP(sizeof(dlb_md_emul_meter_t))
+     || atomic_load_explicit(&p_meter->magic, memory_order_acquire) != DLB_MD_EMUL_METER_MAGIC
+     || p_meter->version != DLB_MD_EMUL_METER_VERSION
+     || p_meter->record_size != sizeof(dlb_md_emul_meter_record_t)
+     || p_meter->capacity < 2)
+    {
+        return DLB_MD_EMUL_METER_BAD_LAYOUT;
+    }
+    if (mem_size < meter_size(p_meter->capacity))
+    {
+        return DLB_MD_EMUL_METER_MEM_ALLOC_ERR;
+    }
+
+    *pp_meter = p_meter;
+    return DLB_MD_EMUL_METER_OK;
+}
+
+int32_t
+dlb_md_emul_meter_publish
+    (dlb_md_emul_meter_t                 *p_meter
+    ,const dlb_md_emul_meter_record_t    *p_record
+    )
+{
+    meter_slot *p_slot;
+    uint64_t n;
+
+    if (!p_meter)
+    {
+        return DLB_MD_EMUL_METER_INVALID_HANDLE;
+    }
+    if (!p_record)
+    {
+        return DLB_MD_EMUL_METER_INVALID_PARAM;
+    }
+
+    n = atomic_load_explicit(&p_meter->head, memory_order_relaxed);
+    p_slot = meter_slots(p_meter) + n % p_meter->capacity;
+
+    atomic_store_explicit(&p_slot->seq, 2 * n + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    memcpy(&p_slot->record, p_record, sizeof(p_slot->record));
+    atomic_store_explicit(&p_slot->seq, 2 * n + 2, memory_order_release);
+
+    atomic_store_explicit(&p_meter->head, n + 1, memory_order_release);
+    return DLB_MD_EMUL_METER_OK;
+}
+
+int32_t
+dlb_md_emul_meter_get_head
+    (const dlb_md_emul_meter_t *p_meter
+    ,uint64_t                  *p_head
+    )
+{
+    if (!p_meter)
+    {
+        return DLB_MD_EMUL_METER_INVALID_HANDLE;
+    }
+    if (!p_head)
+    {
+        return DLB_MD_EMUL_METER_INVALID_PARAM;
+    }
+    *p_head = atomic_load_explicit(&((dlb_md_emul_meter_t *)p_meter)->head, memory_order_acquire);
+    return DLB_MD_EMUL_METER_OK;
+}
+
+int32_t
+dlb_md_emul_meter_read
+    (const dlb_md_emul_meter_t      *p_meter
+    ,uint64_t                       *p_cursor
+    ,dlb_md_emul_meter_record_t     *p_records
+    ,uint32_t                        max_records
+    ,uint32_t                       *p_num_read
+    ,uint64_t                       *p_num_lost
+    )
+{
+    dlb_md_emul_meter_t *p_shared = (dlb_md_emul_meter_t *)p_meter;
+    meter_slot *p_slots;
+    uint64_t head, cursor, lost = 0;
+    uint32_t num_read = 0;
+
+    if (!p_meter)
+    {
+        return DLB_MD_EMUL_METER_INVALID_HANDLE;
+    }
+    if (!p_cursor || (!p_records && max_records) || !p_num_read)
+    {
+        return DLB_MD_EMUL_METER_INVALID_PARAM;
+    }
+
+    p_slots = meter_slots(p_meter);
+    head = atomic_load_explicit(&p_shared->head, memory_order_acquire);
+    cursor = *p_cursor;
+
+    /* The writer started over since the last read */
+    if (cursor > head)
+    {
+        cursor = head;
+    }
+    if (head - cursor > p_meter->capacity)
+    {
+        lost += head - cursor - p_meter->capacity;
+        cursor = head - p_meter->capacity;
+    }
+
+    while (num_read < max_records && cursor < head)
+    {
+        meter_slot *p_slot = p_slots + cursor % p_meter->capacity;
+        uint64_t seq = atomic_load_explicit(&p_slot->seq, memory_order_acquire);
+
+        if (seq == 2 * cursor + 2)
+        {
+            memcpy(&p_records[num_read], &p_slot->record, sizeof(p_records[num_read]));
+            atomic_thread_fence(memory_order_acquire);
+            if (atomic_load_explicit(&p_slot->seq, memory_order_relaxed) == seq)
+            {
+                num_read++;
+                cursor++;
+                continue;
+            }
+        }
+        /* Overwritten by a later record before or during the copy */
+        lost++;
+        cursor++;
+    }
+
+    *p_cursor = cursor;
+    *p_num_read = num_read;
+    if (p_num_lost)
+    {
+        *p_num_lost += lost;
+    }
+    return DLB_MD_EMUL_METER_OK;
+}
+
+int32_t
+dlb_md_emul_set_meter
+    (dlb_md_emul_hdl_t     *p_dlb_md_emul_hdl
+    ,dlb_md_emul_meter_t   *p_meter
+    )
+{
+    if (!p_dlb_md_emul_hdl)
+    {
+        return DLB_MD_EMUL_METER_INVALID_HANDLE;
+    }
+    return dd_emulation_set_tap(p_dlb_md_emul_hdl->p_emul_hdl, DD_EMU_TAP_METER, p_meter ? meter_tap : NULL, p_meter);
+}
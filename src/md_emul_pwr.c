@@ -0,0 +1,206 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ *
+ * @defgroup - Metadata emulation power versus time analyser
+ * @{
+ * Sums of squares are accumulated in double precision whatever the
+ * DLB_LFRACT backend, so the curves do not depend on the build.
+ * @}
+ */
+
+#include<dlb_md_emul_pwr.h>
+
+#include <math.h>
+#include <string.h>
+
+struct dlb_md_emul_pwr_s
+{
+    dlb_md_emul_pwr_config_t    config;
+    uint64_t                    windows_done;
+    uint32_t                    frames_in_window;
+    double                      sum_sq[DLB_MD_EMUL_MAX_CHANS];
+};
+
+/*
+ * Private Functions
+ */
+static int pwr_config_valid(const dlb_md_emul_pwr_config_t *p_config)
+{
+    return p_config
+        && p_config->num_channels >= 1 && p_config->num_channels <= DLB_MD_EMUL_MAX_CHANS
+        && p_config->sample_rate > 0
+        && p_config->window_frames > 0;
+}
+
+static double pwr_to_db(double sum_sq, uint32_t frames)
+{
+    double mean = sum_sq / frames;
+    double db;
+
+    if (mean <= 0.0)
+    {
+        return DLB_MD_EMUL_PWR_FLOOR_DB;
+    }
+    db = 10.0 * log10(mean);
+    return (db < DLB_MD_EMUL_PWR_FLOOR_DB) ? DLB_MD_EMUL_PWR_FLOOR_DB : db;
+}
+
+/*
+ * Public Functions
+ */
+int32_t
+dlb_md_emul_pwr_query_mem
+    (const dlb_md_emul_pwr_config_t *p_config
+    ,size_t                         *p_mem_size
+    )
+{
+    if (!pwr_config_valid(p_config) || !p_mem_size)
+    {
+        return DLB_MD_EMUL_PWR_INVALID_PARAM;
+    }
+    *p_mem_size = sizeof(dlb_md_emul_pwr_t);
+    return DLB_MD_EMUL_PWR_OK;
+}
+
+int32_t
+dlb_md_emul_pwr_open
+    (const dlb_md_emul_pwr_config_t *p_config
+    ,void                           *p_mem
+    ,dlb_md_emul_pwr_t             **pp_pwr
+    )
+{
+    dlb_md_emul_pwr_t *p_pwr = (dlb_md_emul_pwr_t *)p_mem;
+
+    if (!pwr_config_valid(p_config) || !pp_pwr)
+    {
+        return DLB_MD_EMUL_PWR_INVALID_PARAM;
+    }
+    if (!p_mem)
+    {
+        return DLB_MD_EMUL_PWR_MEM_ALLOC_ERR;
+    }
+
+    memset(p_pwr, 0, sizeof(*p_pwr));
+    p_pwr->config = *p_config;
+    *pp_pwr = p_pwr;
+    return DLB_MD_EMUL_PWR_OK;
+}
+
+int32_t
+dlb_md_emul_pwr_close
+    (dlb_md_emul_pwr_t *p_pwr
+    )
+{
+    if (!p_pwr)
+    {
+        return DLB_MD_EMUL_PWR_INVALID_HANDLE;
+    }
+    return DLB_MD_EMUL_PWR_OK;
+}
+
+int32_t
+dlb_md_emul_pwr_process
+    (dlb_md_emul_pwr_t         *p_pwr
+    ,const DLB_LFRACT          *p_samples
+    ,uint32_t                   stride
+    ,uint32_t                   num_frames
+    ,dlb_md_emul_pwr_point_t   *p_points
+    ,uint32_t                   max_points
+    ,uint32_t                  *p_num_points
+    )
+{
+    uint32_t num_channels;
+    uint32_t window;
+    uint32_t n = 0;
+    uint32_t c;
+
+    if (!p_pwr)
+    {
+        return DLB_MD_EMUL_PWR_INVALID_HANDLE;
+    }
+    if (!p_num_points || (num_frames && !p_samples) || stride < p_pwr->config.num_channels)
+    {
+        return DLB_MD_EMUL_PWR_INVALID_PARAM;
+    }
+    *p_num_points = 0;
+    num_channels = p_pwr->config.num_channels;
+    window = p_pwr->config.window_frames;
+
+    while (n < num_frames)
+    {
+        /* accumulate up to the end of the current window */
+        uint32_t run = window - p_pwr->frames_in_window;
+        uint32_t end;
+
+        if (run > num_frames - n)
+        {
+            run = num_frames - n;
+        }
+        for (end = n + run; n < end; n++)
+        {
+            const DLB_LFRACT *p_frame = p_samples + (size_t)n * stride;
+
+            for (c = 0; c < num_channels; c++)
+            {
+                double x = DLB_F_L(p_frame[c]);
+
+                p_pwr->sum_sq[c] += x * x;
+            }
+        }
+        p_pwr->frames_in_window += run;
+
+        if (p_pwr->frames_in_window == window)
+        {
+            dlb_md_emul_pwr_point_t *p_point;
+
+            if (*p_num_points >= max_points || !p_points)
+            {
+                return DLB_MD_EMUL_PWR_POINTS_FULL;
+            }
+            p_point = &p_points[(*p_num_points)++];
+            p_point->time = ((double)p_pwr->windows_done + 0.5) * window / p_pwr->config.sample_rate;
+            for (c = 0; c < DLB_MD_EMUL_MAX_CHANS; c++)
+            {
+                p_point->power_db[c] = (c < num_channels) ? pwr_to_db(p_pwr->sum_sq[c], window) : DLB_MD_EMUL_PWR_FLOOR_DB;
+                p_pwr->sum_sq[c] = 0.0;
+            }
+            p_pwr->windows_done++;
+            p_pwr->frames_in_window = 0;
+        }
+    }
+    return DLB_MD_EMUL_PWR_OK;
+}
@@ -0,0 +1,442 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ *
+ * @defgroup - Metadata emulation ring buffer streaming interface
+ * @{
+ * Cursor ownership:
+ *   write   - producer thread
+ *   process - emulator thread
+ *   read    - consumer thread
+ * Each cursor and the counters of its stage sit on their own cache line.
+ * A stage publishes its cursor with release semantics after touching the
+ * block and reads the upstream cursor with acquire semantics before.
+ * @}
+ */
+
+#include<dlb_md_emul_ring.h>
+
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <string.h>
+
+#define RING_ALIGN          64
+#define RING_ALIGN_UP(x)    (((x) + (RING_ALIGN - 1)) & ~(size_t)(RING_ALIGN - 1))
+
+/* DLB_LFRACT per output per block, frames of DLB_MD_EMUL_MAX_CHANS slots */
+#define RING_BLOCK_LEN      ((size_t)DLB_MD_EMUL_BLOCK_SIZE * DLB_MD_EMUL_MAX_CHANS)
+
+struct dlb_md_emul_ring_s
+{
+    dlb_md_emul_ring_config_t   config;
+    DLB_LFRACT                 *p_audio;        /* [num_blocks][num_outputs][RING_BLOCK_LEN] */
+    int32_t                    *p_status;       /* [num_blocks] */
+    dlb_md_emul_hdl_t           emul_hdl;
+
+    alignas(RING_ALIGN) _Atomic uint64_t write;
+    _Atomic uint64_t            overruns;
+
+    alignas(RING_ALIGN) _Atomic uint64_t process;
+    _Atomic uint64_t            process_underruns;
+
+    alignas(RING_ALIGN) _Atomic uint64_t read;
+    _Atomic uint64_t            consumer_underruns;
+};
+
+/*
+ * Private Functions
+ */
+static int ring_config_valid(const dlb_md_emul_ring_config_t *p_config)
+{
+    return p_config
+        && p_config->num_blocks >= 2
+        && p_config->num_channels >= 1
+        && p_config->num_channels <= DLB_MD_EMUL_MAX_CHANS
+        && p_config->num_outputs >= 1
+        && p_config->num_outputs <= DLB_MD_EMUL_MAX_OUTPUTS;
+}
+
+static DLB_LFRACT *ring_block(dlb_md_emul_ring_t *p_ring, uint64_t index, int output)
+{
+    size_t slot = (size_t)(index % p_ring->config.num_blocks);
+
+    return p_ring->p_audio + (slot * p_ring->config.num_outputs + output) * RING_BLOCK_LEN;
+}
+
+/* single writer counter increment */
+static void ring_count(_Atomic uint64_t *p_counter)
+{
+    atomic_store_explicit(p_counter, atomic_load_explicit(p_counter, memory_order_relaxed) + 1, memory_order_relaxed);
+}
+
+/* Lay out the ring memory; with p_mem == NULL only the size is computed */
+static size_t ring_layout
+    (const dlb_md_emul_ring_config_t *p_config
+    ,const dlb_md_emul_size_t        *p_emul_size
+    ,uint8_t                         *p_mem
+    ,void                           **pp_static
+    ,void                           **pp_dynamic
+    )
+{
+    dlb_md_emul_ring_t *p_ring = (dlb_md_emul_ring_t *)p_mem;
+    size_t offset = RING_ALIGN_UP(sizeof(dlb_md_emul_ring_t));
+
+    if (p_mem)
+    {
+        p_ring->p_audio = (DLB_LFRACT *)(p_mem + offset);
+    }
+    offset += RING_ALIGN_UP(sizeof(DLB_LFRACT) * RING_BLOCK_LEN * p_config->num_outputs * p_config->num_blocks);
+
+    if (p_mem)
+    {
+        p_ring->p_status = (int32_t *)(p_mem + offset);
+    }
+    offset += RING_ALIGN_UP(sizeof(int32_t) * p_config->num_blocks);
+
+    if (p_mem)
+    {
+        *pp_static = p_mem + offset;
+    }
+    offset += RING_ALIGN_UP((size_t)p_emul_size->emul_static_mem_size
+                          + p_emul_size->compr_static_mem_size
+                          + p_emul_size->compr_ext_static_mem_size);
+
+    if (p_mem)
+    {
+        *pp_dynamic = p_mem + offset;
+    }
+    offset += RING_ALIGN_UP((size_t)p_emul_size->emul_dynamic_mem_size
+                          + p_emul_size->compr_dynamic_mem_size);
+
+    return offset;
+}
+
+
+/*
+ * Public Functions
+ */
+int32_t
+dlb_md_emul_ring_query_mem
+    (const dlb_md_emul_ring_config_t *p_config
+    ,size_t                          *p_mem_size
+    )
+{
+    dlb_md_emul_size_t emul_size;
+    int32_t err;
+
+    if (!ring_config_valid(p_config) || !p_mem_size)
+    {
+        return DLB_MD_EMUL_RING_INVALID_PARAM;
+    }
+
+    err = dlb_md_emul_query_mem(&emul_size);
+    if (err)
+    {
+        return err;
+    }
+
+    *p_mem_size = ring_layout(p_config, &emul_size, NULL, NULL, NULL) + RING_ALIGN;
+    return DLB_MD_EMUL_RING_OK;
+}
+
+int32_t
+dlb_md_emul_ring_open
+    (const dlb_md_emul_ring_config_t *p_config
+    ,void                            *p_mem
+    ,dlb_md_emul_ring_t             **pp_ring
+    )
+{
+    dlb_md_emul_size_t emul_size;
+    dlb_md_emul_ring_t *p_ring;
+    void *p_static = NULL;
+    void *p_dynamic = NULL;
+    uint8_t *p_base;
+    int32_t err;
+
+    if (!ring_config_valid(p_config) || !pp_ring)
+    {
+        return DLB_MD_EMUL_RING_INVALID_PARAM;
+    }
+    if (!p_mem)
+    {
+        return DLB_MD_EMUL_RING_MEM_ALLOC_ERR;
+    }
+
+    err = dlb_md_emul_query_mem(&emul_size);
+    if (err)
+    {
+        return err;
+    }
+
+    p_base = (uint8_t *)RING_ALIGN_UP((size_t)p_mem);
+    memset(p_base, 0, ring_layout(p_config, &emul_size, NULL, NULL, NULL));
+    ring_layout(p_config, &emul_size, p_base, &p_static, &p_dynamic);
+
+    p_ring = (dlb_md_emul_ring_t *)p_base;
+    p_ring->config = *p_config;
+
+    err = dlb_md_emul_open(&emul_size, &p_ring->emul_hdl, p_static, p_dynamic);
+    if (err)
+    {
+        return err;
+    }
+
+    *pp_ring = p_ring;
+    return DLB_MD_EMUL_RING_OK;
+}
+
+int32_t
+dlb_md_emul_ring_close
+    (dlb_md_emul_ring_t *p_ring
+    )
+{
+    if (!p_ring)
+    {
+        return DLB_MD_EMUL_RING_INVALID_HANDLE;
+    }
+    return dlb_md_emul_close(&p_ring->emul_hdl);
+}
+
+DLB_LFRACT *
+dlb_md_emul_ring_producer_acquire
+    (dlb_md_emul_ring_t *p_ring
+    )
+{
+    uint64_t write, read;
+
+    if (!p_ring)
+    {
+        return NULL;
+    }
+
+    write = atomic_load_explicit(&p_ring->write, memory_order_relaxed);
+    read  = atomic_load_explicit(&p_ring->read, memory_order_acquire);
+    if (write - read >= p_ring->config.num_blocks)
+    {
+        ring_count(&p_ring->overruns);
+        return NULL;
+    }
+    return ring_block(p_ring, write, 0);
+}
+
+int32_t
+dlb_md_emul_ring_producer_commit
+    (dlb_md_emul_ring_t *p_ring
+    )
+{
+    uint64_t write;
+
+    if (!p_ring)
+    {
+        return DLB_MD_EMUL_RING_INVALID_HANDLE;
+    }
+
+    write = atomic_load_explicit(&p_ring->write, memory_order_relaxed);
+    if (write - atomic_load_explicit(&p_ring->read, memory_order_acquire) >= p_ring->config.num_blocks)
+    {
+        return DLB_MD_EMUL_RING_FULL;
+    }
+    atomic_store_explicit(&p_ring->write, write + 1, memory_order_release);
+    return DLB_MD_EMUL_RING_OK;
+}
+
+int32_t
+dlb_md_emul_ring_write
+    (dlb_md_emul_ring_t *p_ring
+    ,const DLB_LFRACT   *p_frames
+    )
+{
+    DLB_LFRACT *p_block;
+    uint32_t channels;
+    int i;
+
+    if (!p_ring)
+    {
+        return DLB_MD_EMUL_RING_INVALID_HANDLE;
+    }
+    if (!p_frames)
+    {
+        return DLB_MD_EMUL_RING_INVALID_PARAM;
+    }
+
+    p_block = dlb_md_emul_ring_producer_acquire(p_ring);
+    if (!p_block)
+    {
+        return DLB_MD_EMUL_RING_FULL;
+    }
+    channels = p_ring->config.num_channels;
+    for (i = 0; i < DLB_MD_EMUL_BLOCK_SIZE; i++)
+    {
+        memcpy(p_block + i * DLB_MD_EMUL_MAX_CHANS, p_frames + i * channels, sizeof(DLB_LFRACT) * channels);
+    }
+    return dlb_md_emul_ring_producer_commit(p_ring);
+}
+
+int32_t
+dlb_md_emul_ring_process
+    (dlb_md_emul_ring_t                 *p_ring
+    ,const dlb_md_emul_process_config_t *p_config
+    )
+{
+    dlb_md_emul_process_config_t conf;
+    uint64_t process;
+    int i;
+    int32_t status;
+
+    if (!p_ring)
+    {
+        return DLB_MD_EMUL_RING_INVALID_HANDLE;
+    }
+    if (!p_config)
+    {
+        return DLB_MD_EMUL_RING_INVALID_PARAM;
+    }
+
+    process = atomic_load_explicit(&p_ring->process, memory_order_relaxed);
+    if (process == atomic_load_explicit(&p_ring->write, memory_order_acquire))
+    {
+        ring_count(&p_ring->process_underruns);
+        return DLB_MD_EMUL_RING_EMPTY;
+    }
+
+    conf = *p_config;
+    for (i = 0; i < p_ring->config.num_outputs; i++)
+    {
+        conf.pa_in_data[i] = ring_block(p_ring, process, i);
+    }
+    conf.sample_offset = DLB_MD_EMUL_MAX_CHANS;
+    conf.num_samples   = DLB_MD_EMUL_BLOCK_SIZE;
+
+    status = dlb_md_emul_process(&p_ring->emul_hdl, &conf, p_ring->config.num_outputs);
+    p_ring->p_status[process % p_ring->config.num_blocks] = status;
+
+    atomic_store_explicit(&p_ring->process, process + 1, memory_order_release);
+    return status;
+}
+
+int32_t
+dlb_md_emul_ring_consumer_acquire
+    (dlb_md_emul_ring_t      *p_ring
+    ,dlb_md_emul_ring_span_t *p_span
+    )
+{
+    uint64_t read;
+    int i;
+
+    if (!p_ring)
+    {
+        return DLB_MD_EMUL_RING_INVALID_HANDLE;
+    }
+    if (!p_span)
+    {
+        return DLB_MD_EMUL_RING_INVALID_PARAM;
+    }
+
+    read = atomic_load_explicit(&p_ring->read, memory_order_relaxed);
+    if (read == atomic_load_explicit(&p_ring->process, memory_order_acquire))
+    {
+        ring_count(&p_ring->consumer_underruns);
+        return DLB_MD_EMUL_RING_EMPTY;
+    }
+
+    memset(p_span, 0, sizeof(*p_span));
+    for (i = 0; i < p_ring->config.num_outputs; i++)
+    {
+        p_span->pa_data[i] = ring_block(p_ring, read, i);
+    }
+    p_span->num_frames   = DLB_MD_EMUL_BLOCK_SIZE;
+    p_span->num_channels = p_ring->config.num_channels;
+    p_span->frame_stride = DLB_MD_EMUL_MAX_CHANS;
+    p_span->block_index  = read;
+    p_span->status       = p_ring->p_status[read % p_ring->config.num_blocks];
+    return DLB_MD_EMUL_RING_OK;
+}
+
+int32_t
+dlb_md_emul_ring_consumer_release
+    (dlb_md_emul_ring_t *p_ring
+    )
+{
+    uint64_t read;
+
+    if (!p_ring)
+    {
+        return DLB_MD_EMUL_RING_INVALID_HANDLE;
+    }
+
+    read = atomic_load_explicit(&p_ring->read, memory_order_relaxed);
+    if (read == atomic_load_explicit(&p_ring->process, memory_order_acquire))
+    {
+        return DLB_MD_EMUL_RING_EMPTY;
+    }
+    atomic_store_explicit(&p_ring->read, read + 1, memory_order_release);
+    return DLB_MD_EMUL_RING_OK;
+}
+
+int32_t
+dlb_md_emul_ring_get_stats
+    (dlb_md_emul_ring_t       *p_ring
+    ,dlb_md_emul_ring_stats_t *p_stats
+    )
+{
+    uint64_t write, process, read;
+
+    if (!p_ring)
+    {
+        return DLB_MD_EMUL_RING_INVALID_HANDLE;
+    }
+    if (!p_stats)
+    {
+        return DLB_MD_EMUL_RING_INVALID_PARAM;
+    }
+
+    /* read downstream first so the differences can not go negative */
+    read    = atomic_load_explicit(&p_ring->read, memory_order_acquire);
+    process = atomic_load_explicit(&p_ring->process, memory_order_acquire);
+    write   = atomic_load_explicit(&p_ring->write, memory_order_acquire);
+
+    p_stats->capacity           = p_ring->config.num_blocks;
+    p_stats->fill               = (uint32_t)(write - read);
+    p_stats->pending            = (uint32_t)(write - process);
+    p_stats->ready              = (uint32_t)(process - read);
+    p_stats->blocks_produced    = write;
+    p_stats->blocks_processed   = process;
+    p_stats->blocks_consumed    = read;
+    p_stats->overruns           = atomic_load_explicit(&p_ring->overruns, memory_order_relaxed);
+    p_stats->process_underruns  = atomic_load_explicit(&p_ring->process_underruns, memory_order_relaxed);
+    p_stats->consumer_underruns = atomic_load_explicit(&p_ring->consumer_underruns, memory_order_relaxed);
+    return DLB_MD_EMUL_RING_OK;
+}
@@ -0,0 +1,127 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ *
+ * @defgroup - Metadata emulation per-block DRC trace
+ * @{
+ * The trace slot of the dd_emulation tap, converted to the public record
+ * @}
+ */
+
+#include<dlb_md_emul_trace.h>
+#include<dlb_intrinsics.h>
+#include"dd_emulation.h"
+
+#include <string.h>
+
+typedef struct
+{
+    dlb_md_emul_trace_fn    fn;
+    void                   *p_context;
+} trace_target;
+
+/*
+ * Private Functions
+ */
+
+/* dd_emulation tap, runs on the emulator thread */
+static void trace_tap(void *p_context, const dd_emu_tap_block *p_block)
+{
+    const trace_target *p_target = (const trace_target *)p_context;
+    dlb_md_emul_trace_record_t record;
+    int output;
+
+    memset(&record, 0, sizeof(record));
+    record.block_index         = p_block->block_index;
+    record.num_outputs         = (uint32_t)p_block->num_outputs;
+    if (p_block->flags & DD_EMU_TAP_DRC_CALC)
+    {
+        record.flags |= DLB_MD_EMUL_TRACE_DRC_CALC;
+    }
+    if (p_block->flags & DD_EMU_TAP_DECODER)
+    {
+        record.flags |= DLB_MD_EMUL_TRACE_DECODER;
+    }
+    record.log_loudness_db     = p_block->log_loudness_db;
+    record.maxmix_db           = p_block->maxmix_db;
+    record.dyn_state_db        = p_block->dyn_state_db;
+    record.dyn_gain_db         = p_block->dyn_gain_db;
+    record.dlim_gain_db        = p_block->dlim_gain_db;
+    record.compr_state_db      = p_block->compr_state_db;
+    record.compr_gain_db       = p_block->compr_block_gain_db;
+    record.compr_frame_gain_db = p_block->compr_gain_db;
+    record.clim_gain_db        = p_block->clim_gain_db;
+    record.dyn_hold            = p_block->dyn_hold;
+    record.dlim_hold           = p_block->dlim_hold;
+    record.compr_hold          = p_block->compr_hold;
+    record.clim_hold           = p_block->clim_hold;
+    record.dynrng_code         = p_block->dynrng_code;
+    record.compr_code          = p_block->compr_code;
+    for (output = 0; output < DLB_MD_EMUL_MAX_OUTPUTS; output++)
+    {
+        record.applied_gain[output] = p_block->applied_gain[output];
+    }
+
+    p_target->fn(p_target->p_context, &record);
+}
+
+/*
+ * Public Functions
+ */
+int32_t
+dlb_md_emul_set_trace
+    (dlb_md_emul_hdl_t     *p_dlb_md_emul_hdl
+    ,dlb_md_emul_trace_fn   fn
+    ,void                  *p_context
+    )
+{
+    trace_target *p_target;
+
+    if (!p_dlb_md_emul_hdl)
+    {
+        return DD_EMU_STATUS_INVALID_HANDLE;
+    }
+    p_target = (trace_target *)dd_emulation_get_tap_storage(p_dlb_md_emul_hdl->p_emul_hdl, DD_EMU_TAP_TRACE, sizeof(trace_target));
+    if (!p_target)
+    {
+        /* No handle, or no storage for the trace tap */
+        return dd_emulation_set_tap(p_dlb_md_emul_hdl->p_emul_hdl, DD_EMU_TAP_TRACE, fn ? trace_tap : NULL, NULL);
+    }
+    p_target->fn        = fn;
+    p_target->p_context = p_context;
+
+    return dd_emulation_set_tap(p_dlb_md_emul_hdl->p_emul_hdl, DD_EMU_TAP_TRACE, fn ? trace_tap : NULL, p_target);
+}
@@ -0,0 +1,200 @@
+0.050000,	-64.90
+0.150000,	-58.45
+0.250000,	-83.17
+0.350000,	-58.37
+0.450000,	-64.87
+0.550000,	-64.24
+0.650000,	-57.82
+0.750000,	-81.56
+0.850000,	-57.09
+0.950000,	-64.89
+1.050000,	-64.53
+1.150000,	-57.26
+1.250000,	-81.93
+1.350000,	-56.95
+1.450000,	-63.43
+1.550000,	-63.34
+1.650000,	-56.73
+1.750000,	-80.99
+1.850000,	-56.51
+1.950000,	-63.17
+2.050000,	-62.58
+2.150000,	-56.18
+2.250000,	-80.63
+2.350000,	-56.26
+2.450000,	-63.29
+2.550000,	-42.29
+2.650000,	-42.68
+2.750000,	-42.80
+2.850000,	-42.73
+2.950000,	-42.72
+3.050000,	-42.80
+3.150000,	-42.84
+3.250000,	-42.80
+3.350000,	-42.61
+3.450000,	-42.89
+3.550000,	-42.87
+3.650000,	-42.64
+3.750000,	-42.58
+3.850000,	-42.96
+3.950000,	-42.89
+4.050000,	-42.53
+4.150000,	-42.75
+4.250000,	-43.03
+4.350000,	-42.82
+4.450000,	-42.58
+4.550000,	-42.74
+4.650000,	-42.97
+4.750000,	-42.73
+4.850000,	-42.62
+4.950000,	-42.80
+5.050000,	-26.49
+5.150000,	-27.22
+5.250000,	-27.46
+5.350000,	-27.60
+5.450000,	-27.44
+5.550000,	-27.50
+5.650000,	-27.54
+5.750000,	-27.60
+5.850000,	-27.70
+5.950000,	-27.71
+6.050000,	-27.64
+6.150000,	-27.64
+6.250000,	-27.75
+6.350000,	-27.63
+6.450000,	-27.71
+6.550000,	-27.72
+6.650000,	-27.63
+6.750000,	-27.82
+6.850000,	-27.73
+6.950000,	-27.66
+7.050000,	-27.70
+7.150000,	-27.81
+7.250000,	-27.63
+7.350000,	-27.68
+7.450000,	-27.74
+7.550000,	-26.71
+7.650000,	-22.10
+7.750000,	-48.40
+7.850000,	-24.11
+7.950000,	-31.96
+8.050000,	-31.14
+8.150000,	-25.08
+8.250000,	-50.83
+8.350000,	-25.23
+8.450000,	-32.42
+8.550000,	-31.02
+8.650000,	-25.83
+8.750000,	-51.61
+8.850000,	-25.50
+8.950000,	-32.57
+9.050000,	-32.34
+9.150000,	-26.18
+9.250000,	-50.94
+9.350000,	-25.95
+9.450000,	-32.51
+9.550000,	-32.34
+9.650000,	-26.22
+9.750000,	-51.14
+9.850000,	-26.30
+9.950000,	-32.55
+10.050000,	-41.49
+10.150000,	-40.89
+10.250000,	-40.89
+10.350000,	-40.66
+10.450000,	-40.29
+10.550000,	-40.04
+10.650000,	-39.80
+10.750000,	-39.61
+10.850000,	-39.35
+10.950000,	-39.21
+11.050000,	-38.83
+11.150000,	-38.74
+11.250000,	-38.74
+11.350000,	-38.50
+11.450000,	-38.10
+11.550000,	-38.01
+11.650000,	-38.12
+11.750000,	-37.79
+11.850000,	-37.36
+11.950000,	-37.38
+12.050000,	-37.51
+12.150000,	-37.06
+12.250000,	-36.78
+12.350000,	-36.93
+12.450000,	-36.88
+12.550000,	-67.30
+12.650000,	-66.35
+12.750000,	-65.46
+12.850000,	-64.76
+12.950000,	-64.14
+13.050000,	-63.57
+13.150000,	-63.19
+13.250000,	-63.01
+13.350000,	-62.77
+13.450000,	-62.55
+13.550000,	-62.48
+13.650000,	-62.35
+13.750000,	-62.27
+13.850000,	-62.16
+13.950000,	-61.82
+14.050000,	-61.79
+14.150000,	-61.68
+14.250000,	-61.54
+14.350000,	-61.47
+14.450000,	-61.27
+14.550000,	-61.11
+14.650000,	-61.04
+14.750000,	-61.09
+14.850000,	-60.80
+14.950000,	-60.78
+15.050000,	-29.08
+15.150000,	-24.86
+15.250000,	-50.44
+15.350000,	-25.81
+15.450000,	-32.59
+15.550000,	-31.79
+15.650000,	-26.61
+15.750000,	-50.06
+15.850000,	-26.27
+15.950000,	-33.56
+16.050000,	-32.56
+16.150000,	-26.59
+16.250000,	-52.02
+16.350000,	-26.36
+16.450000,	-34.00
+16.550000,	-32.93
+16.650000,	-27.01
+16.750000,	-52.12
+16.850000,	-26.44
+16.950000,	-33.13
+17.050000,	-32.90
+17.150000,	-26.69
+17.250000,	-51.72
+17.350000,	-26.07
+17.450000,	-33.80
+17.550000,	-42.89
+17.650000,	-42.95
+17.750000,	-42.97
+17.850000,	-42.46
+17.950000,	-42.20
+18.050000,	-42.30
+18.150000,	-42.22
+18.250000,	-41.95
+18.350000,	-41.83
+18.450000,	-41.76
+18.550000,	-41.62
+18.650000,	-41.37
+18.750000,	-41.29
+18.850000,	-41.22
+18.950000,	-41.25
+19.050000,	-41.10
+19.150000,	-40.95
+19.250000,	-40.78
+19.350000,	-40.68
+19.450000,	-40.79
+19.550000,	-40.54
+19.650000,	-40.29
+19.750000,	-40.44
+19.850000,	-40.40
+19.950000,	-40.17
@@ -0,0 +1,200 @@
+0.050000,	-65.22
+0.150000,	-58.06
+0.250000,	-82.83
+0.350000,	-58.30
+0.450000,	-64.81
+0.550000,	-64.63
+0.650000,	-57.76
+0.750000,	-82.15
+0.850000,	-56.95
+0.950000,	-64.37
+1.050000,	-63.60
+1.150000,	-56.92
+1.250000,	-82.33
+1.350000,	-57.07
+1.450000,	-63.90
+1.550000,	-64.08
+1.650000,	-56.30
+1.750000,	-81.23
+1.850000,	-56.41
+1.950000,	-62.89
+2.050000,	-63.13
+2.150000,	-56.56
+2.250000,	-80.34
+2.350000,	-56.11
+2.450000,	-62.74
+2.550000,	-42.37
+2.650000,	-42.74
+2.750000,	-42.76
+2.850000,	-42.74
+2.950000,	-42.74
+3.050000,	-42.82
+3.150000,	-42.82
+3.250000,	-42.68
+3.350000,	-42.63
+3.450000,	-42.92
+3.550000,	-42.96
+3.650000,	-42.59
+3.750000,	-42.64
+3.850000,	-42.92
+3.950000,	-42.85
+4.050000,	-42.53
+4.150000,	-42.74
+4.250000,	-42.95
+4.350000,	-42.89
+4.450000,	-42.50
+4.550000,	-42.75
+4.650000,	-43.00
+4.750000,	-42.69
+4.850000,	-42.75
+4.950000,	-42.79
+5.050000,	-26.56
+5.150000,	-27.24
+5.250000,	-27.37
+5.350000,	-27.45
+5.450000,	-27.57
+5.550000,	-27.47
+5.650000,	-27.50
+5.750000,	-27.63
+5.850000,	-27.66
+5.950000,	-27.72
+6.050000,	-27.73
+6.150000,	-27.75
+6.250000,	-27.77
+6.350000,	-27.71
+6.450000,	-27.70
+6.550000,	-27.74
+6.650000,	-27.78
+6.750000,	-27.71
+6.850000,	-27.63
+6.950000,	-27.77
+7.050000,	-27.68
+7.150000,	-27.74
+7.250000,	-27.71
+7.350000,	-27.63
+7.450000,	-27.66
+7.550000,	-26.74
+7.650000,	-22.55
+7.750000,	-48.59
+7.850000,	-24.37
+7.950000,	-31.17
+8.050000,	-30.65
+8.150000,	-26.09
+8.250000,	-49.90
+8.350000,	-25.29
+8.450000,	-33.20
+8.550000,	-32.07
+8.650000,	-26.07
+8.750000,	-50.84
+8.850000,	-25.77
+8.950000,	-32.97
+9.050000,	-32.93
+9.150000,	-25.99
+9.250000,	-50.70
+9.350000,	-25.99
+9.450000,	-32.69
+9.550000,	-31.90
+9.650000,	-25.85
+9.750000,	-50.85
+9.850000,	-26.28
+9.950000,	-32.63
+10.050000,	-41.32
+10.150000,	-40.89
+10.250000,	-40.85
+10.350000,	-40.68
+10.450000,	-40.32
+10.550000,	-40.04
+10.650000,	-39.81
+10.750000,	-39.62
+10.850000,	-39.47
+10.950000,	-39.09
+11.050000,	-38.87
+11.150000,	-38.77
+11.250000,	-38.67
+11.350000,	-38.51
+11.450000,	-38.21
+11.550000,	-38.06
+11.650000,	-38.11
+11.750000,	-37.78
+11.850000,	-37.35
+11.950000,	-37.46
+12.050000,	-37.46
+12.150000,	-37.10
+12.250000,	-36.75
+12.350000,	-36.93
+12.450000,	-36.91
+12.550000,	-67.23
+12.650000,	-66.36
+12.750000,	-65.63
+12.850000,	-64.80
+12.950000,	-64.24
+13.050000,	-63.50
+13.150000,	-63.06
+13.250000,	-62.96
+13.350000,	-62.77
+13.450000,	-62.68
+13.550000,	-62.48
+13.650000,	-62.26
+13.750000,	-62.18
+13.850000,	-62.13
+13.950000,	-61.92
+14.050000,	-61.85
+14.150000,	-61.64
+14.250000,	-61.49
+14.350000,	-61.45
+14.450000,	-61.21
+14.550000,	-61.17
+14.650000,	-61.08
+14.750000,	-60.93
+14.850000,	-60.84
+14.950000,	-60.66
+15.050000,	-28.61
+15.150000,	-24.83
+15.250000,	-50.10
+15.350000,	-25.62
+15.450000,	-32.72
+15.550000,	-32.12
+15.650000,	-26.66
+15.750000,	-52.36
+15.850000,	-26.27
+15.950000,	-33.62
+16.050000,	-33.36
+16.150000,	-26.31
+16.250000,	-52.61
+16.350000,	-26.76
+16.450000,	-33.50
+16.550000,	-33.32
+16.650000,	-26.90
+16.750000,	-51.94
+16.850000,	-26.52
+16.950000,	-34.00
+17.050000,	-32.65
+17.150000,	-26.86
+17.250000,	-52.19
+17.350000,	-27.10
+17.450000,	-33.89
+17.550000,	-42.85
+17.650000,	-43.01
+17.750000,	-42.91
+17.850000,	-42.49
+17.950000,	-42.28
+18.050000,	-42.40
+18.150000,	-42.30
+18.250000,	-41.99
+18.350000,	-41.73
+18.450000,	-41.80
+18.550000,	-41.70
+18.650000,	-41.41
+18.750000,	-41.37
+18.850000,	-41.17
+18.950000,	-41.21
+19.050000,	-41.06
+19.150000,	-41.00
+19.250000,	-40.81
+19.350000,	-40.69
+19.450000,	-40.77
+19.550000,	-40.55
+19.650000,	-40.35
+19.750000,	-40.37
+19.850000,	-40.45
+19.950000,	-40.12
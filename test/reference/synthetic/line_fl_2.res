@@ -0,0 +1,200 @@
+0.050000,	-62.15
+0.150000,	-54.97
+0.250000,	-80.38
+0.350000,	-54.56
+0.450000,	-62.44
+0.550000,	-61.09
+0.650000,	-54.51
+0.750000,	-79.38
+0.850000,	-54.98
+0.950000,	-60.62
+1.050000,	-60.31
+1.150000,	-54.17
+1.250000,	-78.89
+1.350000,	-53.87
+1.450000,	-60.56
+1.550000,	-60.33
+1.650000,	-53.55
+1.750000,	-78.33
+1.850000,	-53.56
+1.950000,	-59.97
+2.050000,	-59.12
+2.150000,	-53.12
+2.250000,	-77.98
+2.350000,	-53.21
+2.450000,	-59.91
+2.550000,	-39.23
+2.650000,	-39.60
+2.750000,	-39.69
+2.850000,	-39.62
+2.950000,	-39.59
+3.050000,	-39.69
+3.150000,	-39.76
+3.250000,	-39.67
+3.350000,	-39.54
+3.450000,	-39.76
+3.550000,	-39.85
+3.650000,	-39.52
+3.750000,	-39.54
+3.850000,	-39.84
+3.950000,	-39.84
+4.050000,	-39.44
+4.150000,	-39.59
+4.250000,	-39.96
+4.350000,	-39.73
+4.450000,	-39.46
+4.550000,	-39.66
+4.650000,	-39.84
+4.750000,	-39.64
+4.850000,	-39.61
+4.950000,	-39.69
+5.050000,	-23.36
+5.150000,	-24.17
+5.250000,	-24.31
+5.350000,	-24.41
+5.450000,	-24.47
+5.550000,	-24.47
+5.650000,	-24.45
+5.750000,	-24.58
+5.850000,	-24.64
+5.950000,	-24.65
+6.050000,	-24.65
+6.150000,	-24.59
+6.250000,	-24.54
+6.350000,	-24.60
+6.450000,	-24.52
+6.550000,	-24.65
+6.650000,	-24.66
+6.750000,	-24.55
+6.850000,	-24.66
+6.950000,	-24.62
+7.050000,	-24.60
+7.150000,	-24.67
+7.250000,	-24.56
+7.350000,	-24.60
+7.450000,	-24.58
+7.550000,	-22.77
+7.650000,	-19.14
+7.750000,	-45.66
+7.850000,	-20.88
+7.950000,	-28.93
+8.050000,	-27.56
+8.150000,	-22.40
+8.250000,	-47.22
+8.350000,	-22.51
+8.450000,	-29.70
+8.550000,	-28.44
+8.650000,	-22.82
+8.750000,	-48.30
+8.850000,	-22.70
+8.950000,	-29.77
+9.050000,	-28.84
+9.150000,	-23.07
+9.250000,	-48.30
+9.350000,	-22.82
+9.450000,	-30.31
+9.550000,	-29.29
+9.650000,	-23.03
+9.750000,	-48.03
+9.850000,	-22.69
+9.950000,	-29.12
+10.050000,	-38.24
+10.150000,	-37.75
+10.250000,	-37.69
+10.350000,	-37.61
+10.450000,	-37.23
+10.550000,	-36.98
+10.650000,	-36.72
+10.750000,	-36.52
+10.850000,	-36.32
+10.950000,	-36.06
+11.050000,	-35.85
+11.150000,	-35.57
+11.250000,	-35.62
+11.350000,	-35.49
+11.450000,	-35.05
+11.550000,	-34.90
+11.650000,	-35.07
+11.750000,	-34.65
+11.850000,	-34.26
+11.950000,	-34.30
+12.050000,	-34.49
+12.150000,	-34.04
+12.250000,	-33.67
+12.350000,	-33.85
+12.450000,	-33.90
+12.550000,	-64.18
+12.650000,	-63.30
+12.750000,	-62.30
+12.850000,	-61.78
+12.950000,	-61.15
+13.050000,	-60.49
+13.150000,	-60.14
+13.250000,	-59.95
+13.350000,	-59.66
+13.450000,	-59.60
+13.550000,	-59.46
+13.650000,	-59.30
+13.750000,	-59.10
+13.850000,	-59.04
+13.950000,	-58.74
+14.050000,	-58.75
+14.150000,	-58.71
+14.250000,	-58.49
+14.350000,	-58.38
+14.450000,	-58.10
+14.550000,	-58.17
+14.650000,	-57.95
+14.750000,	-57.84
+14.850000,	-57.72
+14.950000,	-57.62
+15.050000,	-25.22
+15.150000,	-21.41
+15.250000,	-47.30
+15.350000,	-22.23
+15.450000,	-29.82
+15.550000,	-28.94
+15.650000,	-23.32
+15.750000,	-47.13
+15.850000,	-22.81
+15.950000,	-30.37
+16.050000,	-29.92
+16.150000,	-23.72
+16.250000,	-48.70
+16.350000,	-23.00
+16.450000,	-30.74
+16.550000,	-29.96
+16.650000,	-23.55
+16.750000,	-49.37
+16.850000,	-23.80
+16.950000,	-31.13
+17.050000,	-30.14
+17.150000,	-23.39
+17.250000,	-48.91
+17.350000,	-23.36
+17.450000,	-31.01
+17.550000,	-39.72
+17.650000,	-39.86
+17.750000,	-39.87
+17.850000,	-39.46
+17.950000,	-39.19
+18.050000,	-39.27
+18.150000,	-39.19
+18.250000,	-38.83
+18.350000,	-38.64
+18.450000,	-38.72
+18.550000,	-38.69
+18.650000,	-38.31
+18.750000,	-38.31
+18.850000,	-38.11
+18.950000,	-38.12
+19.050000,	-37.90
+19.150000,	-37.81
+19.250000,	-37.72
+19.350000,	-37.63
+19.450000,	-37.62
+19.550000,	-37.40
+19.650000,	-37.19
+19.750000,	-37.29
+19.850000,	-37.42
+19.950000,	-36.96
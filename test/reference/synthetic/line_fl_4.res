@@ -0,0 +1,200 @@
+0.050000,	-69.61
+0.150000,	-63.15
+0.250000,	-87.36
+0.350000,	-63.39
+0.450000,	-69.95
+0.550000,	-69.26
+0.650000,	-62.58
+0.750000,	-86.68
+0.850000,	-62.80
+0.950000,	-69.26
+1.050000,	-68.87
+1.150000,	-61.87
+1.250000,	-86.25
+1.350000,	-61.51
+1.450000,	-67.60
+1.550000,	-67.63
+1.650000,	-61.49
+1.750000,	-86.27
+1.850000,	-60.93
+1.950000,	-67.41
+2.050000,	-67.22
+2.150000,	-61.14
+2.250000,	-85.94
+2.350000,	-61.12
+2.450000,	-67.48
+2.550000,	-47.25
+2.650000,	-47.46
+2.750000,	-47.65
+2.850000,	-47.63
+2.950000,	-47.57
+3.050000,	-47.69
+3.150000,	-47.81
+3.250000,	-47.61
+3.350000,	-47.47
+3.450000,	-47.82
+3.550000,	-47.79
+3.650000,	-47.49
+3.750000,	-47.54
+3.850000,	-47.74
+3.950000,	-47.74
+4.050000,	-47.42
+4.150000,	-47.59
+4.250000,	-47.87
+4.350000,	-47.74
+4.450000,	-47.36
+4.550000,	-47.65
+4.650000,	-47.87
+4.750000,	-47.64
+4.850000,	-47.48
+4.950000,	-47.65
+5.050000,	-31.42
+5.150000,	-32.07
+5.250000,	-32.22
+5.350000,	-32.44
+5.450000,	-32.55
+5.550000,	-32.44
+5.650000,	-32.44
+5.750000,	-32.36
+5.850000,	-32.48
+5.950000,	-32.50
+6.050000,	-32.62
+6.150000,	-32.58
+6.250000,	-32.61
+6.350000,	-32.48
+6.450000,	-32.56
+6.550000,	-32.68
+6.650000,	-32.60
+6.750000,	-32.51
+6.850000,	-32.57
+6.950000,	-32.55
+7.050000,	-32.52
+7.150000,	-32.58
+7.250000,	-32.52
+7.350000,	-32.55
+7.450000,	-32.49
+7.550000,	-31.03
+7.650000,	-26.88
+7.750000,	-53.21
+7.850000,	-28.76
+7.950000,	-36.56
+8.050000,	-35.91
+8.150000,	-30.23
+8.250000,	-54.98
+8.350000,	-30.43
+8.450000,	-37.42
+8.550000,	-36.56
+8.650000,	-31.50
+8.750000,	-55.67
+8.850000,	-30.60
+8.950000,	-37.74
+9.050000,	-37.12
+9.150000,	-31.06
+9.250000,	-56.18
+9.350000,	-31.01
+9.450000,	-37.79
+9.550000,	-36.93
+9.650000,	-31.07
+9.750000,	-56.35
+9.850000,	-30.67
+9.950000,	-37.60
+10.050000,	-46.25
+10.150000,	-45.80
+10.250000,	-45.73
+10.350000,	-45.51
+10.450000,	-45.12
+10.550000,	-44.86
+10.650000,	-44.67
+10.750000,	-44.50
+10.850000,	-44.27
+10.950000,	-44.06
+11.050000,	-43.86
+11.150000,	-43.62
+11.250000,	-43.58
+11.350000,	-43.45
+11.450000,	-42.97
+11.550000,	-42.89
+11.650000,	-43.00
+11.750000,	-42.73
+11.850000,	-42.19
+11.950000,	-42.25
+12.050000,	-42.42
+12.150000,	-41.90
+12.250000,	-41.53
+12.350000,	-41.76
+12.450000,	-41.75
+12.550000,	-72.01
+12.650000,	-71.18
+12.750000,	-70.42
+12.850000,	-69.53
+12.950000,	-68.92
+13.050000,	-68.40
+13.150000,	-67.99
+13.250000,	-67.92
+13.350000,	-67.59
+13.450000,	-67.39
+13.550000,	-67.32
+13.650000,	-67.13
+13.750000,	-66.93
+13.850000,	-66.92
+13.950000,	-66.70
+14.050000,	-66.55
+14.150000,	-66.38
+14.250000,	-66.37
+14.350000,	-66.32
+14.450000,	-66.12
+14.550000,	-66.07
+14.650000,	-65.74
+14.750000,	-65.78
+14.850000,	-65.53
+14.950000,	-65.52
+15.050000,	-33.36
+15.150000,	-29.28
+15.250000,	-54.97
+15.350000,	-30.38
+15.450000,	-38.06
+15.550000,	-37.76
+15.650000,	-30.96
+15.750000,	-55.92
+15.850000,	-30.95
+15.950000,	-38.50
+16.050000,	-37.33
+16.150000,	-31.35
+16.250000,	-56.61
+16.350000,	-31.35
+16.450000,	-39.22
+16.550000,	-38.76
+16.650000,	-31.47
+16.750000,	-57.20
+16.850000,	-31.58
+16.950000,	-38.25
+17.050000,	-38.14
+17.150000,	-31.59
+17.250000,	-55.77
+17.350000,	-31.89
+17.450000,	-38.60
+17.550000,	-47.69
+17.650000,	-47.78
+17.750000,	-47.78
+17.850000,	-47.44
+17.950000,	-47.16
+18.050000,	-47.21
+18.150000,	-47.12
+18.250000,	-46.85
+18.350000,	-46.67
+18.450000,	-46.64
+18.550000,	-46.55
+18.650000,	-46.26
+18.750000,	-46.22
+18.850000,	-46.07
+18.950000,	-45.96
+19.050000,	-45.95
+19.150000,	-45.77
+19.250000,	-45.71
+19.350000,	-45.59
+19.450000,	-45.58
+19.550000,	-45.42
+19.650000,	-45.18
+19.750000,	-45.26
+19.850000,	-45.33
+19.950000,	-45.03
@@ -0,0 +1,200 @@
+0.050000,	-70.33
+0.150000,	-62.77
+0.250000,	-88.37
+0.350000,	-62.43
+0.450000,	-69.63
+0.550000,	-69.39
+0.650000,	-62.69
+0.750000,	-86.71
+0.850000,	-62.03
+0.950000,	-69.29
+1.050000,	-68.84
+1.150000,	-62.20
+1.250000,	-86.98
+1.350000,	-62.11
+1.450000,	-68.36
+1.550000,	-67.65
+1.650000,	-61.65
+1.750000,	-86.16
+1.850000,	-61.17
+1.950000,	-68.19
+2.050000,	-68.13
+2.150000,	-61.31
+2.250000,	-85.17
+2.350000,	-60.82
+2.450000,	-67.24
+2.550000,	-47.16
+2.650000,	-47.60
+2.750000,	-47.64
+2.850000,	-47.57
+2.950000,	-47.68
+3.050000,	-47.69
+3.150000,	-47.71
+3.250000,	-47.60
+3.350000,	-47.52
+3.450000,	-47.74
+3.550000,	-47.75
+3.650000,	-47.44
+3.750000,	-47.48
+3.850000,	-47.75
+3.950000,	-47.79
+4.050000,	-47.42
+4.150000,	-47.59
+4.250000,	-47.82
+4.350000,	-47.73
+4.450000,	-47.34
+4.550000,	-47.58
+4.650000,	-47.88
+4.750000,	-47.66
+4.850000,	-47.51
+4.950000,	-47.59
+5.050000,	-31.32
+5.150000,	-31.99
+5.250000,	-32.24
+5.350000,	-32.47
+5.450000,	-32.31
+5.550000,	-32.36
+5.650000,	-32.38
+5.750000,	-32.50
+5.850000,	-32.57
+5.950000,	-32.55
+6.050000,	-32.65
+6.150000,	-32.63
+6.250000,	-32.51
+6.350000,	-32.46
+6.450000,	-32.51
+6.550000,	-32.56
+6.650000,	-32.55
+6.750000,	-32.54
+6.850000,	-32.53
+6.950000,	-32.49
+7.050000,	-32.64
+7.150000,	-32.53
+7.250000,	-32.50
+7.350000,	-32.57
+7.450000,	-32.50
+7.550000,	-31.34
+7.650000,	-26.85
+7.750000,	-53.10
+7.850000,	-28.47
+7.950000,	-36.79
+8.050000,	-36.42
+8.150000,	-30.18
+8.250000,	-55.88
+8.350000,	-30.47
+8.450000,	-37.60
+8.550000,	-36.61
+8.650000,	-31.03
+8.750000,	-56.63
+8.850000,	-31.26
+8.950000,	-38.12
+9.050000,	-37.25
+9.150000,	-31.37
+9.250000,	-55.87
+9.350000,	-30.97
+9.450000,	-37.42
+9.550000,	-37.17
+9.650000,	-31.05
+9.750000,	-56.99
+9.850000,	-30.91
+9.950000,	-38.32
+10.050000,	-46.24
+10.150000,	-45.72
+10.250000,	-45.79
+10.350000,	-45.48
+10.450000,	-45.23
+10.550000,	-44.87
+10.650000,	-44.75
+10.750000,	-44.51
+10.850000,	-44.26
+10.950000,	-44.01
+11.050000,	-43.77
+11.150000,	-43.66
+11.250000,	-43.61
+11.350000,	-43.43
+11.450000,	-43.10
+11.550000,	-42.88
+11.650000,	-42.98
+11.750000,	-42.77
+11.850000,	-42.18
+11.950000,	-42.32
+12.050000,	-42.40
+12.150000,	-41.92
+12.250000,	-41.58
+12.350000,	-41.77
+12.450000,	-41.76
+12.550000,	-72.05
+12.650000,	-71.08
+12.750000,	-70.28
+12.850000,	-69.51
+12.950000,	-68.82
+13.050000,	-68.39
+13.150000,	-67.97
+13.250000,	-67.86
+13.350000,	-67.62
+13.450000,	-67.34
+13.550000,	-67.35
+13.650000,	-67.14
+13.750000,	-66.97
+13.850000,	-66.90
+13.950000,	-66.65
+14.050000,	-66.54
+14.150000,	-66.47
+14.250000,	-66.29
+14.350000,	-66.23
+14.450000,	-66.00
+14.550000,	-65.89
+14.650000,	-65.89
+14.750000,	-65.78
+14.850000,	-65.70
+14.950000,	-65.57
+15.050000,	-33.39
+15.150000,	-30.18
+15.250000,	-55.37
+15.350000,	-30.38
+15.450000,	-37.66
+15.550000,	-38.09
+15.650000,	-30.71
+15.750000,	-56.48
+15.850000,	-31.12
+15.950000,	-38.45
+16.050000,	-37.47
+16.150000,	-31.65
+16.250000,	-56.70
+16.350000,	-31.19
+16.450000,	-38.39
+16.550000,	-37.38
+16.650000,	-31.81
+16.750000,	-56.52
+16.850000,	-31.47
+16.950000,	-39.12
+17.050000,	-37.92
+17.150000,	-31.71
+17.250000,	-56.93
+17.350000,	-31.59
+17.450000,	-38.89
+17.550000,	-47.75
+17.650000,	-47.86
+17.750000,	-47.86
+17.850000,	-47.41
+17.950000,	-47.16
+18.050000,	-47.23
+18.150000,	-47.15
+18.250000,	-46.87
+18.350000,	-46.56
+18.450000,	-46.63
+18.550000,	-46.58
+18.650000,	-46.31
+18.750000,	-46.15
+18.850000,	-46.06
+18.950000,	-46.04
+19.050000,	-45.94
+19.150000,	-45.78
+19.250000,	-45.71
+19.350000,	-45.59
+19.450000,	-45.59
+19.550000,	-45.38
+19.650000,	-45.12
+19.750000,	-45.26
+19.850000,	-45.33
+19.950000,	-45.01
@@ -0,0 +1,200 @@
+0.050000,	-64.90
+0.150000,	-58.45
+0.250000,	-83.17
+0.350000,	-58.37
+0.450000,	-64.87
+0.550000,	-64.24
+0.650000,	-57.82
+0.750000,	-81.56
+0.850000,	-57.09
+0.950000,	-64.72
+1.050000,	-64.53
+1.150000,	-57.13
+1.250000,	-81.93
+1.350000,	-56.95
+1.450000,	-63.43
+1.550000,	-63.34
+1.650000,	-56.73
+1.750000,	-80.97
+1.850000,	-56.51
+1.950000,	-63.03
+2.050000,	-62.52
+2.150000,	-55.97
+2.250000,	-80.41
+2.350000,	-55.94
+2.450000,	-62.88
+2.550000,	-41.91
+2.650000,	-42.53
+2.750000,	-42.54
+2.850000,	-42.46
+2.950000,	-42.53
+3.050000,	-42.80
+3.150000,	-42.84
+3.250000,	-42.80
+3.350000,	-42.61
+3.450000,	-42.89
+3.550000,	-42.87
+3.650000,	-42.64
+3.750000,	-42.58
+3.850000,	-42.96
+3.950000,	-42.89
+4.050000,	-42.53
+4.150000,	-42.75
+4.250000,	-43.03
+4.350000,	-42.82
+4.450000,	-42.58
+4.550000,	-42.74
+4.650000,	-42.97
+4.750000,	-42.73
+4.850000,	-42.62
+4.950000,	-42.80
+5.050000,	-27.33
+5.150000,	-29.13
+5.250000,	-29.76
+5.350000,	-30.04
+5.450000,	-29.89
+5.550000,	-30.05
+5.650000,	-30.21
+5.750000,	-30.22
+5.850000,	-30.19
+5.950000,	-30.21
+6.050000,	-30.14
+6.150000,	-30.14
+6.250000,	-30.25
+6.350000,	-30.13
+6.450000,	-30.21
+6.550000,	-30.22
+6.650000,	-30.13
+6.750000,	-30.32
+6.850000,	-30.23
+6.950000,	-30.16
+7.050000,	-30.20
+7.150000,	-30.31
+7.250000,	-30.13
+7.350000,	-30.18
+7.450000,	-30.24
+7.550000,	-29.56
+7.650000,	-25.52
+7.750000,	-52.07
+7.850000,	-28.02
+7.950000,	-36.18
+8.050000,	-35.10
+8.150000,	-29.30
+8.250000,	-55.01
+8.350000,	-29.34
+8.450000,	-36.73
+8.550000,	-35.03
+8.650000,	-30.00
+8.750000,	-55.70
+8.850000,	-29.57
+8.950000,	-36.84
+9.050000,	-36.26
+9.150000,	-30.32
+9.250000,	-54.98
+9.350000,	-30.06
+9.450000,	-36.94
+9.550000,	-36.34
+9.650000,	-30.40
+9.750000,	-55.29
+9.850000,	-30.33
+9.950000,	-36.98
+10.050000,	-45.57
+10.150000,	-44.89
+10.250000,	-44.80
+10.350000,	-44.53
+10.450000,	-44.05
+10.550000,	-43.71
+10.650000,	-43.40
+10.750000,	-43.10
+10.850000,	-42.75
+10.950000,	-42.58
+11.050000,	-42.08
+11.150000,	-41.89
+11.250000,	-41.81
+11.350000,	-41.46
+11.450000,	-41.03
+11.550000,	-40.91
+11.650000,	-40.91
+11.750000,	-40.51
+11.850000,	-40.08
+11.950000,	-39.99
+12.050000,	-40.08
+12.150000,	-39.63
+12.250000,	-39.25
+12.350000,	-39.37
+12.450000,	-39.28
+12.550000,	-69.59
+12.650000,	-68.45
+12.750000,	-67.34
+12.850000,	-66.47
+12.950000,	-65.69
+13.050000,	-64.91
+13.150000,	-64.42
+13.250000,	-64.15
+13.350000,	-63.91
+13.450000,	-63.74
+13.550000,	-63.55
+13.650000,	-63.45
+13.750000,	-63.36
+13.850000,	-63.11
+13.950000,	-62.81
+14.050000,	-62.75
+14.150000,	-62.58
+14.250000,	-62.42
+14.350000,	-62.30
+14.450000,	-62.12
+14.550000,	-61.88
+14.650000,	-61.87
+14.750000,	-61.78
+14.850000,	-61.53
+14.950000,	-61.47
+15.050000,	-30.66
+15.150000,	-28.24
+15.250000,	-53.99
+15.350000,	-29.50
+15.450000,	-36.67
+15.550000,	-35.50
+15.650000,	-30.63
+15.750000,	-54.07
+15.850000,	-30.26
+15.950000,	-37.74
+16.050000,	-36.51
+16.150000,	-30.74
+16.250000,	-55.97
+16.350000,	-30.37
+16.450000,	-38.13
+16.550000,	-36.82
+16.650000,	-31.07
+16.750000,	-56.11
+16.850000,	-30.44
+16.950000,	-37.27
+17.050000,	-36.67
+17.150000,	-30.82
+17.250000,	-55.84
+17.350000,	-30.13
+17.450000,	-38.15
+17.550000,	-46.83
+17.650000,	-46.70
+17.750000,	-46.60
+17.850000,	-46.00
+17.950000,	-45.59
+18.050000,	-45.54
+18.150000,	-45.40
+18.250000,	-44.96
+18.350000,	-44.77
+18.450000,	-44.59
+18.550000,	-44.28
+18.650000,	-44.05
+18.750000,	-43.77
+18.850000,	-43.75
+18.950000,	-43.63
+19.050000,	-43.38
+19.150000,	-43.20
+19.250000,	-42.95
+19.350000,	-42.74
+19.450000,	-42.77
+19.550000,	-42.49
+19.650000,	-42.14
+19.750000,	-42.18
+19.850000,	-42.14
+19.950000,	-41.79
@@ -0,0 +1,200 @@
+0.050000,	-65.22
+0.150000,	-58.06
+0.250000,	-82.83
+0.350000,	-58.30
+0.450000,	-64.81
+0.550000,	-64.63
+0.650000,	-57.76
+0.750000,	-82.15
+0.850000,	-56.95
+0.950000,	-64.19
+1.050000,	-63.60
+1.150000,	-56.79
+1.250000,	-82.33
+1.350000,	-57.07
+1.450000,	-63.90
+1.550000,	-64.08
+1.650000,	-56.30
+1.750000,	-81.22
+1.850000,	-56.41
+1.950000,	-62.75
+2.050000,	-63.05
+2.150000,	-56.34
+2.250000,	-80.13
+2.350000,	-55.77
+2.450000,	-62.33
+2.550000,	-42.00
+2.650000,	-42.58
+2.750000,	-42.49
+2.850000,	-42.47
+2.950000,	-42.55
+3.050000,	-42.82
+3.150000,	-42.82
+3.250000,	-42.68
+3.350000,	-42.63
+3.450000,	-42.92
+3.550000,	-42.96
+3.650000,	-42.59
+3.750000,	-42.64
+3.850000,	-42.92
+3.950000,	-42.85
+4.050000,	-42.53
+4.150000,	-42.74
+4.250000,	-42.95
+4.350000,	-42.89
+4.450000,	-42.50
+4.550000,	-42.75
+4.650000,	-43.00
+4.750000,	-42.69
+4.850000,	-42.75
+4.950000,	-42.79
+5.050000,	-27.39
+5.150000,	-29.15
+5.250000,	-29.69
+5.350000,	-29.90
+5.450000,	-30.02
+5.550000,	-30.03
+5.650000,	-30.16
+5.750000,	-30.25
+5.850000,	-30.16
+5.950000,	-30.22
+6.050000,	-30.23
+6.150000,	-30.25
+6.250000,	-30.27
+6.350000,	-30.21
+6.450000,	-30.20
+6.550000,	-30.24
+6.650000,	-30.28
+6.750000,	-30.21
+6.850000,	-30.13
+6.950000,	-30.27
+7.050000,	-30.17
+7.150000,	-30.24
+7.250000,	-30.21
+7.350000,	-30.12
+7.450000,	-30.16
+7.550000,	-29.56
+7.650000,	-25.97
+7.750000,	-52.30
+7.850000,	-28.28
+7.950000,	-35.39
+8.050000,	-34.61
+8.150000,	-30.30
+8.250000,	-54.01
+8.350000,	-29.41
+8.450000,	-37.51
+8.550000,	-36.08
+8.650000,	-30.24
+8.750000,	-54.86
+8.850000,	-29.83
+8.950000,	-37.24
+9.050000,	-36.84
+9.150000,	-30.14
+9.250000,	-54.76
+9.350000,	-30.09
+9.450000,	-37.12
+9.550000,	-35.90
+9.650000,	-30.03
+9.750000,	-54.97
+9.850000,	-30.31
+9.950000,	-37.05
+10.050000,	-45.40
+10.150000,	-44.88
+10.250000,	-44.76
+10.350000,	-44.54
+10.450000,	-44.08
+10.550000,	-43.71
+10.650000,	-43.40
+10.750000,	-43.10
+10.850000,	-42.87
+10.950000,	-42.47
+11.050000,	-42.12
+11.150000,	-41.92
+11.250000,	-41.73
+11.350000,	-41.47
+11.450000,	-41.14
+11.550000,	-40.95
+11.650000,	-40.89
+11.750000,	-40.51
+11.850000,	-40.06
+11.950000,	-40.07
+12.050000,	-40.02
+12.150000,	-39.67
+12.250000,	-39.22
+12.350000,	-39.36
+12.450000,	-39.31
+12.550000,	-69.51
+12.650000,	-68.44
+12.750000,	-67.52
+12.850000,	-66.50
+12.950000,	-65.79
+13.050000,	-64.84
+13.150000,	-64.29
+13.250000,	-64.10
+13.350000,	-63.91
+13.450000,	-63.86
+13.550000,	-63.55
+13.650000,	-63.35
+13.750000,	-63.27
+13.850000,	-63.08
+13.950000,	-62.92
+14.050000,	-62.80
+14.150000,	-62.53
+14.250000,	-62.38
+14.350000,	-62.28
+14.450000,	-62.06
+14.550000,	-61.95
+14.650000,	-61.91
+14.750000,	-61.62
+14.850000,	-61.58
+14.950000,	-61.35
+15.050000,	-30.26
+15.150000,	-28.21
+15.250000,	-53.65
+15.350000,	-29.33
+15.450000,	-36.80
+15.550000,	-35.84
+15.650000,	-30.68
+15.750000,	-56.38
+15.850000,	-30.27
+15.950000,	-37.81
+16.050000,	-37.30
+16.150000,	-30.48
+16.250000,	-56.62
+16.350000,	-30.77
+16.450000,	-37.63
+16.550000,	-37.21
+16.650000,	-30.96
+16.750000,	-55.94
+16.850000,	-30.52
+16.950000,	-38.13
+17.050000,	-36.42
+17.150000,	-30.98
+17.250000,	-56.32
+17.350000,	-31.15
+17.450000,	-38.24
+17.550000,	-46.80
+17.650000,	-46.76
+17.750000,	-46.54
+17.850000,	-46.03
+17.950000,	-45.67
+18.050000,	-45.64
+18.150000,	-45.47
+18.250000,	-44.99
+18.350000,	-44.67
+18.450000,	-44.63
+18.550000,	-44.37
+18.650000,	-44.09
+18.750000,	-43.85
+18.850000,	-43.70
+18.950000,	-43.59
+19.050000,	-43.35
+19.150000,	-43.25
+19.250000,	-42.98
+19.350000,	-42.75
+19.450000,	-42.75
+19.550000,	-42.50
+19.650000,	-42.20
+19.750000,	-42.11
+19.850000,	-42.20
+19.950000,	-41.75
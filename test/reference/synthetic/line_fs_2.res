@@ -0,0 +1,200 @@
+0.050000,	-62.15
+0.150000,	-54.97
+0.250000,	-80.38
+0.350000,	-54.56
+0.450000,	-62.44
+0.550000,	-61.09
+0.650000,	-54.51
+0.750000,	-79.38
+0.850000,	-54.98
+0.950000,	-60.46
+1.050000,	-60.31
+1.150000,	-54.05
+1.250000,	-78.89
+1.350000,	-53.87
+1.450000,	-60.56
+1.550000,	-60.33
+1.650000,	-53.55
+1.750000,	-78.32
+1.850000,	-53.56
+1.950000,	-59.82
+2.050000,	-59.05
+2.150000,	-52.91
+2.250000,	-77.76
+2.350000,	-52.88
+2.450000,	-59.49
+2.550000,	-38.85
+2.650000,	-39.44
+2.750000,	-39.42
+2.850000,	-39.36
+2.950000,	-39.40
+3.050000,	-39.69
+3.150000,	-39.76
+3.250000,	-39.67
+3.350000,	-39.54
+3.450000,	-39.76
+3.550000,	-39.85
+3.650000,	-39.52
+3.750000,	-39.54
+3.850000,	-39.84
+3.950000,	-39.84
+4.050000,	-39.44
+4.150000,	-39.59
+4.250000,	-39.96
+4.350000,	-39.73
+4.450000,	-39.46
+4.550000,	-39.66
+4.650000,	-39.84
+4.750000,	-39.64
+4.850000,	-39.61
+4.950000,	-39.69
+5.050000,	-24.20
+5.150000,	-26.09
+5.250000,	-26.62
+5.350000,	-26.85
+5.450000,	-26.91
+5.550000,	-27.03
+5.650000,	-27.11
+5.750000,	-27.20
+5.850000,	-27.14
+5.950000,	-27.15
+6.050000,	-27.15
+6.150000,	-27.09
+6.250000,	-27.03
+6.350000,	-27.10
+6.450000,	-27.02
+6.550000,	-27.15
+6.650000,	-27.16
+6.750000,	-27.05
+6.850000,	-27.16
+6.950000,	-27.12
+7.050000,	-27.10
+7.150000,	-27.16
+7.250000,	-27.06
+7.350000,	-27.10
+7.450000,	-27.08
+7.550000,	-25.60
+7.650000,	-22.58
+7.750000,	-49.36
+7.850000,	-24.81
+7.950000,	-33.15
+8.050000,	-31.52
+8.150000,	-26.61
+8.250000,	-51.39
+8.350000,	-26.62
+8.450000,	-34.01
+8.550000,	-32.46
+8.650000,	-26.99
+8.750000,	-52.35
+8.850000,	-26.76
+8.950000,	-34.05
+9.050000,	-32.76
+9.150000,	-27.20
+9.250000,	-52.35
+9.350000,	-26.93
+9.450000,	-34.75
+9.550000,	-33.29
+9.650000,	-27.21
+9.750000,	-52.11
+9.850000,	-26.73
+9.950000,	-33.54
+10.050000,	-42.32
+10.150000,	-41.74
+10.250000,	-41.60
+10.350000,	-41.47
+10.450000,	-40.99
+10.550000,	-40.66
+10.650000,	-40.32
+10.750000,	-40.01
+10.850000,	-39.72
+10.950000,	-39.43
+11.050000,	-39.10
+11.150000,	-38.72
+11.250000,	-38.69
+11.350000,	-38.45
+11.450000,	-37.98
+11.550000,	-37.80
+11.650000,	-37.85
+11.750000,	-37.38
+11.850000,	-36.98
+11.950000,	-36.92
+12.050000,	-37.05
+12.150000,	-36.60
+12.250000,	-36.13
+12.350000,	-36.28
+12.450000,	-36.30
+12.550000,	-66.47
+12.650000,	-65.39
+12.750000,	-64.19
+12.850000,	-63.50
+12.950000,	-62.70
+13.050000,	-61.82
+13.150000,	-61.37
+13.250000,	-61.09
+13.350000,	-60.79
+13.450000,	-60.79
+13.550000,	-60.53
+13.650000,	-60.40
+13.750000,	-60.19
+13.850000,	-59.99
+13.950000,	-59.74
+14.050000,	-59.71
+14.150000,	-59.61
+14.250000,	-59.38
+14.350000,	-59.22
+14.450000,	-58.95
+14.550000,	-58.94
+14.650000,	-58.77
+14.750000,	-58.54
+14.850000,	-58.45
+14.950000,	-58.32
+15.050000,	-26.95
+15.150000,	-24.77
+15.250000,	-50.84
+15.350000,	-25.93
+15.450000,	-33.90
+15.550000,	-32.66
+15.650000,	-27.35
+15.750000,	-51.08
+15.850000,	-26.82
+15.950000,	-34.56
+16.050000,	-33.86
+16.150000,	-27.89
+16.250000,	-52.76
+16.350000,	-27.02
+16.450000,	-34.87
+16.550000,	-33.85
+16.650000,	-27.59
+16.750000,	-53.36
+16.850000,	-27.79
+16.950000,	-35.27
+17.050000,	-33.91
+17.150000,	-27.52
+17.250000,	-53.07
+17.350000,	-27.42
+17.450000,	-35.36
+17.550000,	-43.66
+17.650000,	-43.60
+17.750000,	-43.49
+17.850000,	-43.00
+17.950000,	-42.58
+18.050000,	-42.51
+18.150000,	-42.37
+18.250000,	-41.83
+18.350000,	-41.58
+18.450000,	-41.55
+18.550000,	-41.36
+18.650000,	-40.99
+18.750000,	-40.79
+18.850000,	-40.64
+18.950000,	-40.50
+19.050000,	-40.19
+19.150000,	-40.05
+19.250000,	-39.89
+19.350000,	-39.69
+19.450000,	-39.60
+19.550000,	-39.35
+19.650000,	-39.04
+19.750000,	-39.03
+19.850000,	-39.17
+19.950000,	-38.58
@@ -0,0 +1,200 @@
+0.050000,	-69.61
+0.150000,	-63.15
+0.250000,	-87.36
+0.350000,	-63.39
+0.450000,	-69.95
+0.550000,	-69.26
+0.650000,	-62.58
+0.750000,	-86.68
+0.850000,	-62.80
+0.950000,	-69.10
+1.050000,	-68.87
+1.150000,	-61.75
+1.250000,	-86.25
+1.350000,	-61.51
+1.450000,	-67.60
+1.550000,	-67.63
+1.650000,	-61.49
+1.750000,	-86.26
+1.850000,	-60.93
+1.950000,	-67.27
+2.050000,	-67.14
+2.150000,	-60.93
+2.250000,	-85.73
+2.350000,	-60.79
+2.450000,	-67.07
+2.550000,	-46.87
+2.650000,	-47.30
+2.750000,	-47.38
+2.850000,	-47.36
+2.950000,	-47.38
+3.050000,	-47.69
+3.150000,	-47.81
+3.250000,	-47.61
+3.350000,	-47.47
+3.450000,	-47.82
+3.550000,	-47.79
+3.650000,	-47.49
+3.750000,	-47.54
+3.850000,	-47.74
+3.950000,	-47.74
+4.050000,	-47.42
+4.150000,	-47.59
+4.250000,	-47.87
+4.350000,	-47.74
+4.450000,	-47.36
+4.550000,	-47.65
+4.650000,	-47.87
+4.750000,	-47.64
+4.850000,	-47.48
+4.950000,	-47.65
+5.050000,	-32.26
+5.150000,	-33.98
+5.250000,	-34.53
+5.350000,	-34.89
+5.450000,	-34.99
+5.550000,	-35.00
+5.650000,	-35.10
+5.750000,	-34.98
+5.850000,	-34.98
+5.950000,	-35.00
+6.050000,	-35.12
+6.150000,	-35.08
+6.250000,	-35.11
+6.350000,	-34.98
+6.450000,	-35.06
+6.550000,	-35.18
+6.650000,	-35.10
+6.750000,	-35.01
+6.850000,	-35.07
+6.950000,	-35.05
+7.050000,	-35.01
+7.150000,	-35.08
+7.250000,	-35.02
+7.350000,	-35.05
+7.450000,	-34.99
+7.550000,	-33.87
+7.650000,	-30.30
+7.750000,	-56.90
+7.850000,	-32.69
+7.950000,	-40.78
+8.050000,	-39.88
+8.150000,	-34.45
+8.250000,	-59.15
+8.350000,	-34.53
+8.450000,	-41.73
+8.550000,	-40.58
+8.650000,	-35.67
+8.750000,	-59.74
+8.850000,	-34.66
+8.950000,	-42.01
+9.050000,	-41.02
+9.150000,	-35.20
+9.250000,	-60.24
+9.350000,	-35.11
+9.450000,	-42.22
+9.550000,	-40.94
+9.650000,	-35.24
+9.750000,	-60.48
+9.850000,	-34.72
+9.950000,	-42.02
+10.050000,	-50.33
+10.150000,	-49.79
+10.250000,	-49.64
+10.350000,	-49.38
+10.450000,	-48.87
+10.550000,	-48.54
+10.650000,	-48.26
+10.750000,	-47.98
+10.850000,	-47.68
+10.950000,	-47.44
+11.050000,	-47.11
+11.150000,	-46.77
+11.250000,	-46.64
+11.350000,	-46.42
+11.450000,	-45.91
+11.550000,	-45.78
+11.650000,	-45.78
+11.750000,	-45.45
+11.850000,	-44.91
+11.950000,	-44.86
+12.050000,	-44.98
+12.150000,	-44.47
+12.250000,	-43.99
+12.350000,	-44.20
+12.450000,	-44.14
+12.550000,	-74.31
+12.650000,	-73.28
+12.750000,	-72.31
+12.850000,	-71.24
+12.950000,	-70.47
+13.050000,	-69.73
+13.150000,	-69.22
+13.250000,	-69.07
+13.350000,	-68.72
+13.450000,	-68.58
+13.550000,	-68.38
+13.650000,	-68.23
+13.750000,	-68.01
+13.850000,	-67.86
+13.950000,	-67.69
+14.050000,	-67.50
+14.150000,	-67.28
+14.250000,	-67.25
+14.350000,	-67.15
+14.450000,	-66.97
+14.550000,	-66.84
+14.650000,	-66.57
+14.750000,	-66.47
+14.850000,	-66.27
+14.950000,	-66.22
+15.050000,	-35.00
+15.150000,	-32.63
+15.250000,	-58.52
+15.350000,	-34.09
+15.450000,	-42.14
+15.550000,	-41.46
+15.650000,	-34.98
+15.750000,	-59.90
+15.850000,	-34.95
+15.950000,	-42.68
+16.050000,	-41.28
+16.150000,	-35.50
+16.250000,	-60.61
+16.350000,	-35.37
+16.450000,	-43.36
+16.550000,	-42.65
+16.650000,	-35.52
+16.750000,	-61.19
+16.850000,	-35.57
+16.950000,	-42.39
+17.050000,	-41.91
+17.150000,	-35.72
+17.250000,	-59.85
+17.350000,	-35.94
+17.450000,	-42.95
+17.550000,	-51.63
+17.650000,	-51.53
+17.750000,	-51.41
+17.850000,	-50.97
+17.950000,	-50.55
+18.050000,	-50.45
+18.150000,	-50.30
+18.250000,	-49.85
+18.350000,	-49.61
+18.450000,	-49.47
+18.550000,	-49.22
+18.650000,	-48.94
+18.750000,	-48.70
+18.850000,	-48.60
+18.950000,	-48.34
+19.050000,	-48.24
+19.150000,	-48.01
+19.250000,	-47.88
+19.350000,	-47.65
+19.450000,	-47.56
+19.550000,	-47.37
+19.650000,	-47.03
+19.750000,	-47.01
+19.850000,	-47.08
+19.950000,	-46.65
@@ -0,0 +1,200 @@
+0.050000,	-70.33
+0.150000,	-62.77
+0.250000,	-88.37
+0.350000,	-62.43
+0.450000,	-69.63
+0.550000,	-69.39
+0.650000,	-62.69
+0.750000,	-86.71
+0.850000,	-62.03
+0.950000,	-69.14
+1.050000,	-68.84
+1.150000,	-62.07
+1.250000,	-86.98
+1.350000,	-62.11
+1.450000,	-68.36
+1.550000,	-67.65
+1.650000,	-61.65
+1.750000,	-86.15
+1.850000,	-61.17
+1.950000,	-68.03
+2.050000,	-68.06
+2.150000,	-61.10
+2.250000,	-84.96
+2.350000,	-60.50
+2.450000,	-66.83
+2.550000,	-46.79
+2.650000,	-47.45
+2.750000,	-47.37
+2.850000,	-47.30
+2.950000,	-47.49
+3.050000,	-47.69
+3.150000,	-47.71
+3.250000,	-47.60
+3.350000,	-47.52
+3.450000,	-47.74
+3.550000,	-47.75
+3.650000,	-47.44
+3.750000,	-47.48
+3.850000,	-47.75
+3.950000,	-47.79
+4.050000,	-47.42
+4.150000,	-47.59
+4.250000,	-47.82
+4.350000,	-47.73
+4.450000,	-47.34
+4.550000,	-47.58
+4.650000,	-47.88
+4.750000,	-47.66
+4.850000,	-47.51
+4.950000,	-47.59
+5.050000,	-32.14
+5.150000,	-33.91
+5.250000,	-34.55
+5.350000,	-34.92
+5.450000,	-34.76
+5.550000,	-34.92
+5.650000,	-35.04
+5.750000,	-35.12
+5.850000,	-35.07
+5.950000,	-35.05
+6.050000,	-35.15
+6.150000,	-35.13
+6.250000,	-35.01
+6.350000,	-34.96
+6.450000,	-35.00
+6.550000,	-35.06
+6.650000,	-35.05
+6.750000,	-35.04
+6.850000,	-35.03
+6.950000,	-34.99
+7.050000,	-35.14
+7.150000,	-35.02
+7.250000,	-35.00
+7.350000,	-35.07
+7.450000,	-35.00
+7.550000,	-34.17
+7.650000,	-30.28
+7.750000,	-56.77
+7.850000,	-32.39
+7.950000,	-41.01
+8.050000,	-40.38
+8.150000,	-34.40
+8.250000,	-60.06
+8.350000,	-34.58
+8.450000,	-41.92
+8.550000,	-40.62
+8.650000,	-35.21
+8.750000,	-60.66
+8.850000,	-35.32
+8.950000,	-42.40
+9.050000,	-41.17
+9.150000,	-35.51
+9.250000,	-59.90
+9.350000,	-35.07
+9.450000,	-41.85
+9.550000,	-41.18
+9.650000,	-35.23
+9.750000,	-61.07
+9.850000,	-34.94
+9.950000,	-42.74
+10.050000,	-50.32
+10.150000,	-49.72
+10.250000,	-49.70
+10.350000,	-49.35
+10.450000,	-48.98
+10.550000,	-48.54
+10.650000,	-48.35
+10.750000,	-48.00
+10.850000,	-47.67
+10.950000,	-47.38
+11.050000,	-47.02
+11.150000,	-46.81
+11.250000,	-46.68
+11.350000,	-46.39
+11.450000,	-46.03
+11.550000,	-45.77
+11.650000,	-45.76
+11.750000,	-45.49
+11.850000,	-44.90
+11.950000,	-44.93
+12.050000,	-44.96
+12.150000,	-44.49
+12.250000,	-44.05
+12.350000,	-44.21
+12.450000,	-44.16
+12.550000,	-74.34
+12.650000,	-73.17
+12.750000,	-72.17
+12.850000,	-71.21
+12.950000,	-70.37
+13.050000,	-69.72
+13.150000,	-69.19
+13.250000,	-69.01
+13.350000,	-68.76
+13.450000,	-68.52
+13.550000,	-68.42
+13.650000,	-68.23
+13.750000,	-68.06
+13.850000,	-67.85
+13.950000,	-67.64
+14.050000,	-67.50
+14.150000,	-67.36
+14.250000,	-67.17
+14.350000,	-67.05
+14.450000,	-66.85
+14.550000,	-66.67
+14.650000,	-66.72
+14.750000,	-66.47
+14.850000,	-66.43
+14.950000,	-66.27
+15.050000,	-35.08
+15.150000,	-33.55
+15.250000,	-58.91
+15.350000,	-34.08
+15.450000,	-41.74
+15.550000,	-41.80
+15.650000,	-34.72
+15.750000,	-60.47
+15.850000,	-35.13
+15.950000,	-42.64
+16.050000,	-41.41
+16.150000,	-35.81
+16.250000,	-60.72
+16.350000,	-35.20
+16.450000,	-42.52
+16.550000,	-41.28
+16.650000,	-35.85
+16.750000,	-60.54
+16.850000,	-35.48
+16.950000,	-43.26
+17.050000,	-41.67
+17.150000,	-35.84
+17.250000,	-61.07
+17.350000,	-35.64
+17.450000,	-43.24
+17.550000,	-51.70
+17.650000,	-51.61
+17.750000,	-51.49
+17.850000,	-50.95
+17.950000,	-50.55
+18.050000,	-50.47
+18.150000,	-50.33
+18.250000,	-49.88
+18.350000,	-49.50
+18.450000,	-49.46
+18.550000,	-49.25
+18.650000,	-48.98
+18.750000,	-48.63
+18.850000,	-48.58
+18.950000,	-48.42
+19.050000,	-48.22
+19.150000,	-48.03
+19.250000,	-47.88
+19.350000,	-47.66
+19.450000,	-47.57
+19.550000,	-47.33
+19.650000,	-46.96
+19.750000,	-47.01
+19.850000,	-47.08
+19.950000,	-46.63
@@ -0,0 +1,200 @@
+0.050000,	-64.90
+0.150000,	-58.45
+0.250000,	-83.17
+0.350000,	-58.37
+0.450000,	-64.87
+0.550000,	-64.24
+0.650000,	-57.82
+0.750000,	-81.56
+0.850000,	-57.09
+0.950000,	-64.89
+1.050000,	-64.53
+1.150000,	-57.26
+1.250000,	-81.93
+1.350000,	-56.95
+1.450000,	-63.43
+1.550000,	-63.34
+1.650000,	-56.73
+1.750000,	-80.97
+1.850000,	-56.51
+1.950000,	-63.17
+2.050000,	-62.58
+2.150000,	-56.18
+2.250000,	-80.41
+2.350000,	-56.06
+2.450000,	-63.08
+2.550000,	-42.21
+2.650000,	-42.67
+2.750000,	-42.80
+2.850000,	-42.73
+2.950000,	-42.72
+3.050000,	-42.80
+3.150000,	-42.84
+3.250000,	-42.80
+3.350000,	-42.61
+3.450000,	-42.89
+3.550000,	-42.87
+3.650000,	-42.64
+3.750000,	-42.58
+3.850000,	-42.96
+3.950000,	-42.89
+4.050000,	-42.53
+4.150000,	-42.75
+4.250000,	-43.03
+4.350000,	-42.82
+4.450000,	-42.58
+4.550000,	-42.74
+4.650000,	-42.97
+4.750000,	-42.73
+4.850000,	-42.62
+4.950000,	-42.80
+5.050000,	-26.49
+5.150000,	-27.22
+5.250000,	-27.46
+5.350000,	-27.60
+5.450000,	-27.44
+5.550000,	-27.50
+5.650000,	-27.54
+5.750000,	-27.60
+5.850000,	-27.70
+5.950000,	-27.71
+6.050000,	-27.64
+6.150000,	-27.64
+6.250000,	-27.75
+6.350000,	-27.63
+6.450000,	-27.71
+6.550000,	-27.72
+6.650000,	-27.63
+6.750000,	-27.82
+6.850000,	-27.73
+6.950000,	-27.66
+7.050000,	-27.70
+7.150000,	-27.81
+7.250000,	-27.63
+7.350000,	-27.68
+7.450000,	-27.74
+7.550000,	-26.62
+7.650000,	-21.32
+7.750000,	-47.18
+7.850000,	-22.70
+7.950000,	-30.22
+8.050000,	-29.38
+8.150000,	-23.20
+8.250000,	-48.74
+8.350000,	-23.11
+8.450000,	-30.11
+8.550000,	-28.78
+8.650000,	-23.54
+8.750000,	-49.23
+8.850000,	-23.13
+8.950000,	-30.21
+9.050000,	-30.00
+9.150000,	-23.77
+9.250000,	-48.46
+9.350000,	-23.54
+9.450000,	-30.16
+9.550000,	-29.99
+9.650000,	-23.79
+9.750000,	-48.73
+9.850000,	-23.91
+9.950000,	-30.20
+10.050000,	-39.10
+10.150000,	-38.61
+10.250000,	-38.70
+10.350000,	-38.61
+10.450000,	-38.24
+10.550000,	-38.06
+10.650000,	-37.93
+10.750000,	-37.79
+10.850000,	-37.55
+10.950000,	-37.53
+11.050000,	-37.17
+11.150000,	-37.08
+11.250000,	-37.17
+11.350000,	-36.89
+11.450000,	-36.58
+11.550000,	-36.61
+11.650000,	-36.69
+11.750000,	-36.45
+11.850000,	-36.03
+11.950000,	-36.11
+12.050000,	-36.24
+12.150000,	-35.92
+12.250000,	-35.61
+12.350000,	-35.83
+12.450000,	-35.79
+12.550000,	-66.23
+12.650000,	-65.25
+12.750000,	-64.32
+12.850000,	-63.67
+12.950000,	-63.05
+13.050000,	-62.37
+13.150000,	-62.14
+13.250000,	-62.04
+13.350000,	-61.86
+13.450000,	-61.72
+13.550000,	-61.64
+13.650000,	-61.59
+13.750000,	-61.55
+13.850000,	-61.38
+13.950000,	-61.19
+14.050000,	-61.08
+14.150000,	-61.03
+14.250000,	-60.90
+14.350000,	-60.77
+14.450000,	-60.69
+14.550000,	-60.42
+14.650000,	-60.42
+14.750000,	-60.41
+14.850000,	-60.12
+14.950000,	-60.11
+15.050000,	-28.90
+15.150000,	-24.62
+15.250000,	-50.02
+15.350000,	-25.26
+15.450000,	-32.12
+15.550000,	-31.17
+15.650000,	-26.02
+15.750000,	-49.48
+15.850000,	-25.58
+15.950000,	-32.82
+16.050000,	-31.69
+16.150000,	-25.80
+16.250000,	-51.04
+16.350000,	-25.49
+16.450000,	-33.24
+16.550000,	-31.93
+16.650000,	-26.07
+16.750000,	-51.17
+16.850000,	-25.52
+16.950000,	-32.14
+17.050000,	-31.81
+17.150000,	-25.80
+17.250000,	-50.88
+17.350000,	-25.19
+17.450000,	-32.81
+17.550000,	-41.93
+17.650000,	-41.98
+17.750000,	-42.06
+17.850000,	-41.56
+17.950000,	-41.35
+18.050000,	-41.43
+18.150000,	-41.44
+18.250000,	-41.15
+18.350000,	-41.08
+18.450000,	-41.06
+18.550000,	-40.85
+18.650000,	-40.77
+18.750000,	-40.57
+18.850000,	-40.63
+18.950000,	-40.60
+19.050000,	-40.52
+19.150000,	-40.36
+19.250000,	-40.22
+19.350000,	-40.16
+19.450000,	-40.24
+19.550000,	-40.09
+19.650000,	-39.76
+19.750000,	-39.99
+19.850000,	-39.94
+19.950000,	-39.68
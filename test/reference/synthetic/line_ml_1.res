@@ -0,0 +1,200 @@
+0.050000,	-65.22
+0.150000,	-58.06
+0.250000,	-82.83
+0.350000,	-58.30
+0.450000,	-64.81
+0.550000,	-64.63
+0.650000,	-57.76
+0.750000,	-82.15
+0.850000,	-56.95
+0.950000,	-64.37
+1.050000,	-63.60
+1.150000,	-56.92
+1.250000,	-82.33
+1.350000,	-57.07
+1.450000,	-63.90
+1.550000,	-64.08
+1.650000,	-56.30
+1.750000,	-81.22
+1.850000,	-56.41
+1.950000,	-62.89
+2.050000,	-63.13
+2.150000,	-56.56
+2.250000,	-80.13
+2.350000,	-55.90
+2.450000,	-62.53
+2.550000,	-42.29
+2.650000,	-42.72
+2.750000,	-42.76
+2.850000,	-42.74
+2.950000,	-42.74
+3.050000,	-42.82
+3.150000,	-42.82
+3.250000,	-42.68
+3.350000,	-42.63
+3.450000,	-42.92
+3.550000,	-42.96
+3.650000,	-42.59
+3.750000,	-42.64
+3.850000,	-42.92
+3.950000,	-42.85
+4.050000,	-42.53
+4.150000,	-42.74
+4.250000,	-42.95
+4.350000,	-42.89
+4.450000,	-42.50
+4.550000,	-42.75
+4.650000,	-43.00
+4.750000,	-42.69
+4.850000,	-42.75
+4.950000,	-42.79
+5.050000,	-26.56
+5.150000,	-27.24
+5.250000,	-27.37
+5.350000,	-27.45
+5.450000,	-27.57
+5.550000,	-27.47
+5.650000,	-27.50
+5.750000,	-27.63
+5.850000,	-27.66
+5.950000,	-27.72
+6.050000,	-27.73
+6.150000,	-27.75
+6.250000,	-27.77
+6.350000,	-27.71
+6.450000,	-27.70
+6.550000,	-27.74
+6.650000,	-27.78
+6.750000,	-27.71
+6.850000,	-27.63
+6.950000,	-27.77
+7.050000,	-27.68
+7.150000,	-27.74
+7.250000,	-27.71
+7.350000,	-27.63
+7.450000,	-27.66
+7.550000,	-26.64
+7.650000,	-21.78
+7.750000,	-47.38
+7.850000,	-22.97
+7.950000,	-29.43
+8.050000,	-28.90
+8.150000,	-24.20
+8.250000,	-47.78
+8.350000,	-23.19
+8.450000,	-30.89
+8.550000,	-29.83
+8.650000,	-23.79
+8.750000,	-48.45
+8.850000,	-23.41
+8.950000,	-30.61
+9.050000,	-30.58
+9.150000,	-23.61
+9.250000,	-48.24
+9.350000,	-23.58
+9.450000,	-30.33
+9.550000,	-29.55
+9.650000,	-23.42
+9.750000,	-48.44
+9.850000,	-23.89
+9.950000,	-30.28
+10.050000,	-38.93
+10.150000,	-38.60
+10.250000,	-38.66
+10.350000,	-38.62
+10.450000,	-38.28
+10.550000,	-38.06
+10.650000,	-37.94
+10.750000,	-37.80
+10.850000,	-37.67
+10.950000,	-37.42
+11.050000,	-37.21
+11.150000,	-37.11
+11.250000,	-37.10
+11.350000,	-36.90
+11.450000,	-36.69
+11.550000,	-36.65
+11.650000,	-36.67
+11.750000,	-36.44
+11.850000,	-36.02
+11.950000,	-36.19
+12.050000,	-36.19
+12.150000,	-35.96
+12.250000,	-35.58
+12.350000,	-35.83
+12.450000,	-35.83
+12.550000,	-66.17
+12.650000,	-65.26
+12.750000,	-64.51
+12.850000,	-63.71
+12.950000,	-63.15
+13.050000,	-62.29
+13.150000,	-62.01
+13.250000,	-61.99
+13.350000,	-61.86
+13.450000,	-61.85
+13.550000,	-61.63
+13.650000,	-61.50
+13.750000,	-61.46
+13.850000,	-61.35
+13.950000,	-61.30
+14.050000,	-61.13
+14.150000,	-60.98
+14.250000,	-60.85
+14.350000,	-60.76
+14.450000,	-60.62
+14.550000,	-60.48
+14.650000,	-60.46
+14.750000,	-60.25
+14.850000,	-60.16
+14.950000,	-60.00
+15.050000,	-28.43
+15.150000,	-24.59
+15.250000,	-49.69
+15.350000,	-25.08
+15.450000,	-32.24
+15.550000,	-31.51
+15.650000,	-26.07
+15.750000,	-51.79
+15.850000,	-25.59
+15.950000,	-32.89
+16.050000,	-32.48
+16.150000,	-25.54
+16.250000,	-51.66
+16.350000,	-25.90
+16.450000,	-32.74
+16.550000,	-32.31
+16.650000,	-25.97
+16.750000,	-50.99
+16.850000,	-25.61
+16.950000,	-33.01
+17.050000,	-31.57
+17.150000,	-25.97
+17.250000,	-51.34
+17.350000,	-26.22
+17.450000,	-32.90
+17.550000,	-41.90
+17.650000,	-42.04
+17.750000,	-41.99
+17.850000,	-41.59
+17.950000,	-41.43
+18.050000,	-41.53
+18.150000,	-41.52
+18.250000,	-41.18
+18.350000,	-40.97
+18.450000,	-41.10
+18.550000,	-40.94
+18.650000,	-40.81
+18.750000,	-40.66
+18.850000,	-40.59
+18.950000,	-40.55
+19.050000,	-40.49
+19.150000,	-40.41
+19.250000,	-40.25
+19.350000,	-40.16
+19.450000,	-40.22
+19.550000,	-40.10
+19.650000,	-39.81
+19.750000,	-39.92
+19.850000,	-39.99
+19.950000,	-39.64
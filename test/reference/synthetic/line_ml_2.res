@@ -0,0 +1,200 @@
+0.050000,	-62.15
+0.150000,	-54.97
+0.250000,	-80.38
+0.350000,	-54.56
+0.450000,	-62.44
+0.550000,	-61.09
+0.650000,	-54.51
+0.750000,	-79.38
+0.850000,	-54.98
+0.950000,	-60.62
+1.050000,	-60.31
+1.150000,	-54.17
+1.250000,	-78.89
+1.350000,	-53.87
+1.450000,	-60.56
+1.550000,	-60.33
+1.650000,	-53.55
+1.750000,	-78.32
+1.850000,	-53.56
+1.950000,	-59.96
+2.050000,	-59.12
+2.150000,	-53.12
+2.250000,	-77.76
+2.350000,	-53.00
+2.450000,	-59.70
+2.550000,	-39.15
+2.650000,	-39.58
+2.750000,	-39.69
+2.850000,	-39.62
+2.950000,	-39.59
+3.050000,	-39.69
+3.150000,	-39.76
+3.250000,	-39.67
+3.350000,	-39.54
+3.450000,	-39.76
+3.550000,	-39.85
+3.650000,	-39.52
+3.750000,	-39.54
+3.850000,	-39.84
+3.950000,	-39.84
+4.050000,	-39.44
+4.150000,	-39.59
+4.250000,	-39.96
+4.350000,	-39.73
+4.450000,	-39.46
+4.550000,	-39.66
+4.650000,	-39.84
+4.750000,	-39.64
+4.850000,	-39.61
+4.950000,	-39.69
+5.050000,	-23.36
+5.150000,	-24.17
+5.250000,	-24.31
+5.350000,	-24.41
+5.450000,	-24.47
+5.550000,	-24.47
+5.650000,	-24.45
+5.750000,	-24.58
+5.850000,	-24.64
+5.950000,	-24.65
+6.050000,	-24.65
+6.150000,	-24.59
+6.250000,	-24.54
+6.350000,	-24.60
+6.450000,	-24.52
+6.550000,	-24.65
+6.650000,	-24.66
+6.750000,	-24.55
+6.850000,	-24.66
+6.950000,	-24.62
+7.050000,	-24.60
+7.150000,	-24.67
+7.250000,	-24.56
+7.350000,	-24.60
+7.450000,	-24.58
+7.550000,	-22.67
+7.650000,	-18.33
+7.750000,	-44.45
+7.850000,	-19.46
+7.950000,	-27.19
+8.050000,	-25.80
+8.150000,	-20.50
+8.250000,	-45.12
+8.350000,	-20.43
+8.450000,	-27.39
+8.550000,	-26.20
+8.650000,	-20.54
+8.750000,	-45.91
+8.850000,	-20.33
+8.950000,	-27.41
+9.050000,	-26.50
+9.150000,	-20.68
+9.250000,	-45.83
+9.350000,	-20.41
+9.450000,	-27.96
+9.550000,	-26.96
+9.650000,	-20.60
+9.750000,	-45.60
+9.850000,	-20.31
+9.950000,	-26.76
+10.050000,	-35.85
+10.150000,	-35.46
+10.250000,	-35.49
+10.350000,	-35.55
+10.450000,	-35.19
+10.550000,	-35.01
+10.650000,	-34.85
+10.750000,	-34.70
+10.850000,	-34.52
+10.950000,	-34.39
+11.050000,	-34.18
+11.150000,	-33.91
+11.250000,	-34.05
+11.350000,	-33.88
+11.450000,	-33.53
+11.550000,	-33.50
+11.650000,	-33.63
+11.750000,	-33.31
+11.850000,	-32.93
+11.950000,	-33.04
+12.050000,	-33.21
+12.150000,	-32.89
+12.250000,	-32.49
+12.350000,	-32.75
+12.450000,	-32.82
+12.550000,	-63.11
+12.650000,	-62.20
+12.750000,	-61.18
+12.850000,	-60.69
+12.950000,	-60.06
+13.050000,	-59.28
+13.150000,	-59.10
+13.250000,	-58.97
+13.350000,	-58.74
+13.450000,	-58.77
+13.550000,	-58.61
+13.650000,	-58.54
+13.750000,	-58.38
+13.850000,	-58.27
+13.950000,	-58.12
+14.050000,	-58.04
+14.150000,	-58.06
+14.250000,	-57.85
+14.350000,	-57.70
+14.450000,	-57.51
+14.550000,	-57.48
+14.650000,	-57.33
+14.750000,	-57.17
+14.850000,	-57.04
+14.950000,	-56.96
+15.050000,	-25.05
+15.150000,	-21.18
+15.250000,	-46.87
+15.350000,	-21.71
+15.450000,	-29.35
+15.550000,	-28.34
+15.650000,	-22.73
+15.750000,	-46.52
+15.850000,	-22.12
+15.950000,	-29.64
+16.050000,	-29.04
+16.150000,	-22.93
+16.250000,	-47.78
+16.350000,	-22.14
+16.450000,	-29.98
+16.550000,	-28.96
+16.650000,	-22.61
+16.750000,	-48.42
+16.850000,	-22.89
+16.950000,	-30.14
+17.050000,	-29.05
+17.150000,	-22.51
+17.250000,	-48.08
+17.350000,	-22.48
+17.450000,	-30.02
+17.550000,	-38.76
+17.650000,	-38.89
+17.750000,	-38.95
+17.850000,	-38.57
+17.950000,	-38.34
+18.050000,	-38.40
+18.150000,	-38.42
+18.250000,	-38.02
+18.350000,	-37.88
+18.450000,	-38.01
+18.550000,	-37.93
+18.650000,	-37.71
+18.750000,	-37.59
+18.850000,	-37.53
+18.950000,	-37.46
+19.050000,	-37.33
+19.150000,	-37.21
+19.250000,	-37.16
+19.350000,	-37.10
+19.450000,	-37.07
+19.550000,	-36.94
+19.650000,	-36.65
+19.750000,	-36.84
+19.850000,	-36.96
+19.950000,	-36.47
@@ -0,0 +1,200 @@
+0.050000,	-69.61
+0.150000,	-63.15
+0.250000,	-87.36
+0.350000,	-63.39
+0.450000,	-69.95
+0.550000,	-69.26
+0.650000,	-62.58
+0.750000,	-86.68
+0.850000,	-62.80
+0.950000,	-69.26
+1.050000,	-68.87
+1.150000,	-61.87
+1.250000,	-86.25
+1.350000,	-61.51
+1.450000,	-67.60
+1.550000,	-67.63
+1.650000,	-61.49
+1.750000,	-86.26
+1.850000,	-60.93
+1.950000,	-67.41
+2.050000,	-67.22
+2.150000,	-61.14
+2.250000,	-85.73
+2.350000,	-60.91
+2.450000,	-67.27
+2.550000,	-47.16
+2.650000,	-47.44
+2.750000,	-47.65
+2.850000,	-47.63
+2.950000,	-47.57
+3.050000,	-47.69
+3.150000,	-47.81
+3.250000,	-47.61
+3.350000,	-47.47
+3.450000,	-47.82
+3.550000,	-47.79
+3.650000,	-47.49
+3.750000,	-47.54
+3.850000,	-47.74
+3.950000,	-47.74
+4.050000,	-47.42
+4.150000,	-47.59
+4.250000,	-47.87
+4.350000,	-47.74
+4.450000,	-47.36
+4.550000,	-47.65
+4.650000,	-47.87
+4.750000,	-47.64
+4.850000,	-47.48
+4.950000,	-47.65
+5.050000,	-31.42
+5.150000,	-32.07
+5.250000,	-32.22
+5.350000,	-32.44
+5.450000,	-32.55
+5.550000,	-32.44
+5.650000,	-32.44
+5.750000,	-32.36
+5.850000,	-32.48
+5.950000,	-32.50
+6.050000,	-32.62
+6.150000,	-32.58
+6.250000,	-32.61
+6.350000,	-32.48
+6.450000,	-32.56
+6.550000,	-32.68
+6.650000,	-32.60
+6.750000,	-32.51
+6.850000,	-32.57
+6.950000,	-32.55
+7.050000,	-32.52
+7.150000,	-32.58
+7.250000,	-32.52
+7.350000,	-32.55
+7.450000,	-32.49
+7.550000,	-30.92
+7.650000,	-26.10
+7.750000,	-51.99
+7.850000,	-27.36
+7.950000,	-34.82
+8.050000,	-34.16
+8.150000,	-28.34
+8.250000,	-52.87
+8.350000,	-28.32
+8.450000,	-35.11
+8.550000,	-34.32
+8.650000,	-29.21
+8.750000,	-53.29
+8.850000,	-28.23
+8.950000,	-35.38
+9.050000,	-34.75
+9.150000,	-28.67
+9.250000,	-53.71
+9.350000,	-28.60
+9.450000,	-35.44
+9.550000,	-34.60
+9.650000,	-28.65
+9.750000,	-53.94
+9.850000,	-28.28
+9.950000,	-35.24
+10.050000,	-43.86
+10.150000,	-43.51
+10.250000,	-43.53
+10.350000,	-43.46
+10.450000,	-43.07
+10.550000,	-42.89
+10.650000,	-42.79
+10.750000,	-42.67
+10.850000,	-42.47
+10.950000,	-42.39
+11.050000,	-42.19
+11.150000,	-41.96
+11.250000,	-42.01
+11.350000,	-41.85
+11.450000,	-41.46
+11.550000,	-41.48
+11.650000,	-41.56
+11.750000,	-41.39
+11.850000,	-40.86
+11.950000,	-40.99
+12.050000,	-41.14
+12.150000,	-40.76
+12.250000,	-40.35
+12.350000,	-40.67
+12.450000,	-40.66
+12.550000,	-70.95
+12.650000,	-70.08
+12.750000,	-69.29
+12.850000,	-68.45
+12.950000,	-67.83
+13.050000,	-67.21
+13.150000,	-66.94
+13.250000,	-66.95
+13.350000,	-66.68
+13.450000,	-66.56
+13.550000,	-66.47
+13.650000,	-66.37
+13.750000,	-66.21
+13.850000,	-66.14
+13.950000,	-66.07
+14.050000,	-65.83
+14.150000,	-65.74
+14.250000,	-65.73
+14.350000,	-65.63
+14.450000,	-65.54
+14.550000,	-65.38
+14.650000,	-65.13
+14.750000,	-65.10
+14.850000,	-64.86
+14.950000,	-64.85
+15.050000,	-33.20
+15.150000,	-29.04
+15.250000,	-54.56
+15.350000,	-29.86
+15.450000,	-37.59
+15.550000,	-37.13
+15.650000,	-30.37
+15.750000,	-55.32
+15.850000,	-30.25
+15.950000,	-37.76
+16.050000,	-36.46
+16.150000,	-30.57
+16.250000,	-55.65
+16.350000,	-30.49
+16.450000,	-38.47
+16.550000,	-37.75
+16.650000,	-30.53
+16.750000,	-56.25
+16.850000,	-30.66
+16.950000,	-37.26
+17.050000,	-37.05
+17.150000,	-30.71
+17.250000,	-54.91
+17.350000,	-31.00
+17.450000,	-37.60
+17.550000,	-46.73
+17.650000,	-46.82
+17.750000,	-46.86
+17.850000,	-46.54
+17.950000,	-46.31
+18.050000,	-46.34
+18.150000,	-46.35
+18.250000,	-46.04
+18.350000,	-45.91
+18.450000,	-45.94
+18.550000,	-45.79
+18.650000,	-45.66
+18.750000,	-45.50
+18.850000,	-45.49
+18.950000,	-45.31
+19.050000,	-45.38
+19.150000,	-45.18
+19.250000,	-45.15
+19.350000,	-45.06
+19.450000,	-45.03
+19.550000,	-44.97
+19.650000,	-44.65
+19.750000,	-44.82
+19.850000,	-44.87
+19.950000,	-44.54
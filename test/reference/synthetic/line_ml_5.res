@@ -0,0 +1,200 @@
+0.050000,	-70.33
+0.150000,	-62.77
+0.250000,	-88.37
+0.350000,	-62.43
+0.450000,	-69.63
+0.550000,	-69.39
+0.650000,	-62.69
+0.750000,	-86.71
+0.850000,	-62.03
+0.950000,	-69.29
+1.050000,	-68.84
+1.150000,	-62.20
+1.250000,	-86.98
+1.350000,	-62.11
+1.450000,	-68.36
+1.550000,	-67.65
+1.650000,	-61.65
+1.750000,	-86.15
+1.850000,	-61.17
+1.950000,	-68.19
+2.050000,	-68.13
+2.150000,	-61.31
+2.250000,	-84.96
+2.350000,	-60.62
+2.450000,	-67.03
+2.550000,	-47.08
+2.650000,	-47.59
+2.750000,	-47.64
+2.850000,	-47.57
+2.950000,	-47.68
+3.050000,	-47.69
+3.150000,	-47.71
+3.250000,	-47.60
+3.350000,	-47.52
+3.450000,	-47.74
+3.550000,	-47.75
+3.650000,	-47.44
+3.750000,	-47.48
+3.850000,	-47.75
+3.950000,	-47.79
+4.050000,	-47.42
+4.150000,	-47.59
+4.250000,	-47.82
+4.350000,	-47.73
+4.450000,	-47.34
+4.550000,	-47.58
+4.650000,	-47.88
+4.750000,	-47.66
+4.850000,	-47.51
+4.950000,	-47.59
+5.050000,	-31.32
+5.150000,	-31.99
+5.250000,	-32.24
+5.350000,	-32.47
+5.450000,	-32.31
+5.550000,	-32.36
+5.650000,	-32.38
+5.750000,	-32.50
+5.850000,	-32.57
+5.950000,	-32.55
+6.050000,	-32.65
+6.150000,	-32.63
+6.250000,	-32.51
+6.350000,	-32.46
+6.450000,	-32.51
+6.550000,	-32.56
+6.650000,	-32.55
+6.750000,	-32.54
+6.850000,	-32.53
+6.950000,	-32.49
+7.050000,	-32.64
+7.150000,	-32.53
+7.250000,	-32.50
+7.350000,	-32.57
+7.450000,	-32.50
+7.550000,	-31.26
+7.650000,	-26.07
+7.750000,	-51.89
+7.850000,	-27.05
+7.950000,	-35.06
+8.050000,	-34.67
+8.150000,	-28.28
+8.250000,	-53.78
+8.350000,	-28.38
+8.450000,	-35.30
+8.550000,	-34.37
+8.650000,	-28.74
+8.750000,	-54.24
+8.850000,	-28.91
+8.950000,	-35.77
+9.050000,	-34.91
+9.150000,	-28.97
+9.250000,	-53.39
+9.350000,	-28.55
+9.450000,	-35.06
+9.550000,	-34.84
+9.650000,	-28.62
+9.750000,	-54.57
+9.850000,	-28.52
+9.950000,	-35.96
+10.050000,	-43.85
+10.150000,	-43.44
+10.250000,	-43.59
+10.350000,	-43.43
+10.450000,	-43.18
+10.550000,	-42.89
+10.650000,	-42.88
+10.750000,	-42.69
+10.850000,	-42.46
+10.950000,	-42.34
+11.050000,	-42.10
+11.150000,	-42.00
+11.250000,	-42.04
+11.350000,	-41.82
+11.450000,	-41.58
+11.550000,	-41.47
+11.650000,	-41.54
+11.750000,	-41.42
+11.850000,	-40.85
+11.950000,	-41.05
+12.050000,	-41.12
+12.150000,	-40.78
+12.250000,	-40.41
+12.350000,	-40.67
+12.450000,	-40.67
+12.550000,	-70.99
+12.650000,	-69.98
+12.750000,	-69.15
+12.850000,	-68.42
+12.950000,	-67.73
+13.050000,	-67.18
+13.150000,	-66.92
+13.250000,	-66.89
+13.350000,	-66.71
+13.450000,	-66.51
+13.550000,	-66.50
+13.650000,	-66.37
+13.750000,	-66.25
+13.850000,	-66.13
+13.950000,	-66.02
+14.050000,	-65.82
+14.150000,	-65.81
+14.250000,	-65.65
+14.350000,	-65.54
+14.450000,	-65.42
+14.550000,	-65.20
+14.650000,	-65.27
+14.750000,	-65.10
+14.850000,	-65.03
+14.950000,	-64.91
+15.050000,	-33.22
+15.150000,	-29.93
+15.250000,	-54.95
+15.350000,	-29.82
+15.450000,	-37.19
+15.550000,	-37.47
+15.650000,	-30.11
+15.750000,	-55.89
+15.850000,	-30.43
+15.950000,	-37.72
+16.050000,	-36.60
+16.150000,	-30.87
+16.250000,	-55.76
+16.350000,	-30.32
+16.450000,	-37.63
+16.550000,	-36.38
+16.650000,	-30.86
+16.750000,	-55.56
+16.850000,	-30.55
+16.950000,	-38.13
+17.050000,	-36.81
+17.150000,	-30.83
+17.250000,	-56.09
+17.350000,	-30.70
+17.450000,	-37.90
+17.550000,	-46.80
+17.650000,	-46.89
+17.750000,	-46.95
+17.850000,	-46.51
+17.950000,	-46.31
+18.050000,	-46.37
+18.150000,	-46.38
+18.250000,	-46.07
+18.350000,	-45.80
+18.450000,	-45.93
+18.550000,	-45.82
+18.650000,	-45.70
+18.750000,	-45.43
+18.850000,	-45.47
+18.950000,	-45.39
+19.050000,	-45.36
+19.150000,	-45.19
+19.250000,	-45.15
+19.350000,	-45.07
+19.450000,	-45.04
+19.550000,	-44.93
+19.650000,	-44.58
+19.750000,	-44.81
+19.850000,	-44.87
+19.950000,	-44.52
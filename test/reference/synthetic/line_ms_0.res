@@ -0,0 +1,200 @@
+0.050000,	-64.90
+0.150000,	-58.45
+0.250000,	-83.17
+0.350000,	-58.37
+0.450000,	-64.87
+0.550000,	-64.24
+0.650000,	-57.82
+0.750000,	-81.67
+0.850000,	-57.09
+0.950000,	-64.92
+1.050000,	-64.53
+1.150000,	-57.31
+1.250000,	-82.07
+1.350000,	-57.17
+1.450000,	-63.67
+1.550000,	-63.56
+1.650000,	-56.96
+1.750000,	-81.21
+1.850000,	-56.72
+1.950000,	-63.39
+2.050000,	-62.80
+2.150000,	-56.39
+2.250000,	-80.84
+2.350000,	-56.35
+2.450000,	-63.29
+2.550000,	-42.10
+2.650000,	-42.53
+2.750000,	-42.54
+2.850000,	-42.46
+2.950000,	-42.63
+3.050000,	-42.80
+3.150000,	-42.84
+3.250000,	-42.80
+3.350000,	-42.61
+3.450000,	-42.89
+3.550000,	-42.87
+3.650000,	-42.64
+3.750000,	-42.58
+3.850000,	-42.96
+3.950000,	-42.89
+4.050000,	-42.53
+4.150000,	-42.75
+4.250000,	-43.03
+4.350000,	-42.82
+4.450000,	-42.58
+4.550000,	-42.74
+4.650000,	-42.97
+4.750000,	-42.73
+4.850000,	-42.62
+4.950000,	-42.80
+5.050000,	-27.39
+5.150000,	-29.13
+5.250000,	-29.76
+5.350000,	-30.04
+5.450000,	-29.89
+5.550000,	-30.05
+5.650000,	-30.21
+5.750000,	-30.22
+5.850000,	-30.19
+5.950000,	-30.21
+6.050000,	-30.14
+6.150000,	-30.14
+6.250000,	-30.25
+6.350000,	-30.13
+6.450000,	-30.21
+6.550000,	-30.22
+6.650000,	-30.13
+6.750000,	-30.32
+6.850000,	-30.23
+6.950000,	-30.16
+7.050000,	-30.20
+7.150000,	-30.31
+7.250000,	-30.13
+7.350000,	-30.18
+7.450000,	-30.24
+7.550000,	-29.25
+7.650000,	-25.35
+7.750000,	-51.84
+7.850000,	-27.80
+7.950000,	-36.16
+8.050000,	-34.85
+8.150000,	-29.13
+8.250000,	-54.73
+8.350000,	-29.14
+8.450000,	-36.57
+8.550000,	-34.67
+8.650000,	-29.82
+8.750000,	-55.35
+8.850000,	-29.27
+8.950000,	-36.69
+9.050000,	-35.95
+9.150000,	-30.07
+9.250000,	-54.68
+9.350000,	-29.74
+9.450000,	-36.63
+9.550000,	-35.95
+9.650000,	-30.16
+9.750000,	-55.00
+9.850000,	-30.13
+9.950000,	-36.78
+10.050000,	-45.40
+10.150000,	-44.99
+10.250000,	-45.14
+10.350000,	-45.08
+10.450000,	-44.81
+10.550000,	-44.80
+10.650000,	-44.68
+10.750000,	-44.56
+10.850000,	-44.52
+10.950000,	-44.35
+11.050000,	-44.15
+11.150000,	-44.10
+11.250000,	-44.15
+11.350000,	-44.07
+11.450000,	-43.63
+11.550000,	-43.76
+11.650000,	-43.86
+11.750000,	-43.57
+11.850000,	-43.32
+11.950000,	-43.26
+12.050000,	-43.53
+12.150000,	-43.11
+12.250000,	-42.87
+12.350000,	-43.09
+12.450000,	-43.03
+12.550000,	-72.86
+12.650000,	-70.82
+12.750000,	-68.97
+12.850000,	-67.37
+12.950000,	-65.93
+13.050000,	-64.54
+13.150000,	-63.44
+13.250000,	-62.45
+13.350000,	-62.11
+13.450000,	-62.02
+13.550000,	-61.92
+13.650000,	-61.90
+13.750000,	-61.85
+13.850000,	-61.73
+13.950000,	-61.51
+14.050000,	-61.47
+14.150000,	-61.41
+14.250000,	-61.29
+14.350000,	-61.23
+14.450000,	-61.07
+14.550000,	-60.95
+14.650000,	-60.84
+14.750000,	-60.97
+14.850000,	-60.62
+14.950000,	-60.68
+15.050000,	-30.04
+15.150000,	-27.31
+15.250000,	-53.22
+15.350000,	-28.85
+15.450000,	-36.29
+15.550000,	-35.00
+15.650000,	-30.28
+15.750000,	-53.70
+15.850000,	-29.90
+15.950000,	-37.54
+16.050000,	-35.99
+16.150000,	-30.42
+16.250000,	-55.58
+16.350000,	-30.03
+16.450000,	-37.92
+16.550000,	-36.28
+16.650000,	-30.78
+16.750000,	-55.68
+16.850000,	-30.11
+16.950000,	-37.06
+17.050000,	-36.27
+17.150000,	-30.48
+17.250000,	-55.42
+17.350000,	-29.81
+17.450000,	-37.73
+17.550000,	-46.54
+17.650000,	-46.62
+17.750000,	-46.68
+17.850000,	-46.33
+17.950000,	-46.04
+18.050000,	-46.27
+18.150000,	-46.21
+18.250000,	-46.03
+18.350000,	-45.92
+18.450000,	-45.97
+18.550000,	-45.75
+18.650000,	-45.70
+18.750000,	-45.51
+18.850000,	-45.59
+18.950000,	-45.56
+19.050000,	-45.50
+19.150000,	-45.34
+19.250000,	-45.21
+19.350000,	-45.13
+19.450000,	-45.26
+19.550000,	-45.03
+19.650000,	-44.79
+19.750000,	-44.94
+19.850000,	-44.92
+19.950000,	-44.67
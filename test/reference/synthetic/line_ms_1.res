@@ -0,0 +1,200 @@
+0.050000,	-65.22
+0.150000,	-58.06
+0.250000,	-82.83
+0.350000,	-58.30
+0.450000,	-64.81
+0.550000,	-64.63
+0.650000,	-57.76
+0.750000,	-82.29
+0.850000,	-56.95
+0.950000,	-64.39
+1.050000,	-63.60
+1.150000,	-56.96
+1.250000,	-82.42
+1.350000,	-57.30
+1.450000,	-64.13
+1.550000,	-64.31
+1.650000,	-56.53
+1.750000,	-81.46
+1.850000,	-56.63
+1.950000,	-63.11
+2.050000,	-63.35
+2.150000,	-56.77
+2.250000,	-80.55
+2.350000,	-56.19
+2.450000,	-62.74
+2.550000,	-42.19
+2.650000,	-42.58
+2.750000,	-42.49
+2.850000,	-42.47
+2.950000,	-42.65
+3.050000,	-42.82
+3.150000,	-42.82
+3.250000,	-42.68
+3.350000,	-42.63
+3.450000,	-42.92
+3.550000,	-42.96
+3.650000,	-42.59
+3.750000,	-42.64
+3.850000,	-42.92
+3.950000,	-42.85
+4.050000,	-42.53
+4.150000,	-42.74
+4.250000,	-42.95
+4.350000,	-42.89
+4.450000,	-42.50
+4.550000,	-42.75
+4.650000,	-43.00
+4.750000,	-42.69
+4.850000,	-42.75
+4.950000,	-42.79
+5.050000,	-27.45
+5.150000,	-29.15
+5.250000,	-29.69
+5.350000,	-29.90
+5.450000,	-30.02
+5.550000,	-30.03
+5.650000,	-30.16
+5.750000,	-30.25
+5.850000,	-30.16
+5.950000,	-30.22
+6.050000,	-30.23
+6.150000,	-30.25
+6.250000,	-30.27
+6.350000,	-30.21
+6.450000,	-30.20
+6.550000,	-30.24
+6.650000,	-30.28
+6.750000,	-30.21
+6.850000,	-30.13
+6.950000,	-30.27
+7.050000,	-30.17
+7.150000,	-30.24
+7.250000,	-30.21
+7.350000,	-30.12
+7.450000,	-30.16
+7.550000,	-29.27
+7.650000,	-25.81
+7.750000,	-52.10
+7.850000,	-28.05
+7.950000,	-35.37
+8.050000,	-34.35
+8.150000,	-30.13
+8.250000,	-53.74
+8.350000,	-29.21
+8.450000,	-37.36
+8.550000,	-35.72
+8.650000,	-30.05
+8.750000,	-54.46
+8.850000,	-29.53
+8.950000,	-37.09
+9.050000,	-36.54
+9.150000,	-29.90
+9.250000,	-54.47
+9.350000,	-29.77
+9.450000,	-36.81
+9.550000,	-35.52
+9.650000,	-29.79
+9.750000,	-54.67
+9.850000,	-30.11
+9.950000,	-36.84
+10.050000,	-45.24
+10.150000,	-44.98
+10.250000,	-45.10
+10.350000,	-45.10
+10.450000,	-44.85
+10.550000,	-44.80
+10.650000,	-44.69
+10.750000,	-44.57
+10.850000,	-44.64
+10.950000,	-44.24
+11.050000,	-44.19
+11.150000,	-44.13
+11.250000,	-44.08
+11.350000,	-44.07
+11.450000,	-43.73
+11.550000,	-43.80
+11.650000,	-43.84
+11.750000,	-43.57
+11.850000,	-43.31
+11.950000,	-43.34
+12.050000,	-43.48
+12.150000,	-43.15
+12.250000,	-42.84
+12.350000,	-43.08
+12.450000,	-43.06
+12.550000,	-72.80
+12.650000,	-70.83
+12.750000,	-69.17
+12.850000,	-67.41
+12.950000,	-66.04
+13.050000,	-64.46
+13.150000,	-63.31
+13.250000,	-62.40
+13.350000,	-62.11
+13.450000,	-62.14
+13.550000,	-61.91
+13.650000,	-61.81
+13.750000,	-61.76
+13.850000,	-61.70
+13.950000,	-61.61
+14.050000,	-61.52
+14.150000,	-61.36
+14.250000,	-61.24
+14.350000,	-61.21
+14.450000,	-61.01
+14.550000,	-61.02
+14.650000,	-60.88
+14.750000,	-60.81
+14.850000,	-60.66
+14.950000,	-60.57
+15.050000,	-29.60
+15.150000,	-27.29
+15.250000,	-52.89
+15.350000,	-28.69
+15.450000,	-36.42
+15.550000,	-35.34
+15.650000,	-30.33
+15.750000,	-56.01
+15.850000,	-29.89
+15.950000,	-37.60
+16.050000,	-36.78
+16.150000,	-30.15
+16.250000,	-56.27
+16.350000,	-30.42
+16.450000,	-37.42
+16.550000,	-36.67
+16.650000,	-30.67
+16.750000,	-55.53
+16.850000,	-30.18
+16.950000,	-37.93
+17.050000,	-36.03
+17.150000,	-30.65
+17.250000,	-55.88
+17.350000,	-30.82
+17.450000,	-37.82
+17.550000,	-46.50
+17.650000,	-46.69
+17.750000,	-46.61
+17.850000,	-46.36
+17.950000,	-46.11
+18.050000,	-46.37
+18.150000,	-46.29
+18.250000,	-46.06
+18.350000,	-45.81
+18.450000,	-46.01
+18.550000,	-45.83
+18.650000,	-45.74
+18.750000,	-45.59
+18.850000,	-45.54
+18.950000,	-45.52
+19.050000,	-45.47
+19.150000,	-45.39
+19.250000,	-45.25
+19.350000,	-45.14
+19.450000,	-45.24
+19.550000,	-45.04
+19.650000,	-44.85
+19.750000,	-44.87
+19.850000,	-44.98
+19.950000,	-44.62
@@ -0,0 +1,200 @@
+0.050000,	-62.15
+0.150000,	-54.97
+0.250000,	-80.38
+0.350000,	-54.56
+0.450000,	-62.44
+0.550000,	-61.09
+0.650000,	-54.51
+0.750000,	-79.51
+0.850000,	-54.98
+0.950000,	-60.64
+1.050000,	-60.31
+1.150000,	-54.22
+1.250000,	-79.02
+1.350000,	-54.10
+1.450000,	-60.79
+1.550000,	-60.56
+1.650000,	-53.77
+1.750000,	-78.55
+1.850000,	-53.78
+1.950000,	-60.19
+2.050000,	-59.34
+2.150000,	-53.34
+2.250000,	-78.19
+2.350000,	-53.29
+2.450000,	-59.91
+2.550000,	-39.04
+2.650000,	-39.44
+2.750000,	-39.42
+2.850000,	-39.36
+2.950000,	-39.50
+3.050000,	-39.69
+3.150000,	-39.76
+3.250000,	-39.67
+3.350000,	-39.54
+3.450000,	-39.76
+3.550000,	-39.85
+3.650000,	-39.52
+3.750000,	-39.54
+3.850000,	-39.84
+3.950000,	-39.84
+4.050000,	-39.44
+4.150000,	-39.59
+4.250000,	-39.96
+4.350000,	-39.73
+4.450000,	-39.46
+4.550000,	-39.66
+4.650000,	-39.84
+4.750000,	-39.64
+4.850000,	-39.61
+4.950000,	-39.69
+5.050000,	-24.26
+5.150000,	-26.09
+5.250000,	-26.62
+5.350000,	-26.85
+5.450000,	-26.91
+5.550000,	-27.03
+5.650000,	-27.11
+5.750000,	-27.20
+5.850000,	-27.14
+5.950000,	-27.15
+6.050000,	-27.15
+6.150000,	-27.09
+6.250000,	-27.03
+6.350000,	-27.10
+6.450000,	-27.02
+6.550000,	-27.15
+6.650000,	-27.16
+6.750000,	-27.05
+6.850000,	-27.16
+6.950000,	-27.12
+7.050000,	-27.10
+7.150000,	-27.16
+7.250000,	-27.06
+7.350000,	-27.10
+7.450000,	-27.08
+7.550000,	-25.30
+7.650000,	-22.41
+7.750000,	-49.15
+7.850000,	-24.59
+7.950000,	-33.13
+8.050000,	-31.27
+8.150000,	-26.45
+8.250000,	-51.11
+8.350000,	-26.41
+8.450000,	-33.86
+8.550000,	-32.09
+8.650000,	-26.80
+8.750000,	-51.97
+8.850000,	-26.45
+8.950000,	-33.89
+9.050000,	-32.45
+9.150000,	-26.96
+9.250000,	-52.05
+9.350000,	-26.62
+9.450000,	-34.43
+9.550000,	-32.91
+9.650000,	-26.97
+9.750000,	-51.80
+9.850000,	-26.53
+9.950000,	-33.33
+10.050000,	-42.15
+10.150000,	-41.85
+10.250000,	-41.93
+10.350000,	-42.02
+10.450000,	-41.75
+10.550000,	-41.75
+10.650000,	-41.60
+10.750000,	-41.48
+10.850000,	-41.49
+10.950000,	-41.21
+11.050000,	-41.17
+11.150000,	-40.93
+11.250000,	-41.03
+11.350000,	-41.05
+11.450000,	-40.57
+11.550000,	-40.65
+11.650000,	-40.80
+11.750000,	-40.44
+11.850000,	-40.22
+11.950000,	-40.19
+12.050000,	-40.51
+12.150000,	-40.09
+12.250000,	-39.76
+12.350000,	-40.00
+12.450000,	-40.05
+12.550000,	-69.75
+12.650000,	-67.77
+12.750000,	-65.83
+12.850000,	-64.40
+12.950000,	-62.95
+13.050000,	-61.45
+13.150000,	-60.39
+13.250000,	-59.38
+13.350000,	-58.99
+13.450000,	-59.07
+13.550000,	-58.89
+13.650000,	-58.86
+13.750000,	-58.67
+13.850000,	-58.62
+13.950000,	-58.44
+14.050000,	-58.43
+14.150000,	-58.44
+14.250000,	-58.24
+14.350000,	-58.15
+14.450000,	-57.90
+14.550000,	-58.01
+14.650000,	-57.75
+14.750000,	-57.73
+14.850000,	-57.54
+14.950000,	-57.53
+15.050000,	-26.32
+15.150000,	-23.83
+15.250000,	-50.06
+15.350000,	-25.27
+15.450000,	-33.53
+15.550000,	-32.17
+15.650000,	-27.00
+15.750000,	-50.66
+15.850000,	-26.46
+15.950000,	-34.35
+16.050000,	-33.33
+16.150000,	-27.55
+16.250000,	-52.42
+16.350000,	-26.68
+16.450000,	-34.66
+16.550000,	-33.30
+16.650000,	-27.31
+16.750000,	-52.95
+16.850000,	-27.46
+16.950000,	-35.06
+17.050000,	-33.52
+17.150000,	-27.18
+17.250000,	-52.64
+17.350000,	-27.10
+17.450000,	-34.94
+17.550000,	-43.37
+17.650000,	-43.53
+17.750000,	-43.57
+17.850000,	-43.34
+17.950000,	-43.02
+18.050000,	-43.23
+18.150000,	-43.18
+18.250000,	-42.90
+18.350000,	-42.72
+18.450000,	-42.93
+18.550000,	-42.82
+18.650000,	-42.64
+18.750000,	-42.52
+18.850000,	-42.48
+18.950000,	-42.43
+19.050000,	-42.30
+19.150000,	-42.20
+19.250000,	-42.15
+19.350000,	-42.08
+19.450000,	-42.09
+19.550000,	-41.88
+19.650000,	-41.69
+19.750000,	-41.79
+19.850000,	-41.95
+19.950000,	-41.46
@@ -0,0 +1,200 @@
+0.050000,	-69.61
+0.150000,	-63.15
+0.250000,	-87.36
+0.350000,	-63.39
+0.450000,	-69.95
+0.550000,	-69.26
+0.650000,	-62.58
+0.750000,	-86.81
+0.850000,	-62.80
+0.950000,	-69.28
+1.050000,	-68.87
+1.150000,	-61.92
+1.250000,	-86.36
+1.350000,	-61.74
+1.450000,	-67.83
+1.550000,	-67.86
+1.650000,	-61.72
+1.750000,	-86.53
+1.850000,	-61.15
+1.950000,	-67.63
+2.050000,	-67.44
+2.150000,	-61.36
+2.250000,	-86.18
+2.350000,	-61.21
+2.450000,	-67.48
+2.550000,	-47.06
+2.650000,	-47.30
+2.750000,	-47.38
+2.850000,	-47.36
+2.950000,	-47.48
+3.050000,	-47.69
+3.150000,	-47.81
+3.250000,	-47.61
+3.350000,	-47.47
+3.450000,	-47.82
+3.550000,	-47.79
+3.650000,	-47.49
+3.750000,	-47.54
+3.850000,	-47.74
+3.950000,	-47.74
+4.050000,	-47.42
+4.150000,	-47.59
+4.250000,	-47.87
+4.350000,	-47.74
+4.450000,	-47.36
+4.550000,	-47.65
+4.650000,	-47.87
+4.750000,	-47.64
+4.850000,	-47.48
+4.950000,	-47.65
+5.050000,	-32.32
+5.150000,	-33.98
+5.250000,	-34.53
+5.350000,	-34.89
+5.450000,	-34.99
+5.550000,	-35.00
+5.650000,	-35.10
+5.750000,	-34.98
+5.850000,	-34.98
+5.950000,	-35.00
+6.050000,	-35.12
+6.150000,	-35.08
+6.250000,	-35.11
+6.350000,	-34.98
+6.450000,	-35.06
+6.550000,	-35.18
+6.650000,	-35.10
+6.750000,	-35.01
+6.850000,	-35.07
+6.950000,	-35.05
+7.050000,	-35.01
+7.150000,	-35.08
+7.250000,	-35.02
+7.350000,	-35.05
+7.450000,	-34.99
+7.550000,	-33.57
+7.650000,	-30.13
+7.750000,	-56.67
+7.850000,	-32.46
+7.950000,	-40.75
+8.050000,	-39.63
+8.150000,	-34.27
+8.250000,	-58.88
+8.350000,	-34.32
+8.450000,	-41.58
+8.550000,	-40.20
+8.650000,	-35.48
+8.750000,	-59.39
+8.850000,	-34.36
+8.950000,	-41.86
+9.050000,	-40.73
+9.150000,	-34.96
+9.250000,	-59.95
+9.350000,	-34.79
+9.450000,	-41.91
+9.550000,	-40.55
+9.650000,	-35.00
+9.750000,	-60.19
+9.850000,	-34.52
+9.950000,	-41.81
+10.050000,	-50.16
+10.150000,	-49.90
+10.250000,	-49.97
+10.350000,	-49.93
+10.450000,	-49.64
+10.550000,	-49.63
+10.650000,	-49.54
+10.750000,	-49.45
+10.850000,	-49.44
+10.950000,	-49.21
+11.050000,	-49.18
+11.150000,	-48.98
+11.250000,	-48.99
+11.350000,	-49.02
+11.450000,	-48.50
+11.550000,	-48.63
+11.650000,	-48.73
+11.750000,	-48.51
+11.850000,	-48.15
+11.950000,	-48.13
+12.050000,	-48.44
+12.150000,	-47.95
+12.250000,	-47.61
+12.350000,	-47.92
+12.450000,	-47.89
+12.550000,	-77.56
+12.650000,	-75.66
+12.750000,	-73.95
+12.850000,	-72.15
+12.950000,	-70.71
+13.050000,	-69.37
+13.150000,	-68.24
+13.250000,	-67.35
+13.350000,	-66.93
+13.450000,	-66.86
+13.550000,	-66.74
+13.650000,	-66.69
+13.750000,	-66.50
+13.850000,	-66.49
+13.950000,	-66.39
+14.050000,	-66.22
+14.150000,	-66.11
+14.250000,	-66.12
+14.350000,	-66.09
+14.450000,	-65.92
+14.550000,	-65.92
+14.650000,	-65.55
+14.750000,	-65.66
+14.850000,	-65.35
+14.950000,	-65.42
+15.050000,	-34.41
+15.150000,	-31.68
+15.250000,	-57.76
+15.350000,	-33.44
+15.450000,	-41.76
+15.550000,	-40.96
+15.650000,	-34.62
+15.750000,	-59.50
+15.850000,	-34.58
+15.950000,	-42.48
+16.050000,	-40.75
+16.150000,	-35.17
+16.250000,	-60.24
+16.350000,	-35.04
+16.450000,	-43.15
+16.550000,	-42.11
+16.650000,	-35.22
+16.750000,	-60.77
+16.850000,	-35.24
+16.950000,	-42.18
+17.050000,	-41.51
+17.150000,	-35.39
+17.250000,	-59.43
+17.350000,	-35.61
+17.450000,	-42.52
+17.550000,	-51.34
+17.650000,	-51.46
+17.750000,	-51.48
+17.850000,	-51.31
+17.950000,	-51.00
+18.050000,	-51.18
+18.150000,	-51.12
+18.250000,	-50.92
+18.350000,	-50.75
+18.450000,	-50.85
+18.550000,	-50.68
+18.650000,	-50.59
+18.750000,	-50.43
+18.850000,	-50.44
+18.950000,	-50.27
+19.050000,	-50.36
+19.150000,	-50.16
+19.250000,	-50.15
+19.350000,	-50.04
+19.450000,	-50.04
+19.550000,	-49.91
+19.650000,	-49.68
+19.750000,	-49.77
+19.850000,	-49.86
+19.950000,	-49.53
@@ -0,0 +1,200 @@
+0.050000,	-70.33
+0.150000,	-62.77
+0.250000,	-88.37
+0.350000,	-62.43
+0.450000,	-69.64
+0.550000,	-69.39
+0.650000,	-62.70
+0.750000,	-86.86
+0.850000,	-62.03
+0.950000,	-69.31
+1.050000,	-68.84
+1.150000,	-62.25
+1.250000,	-87.11
+1.350000,	-62.34
+1.450000,	-68.59
+1.550000,	-67.87
+1.650000,	-61.87
+1.750000,	-86.36
+1.850000,	-61.39
+1.950000,	-68.41
+2.050000,	-68.36
+2.150000,	-61.52
+2.250000,	-85.41
+2.350000,	-60.91
+2.450000,	-67.24
+2.550000,	-46.98
+2.650000,	-47.45
+2.750000,	-47.37
+2.850000,	-47.30
+2.950000,	-47.59
+3.050000,	-47.69
+3.150000,	-47.71
+3.250000,	-47.60
+3.350000,	-47.52
+3.450000,	-47.74
+3.550000,	-47.75
+3.650000,	-47.44
+3.750000,	-47.48
+3.850000,	-47.75
+3.950000,	-47.79
+4.050000,	-47.42
+4.150000,	-47.59
+4.250000,	-47.82
+4.350000,	-47.73
+4.450000,	-47.34
+4.550000,	-47.58
+4.650000,	-47.88
+4.750000,	-47.66
+4.850000,	-47.51
+4.950000,	-47.59
+5.050000,	-32.20
+5.150000,	-33.91
+5.250000,	-34.55
+5.350000,	-34.92
+5.450000,	-34.76
+5.550000,	-34.92
+5.650000,	-35.04
+5.750000,	-35.12
+5.850000,	-35.07
+5.950000,	-35.05
+6.050000,	-35.15
+6.150000,	-35.13
+6.250000,	-35.01
+6.350000,	-34.96
+6.450000,	-35.00
+6.550000,	-35.06
+6.650000,	-35.05
+6.750000,	-35.04
+6.850000,	-35.03
+6.950000,	-34.99
+7.050000,	-35.14
+7.150000,	-35.02
+7.250000,	-35.00
+7.350000,	-35.07
+7.450000,	-35.00
+7.550000,	-33.86
+7.650000,	-30.11
+7.750000,	-56.53
+7.850000,	-32.17
+7.950000,	-40.99
+8.050000,	-40.12
+8.150000,	-34.23
+8.250000,	-59.78
+8.350000,	-34.38
+8.450000,	-41.76
+8.550000,	-40.23
+8.650000,	-35.02
+8.750000,	-60.27
+8.850000,	-35.00
+8.950000,	-42.24
+9.050000,	-40.86
+9.150000,	-35.26
+9.250000,	-59.60
+9.350000,	-34.77
+9.450000,	-41.54
+9.550000,	-40.79
+9.650000,	-34.99
+9.750000,	-60.76
+9.850000,	-34.74
+9.950000,	-42.54
+10.050000,	-50.16
+10.150000,	-49.82
+10.250000,	-50.03
+10.350000,	-49.90
+10.450000,	-49.75
+10.550000,	-49.63
+10.650000,	-49.63
+10.750000,	-49.47
+10.850000,	-49.43
+10.950000,	-49.16
+11.050000,	-49.09
+11.150000,	-49.02
+11.250000,	-49.02
+11.350000,	-48.99
+11.450000,	-48.62
+11.550000,	-48.62
+11.650000,	-48.71
+11.750000,	-48.55
+11.850000,	-48.14
+11.950000,	-48.20
+12.050000,	-48.42
+12.150000,	-47.97
+12.250000,	-47.67
+12.350000,	-47.92
+12.450000,	-47.91
+12.550000,	-77.60
+12.650000,	-75.54
+12.750000,	-73.80
+12.850000,	-72.11
+12.950000,	-70.61
+13.050000,	-69.35
+13.150000,	-68.22
+13.250000,	-67.30
+13.350000,	-66.96
+13.450000,	-66.81
+13.550000,	-66.78
+13.650000,	-66.70
+13.750000,	-66.54
+13.850000,	-66.47
+13.950000,	-66.34
+14.050000,	-66.21
+14.150000,	-66.19
+14.250000,	-66.04
+14.350000,	-65.99
+14.450000,	-65.80
+14.550000,	-65.74
+14.650000,	-65.70
+14.750000,	-65.66
+14.850000,	-65.53
+14.950000,	-65.48
+15.050000,	-34.44
+15.150000,	-32.62
+15.250000,	-58.15
+15.350000,	-33.43
+15.450000,	-41.37
+15.550000,	-41.31
+15.650000,	-34.37
+15.750000,	-60.08
+15.850000,	-34.75
+15.950000,	-42.43
+16.050000,	-40.89
+16.150000,	-35.49
+16.250000,	-60.36
+16.350000,	-34.87
+16.450000,	-42.32
+16.550000,	-40.73
+16.650000,	-35.56
+16.750000,	-60.17
+16.850000,	-35.14
+16.950000,	-43.05
+17.050000,	-41.28
+17.150000,	-35.50
+17.250000,	-60.65
+17.350000,	-35.32
+17.450000,	-42.82
+17.550000,	-51.40
+17.650000,	-51.54
+17.750000,	-51.57
+17.850000,	-51.28
+17.950000,	-51.00
+18.050000,	-51.20
+18.150000,	-51.14
+18.250000,	-50.94
+18.350000,	-50.65
+18.450000,	-50.84
+18.550000,	-50.71
+18.650000,	-50.64
+18.750000,	-50.37
+18.850000,	-50.43
+18.950000,	-50.35
+19.050000,	-50.34
+19.150000,	-50.17
+19.250000,	-50.15
+19.350000,	-50.04
+19.450000,	-50.06
+19.550000,	-49.87
+19.650000,	-49.62
+19.750000,	-49.76
+19.850000,	-49.86
+19.950000,	-49.51
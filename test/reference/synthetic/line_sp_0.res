@@ -0,0 +1,200 @@
+0.050000,	-64.90
+0.150000,	-58.45
+0.250000,	-83.17
+0.350000,	-58.37
+0.450000,	-64.87
+0.550000,	-64.24
+0.650000,	-57.82
+0.750000,	-81.56
+0.850000,	-57.09
+0.950000,	-64.72
+1.050000,	-64.53
+1.150000,	-57.13
+1.250000,	-81.93
+1.350000,	-56.95
+1.450000,	-63.43
+1.550000,	-63.34
+1.650000,	-56.73
+1.750000,	-80.97
+1.850000,	-56.51
+1.950000,	-63.03
+2.050000,	-62.52
+2.150000,	-55.97
+2.250000,	-80.41
+2.350000,	-55.94
+2.450000,	-62.88
+2.550000,	-41.77
+2.650000,	-42.20
+2.750000,	-42.24
+2.850000,	-42.21
+2.950000,	-42.33
+3.050000,	-42.53
+3.150000,	-42.58
+3.250000,	-42.53
+3.350000,	-42.34
+3.450000,	-42.81
+3.550000,	-42.87
+3.650000,	-42.64
+3.750000,	-42.56
+3.850000,	-42.96
+3.950000,	-42.89
+4.050000,	-42.53
+4.150000,	-42.75
+4.250000,	-43.03
+4.350000,	-42.71
+4.450000,	-42.38
+4.550000,	-42.65
+4.650000,	-42.70
+4.750000,	-42.46
+4.850000,	-42.36
+4.950000,	-42.53
+5.050000,	-27.94
+5.150000,	-29.35
+5.250000,	-29.87
+5.350000,	-30.04
+5.450000,	-29.92
+5.550000,	-30.15
+5.650000,	-30.21
+5.750000,	-30.22
+5.850000,	-30.19
+5.950000,	-30.21
+6.050000,	-30.14
+6.150000,	-30.14
+6.250000,	-30.25
+6.350000,	-30.13
+6.450000,	-30.21
+6.550000,	-30.22
+6.650000,	-30.13
+6.750000,	-30.32
+6.850000,	-30.23
+6.950000,	-30.16
+7.050000,	-30.20
+7.150000,	-30.31
+7.250000,	-30.13
+7.350000,	-30.18
+7.450000,	-30.24
+7.550000,	-29.53
+7.650000,	-25.51
+7.750000,	-48.21
+7.850000,	-26.78
+7.950000,	-35.91
+8.050000,	-31.31
+8.150000,	-28.34
+8.250000,	-50.17
+8.350000,	-26.87
+8.450000,	-35.57
+8.550000,	-31.01
+8.650000,	-28.28
+8.750000,	-50.66
+8.850000,	-26.88
+8.950000,	-35.48
+9.050000,	-31.51
+9.150000,	-27.90
+9.250000,	-49.64
+9.350000,	-27.39
+9.450000,	-35.60
+9.550000,	-31.42
+9.650000,	-28.15
+9.750000,	-50.06
+9.850000,	-27.33
+9.950000,	-35.35
+10.050000,	-41.12
+10.150000,	-39.66
+10.250000,	-39.09
+10.350000,	-38.68
+10.450000,	-38.06
+10.550000,	-37.65
+10.650000,	-37.31
+10.750000,	-37.01
+10.850000,	-36.69
+10.950000,	-36.51
+11.050000,	-36.06
+11.150000,	-35.94
+11.250000,	-35.95
+11.350000,	-35.87
+11.450000,	-35.67
+11.550000,	-35.68
+11.650000,	-35.85
+11.750000,	-35.66
+11.850000,	-35.45
+11.950000,	-35.58
+12.050000,	-35.84
+12.150000,	-35.59
+12.250000,	-35.40
+12.350000,	-35.72
+12.450000,	-35.62
+12.550000,	-65.20
+12.650000,	-62.76
+12.750000,	-62.48
+12.850000,	-62.47
+12.950000,	-62.34
+13.050000,	-62.26
+13.150000,	-62.14
+13.250000,	-62.04
+13.350000,	-61.86
+13.450000,	-61.72
+13.550000,	-61.64
+13.650000,	-61.59
+13.750000,	-61.55
+13.850000,	-61.38
+13.950000,	-61.19
+14.050000,	-61.08
+14.150000,	-61.03
+14.250000,	-60.90
+14.350000,	-60.77
+14.450000,	-60.69
+14.550000,	-60.42
+14.650000,	-60.42
+14.750000,	-60.41
+14.850000,	-60.12
+14.950000,	-60.11
+15.050000,	-31.42
+15.150000,	-28.64
+15.250000,	-50.73
+15.350000,	-27.98
+15.450000,	-36.29
+15.550000,	-31.47
+15.650000,	-29.64
+15.750000,	-49.59
+15.850000,	-27.67
+15.950000,	-36.58
+16.050000,	-31.77
+16.150000,	-29.46
+16.250000,	-50.80
+16.350000,	-27.87
+16.450000,	-37.13
+16.550000,	-32.00
+16.650000,	-29.66
+16.750000,	-51.43
+16.850000,	-27.80
+16.950000,	-36.46
+17.050000,	-32.24
+17.150000,	-28.74
+17.250000,	-50.77
+17.350000,	-27.29
+17.450000,	-36.39
+17.550000,	-41.86
+17.650000,	-41.36
+17.750000,	-41.07
+17.850000,	-40.28
+17.950000,	-39.84
+18.050000,	-39.72
+18.150000,	-39.61
+18.250000,	-39.23
+18.350000,	-39.12
+18.450000,	-38.97
+18.550000,	-38.79
+18.650000,	-38.59
+18.750000,	-38.48
+18.850000,	-38.47
+18.950000,	-38.56
+19.050000,	-38.40
+19.150000,	-38.37
+19.250000,	-38.28
+19.350000,	-38.31
+19.450000,	-38.48
+19.550000,	-38.35
+19.650000,	-38.05
+19.750000,	-38.26
+19.850000,	-38.31
+19.950000,	-38.13
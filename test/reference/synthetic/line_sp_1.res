@@ -0,0 +1,200 @@
+0.050000,	-65.22
+0.150000,	-58.06
+0.250000,	-82.83
+0.350000,	-58.30
+0.450000,	-64.81
+0.550000,	-64.63
+0.650000,	-57.76
+0.750000,	-82.15
+0.850000,	-56.95
+0.950000,	-64.19
+1.050000,	-63.60
+1.150000,	-56.79
+1.250000,	-82.33
+1.350000,	-57.07
+1.450000,	-63.90
+1.550000,	-64.08
+1.650000,	-56.30
+1.750000,	-81.22
+1.850000,	-56.41
+1.950000,	-62.75
+2.050000,	-63.05
+2.150000,	-56.34
+2.250000,	-80.13
+2.350000,	-55.77
+2.450000,	-62.33
+2.550000,	-41.85
+2.650000,	-42.25
+2.750000,	-42.19
+2.850000,	-42.21
+2.950000,	-42.35
+3.050000,	-42.56
+3.150000,	-42.55
+3.250000,	-42.42
+3.350000,	-42.37
+3.450000,	-42.83
+3.550000,	-42.96
+3.650000,	-42.59
+3.750000,	-42.61
+3.850000,	-42.92
+3.950000,	-42.85
+4.050000,	-42.53
+4.150000,	-42.74
+4.250000,	-42.95
+4.350000,	-42.79
+4.450000,	-42.29
+4.550000,	-42.65
+4.650000,	-42.74
+4.750000,	-42.42
+4.850000,	-42.48
+4.950000,	-42.53
+5.050000,	-28.01
+5.150000,	-29.37
+5.250000,	-29.79
+5.350000,	-29.90
+5.450000,	-30.05
+5.550000,	-30.13
+5.650000,	-30.16
+5.750000,	-30.25
+5.850000,	-30.16
+5.950000,	-30.22
+6.050000,	-30.23
+6.150000,	-30.25
+6.250000,	-30.27
+6.350000,	-30.21
+6.450000,	-30.20
+6.550000,	-30.24
+6.650000,	-30.28
+6.750000,	-30.21
+6.850000,	-30.13
+6.950000,	-30.27
+7.050000,	-30.17
+7.150000,	-30.24
+7.250000,	-30.21
+7.350000,	-30.12
+7.450000,	-30.16
+7.550000,	-29.53
+7.650000,	-25.97
+7.750000,	-48.90
+7.850000,	-26.90
+7.950000,	-35.12
+8.050000,	-30.81
+8.150000,	-29.34
+8.250000,	-48.83
+8.350000,	-26.97
+8.450000,	-36.35
+8.550000,	-31.96
+8.650000,	-28.48
+8.750000,	-49.09
+8.850000,	-27.00
+8.950000,	-35.87
+9.050000,	-31.94
+9.150000,	-27.68
+9.250000,	-49.66
+9.350000,	-27.42
+9.450000,	-35.78
+9.550000,	-31.24
+9.650000,	-27.78
+9.750000,	-49.52
+9.850000,	-27.36
+9.950000,	-35.39
+10.050000,	-40.95
+10.150000,	-39.66
+10.250000,	-39.05
+10.350000,	-38.69
+10.450000,	-38.09
+10.550000,	-37.65
+10.650000,	-37.31
+10.750000,	-37.02
+10.850000,	-36.81
+10.950000,	-36.40
+11.050000,	-36.10
+11.150000,	-35.97
+11.250000,	-35.88
+11.350000,	-35.88
+11.450000,	-35.77
+11.550000,	-35.72
+11.650000,	-35.84
+11.750000,	-35.65
+11.850000,	-35.43
+11.950000,	-35.66
+12.050000,	-35.78
+12.150000,	-35.63
+12.250000,	-35.37
+12.350000,	-35.71
+12.450000,	-35.66
+12.550000,	-65.15
+12.650000,	-62.75
+12.750000,	-62.66
+12.850000,	-62.51
+12.950000,	-62.44
+13.050000,	-62.19
+13.150000,	-62.01
+13.250000,	-61.99
+13.350000,	-61.86
+13.450000,	-61.85
+13.550000,	-61.63
+13.650000,	-61.50
+13.750000,	-61.46
+13.850000,	-61.35
+13.950000,	-61.30
+14.050000,	-61.13
+14.150000,	-60.98
+14.250000,	-60.85
+14.350000,	-60.76
+14.450000,	-60.62
+14.550000,	-60.48
+14.650000,	-60.46
+14.750000,	-60.25
+14.850000,	-60.16
+14.950000,	-60.00
+15.050000,	-31.04
+15.150000,	-28.62
+15.250000,	-50.60
+15.350000,	-28.02
+15.450000,	-36.42
+15.550000,	-31.90
+15.650000,	-29.68
+15.750000,	-51.96
+15.850000,	-27.61
+15.950000,	-36.65
+16.050000,	-32.47
+16.150000,	-29.13
+16.250000,	-51.85
+16.350000,	-28.20
+16.450000,	-36.63
+16.550000,	-32.32
+16.650000,	-29.59
+16.750000,	-51.51
+16.850000,	-27.93
+16.950000,	-37.33
+17.050000,	-32.19
+17.150000,	-28.88
+17.250000,	-51.13
+17.350000,	-28.03
+17.450000,	-36.48
+17.550000,	-41.82
+17.650000,	-41.42
+17.750000,	-41.01
+17.850000,	-40.31
+17.950000,	-39.91
+18.050000,	-39.82
+18.150000,	-39.69
+18.250000,	-39.26
+18.350000,	-39.02
+18.450000,	-39.01
+18.550000,	-38.88
+18.650000,	-38.63
+18.750000,	-38.56
+18.850000,	-38.43
+18.950000,	-38.52
+19.050000,	-38.37
+19.150000,	-38.42
+19.250000,	-38.32
+19.350000,	-38.31
+19.450000,	-38.46
+19.550000,	-38.35
+19.650000,	-38.10
+19.750000,	-38.19
+19.850000,	-38.37
+19.950000,	-38.08
@@ -0,0 +1,200 @@
+0.050000,	-62.15
+0.150000,	-54.97
+0.250000,	-80.38
+0.350000,	-54.56
+0.450000,	-62.44
+0.550000,	-61.09
+0.650000,	-54.51
+0.750000,	-79.38
+0.850000,	-54.98
+0.950000,	-60.46
+1.050000,	-60.31
+1.150000,	-54.05
+1.250000,	-78.89
+1.350000,	-53.87
+1.450000,	-60.56
+1.550000,	-60.33
+1.650000,	-53.55
+1.750000,	-78.32
+1.850000,	-53.56
+1.950000,	-59.82
+2.050000,	-59.05
+2.150000,	-52.91
+2.250000,	-77.76
+2.350000,	-52.88
+2.450000,	-59.49
+2.550000,	-38.70
+2.650000,	-39.11
+2.750000,	-39.12
+2.850000,	-39.10
+2.950000,	-39.20
+3.050000,	-39.43
+3.150000,	-39.49
+3.250000,	-39.40
+3.350000,	-39.27
+3.450000,	-39.67
+3.550000,	-39.85
+3.650000,	-39.52
+3.750000,	-39.51
+3.850000,	-39.84
+3.950000,	-39.84
+4.050000,	-39.44
+4.150000,	-39.59
+4.250000,	-39.96
+4.350000,	-39.63
+4.450000,	-39.26
+4.550000,	-39.56
+4.650000,	-39.57
+4.750000,	-39.37
+4.850000,	-39.35
+4.950000,	-39.42
+5.050000,	-24.82
+5.150000,	-26.31
+5.250000,	-26.72
+5.350000,	-26.85
+5.450000,	-26.94
+5.550000,	-27.13
+5.650000,	-27.11
+5.750000,	-27.20
+5.850000,	-27.14
+5.950000,	-27.15
+6.050000,	-27.15
+6.150000,	-27.09
+6.250000,	-27.03
+6.350000,	-27.10
+6.450000,	-27.02
+6.550000,	-27.15
+6.650000,	-27.16
+6.750000,	-27.05
+6.850000,	-27.16
+6.950000,	-27.12
+7.050000,	-27.10
+7.150000,	-27.16
+7.250000,	-27.06
+7.350000,	-27.10
+7.450000,	-27.08
+7.550000,	-25.57
+7.650000,	-22.57
+7.750000,	-45.77
+7.850000,	-23.61
+7.950000,	-32.88
+8.050000,	-27.75
+8.150000,	-25.67
+8.250000,	-46.51
+8.350000,	-24.12
+8.450000,	-32.85
+8.550000,	-28.48
+8.650000,	-25.22
+8.750000,	-46.92
+8.850000,	-23.88
+8.950000,	-32.68
+9.050000,	-27.87
+9.150000,	-24.69
+9.250000,	-47.13
+9.350000,	-24.31
+9.450000,	-33.41
+9.550000,	-28.74
+9.650000,	-24.96
+9.750000,	-46.40
+9.850000,	-23.83
+9.950000,	-31.89
+10.050000,	-37.87
+10.150000,	-36.52
+10.250000,	-35.88
+10.350000,	-35.62
+10.450000,	-35.00
+10.550000,	-34.59
+10.650000,	-34.23
+10.750000,	-33.92
+10.850000,	-33.66
+10.950000,	-33.37
+11.050000,	-33.08
+11.150000,	-32.77
+11.250000,	-32.83
+11.350000,	-32.86
+11.450000,	-32.61
+11.550000,	-32.57
+11.650000,	-32.79
+11.750000,	-32.53
+11.850000,	-32.35
+11.950000,	-32.51
+12.050000,	-32.81
+12.150000,	-32.57
+12.250000,	-32.29
+12.350000,	-32.63
+12.450000,	-32.65
+12.550000,	-62.06
+12.650000,	-59.70
+12.750000,	-59.33
+12.850000,	-59.49
+12.950000,	-59.35
+13.050000,	-59.17
+13.150000,	-59.10
+13.250000,	-58.97
+13.350000,	-58.74
+13.450000,	-58.77
+13.550000,	-58.61
+13.650000,	-58.54
+13.750000,	-58.38
+13.850000,	-58.27
+13.950000,	-58.12
+14.050000,	-58.04
+14.150000,	-58.06
+14.250000,	-57.85
+14.350000,	-57.70
+14.450000,	-57.51
+14.550000,	-57.48
+14.650000,	-57.33
+14.750000,	-57.17
+14.850000,	-57.04
+14.950000,	-56.96
+15.050000,	-27.70
+15.150000,	-25.18
+15.250000,	-47.53
+15.350000,	-24.56
+15.450000,	-33.53
+15.550000,	-28.85
+15.650000,	-26.36
+15.750000,	-45.99
+15.850000,	-24.32
+15.950000,	-33.40
+16.050000,	-29.02
+16.150000,	-26.66
+16.250000,	-48.32
+16.350000,	-24.59
+16.450000,	-33.87
+16.550000,	-29.02
+16.650000,	-26.18
+16.750000,	-48.85
+16.850000,	-25.11
+16.950000,	-34.46
+17.050000,	-29.49
+17.150000,	-25.45
+17.250000,	-48.32
+17.350000,	-24.47
+17.450000,	-33.60
+17.550000,	-38.68
+17.650000,	-38.27
+17.750000,	-37.96
+17.850000,	-37.28
+17.950000,	-36.83
+18.050000,	-36.68
+18.150000,	-36.58
+18.250000,	-36.10
+18.350000,	-35.92
+18.450000,	-35.93
+18.550000,	-35.86
+18.650000,	-35.53
+18.750000,	-35.50
+18.850000,	-35.37
+18.950000,	-35.43
+19.050000,	-35.21
+19.150000,	-35.22
+19.250000,	-35.22
+19.350000,	-35.26
+19.450000,	-35.31
+19.550000,	-35.20
+19.650000,	-34.94
+19.750000,	-35.12
+19.850000,	-35.34
+19.950000,	-34.92
@@ -0,0 +1,200 @@
+0.050000,	-69.61
+0.150000,	-63.15
+0.250000,	-87.36
+0.350000,	-63.39
+0.450000,	-69.95
+0.550000,	-69.26
+0.650000,	-62.58
+0.750000,	-86.68
+0.850000,	-62.80
+0.950000,	-69.10
+1.050000,	-68.87
+1.150000,	-61.75
+1.250000,	-86.25
+1.350000,	-61.51
+1.450000,	-67.60
+1.550000,	-67.63
+1.650000,	-61.49
+1.750000,	-86.26
+1.850000,	-60.93
+1.950000,	-67.27
+2.050000,	-67.14
+2.150000,	-60.93
+2.250000,	-85.73
+2.350000,	-60.79
+2.450000,	-67.07
+2.550000,	-46.72
+2.650000,	-46.97
+2.750000,	-47.08
+2.850000,	-47.10
+2.950000,	-47.18
+3.050000,	-47.42
+3.150000,	-47.54
+3.250000,	-47.35
+3.350000,	-47.21
+3.450000,	-47.73
+3.550000,	-47.79
+3.650000,	-47.49
+3.750000,	-47.52
+3.850000,	-47.74
+3.950000,	-47.74
+4.050000,	-47.42
+4.150000,	-47.59
+4.250000,	-47.87
+4.350000,	-47.64
+4.450000,	-47.16
+4.550000,	-47.55
+4.650000,	-47.61
+4.750000,	-47.37
+4.850000,	-47.21
+4.950000,	-47.39
+5.050000,	-32.88
+5.150000,	-34.20
+5.250000,	-34.63
+5.350000,	-34.89
+5.450000,	-35.02
+5.550000,	-35.09
+5.650000,	-35.10
+5.750000,	-34.98
+5.850000,	-34.98
+5.950000,	-35.00
+6.050000,	-35.12
+6.150000,	-35.08
+6.250000,	-35.11
+6.350000,	-34.98
+6.450000,	-35.06
+6.550000,	-35.18
+6.650000,	-35.10
+6.750000,	-35.01
+6.850000,	-35.07
+6.950000,	-35.05
+7.050000,	-35.01
+7.150000,	-35.08
+7.250000,	-35.02
+7.350000,	-35.05
+7.450000,	-34.99
+7.550000,	-33.84
+7.650000,	-30.30
+7.750000,	-53.17
+7.850000,	-31.40
+7.950000,	-40.51
+8.050000,	-36.15
+8.150000,	-33.48
+8.250000,	-54.41
+8.350000,	-31.87
+8.450000,	-40.57
+8.550000,	-36.64
+8.650000,	-33.93
+8.750000,	-54.57
+8.850000,	-31.86
+8.950000,	-40.64
+9.050000,	-36.20
+9.150000,	-32.74
+9.250000,	-55.15
+9.350000,	-32.41
+9.450000,	-40.88
+9.550000,	-36.20
+9.650000,	-32.95
+9.750000,	-55.14
+9.850000,	-31.80
+9.950000,	-40.37
+10.050000,	-45.88
+10.150000,	-44.58
+10.250000,	-43.92
+10.350000,	-43.53
+10.450000,	-42.89
+10.550000,	-42.47
+10.650000,	-42.17
+10.750000,	-41.89
+10.850000,	-41.61
+10.950000,	-41.36
+11.050000,	-41.09
+11.150000,	-40.82
+11.250000,	-40.78
+11.350000,	-40.82
+11.450000,	-40.54
+11.550000,	-40.56
+11.650000,	-40.73
+11.750000,	-40.60
+11.850000,	-40.27
+11.950000,	-40.45
+12.050000,	-40.74
+12.150000,	-40.43
+12.250000,	-40.14
+12.350000,	-40.55
+12.450000,	-40.49
+12.550000,	-69.91
+12.650000,	-67.58
+12.750000,	-67.45
+12.850000,	-67.25
+12.950000,	-67.12
+13.050000,	-67.09
+13.150000,	-66.94
+13.250000,	-66.95
+13.350000,	-66.68
+13.450000,	-66.56
+13.550000,	-66.47
+13.650000,	-66.37
+13.750000,	-66.21
+13.850000,	-66.14
+13.950000,	-66.07
+14.050000,	-65.83
+14.150000,	-65.74
+14.250000,	-65.73
+14.350000,	-65.63
+14.450000,	-65.54
+14.550000,	-65.38
+14.650000,	-65.13
+14.750000,	-65.10
+14.850000,	-64.86
+14.950000,	-64.85
+15.050000,	-35.80
+15.150000,	-33.04
+15.250000,	-55.46
+15.350000,	-32.68
+15.450000,	-41.76
+15.550000,	-37.38
+15.650000,	-33.98
+15.750000,	-55.14
+15.850000,	-32.34
+15.950000,	-41.52
+16.050000,	-36.45
+16.150000,	-34.10
+16.250000,	-55.76
+16.350000,	-32.99
+16.450000,	-42.36
+16.550000,	-37.73
+16.650000,	-34.05
+16.750000,	-56.57
+16.850000,	-32.95
+16.950000,	-41.58
+17.050000,	-37.37
+17.150000,	-33.65
+17.250000,	-54.37
+17.350000,	-32.91
+17.450000,	-41.18
+17.550000,	-46.66
+17.650000,	-46.20
+17.750000,	-45.87
+17.850000,	-45.25
+17.950000,	-44.80
+18.050000,	-44.63
+18.150000,	-44.51
+18.250000,	-44.12
+18.350000,	-43.96
+18.450000,	-43.85
+18.550000,	-43.72
+18.650000,	-43.48
+18.750000,	-43.41
+18.850000,	-43.32
+18.950000,	-43.27
+19.050000,	-43.26
+19.150000,	-43.18
+19.250000,	-43.21
+19.350000,	-43.21
+19.450000,	-43.27
+19.550000,	-43.23
+19.650000,	-42.94
+19.750000,	-43.09
+19.850000,	-43.25
+19.950000,	-42.99
@@ -0,0 +1,200 @@
+0.050000,	-70.33
+0.150000,	-62.77
+0.250000,	-88.37
+0.350000,	-62.43
+0.450000,	-69.63
+0.550000,	-69.39
+0.650000,	-62.69
+0.750000,	-86.71
+0.850000,	-62.03
+0.950000,	-69.14
+1.050000,	-68.84
+1.150000,	-62.07
+1.250000,	-86.98
+1.350000,	-62.11
+1.450000,	-68.36
+1.550000,	-67.65
+1.650000,	-61.65
+1.750000,	-86.15
+1.850000,	-61.17
+1.950000,	-68.03
+2.050000,	-68.06
+2.150000,	-61.10
+2.250000,	-84.96
+2.350000,	-60.50
+2.450000,	-66.83
+2.550000,	-46.64
+2.650000,	-47.12
+2.750000,	-47.07
+2.850000,	-47.05
+2.950000,	-47.29
+3.050000,	-47.43
+3.150000,	-47.44
+3.250000,	-47.34
+3.350000,	-47.25
+3.450000,	-47.65
+3.550000,	-47.75
+3.650000,	-47.44
+3.750000,	-47.45
+3.850000,	-47.75
+3.950000,	-47.79
+4.050000,	-47.42
+4.150000,	-47.59
+4.250000,	-47.82
+4.350000,	-47.62
+4.450000,	-47.14
+4.550000,	-47.49
+4.650000,	-47.61
+4.750000,	-47.39
+4.850000,	-47.24
+4.950000,	-47.33
+5.050000,	-32.76
+5.150000,	-34.13
+5.250000,	-34.66
+5.350000,	-34.92
+5.450000,	-34.79
+5.550000,	-35.01
+5.650000,	-35.04
+5.750000,	-35.12
+5.850000,	-35.07
+5.950000,	-35.05
+6.050000,	-35.15
+6.150000,	-35.13
+6.250000,	-35.01
+6.350000,	-34.96
+6.450000,	-35.00
+6.550000,	-35.06
+6.650000,	-35.05
+6.750000,	-35.04
+6.850000,	-35.03
+6.950000,	-34.99
+7.050000,	-35.14
+7.150000,	-35.02
+7.250000,	-35.00
+7.350000,	-35.07
+7.450000,	-35.00
+7.550000,	-34.14
+7.650000,	-30.27
+7.750000,	-52.84
+7.850000,	-31.18
+7.950000,	-40.74
+8.050000,	-36.46
+8.150000,	-33.46
+8.250000,	-55.31
+8.350000,	-32.01
+8.450000,	-40.76
+8.550000,	-36.48
+8.650000,	-33.47
+8.750000,	-55.02
+8.850000,	-32.39
+8.950000,	-41.01
+9.050000,	-36.31
+9.150000,	-33.03
+9.250000,	-54.49
+9.350000,	-32.50
+9.450000,	-40.51
+9.550000,	-36.35
+9.650000,	-32.96
+9.750000,	-55.37
+9.850000,	-31.96
+9.950000,	-41.13
+10.050000,	-45.87
+10.150000,	-44.50
+10.250000,	-43.98
+10.350000,	-43.50
+10.450000,	-43.00
+10.550000,	-42.48
+10.650000,	-42.26
+10.750000,	-41.91
+10.850000,	-41.60
+10.950000,	-41.31
+11.050000,	-41.00
+11.150000,	-40.86
+11.250000,	-40.82
+11.350000,	-40.80
+11.450000,	-40.66
+11.550000,	-40.54
+11.650000,	-40.70
+11.750000,	-40.64
+11.850000,	-40.27
+11.950000,	-40.52
+12.050000,	-40.72
+12.150000,	-40.45
+12.250000,	-40.20
+12.350000,	-40.56
+12.450000,	-40.50
+12.550000,	-69.95
+12.650000,	-67.48
+12.750000,	-67.31
+12.850000,	-67.22
+12.950000,	-67.02
+13.050000,	-67.07
+13.150000,	-66.92
+13.250000,	-66.89
+13.350000,	-66.71
+13.450000,	-66.51
+13.550000,	-66.50
+13.650000,	-66.37
+13.750000,	-66.25
+13.850000,	-66.13
+13.950000,	-66.02
+14.050000,	-65.82
+14.150000,	-65.81
+14.250000,	-65.65
+14.350000,	-65.54
+14.450000,	-65.42
+14.550000,	-65.20
+14.650000,	-65.27
+14.750000,	-65.10
+14.850000,	-65.03
+14.950000,	-64.91
+15.050000,	-35.84
+15.150000,	-33.96
+15.250000,	-55.72
+15.350000,	-32.69
+15.450000,	-41.37
+15.550000,	-37.85
+15.650000,	-33.72
+15.750000,	-55.79
+15.850000,	-32.42
+15.950000,	-41.48
+16.050000,	-36.63
+16.150000,	-34.58
+16.250000,	-56.00
+16.350000,	-32.84
+16.450000,	-41.52
+16.550000,	-36.43
+16.650000,	-34.42
+16.750000,	-56.60
+16.850000,	-32.88
+16.950000,	-42.45
+17.050000,	-37.19
+17.150000,	-33.74
+17.250000,	-56.20
+17.350000,	-32.66
+17.450000,	-41.48
+17.550000,	-46.71
+17.650000,	-46.27
+17.750000,	-45.96
+17.850000,	-45.23
+17.950000,	-44.80
+18.050000,	-44.65
+18.150000,	-44.54
+18.250000,	-44.14
+18.350000,	-43.85
+18.450000,	-43.84
+18.550000,	-43.76
+18.650000,	-43.53
+18.750000,	-43.34
+18.850000,	-43.31
+18.950000,	-43.35
+19.050000,	-43.24
+19.150000,	-43.20
+19.250000,	-43.21
+19.350000,	-43.22
+19.450000,	-43.28
+19.550000,	-43.19
+19.650000,	-42.87
+19.750000,	-43.09
+19.850000,	-43.25
+19.950000,	-42.97
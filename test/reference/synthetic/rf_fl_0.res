@@ -0,0 +1,200 @@
+0.050000,	-65.17
+0.150000,	-58.73
+0.250000,	-83.62
+0.350000,	-58.12
+0.450000,	-64.62
+0.550000,	-64.24
+0.650000,	-57.82
+0.750000,	-81.32
+0.850000,	-56.85
+0.950000,	-64.68
+1.050000,	-64.06
+1.150000,	-56.84
+1.250000,	-81.71
+1.350000,	-56.94
+1.450000,	-63.43
+1.550000,	-63.12
+1.650000,	-56.52
+1.750000,	-80.89
+1.850000,	-56.51
+1.950000,	-63.17
+2.050000,	-62.37
+2.150000,	-55.97
+2.250000,	-80.51
+2.350000,	-56.14
+2.450000,	-63.08
+2.550000,	-42.27
+2.650000,	-43.07
+2.750000,	-43.08
+2.850000,	-43.01
+2.950000,	-43.00
+3.050000,	-43.08
+3.150000,	-43.12
+3.250000,	-43.07
+3.350000,	-42.88
+3.450000,	-43.17
+3.550000,	-43.14
+3.650000,	-42.91
+3.750000,	-42.86
+3.850000,	-43.23
+3.950000,	-43.16
+4.050000,	-42.80
+4.150000,	-43.02
+4.250000,	-43.31
+4.350000,	-43.09
+4.450000,	-42.85
+4.550000,	-43.02
+4.650000,	-43.24
+4.750000,	-43.01
+4.850000,	-42.90
+4.950000,	-43.07
+5.050000,	-26.57
+5.150000,	-27.30
+5.250000,	-27.50
+5.350000,	-27.76
+5.450000,	-27.61
+5.550000,	-27.66
+5.650000,	-27.71
+5.750000,	-27.72
+5.850000,	-27.70
+5.950000,	-27.71
+6.050000,	-27.64
+6.150000,	-27.64
+6.250000,	-27.75
+6.350000,	-27.63
+6.450000,	-27.71
+6.550000,	-27.72
+6.650000,	-27.63
+6.750000,	-27.82
+6.850000,	-27.73
+6.950000,	-27.66
+7.050000,	-27.70
+7.150000,	-27.81
+7.250000,	-27.63
+7.350000,	-27.68
+7.450000,	-27.74
+7.550000,	-26.75
+7.650000,	-22.22
+7.750000,	-48.61
+7.850000,	-24.22
+7.950000,	-31.96
+8.050000,	-31.24
+8.150000,	-25.16
+8.250000,	-50.92
+8.350000,	-25.33
+8.450000,	-32.42
+8.550000,	-31.19
+8.650000,	-25.95
+8.750000,	-51.72
+8.850000,	-25.60
+8.950000,	-32.76
+9.050000,	-32.34
+9.150000,	-26.32
+9.250000,	-51.13
+9.350000,	-26.03
+9.450000,	-32.70
+9.550000,	-32.35
+9.650000,	-26.32
+9.750000,	-51.33
+9.850000,	-26.38
+9.950000,	-32.75
+10.050000,	-41.58
+10.150000,	-40.99
+10.250000,	-41.00
+10.350000,	-40.73
+10.450000,	-40.35
+10.550000,	-40.14
+10.650000,	-39.90
+10.750000,	-39.67
+10.850000,	-39.39
+10.950000,	-39.29
+11.050000,	-38.92
+11.150000,	-38.74
+11.250000,	-38.91
+11.350000,	-38.70
+11.450000,	-38.10
+11.550000,	-38.24
+11.650000,	-38.26
+11.750000,	-37.79
+11.850000,	-37.58
+11.950000,	-37.51
+12.050000,	-37.51
+12.150000,	-37.25
+12.250000,	-36.93
+12.350000,	-36.93
+12.450000,	-37.01
+12.550000,	-67.41
+12.650000,	-66.43
+12.750000,	-65.54
+12.850000,	-64.84
+12.950000,	-64.24
+13.050000,	-63.91
+13.150000,	-63.33
+13.250000,	-63.23
+13.350000,	-62.77
+13.450000,	-62.71
+13.550000,	-62.68
+13.650000,	-62.35
+13.750000,	-62.42
+13.850000,	-62.37
+13.950000,	-61.82
+14.050000,	-61.89
+14.150000,	-61.90
+14.250000,	-61.58
+14.350000,	-61.47
+14.450000,	-61.48
+14.550000,	-61.26
+14.650000,	-61.04
+14.750000,	-61.17
+14.850000,	-60.99
+14.950000,	-60.87
+15.050000,	-29.28
+15.150000,	-24.93
+15.250000,	-50.44
+15.350000,	-25.90
+15.450000,	-32.59
+15.550000,	-32.02
+15.650000,	-26.75
+15.750000,	-50.18
+15.850000,	-26.33
+15.950000,	-33.56
+16.050000,	-32.80
+16.150000,	-26.65
+16.250000,	-52.02
+16.350000,	-26.50
+16.450000,	-34.27
+16.550000,	-32.93
+16.650000,	-27.16
+16.750000,	-52.22
+16.850000,	-26.50
+16.950000,	-33.40
+17.050000,	-32.90
+17.150000,	-26.82
+17.250000,	-51.84
+17.350000,	-26.18
+17.450000,	-34.07
+17.550000,	-43.05
+17.650000,	-43.12
+17.750000,	-42.97
+17.850000,	-42.66
+17.950000,	-42.35
+18.050000,	-42.30
+18.150000,	-42.40
+18.250000,	-42.13
+18.350000,	-41.83
+18.450000,	-41.89
+18.550000,	-41.83
+18.650000,	-41.38
+18.750000,	-41.33
+18.850000,	-41.43
+18.950000,	-41.37
+19.050000,	-41.10
+19.150000,	-41.06
+19.250000,	-40.97
+19.350000,	-40.75
+19.450000,	-40.79
+19.550000,	-40.65
+19.650000,	-40.48
+19.750000,	-40.53
+19.850000,	-40.40
+19.950000,	-40.21
@@ -0,0 +1,200 @@
+0.050000,	-65.49
+0.150000,	-58.34
+0.250000,	-83.23
+0.350000,	-58.05
+0.450000,	-64.55
+0.550000,	-64.63
+0.650000,	-57.76
+0.750000,	-81.90
+0.850000,	-56.71
+0.950000,	-64.14
+1.050000,	-63.13
+1.150000,	-56.50
+1.250000,	-82.08
+1.350000,	-57.06
+1.450000,	-63.90
+1.550000,	-63.87
+1.650000,	-56.08
+1.750000,	-81.13
+1.850000,	-56.41
+1.950000,	-62.89
+2.050000,	-62.93
+2.150000,	-56.34
+2.250000,	-80.22
+2.350000,	-55.98
+2.450000,	-62.53
+2.550000,	-42.35
+2.650000,	-43.13
+2.750000,	-43.03
+2.850000,	-43.02
+2.950000,	-43.02
+3.050000,	-43.10
+3.150000,	-43.09
+3.250000,	-42.96
+3.350000,	-42.91
+3.450000,	-43.19
+3.550000,	-43.24
+3.650000,	-42.87
+3.750000,	-42.92
+3.850000,	-43.20
+3.950000,	-43.12
+4.050000,	-42.80
+4.150000,	-43.02
+4.250000,	-43.23
+4.350000,	-43.17
+4.450000,	-42.77
+4.550000,	-43.02
+4.650000,	-43.28
+4.750000,	-42.96
+4.850000,	-43.03
+4.950000,	-43.07
+5.050000,	-26.63
+5.150000,	-27.32
+5.250000,	-27.42
+5.350000,	-27.62
+5.450000,	-27.74
+5.550000,	-27.64
+5.650000,	-27.66
+5.750000,	-27.76
+5.850000,	-27.66
+5.950000,	-27.72
+6.050000,	-27.73
+6.150000,	-27.75
+6.250000,	-27.77
+6.350000,	-27.71
+6.450000,	-27.70
+6.550000,	-27.74
+6.650000,	-27.78
+6.750000,	-27.71
+6.850000,	-27.63
+6.950000,	-27.77
+7.050000,	-27.68
+7.150000,	-27.74
+7.250000,	-27.71
+7.350000,	-27.63
+7.450000,	-27.66
+7.550000,	-26.78
+7.650000,	-22.67
+7.750000,	-48.79
+7.850000,	-24.49
+7.950000,	-31.17
+8.050000,	-30.75
+8.150000,	-26.17
+8.250000,	-50.00
+8.350000,	-25.40
+8.450000,	-33.20
+8.550000,	-32.24
+8.650000,	-26.18
+8.750000,	-50.91
+8.850000,	-25.87
+8.950000,	-33.16
+9.050000,	-32.93
+9.150000,	-26.13
+9.250000,	-50.89
+9.350000,	-26.07
+9.450000,	-32.88
+9.550000,	-31.92
+9.650000,	-25.95
+9.750000,	-51.04
+9.850000,	-26.36
+9.950000,	-32.83
+10.050000,	-41.41
+10.150000,	-40.99
+10.250000,	-40.96
+10.350000,	-40.75
+10.450000,	-40.38
+10.550000,	-40.14
+10.650000,	-39.91
+10.750000,	-39.67
+10.850000,	-39.51
+10.950000,	-39.17
+11.050000,	-38.96
+11.150000,	-38.77
+11.250000,	-38.84
+11.350000,	-38.71
+11.450000,	-38.21
+11.550000,	-38.28
+11.650000,	-38.25
+11.750000,	-37.78
+11.850000,	-37.56
+11.950000,	-37.59
+12.050000,	-37.46
+12.150000,	-37.29
+12.250000,	-36.91
+12.350000,	-36.93
+12.450000,	-37.04
+12.550000,	-67.34
+12.650000,	-66.43
+12.750000,	-65.72
+12.850000,	-64.88
+12.950000,	-64.34
+13.050000,	-63.82
+13.150000,	-63.21
+13.250000,	-63.18
+13.350000,	-62.77
+13.450000,	-62.84
+13.550000,	-62.67
+13.650000,	-62.26
+13.750000,	-62.33
+13.850000,	-62.35
+13.950000,	-61.92
+14.050000,	-61.94
+14.150000,	-61.85
+14.250000,	-61.53
+14.350000,	-61.46
+14.450000,	-61.41
+14.550000,	-61.32
+14.650000,	-61.08
+14.750000,	-61.01
+14.850000,	-61.04
+14.950000,	-60.76
+15.050000,	-28.81
+15.150000,	-24.90
+15.250000,	-50.10
+15.350000,	-25.71
+15.450000,	-32.72
+15.550000,	-32.35
+15.650000,	-26.80
+15.750000,	-52.48
+15.850000,	-26.34
+15.950000,	-33.62
+16.050000,	-33.60
+16.150000,	-26.38
+16.250000,	-52.61
+16.350000,	-26.89
+16.450000,	-33.76
+16.550000,	-33.32
+16.650000,	-27.04
+16.750000,	-52.05
+16.850000,	-26.59
+16.950000,	-34.27
+17.050000,	-32.65
+17.150000,	-27.00
+17.250000,	-52.31
+17.350000,	-27.19
+17.450000,	-34.16
+17.550000,	-43.01
+17.650000,	-43.18
+17.750000,	-42.91
+17.850000,	-42.69
+17.950000,	-42.43
+18.050000,	-42.40
+18.150000,	-42.47
+18.250000,	-42.16
+18.350000,	-41.73
+18.450000,	-41.93
+18.550000,	-41.92
+18.650000,	-41.42
+18.750000,	-41.41
+18.850000,	-41.38
+18.950000,	-41.33
+19.050000,	-41.06
+19.150000,	-41.11
+19.250000,	-41.01
+19.350000,	-40.75
+19.450000,	-40.77
+19.550000,	-40.66
+19.650000,	-40.54
+19.750000,	-40.46
+19.850000,	-40.45
+19.950000,	-40.16
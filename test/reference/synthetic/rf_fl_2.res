@@ -0,0 +1,200 @@
+0.050000,	-62.42
+0.150000,	-55.25
+0.250000,	-80.78
+0.350000,	-54.32
+0.450000,	-62.18
+0.550000,	-61.09
+0.650000,	-54.51
+0.750000,	-79.15
+0.850000,	-54.74
+0.950000,	-60.40
+1.050000,	-59.85
+1.150000,	-53.75
+1.250000,	-78.64
+1.350000,	-53.87
+1.450000,	-60.56
+1.550000,	-60.11
+1.650000,	-53.33
+1.750000,	-78.23
+1.850000,	-53.56
+1.950000,	-59.97
+2.050000,	-58.91
+2.150000,	-52.91
+2.250000,	-77.88
+2.350000,	-53.08
+2.450000,	-59.70
+2.550000,	-39.21
+2.650000,	-39.99
+2.750000,	-39.96
+2.850000,	-39.90
+2.950000,	-39.87
+3.050000,	-39.97
+3.150000,	-40.04
+3.250000,	-39.94
+3.350000,	-39.81
+3.450000,	-40.04
+3.550000,	-40.13
+3.650000,	-39.80
+3.750000,	-39.81
+3.850000,	-40.11
+3.950000,	-40.11
+4.050000,	-39.71
+4.150000,	-39.86
+4.250000,	-40.23
+4.350000,	-40.01
+4.450000,	-39.73
+4.550000,	-39.93
+4.650000,	-40.11
+4.750000,	-39.91
+4.850000,	-39.89
+4.950000,	-39.96
+5.050000,	-23.44
+5.150000,	-24.25
+5.250000,	-24.36
+5.350000,	-24.57
+5.450000,	-24.63
+5.550000,	-24.64
+5.650000,	-24.61
+5.750000,	-24.70
+5.850000,	-24.64
+5.950000,	-24.65
+6.050000,	-24.65
+6.150000,	-24.59
+6.250000,	-24.54
+6.350000,	-24.60
+6.450000,	-24.52
+6.550000,	-24.65
+6.650000,	-24.66
+6.750000,	-24.55
+6.850000,	-24.66
+6.950000,	-24.62
+7.050000,	-24.60
+7.150000,	-24.67
+7.250000,	-24.56
+7.350000,	-24.60
+7.450000,	-24.58
+7.550000,	-22.81
+7.650000,	-19.26
+7.750000,	-45.86
+7.850000,	-20.98
+7.950000,	-28.93
+8.050000,	-27.66
+8.150000,	-22.47
+8.250000,	-47.31
+8.350000,	-22.63
+8.450000,	-29.70
+8.550000,	-28.61
+8.650000,	-22.92
+8.750000,	-48.38
+8.850000,	-22.80
+8.950000,	-29.96
+9.050000,	-28.84
+9.150000,	-23.20
+9.250000,	-48.49
+9.350000,	-22.90
+9.450000,	-30.51
+9.550000,	-29.33
+9.650000,	-23.13
+9.750000,	-48.22
+9.850000,	-22.77
+9.950000,	-29.31
+10.050000,	-38.33
+10.150000,	-37.85
+10.250000,	-37.79
+10.350000,	-37.68
+10.450000,	-37.29
+10.550000,	-37.08
+10.650000,	-36.82
+10.750000,	-36.58
+10.850000,	-36.36
+10.950000,	-36.14
+11.050000,	-35.94
+11.150000,	-35.57
+11.250000,	-35.79
+11.350000,	-35.69
+11.450000,	-35.05
+11.550000,	-35.12
+11.650000,	-35.21
+11.750000,	-34.65
+11.850000,	-34.47
+11.950000,	-34.44
+12.050000,	-34.49
+12.150000,	-34.23
+12.250000,	-33.82
+12.350000,	-33.85
+12.450000,	-34.03
+12.550000,	-64.30
+12.650000,	-63.38
+12.750000,	-62.38
+12.850000,	-61.87
+12.950000,	-61.25
+13.050000,	-60.82
+13.150000,	-60.29
+13.250000,	-60.16
+13.350000,	-59.66
+13.450000,	-59.77
+13.550000,	-59.65
+13.650000,	-59.30
+13.750000,	-59.25
+13.850000,	-59.26
+13.950000,	-58.74
+14.050000,	-58.85
+14.150000,	-58.93
+14.250000,	-58.53
+14.350000,	-58.39
+14.450000,	-58.30
+14.550000,	-58.32
+14.650000,	-57.95
+14.750000,	-57.92
+14.850000,	-57.91
+14.950000,	-57.72
+15.050000,	-25.42
+15.150000,	-21.49
+15.250000,	-47.30
+15.350000,	-22.34
+15.450000,	-29.82
+15.550000,	-29.17
+15.650000,	-23.46
+15.750000,	-47.21
+15.850000,	-22.89
+15.950000,	-30.37
+16.050000,	-30.16
+16.150000,	-23.78
+16.250000,	-48.70
+16.350000,	-23.12
+16.450000,	-31.00
+16.550000,	-29.96
+16.650000,	-23.68
+16.750000,	-49.48
+16.850000,	-23.86
+16.950000,	-31.40
+17.050000,	-30.14
+17.150000,	-23.52
+17.250000,	-49.05
+17.350000,	-23.46
+17.450000,	-31.28
+17.550000,	-39.88
+17.650000,	-40.03
+17.750000,	-39.87
+17.850000,	-39.66
+17.950000,	-39.34
+18.050000,	-39.27
+18.150000,	-39.37
+18.250000,	-39.01
+18.350000,	-38.64
+18.450000,	-38.84
+18.550000,	-38.91
+18.650000,	-38.32
+18.750000,	-38.35
+18.850000,	-38.32
+18.950000,	-38.23
+19.050000,	-37.90
+19.150000,	-37.92
+19.250000,	-37.91
+19.350000,	-37.69
+19.450000,	-37.62
+19.550000,	-37.51
+19.650000,	-37.38
+19.750000,	-37.38
+19.850000,	-37.42
+19.950000,	-37.00
@@ -0,0 +1,200 @@
+0.050000,	-69.89
+0.150000,	-63.43
+0.250000,	-87.72
+0.350000,	-63.14
+0.450000,	-69.69
+0.550000,	-69.26
+0.650000,	-62.58
+0.750000,	-86.43
+0.850000,	-62.55
+0.950000,	-69.04
+1.050000,	-68.41
+1.150000,	-61.45
+1.250000,	-86.01
+1.350000,	-61.51
+1.450000,	-67.60
+1.550000,	-67.41
+1.650000,	-61.27
+1.750000,	-86.18
+1.850000,	-60.93
+1.950000,	-67.41
+2.050000,	-67.01
+2.150000,	-60.93
+2.250000,	-85.83
+2.350000,	-61.00
+2.450000,	-67.27
+2.550000,	-47.23
+2.650000,	-47.84
+2.750000,	-47.93
+2.850000,	-47.91
+2.950000,	-47.85
+3.050000,	-47.96
+3.150000,	-48.08
+3.250000,	-47.89
+3.350000,	-47.75
+3.450000,	-48.09
+3.550000,	-48.07
+3.650000,	-47.77
+3.750000,	-47.82
+3.850000,	-48.01
+3.950000,	-48.01
+4.050000,	-47.70
+4.150000,	-47.86
+4.250000,	-48.14
+4.350000,	-48.02
+4.450000,	-47.64
+4.550000,	-47.92
+4.650000,	-48.15
+4.750000,	-47.92
+4.850000,	-47.76
+4.950000,	-47.93
+5.050000,	-31.50
+5.150000,	-32.15
+5.250000,	-32.26
+5.350000,	-32.61
+5.450000,	-32.71
+5.550000,	-32.61
+5.650000,	-32.61
+5.750000,	-32.48
+5.850000,	-32.48
+5.950000,	-32.50
+6.050000,	-32.62
+6.150000,	-32.58
+6.250000,	-32.61
+6.350000,	-32.48
+6.450000,	-32.56
+6.550000,	-32.68
+6.650000,	-32.60
+6.750000,	-32.51
+6.850000,	-32.57
+6.950000,	-32.55
+7.050000,	-32.52
+7.150000,	-32.58
+7.250000,	-32.52
+7.350000,	-32.55
+7.450000,	-32.49
+7.550000,	-31.06
+7.650000,	-26.99
+7.750000,	-53.42
+7.850000,	-28.87
+7.950000,	-36.56
+8.050000,	-36.01
+8.150000,	-30.30
+8.250000,	-55.06
+8.350000,	-30.54
+8.450000,	-37.42
+8.550000,	-36.72
+8.650000,	-31.61
+8.750000,	-55.76
+8.850000,	-30.70
+8.950000,	-37.93
+9.050000,	-37.12
+9.150000,	-31.20
+9.250000,	-56.36
+9.350000,	-31.10
+9.450000,	-37.98
+9.550000,	-36.96
+9.650000,	-31.16
+9.750000,	-56.54
+9.850000,	-30.74
+9.950000,	-37.79
+10.050000,	-46.34
+10.150000,	-45.90
+10.250000,	-45.84
+10.350000,	-45.58
+10.450000,	-45.17
+10.550000,	-44.96
+10.650000,	-44.76
+10.750000,	-44.55
+10.850000,	-44.31
+10.950000,	-44.14
+11.050000,	-43.95
+11.150000,	-43.62
+11.250000,	-43.75
+11.350000,	-43.65
+11.450000,	-42.97
+11.550000,	-43.11
+11.650000,	-43.14
+11.750000,	-42.73
+11.850000,	-42.40
+11.950000,	-42.39
+12.050000,	-42.42
+12.150000,	-42.09
+12.250000,	-41.68
+12.350000,	-41.76
+12.450000,	-41.87
+12.550000,	-72.12
+12.650000,	-71.27
+12.750000,	-70.51
+12.850000,	-69.62
+12.950000,	-69.02
+13.050000,	-68.73
+13.150000,	-68.13
+13.250000,	-68.14
+13.350000,	-67.59
+13.450000,	-67.55
+13.550000,	-67.50
+13.650000,	-67.13
+13.750000,	-67.07
+13.850000,	-67.13
+13.950000,	-66.70
+14.050000,	-66.65
+14.150000,	-66.60
+14.250000,	-66.41
+14.350000,	-66.33
+14.450000,	-66.32
+14.550000,	-66.22
+14.650000,	-65.74
+14.750000,	-65.85
+14.850000,	-65.73
+14.950000,	-65.62
+15.050000,	-33.54
+15.150000,	-29.36
+15.250000,	-54.97
+15.350000,	-30.47
+15.450000,	-38.06
+15.550000,	-37.98
+15.650000,	-31.09
+15.750000,	-56.02
+15.850000,	-31.01
+15.950000,	-38.50
+16.050000,	-37.57
+16.150000,	-31.43
+16.250000,	-56.61
+16.350000,	-31.47
+16.450000,	-39.49
+16.550000,	-38.76
+16.650000,	-31.60
+16.750000,	-57.31
+16.850000,	-31.63
+16.950000,	-38.52
+17.050000,	-38.14
+17.150000,	-31.74
+17.250000,	-55.86
+17.350000,	-31.99
+17.450000,	-38.86
+17.550000,	-47.85
+17.650000,	-47.95
+17.750000,	-47.78
+17.850000,	-47.63
+17.950000,	-47.31
+18.050000,	-47.21
+18.150000,	-47.30
+18.250000,	-47.02
+18.350000,	-46.67
+18.450000,	-46.77
+18.550000,	-46.77
+18.650000,	-46.27
+18.750000,	-46.26
+18.850000,	-46.28
+18.950000,	-46.08
+19.050000,	-45.95
+19.150000,	-45.88
+19.250000,	-45.91
+19.350000,	-45.65
+19.450000,	-45.58
+19.550000,	-45.53
+19.650000,	-45.37
+19.750000,	-45.36
+19.850000,	-45.33
+19.950000,	-45.07
@@ -0,0 +1,200 @@
+0.050000,	-70.60
+0.150000,	-63.05
+0.250000,	-88.79
+0.350000,	-62.18
+0.450000,	-69.37
+0.550000,	-69.39
+0.650000,	-62.69
+0.750000,	-86.49
+0.850000,	-61.79
+0.950000,	-69.08
+1.050000,	-68.38
+1.150000,	-61.78
+1.250000,	-86.74
+1.350000,	-62.10
+1.450000,	-68.36
+1.550000,	-67.43
+1.650000,	-61.43
+1.750000,	-86.09
+1.850000,	-61.17
+1.950000,	-68.19
+2.050000,	-67.93
+2.150000,	-61.10
+2.250000,	-85.05
+2.350000,	-60.70
+2.450000,	-67.03
+2.550000,	-47.14
+2.650000,	-48.00
+2.750000,	-47.92
+2.850000,	-47.85
+2.950000,	-47.96
+3.050000,	-47.97
+3.150000,	-47.98
+3.250000,	-47.88
+3.350000,	-47.80
+3.450000,	-48.02
+3.550000,	-48.02
+3.650000,	-47.71
+3.750000,	-47.75
+3.850000,	-48.03
+3.950000,	-48.07
+4.050000,	-47.70
+4.150000,	-47.87
+4.250000,	-48.09
+4.350000,	-48.00
+4.450000,	-47.61
+4.550000,	-47.86
+4.650000,	-48.15
+4.750000,	-47.93
+4.850000,	-47.78
+4.950000,	-47.87
+5.050000,	-31.40
+5.150000,	-32.07
+5.250000,	-32.29
+5.350000,	-32.64
+5.450000,	-32.48
+5.550000,	-32.53
+5.650000,	-32.54
+5.750000,	-32.62
+5.850000,	-32.57
+5.950000,	-32.55
+6.050000,	-32.65
+6.150000,	-32.63
+6.250000,	-32.51
+6.350000,	-32.46
+6.450000,	-32.51
+6.550000,	-32.56
+6.650000,	-32.55
+6.750000,	-32.54
+6.850000,	-32.53
+6.950000,	-32.49
+7.050000,	-32.64
+7.150000,	-32.53
+7.250000,	-32.50
+7.350000,	-32.57
+7.450000,	-32.50
+7.550000,	-31.38
+7.650000,	-26.97
+7.750000,	-53.32
+7.850000,	-28.58
+7.950000,	-36.79
+8.050000,	-36.53
+8.150000,	-30.25
+8.250000,	-55.96
+8.350000,	-30.57
+8.450000,	-37.60
+8.550000,	-36.78
+8.650000,	-31.14
+8.750000,	-56.71
+8.850000,	-31.36
+8.950000,	-38.32
+9.050000,	-37.25
+9.150000,	-31.50
+9.250000,	-56.06
+9.350000,	-31.06
+9.450000,	-37.61
+9.550000,	-37.20
+9.650000,	-31.14
+9.750000,	-57.18
+9.850000,	-30.99
+9.950000,	-38.51
+10.050000,	-46.33
+10.150000,	-45.82
+10.250000,	-45.90
+10.350000,	-45.55
+10.450000,	-45.29
+10.550000,	-44.96
+10.650000,	-44.85
+10.750000,	-44.57
+10.850000,	-44.30
+10.950000,	-44.09
+11.050000,	-43.86
+11.150000,	-43.66
+11.250000,	-43.78
+11.350000,	-43.62
+11.450000,	-43.10
+11.550000,	-43.10
+11.650000,	-43.12
+11.750000,	-42.77
+11.850000,	-42.39
+11.950000,	-42.45
+12.050000,	-42.40
+12.150000,	-42.11
+12.250000,	-41.73
+12.350000,	-41.77
+12.450000,	-41.89
+12.550000,	-72.17
+12.650000,	-71.16
+12.750000,	-70.36
+12.850000,	-69.59
+12.950000,	-68.93
+13.050000,	-68.71
+13.150000,	-68.12
+13.250000,	-68.08
+13.350000,	-67.62
+13.450000,	-67.50
+13.550000,	-67.54
+13.650000,	-67.14
+13.750000,	-67.11
+13.850000,	-67.12
+13.950000,	-66.65
+14.050000,	-66.63
+14.150000,	-66.68
+14.250000,	-66.34
+14.350000,	-66.23
+14.450000,	-66.20
+14.550000,	-66.04
+14.650000,	-65.89
+14.750000,	-65.86
+14.850000,	-65.90
+14.950000,	-65.67
+15.050000,	-33.59
+15.150000,	-30.24
+15.250000,	-55.37
+15.350000,	-30.46
+15.450000,	-37.66
+15.550000,	-38.31
+15.650000,	-30.85
+15.750000,	-56.58
+15.850000,	-31.18
+15.950000,	-38.45
+16.050000,	-37.71
+16.150000,	-31.70
+16.250000,	-56.70
+16.350000,	-31.31
+16.450000,	-38.66
+16.550000,	-37.38
+16.650000,	-31.95
+16.750000,	-56.66
+16.850000,	-31.55
+16.950000,	-39.39
+17.050000,	-37.92
+17.150000,	-31.84
+17.250000,	-57.06
+17.350000,	-31.69
+17.450000,	-39.16
+17.550000,	-47.92
+17.650000,	-48.03
+17.750000,	-47.86
+17.850000,	-47.61
+17.950000,	-47.32
+18.050000,	-47.23
+18.150000,	-47.33
+18.250000,	-47.05
+18.350000,	-46.56
+18.450000,	-46.76
+18.550000,	-46.80
+18.650000,	-46.31
+18.750000,	-46.19
+18.850000,	-46.26
+18.950000,	-46.16
+19.050000,	-45.94
+19.150000,	-45.89
+19.250000,	-45.91
+19.350000,	-45.66
+19.450000,	-45.59
+19.550000,	-45.49
+19.650000,	-45.31
+19.750000,	-45.35
+19.850000,	-45.33
+19.950000,	-45.05
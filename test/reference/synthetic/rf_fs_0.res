@@ -0,0 +1,200 @@
+0.050000,	-65.17
+0.150000,	-58.73
+0.250000,	-83.19
+0.350000,	-58.11
+0.450000,	-64.62
+0.550000,	-63.76
+0.650000,	-57.32
+0.750000,	-81.32
+0.850000,	-56.52
+0.950000,	-64.21
+1.050000,	-64.06
+1.150000,	-56.81
+1.250000,	-81.24
+1.350000,	-56.50
+1.450000,	-62.99
+1.550000,	-62.70
+1.650000,	-56.09
+1.750000,	-80.47
+1.850000,	-55.75
+1.950000,	-62.35
+2.050000,	-61.97
+2.150000,	-55.57
+2.250000,	-79.95
+2.350000,	-55.35
+2.450000,	-62.29
+2.550000,	-41.76
+2.650000,	-42.34
+2.750000,	-43.08
+2.850000,	-43.01
+2.950000,	-43.00
+3.050000,	-43.08
+3.150000,	-43.12
+3.250000,	-43.07
+3.350000,	-42.88
+3.450000,	-43.17
+3.550000,	-43.14
+3.650000,	-42.91
+3.750000,	-42.86
+3.850000,	-43.23
+3.950000,	-43.16
+4.050000,	-42.80
+4.150000,	-43.02
+4.250000,	-43.31
+4.350000,	-43.09
+4.450000,	-42.85
+4.550000,	-43.02
+4.650000,	-43.24
+4.750000,	-43.01
+4.850000,	-42.90
+4.950000,	-43.07
+5.050000,	-27.41
+5.150000,	-29.23
+5.250000,	-29.91
+5.350000,	-30.04
+5.450000,	-29.89
+5.550000,	-30.17
+5.650000,	-30.43
+5.750000,	-30.44
+5.850000,	-30.42
+5.950000,	-30.44
+6.050000,	-30.37
+6.150000,	-30.36
+6.250000,	-30.48
+6.350000,	-30.35
+6.450000,	-30.43
+6.550000,	-30.44
+6.650000,	-30.36
+6.750000,	-30.55
+6.850000,	-30.46
+6.950000,	-30.39
+7.050000,	-30.43
+7.150000,	-30.53
+7.250000,	-30.35
+7.350000,	-30.41
+7.450000,	-30.46
+7.550000,	-29.70
+7.650000,	-25.63
+7.750000,	-52.17
+7.850000,	-28.13
+7.950000,	-36.18
+8.050000,	-35.24
+8.150000,	-29.39
+8.250000,	-55.09
+8.350000,	-29.40
+8.450000,	-36.73
+8.550000,	-35.07
+8.650000,	-30.10
+8.750000,	-55.77
+8.850000,	-29.63
+8.950000,	-37.00
+9.050000,	-36.29
+9.150000,	-30.42
+9.250000,	-55.13
+9.350000,	-30.13
+9.450000,	-36.94
+9.550000,	-36.47
+9.650000,	-30.45
+9.750000,	-55.36
+9.850000,	-30.40
+9.950000,	-36.99
+10.050000,	-45.64
+10.150000,	-44.97
+10.250000,	-44.88
+10.350000,	-44.64
+10.450000,	-44.24
+10.550000,	-43.78
+10.650000,	-43.49
+10.750000,	-43.26
+10.850000,	-42.85
+10.950000,	-42.65
+11.050000,	-42.21
+11.150000,	-41.99
+11.250000,	-41.85
+11.350000,	-41.60
+11.450000,	-41.13
+11.550000,	-40.96
+11.650000,	-41.00
+11.750000,	-40.62
+11.850000,	-40.13
+11.950000,	-40.09
+12.050000,	-40.17
+12.150000,	-39.66
+12.250000,	-39.36
+12.350000,	-39.43
+12.450000,	-39.34
+12.550000,	-69.70
+12.650000,	-68.57
+12.750000,	-67.43
+12.850000,	-66.58
+12.950000,	-65.77
+13.050000,	-64.98
+13.150000,	-64.48
+13.250000,	-64.21
+13.350000,	-64.08
+13.450000,	-64.01
+13.550000,	-64.06
+13.650000,	-63.70
+13.750000,	-63.39
+13.850000,	-63.36
+13.950000,	-62.89
+14.050000,	-62.81
+14.150000,	-62.81
+14.250000,	-62.49
+14.350000,	-62.34
+14.450000,	-62.35
+14.550000,	-61.97
+14.650000,	-61.87
+14.750000,	-61.99
+14.850000,	-61.67
+14.950000,	-61.47
+15.050000,	-30.79
+15.150000,	-28.29
+15.250000,	-54.07
+15.350000,	-29.59
+15.450000,	-36.86
+15.550000,	-35.65
+15.650000,	-30.74
+15.750000,	-54.26
+15.850000,	-30.36
+15.950000,	-37.74
+16.050000,	-36.69
+16.150000,	-30.85
+16.250000,	-56.15
+16.350000,	-30.50
+16.450000,	-38.35
+16.550000,	-36.82
+16.650000,	-31.22
+16.750000,	-56.19
+16.850000,	-30.53
+16.950000,	-37.48
+17.050000,	-36.79
+17.150000,	-30.89
+17.250000,	-55.87
+17.350000,	-30.22
+17.450000,	-38.15
+17.550000,	-46.96
+17.650000,	-46.76
+17.750000,	-46.71
+17.850000,	-46.11
+17.950000,	-45.68
+18.050000,	-45.60
+18.150000,	-45.45
+18.250000,	-45.04
+18.350000,	-44.87
+18.450000,	-44.68
+18.550000,	-44.34
+18.650000,	-44.10
+18.750000,	-43.85
+18.850000,	-43.79
+18.950000,	-43.90
+19.050000,	-43.43
+19.150000,	-43.30
+19.250000,	-43.18
+19.350000,	-42.74
+19.450000,	-42.92
+19.550000,	-42.68
+19.650000,	-42.14
+19.750000,	-42.37
+19.850000,	-42.31
+19.950000,	-41.79
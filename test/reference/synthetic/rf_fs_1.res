@@ -0,0 +1,200 @@
+0.050000,	-65.49
+0.150000,	-58.34
+0.250000,	-82.86
+0.350000,	-58.04
+0.450000,	-64.55
+0.550000,	-64.15
+0.650000,	-57.26
+0.750000,	-81.90
+0.850000,	-56.36
+0.950000,	-63.68
+1.050000,	-63.13
+1.150000,	-56.46
+1.250000,	-81.63
+1.350000,	-56.62
+1.450000,	-63.46
+1.550000,	-63.44
+1.650000,	-55.66
+1.750000,	-80.72
+1.850000,	-55.66
+1.950000,	-62.06
+2.050000,	-62.52
+2.150000,	-55.94
+2.250000,	-79.61
+2.350000,	-55.19
+2.450000,	-61.74
+2.550000,	-41.85
+2.650000,	-42.39
+2.750000,	-43.03
+2.850000,	-43.02
+2.950000,	-43.02
+3.050000,	-43.10
+3.150000,	-43.09
+3.250000,	-42.96
+3.350000,	-42.91
+3.450000,	-43.19
+3.550000,	-43.24
+3.650000,	-42.87
+3.750000,	-42.92
+3.850000,	-43.20
+3.950000,	-43.12
+4.050000,	-42.80
+4.150000,	-43.02
+4.250000,	-43.23
+4.350000,	-43.17
+4.450000,	-42.77
+4.550000,	-43.02
+4.650000,	-43.28
+4.750000,	-42.96
+4.850000,	-43.03
+4.950000,	-43.07
+5.050000,	-27.47
+5.150000,	-29.24
+5.250000,	-29.83
+5.350000,	-29.90
+5.450000,	-30.02
+5.550000,	-30.14
+5.650000,	-30.39
+5.750000,	-30.48
+5.850000,	-30.38
+5.950000,	-30.44
+6.050000,	-30.46
+6.150000,	-30.48
+6.250000,	-30.50
+6.350000,	-30.43
+6.450000,	-30.43
+6.550000,	-30.47
+6.650000,	-30.51
+6.750000,	-30.43
+6.850000,	-30.35
+6.950000,	-30.49
+7.050000,	-30.40
+7.150000,	-30.46
+7.250000,	-30.44
+7.350000,	-30.35
+7.450000,	-30.38
+7.550000,	-29.69
+7.650000,	-26.09
+7.750000,	-52.42
+7.850000,	-28.41
+7.950000,	-35.39
+8.050000,	-34.75
+8.150000,	-30.40
+8.250000,	-54.07
+8.350000,	-29.47
+8.450000,	-37.51
+8.550000,	-36.12
+8.650000,	-30.34
+8.750000,	-54.91
+8.850000,	-29.89
+8.950000,	-37.40
+9.050000,	-36.87
+9.150000,	-30.25
+9.250000,	-54.91
+9.350000,	-30.17
+9.450000,	-37.12
+9.550000,	-36.02
+9.650000,	-30.08
+9.750000,	-55.04
+9.850000,	-30.38
+9.950000,	-37.07
+10.050000,	-45.47
+10.150000,	-44.96
+10.250000,	-44.84
+10.350000,	-44.65
+10.450000,	-44.27
+10.550000,	-43.78
+10.650000,	-43.50
+10.750000,	-43.27
+10.850000,	-42.97
+10.950000,	-42.54
+11.050000,	-42.25
+11.150000,	-42.02
+11.250000,	-41.78
+11.350000,	-41.61
+11.450000,	-41.23
+11.550000,	-41.01
+11.650000,	-40.99
+11.750000,	-40.61
+11.850000,	-40.11
+11.950000,	-40.17
+12.050000,	-40.11
+12.150000,	-39.70
+12.250000,	-39.34
+12.350000,	-39.43
+12.450000,	-39.37
+12.550000,	-69.63
+12.650000,	-68.56
+12.750000,	-67.61
+12.850000,	-66.61
+12.950000,	-65.87
+13.050000,	-64.91
+13.150000,	-64.36
+13.250000,	-64.16
+13.350000,	-64.07
+13.450000,	-64.14
+13.550000,	-64.07
+13.650000,	-63.62
+13.750000,	-63.29
+13.850000,	-63.33
+13.950000,	-63.00
+14.050000,	-62.86
+14.150000,	-62.77
+14.250000,	-62.44
+14.350000,	-62.32
+14.450000,	-62.28
+14.550000,	-62.03
+14.650000,	-61.91
+14.750000,	-61.83
+14.850000,	-61.71
+14.950000,	-61.35
+15.050000,	-30.38
+15.150000,	-28.25
+15.250000,	-53.73
+15.350000,	-29.42
+15.450000,	-36.99
+15.550000,	-35.99
+15.650000,	-30.79
+15.750000,	-56.56
+15.850000,	-30.38
+15.950000,	-37.81
+16.050000,	-37.49
+16.150000,	-30.60
+16.250000,	-56.81
+16.350000,	-30.90
+16.450000,	-37.85
+16.550000,	-37.21
+16.650000,	-31.10
+16.750000,	-56.03
+16.850000,	-30.61
+16.950000,	-38.35
+17.050000,	-36.54
+17.150000,	-31.05
+17.250000,	-56.36
+17.350000,	-31.23
+17.450000,	-38.24
+17.550000,	-46.93
+17.650000,	-46.83
+17.750000,	-46.65
+17.850000,	-46.14
+17.950000,	-45.76
+18.050000,	-45.70
+18.150000,	-45.53
+18.250000,	-45.08
+18.350000,	-44.77
+18.450000,	-44.72
+18.550000,	-44.43
+18.650000,	-44.14
+18.750000,	-43.93
+18.850000,	-43.74
+18.950000,	-43.86
+19.050000,	-43.39
+19.150000,	-43.35
+19.250000,	-43.22
+19.350000,	-42.75
+19.450000,	-42.90
+19.550000,	-42.69
+19.650000,	-42.20
+19.750000,	-42.30
+19.850000,	-42.37
+19.950000,	-41.75
@@ -0,0 +1,200 @@
+0.050000,	-62.42
+0.150000,	-55.25
+0.250000,	-80.40
+0.350000,	-54.31
+0.450000,	-62.18
+0.550000,	-60.61
+0.650000,	-54.01
+0.750000,	-79.15
+0.850000,	-54.43
+0.950000,	-59.93
+1.050000,	-59.84
+1.150000,	-53.72
+1.250000,	-78.23
+1.350000,	-53.42
+1.450000,	-60.11
+1.550000,	-59.69
+1.650000,	-52.90
+1.750000,	-77.81
+1.850000,	-52.81
+1.950000,	-59.14
+2.050000,	-58.51
+2.150000,	-52.51
+2.250000,	-77.26
+2.350000,	-52.29
+2.450000,	-58.91
+2.550000,	-38.70
+2.650000,	-39.25
+2.750000,	-39.96
+2.850000,	-39.90
+2.950000,	-39.87
+3.050000,	-39.97
+3.150000,	-40.04
+3.250000,	-39.94
+3.350000,	-39.81
+3.450000,	-40.04
+3.550000,	-40.13
+3.650000,	-39.80
+3.750000,	-39.81
+3.850000,	-40.11
+3.950000,	-40.11
+4.050000,	-39.71
+4.150000,	-39.86
+4.250000,	-40.23
+4.350000,	-40.01
+4.450000,	-39.73
+4.550000,	-39.93
+4.650000,	-40.11
+4.750000,	-39.91
+4.850000,	-39.89
+4.950000,	-39.96
+5.050000,	-24.28
+5.150000,	-26.19
+5.250000,	-26.77
+5.350000,	-26.85
+5.450000,	-26.91
+5.550000,	-27.14
+5.650000,	-27.34
+5.750000,	-27.43
+5.850000,	-27.36
+5.950000,	-27.38
+6.050000,	-27.38
+6.150000,	-27.31
+6.250000,	-27.26
+6.350000,	-27.32
+6.450000,	-27.24
+6.550000,	-27.38
+6.650000,	-27.39
+6.750000,	-27.28
+6.850000,	-27.38
+6.950000,	-27.34
+7.050000,	-27.32
+7.150000,	-27.39
+7.250000,	-27.28
+7.350000,	-27.33
+7.450000,	-27.30
+7.550000,	-25.76
+7.650000,	-22.69
+7.750000,	-49.46
+7.850000,	-24.93
+7.950000,	-33.15
+8.050000,	-31.66
+8.150000,	-26.71
+8.250000,	-51.47
+8.350000,	-26.70
+8.450000,	-34.01
+8.550000,	-32.49
+8.650000,	-27.08
+8.750000,	-52.41
+8.850000,	-26.83
+8.950000,	-34.20
+9.050000,	-32.79
+9.150000,	-27.30
+9.250000,	-52.50
+9.350000,	-27.01
+9.450000,	-34.75
+9.550000,	-33.40
+9.650000,	-27.26
+9.750000,	-52.19
+9.850000,	-26.79
+9.950000,	-33.55
+10.050000,	-42.39
+10.150000,	-41.83
+10.250000,	-41.67
+10.350000,	-41.58
+10.450000,	-41.18
+10.550000,	-40.72
+10.650000,	-40.41
+10.750000,	-40.17
+10.850000,	-39.82
+10.950000,	-39.50
+11.050000,	-39.23
+11.150000,	-38.82
+11.250000,	-38.74
+11.350000,	-38.59
+11.450000,	-38.07
+11.550000,	-37.85
+11.650000,	-37.95
+11.750000,	-37.48
+11.850000,	-37.02
+11.950000,	-37.02
+12.050000,	-37.14
+12.150000,	-36.63
+12.250000,	-36.25
+12.350000,	-36.34
+12.450000,	-36.36
+12.550000,	-66.58
+12.650000,	-65.50
+12.750000,	-64.28
+12.850000,	-63.60
+12.950000,	-62.78
+13.050000,	-61.89
+13.150000,	-61.44
+13.250000,	-61.14
+13.350000,	-60.96
+13.450000,	-61.07
+13.550000,	-61.04
+13.650000,	-60.66
+13.750000,	-60.22
+13.850000,	-60.24
+13.950000,	-59.82
+14.050000,	-59.77
+14.150000,	-59.84
+14.250000,	-59.44
+14.350000,	-59.26
+14.450000,	-59.17
+14.550000,	-59.04
+14.650000,	-58.77
+14.750000,	-58.75
+14.850000,	-58.59
+14.950000,	-58.32
+15.050000,	-27.08
+15.150000,	-24.82
+15.250000,	-50.92
+15.350000,	-26.03
+15.450000,	-34.10
+15.550000,	-32.80
+15.650000,	-27.45
+15.750000,	-51.26
+15.850000,	-26.91
+15.950000,	-34.56
+16.050000,	-34.05
+16.150000,	-28.00
+16.250000,	-52.95
+16.350000,	-27.14
+16.450000,	-35.09
+16.550000,	-33.85
+16.650000,	-27.74
+16.750000,	-53.45
+16.850000,	-27.88
+16.950000,	-35.48
+17.050000,	-34.04
+17.150000,	-27.60
+17.250000,	-53.11
+17.350000,	-27.51
+17.450000,	-35.36
+17.550000,	-43.79
+17.650000,	-43.67
+17.750000,	-43.60
+17.850000,	-43.11
+17.950000,	-42.67
+18.050000,	-42.57
+18.150000,	-42.42
+18.250000,	-41.92
+18.350000,	-41.68
+18.450000,	-41.64
+18.550000,	-41.41
+18.650000,	-41.04
+18.750000,	-40.86
+18.850000,	-40.68
+18.950000,	-40.77
+19.050000,	-40.24
+19.150000,	-40.16
+19.250000,	-40.12
+19.350000,	-39.69
+19.450000,	-39.75
+19.550000,	-39.53
+19.650000,	-39.04
+19.750000,	-39.23
+19.850000,	-39.33
+19.950000,	-38.58
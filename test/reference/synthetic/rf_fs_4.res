@@ -0,0 +1,200 @@
+0.050000,	-69.89
+0.150000,	-63.43
+0.250000,	-87.33
+0.350000,	-63.13
+0.450000,	-69.69
+0.550000,	-68.78
+0.650000,	-62.08
+0.750000,	-86.43
+0.850000,	-62.21
+0.950000,	-68.57
+1.050000,	-68.41
+1.150000,	-61.41
+1.250000,	-85.59
+1.350000,	-61.06
+1.450000,	-67.16
+1.550000,	-67.00
+1.650000,	-60.85
+1.750000,	-85.75
+1.850000,	-60.17
+1.950000,	-66.59
+2.050000,	-66.61
+2.150000,	-60.53
+2.250000,	-85.30
+2.350000,	-60.21
+2.450000,	-66.48
+2.550000,	-46.72
+2.650000,	-47.11
+2.750000,	-47.93
+2.850000,	-47.91
+2.950000,	-47.85
+3.050000,	-47.96
+3.150000,	-48.08
+3.250000,	-47.89
+3.350000,	-47.75
+3.450000,	-48.09
+3.550000,	-48.07
+3.650000,	-47.77
+3.750000,	-47.82
+3.850000,	-48.01
+3.950000,	-48.01
+4.050000,	-47.70
+4.150000,	-47.86
+4.250000,	-48.14
+4.350000,	-48.02
+4.450000,	-47.64
+4.550000,	-47.92
+4.650000,	-48.15
+4.750000,	-47.92
+4.850000,	-47.76
+4.950000,	-47.93
+5.050000,	-32.34
+5.150000,	-34.08
+5.250000,	-34.67
+5.350000,	-34.89
+5.450000,	-34.99
+5.550000,	-35.10
+5.650000,	-35.33
+5.750000,	-35.20
+5.850000,	-35.21
+5.950000,	-35.23
+6.050000,	-35.34
+6.150000,	-35.30
+6.250000,	-35.33
+6.350000,	-35.20
+6.450000,	-35.29
+6.550000,	-35.41
+6.650000,	-35.32
+6.750000,	-35.24
+6.850000,	-35.30
+6.950000,	-35.27
+7.050000,	-35.24
+7.150000,	-35.30
+7.250000,	-35.24
+7.350000,	-35.28
+7.450000,	-35.21
+7.550000,	-34.01
+7.650000,	-30.42
+7.750000,	-57.00
+7.850000,	-32.81
+7.950000,	-40.78
+8.050000,	-40.02
+8.150000,	-34.55
+8.250000,	-59.22
+8.350000,	-34.60
+8.450000,	-41.73
+8.550000,	-40.61
+8.650000,	-35.76
+8.750000,	-59.81
+8.850000,	-34.72
+8.950000,	-42.17
+9.050000,	-41.04
+9.150000,	-35.30
+9.250000,	-60.38
+9.350000,	-35.18
+9.450000,	-42.23
+9.550000,	-41.05
+9.650000,	-35.30
+9.750000,	-60.55
+9.850000,	-34.78
+9.950000,	-42.03
+10.050000,	-50.40
+10.150000,	-49.88
+10.250000,	-49.72
+10.350000,	-49.49
+10.450000,	-49.07
+10.550000,	-48.60
+10.650000,	-48.36
+10.750000,	-48.14
+10.850000,	-47.77
+10.950000,	-47.51
+11.050000,	-47.24
+11.150000,	-46.88
+11.250000,	-46.69
+11.350000,	-46.55
+11.450000,	-46.00
+11.550000,	-45.84
+11.650000,	-45.88
+11.750000,	-45.56
+11.850000,	-44.95
+11.950000,	-44.96
+12.050000,	-45.07
+12.150000,	-44.50
+12.250000,	-44.11
+12.350000,	-44.26
+12.450000,	-44.20
+12.550000,	-74.42
+12.650000,	-73.39
+12.750000,	-72.41
+12.850000,	-71.35
+12.950000,	-70.55
+13.050000,	-69.80
+13.150000,	-69.28
+13.250000,	-69.12
+13.350000,	-68.89
+13.450000,	-68.86
+13.550000,	-68.90
+13.650000,	-68.50
+13.750000,	-68.04
+13.850000,	-68.12
+13.950000,	-67.76
+14.050000,	-67.56
+14.150000,	-67.52
+14.250000,	-67.31
+14.350000,	-67.19
+14.450000,	-67.19
+14.550000,	-66.93
+14.650000,	-66.57
+14.750000,	-66.68
+14.850000,	-66.41
+14.950000,	-66.22
+15.050000,	-35.13
+15.150000,	-32.69
+15.250000,	-58.60
+15.350000,	-34.18
+15.450000,	-42.33
+15.550000,	-41.62
+15.650000,	-35.10
+15.750000,	-60.08
+15.850000,	-35.06
+15.950000,	-42.68
+16.050000,	-41.46
+16.150000,	-35.62
+16.250000,	-60.80
+16.350000,	-35.49
+16.450000,	-43.57
+16.550000,	-42.65
+16.650000,	-35.67
+16.750000,	-61.27
+16.850000,	-35.66
+16.950000,	-42.60
+17.050000,	-42.03
+17.150000,	-35.79
+17.250000,	-59.87
+17.350000,	-36.02
+17.450000,	-42.95
+17.550000,	-51.76
+17.650000,	-51.60
+17.750000,	-51.51
+17.850000,	-51.09
+17.950000,	-50.64
+18.050000,	-50.52
+18.150000,	-50.36
+18.250000,	-49.93
+18.350000,	-49.71
+18.450000,	-49.56
+18.550000,	-49.28
+18.650000,	-48.99
+18.750000,	-48.78
+18.850000,	-48.64
+18.950000,	-48.61
+19.050000,	-48.29
+19.150000,	-48.12
+19.250000,	-48.12
+19.350000,	-47.65
+19.450000,	-47.70
+19.550000,	-47.56
+19.650000,	-47.03
+19.750000,	-47.20
+19.850000,	-47.25
+19.950000,	-46.65
@@ -0,0 +1,200 @@
+0.050000,	-70.60
+0.150000,	-63.05
+0.250000,	-88.35
+0.350000,	-62.17
+0.450000,	-69.37
+0.550000,	-68.91
+0.650000,	-62.20
+0.750000,	-86.49
+0.850000,	-61.44
+0.950000,	-68.61
+1.050000,	-68.38
+1.150000,	-61.75
+1.250000,	-86.30
+1.350000,	-61.66
+1.450000,	-67.91
+1.550000,	-67.00
+1.650000,	-61.00
+1.750000,	-85.63
+1.850000,	-60.41
+1.950000,	-67.36
+2.050000,	-67.52
+2.150000,	-60.70
+2.250000,	-84.49
+2.350000,	-59.91
+2.450000,	-66.25
+2.550000,	-46.64
+2.650000,	-47.26
+2.750000,	-47.92
+2.850000,	-47.85
+2.950000,	-47.96
+3.050000,	-47.97
+3.150000,	-47.98
+3.250000,	-47.88
+3.350000,	-47.80
+3.450000,	-48.02
+3.550000,	-48.02
+3.650000,	-47.71
+3.750000,	-47.75
+3.850000,	-48.03
+3.950000,	-48.07
+4.050000,	-47.70
+4.150000,	-47.87
+4.250000,	-48.09
+4.350000,	-48.00
+4.450000,	-47.61
+4.550000,	-47.86
+4.650000,	-48.15
+4.750000,	-47.93
+4.850000,	-47.78
+4.950000,	-47.87
+5.050000,	-32.22
+5.150000,	-34.01
+5.250000,	-34.70
+5.350000,	-34.92
+5.450000,	-34.76
+5.550000,	-35.03
+5.650000,	-35.27
+5.750000,	-35.34
+5.850000,	-35.30
+5.950000,	-35.27
+6.050000,	-35.38
+6.150000,	-35.36
+6.250000,	-35.24
+6.350000,	-35.18
+6.450000,	-35.23
+6.550000,	-35.28
+6.650000,	-35.28
+6.750000,	-35.26
+6.850000,	-35.26
+6.950000,	-35.21
+7.050000,	-35.37
+7.150000,	-35.25
+7.250000,	-35.22
+7.350000,	-35.29
+7.450000,	-35.23
+7.550000,	-34.32
+7.650000,	-30.39
+7.750000,	-56.86
+7.850000,	-32.51
+7.950000,	-41.01
+8.050000,	-40.51
+8.150000,	-34.49
+8.250000,	-60.13
+8.350000,	-34.64
+8.450000,	-41.92
+8.550000,	-40.65
+8.650000,	-35.30
+8.750000,	-60.72
+8.850000,	-35.39
+8.950000,	-42.56
+9.050000,	-41.20
+9.150000,	-35.60
+9.250000,	-60.05
+9.350000,	-35.15
+9.450000,	-41.85
+9.550000,	-41.30
+9.650000,	-35.28
+9.750000,	-61.15
+9.850000,	-35.00
+9.950000,	-42.75
+10.050000,	-50.39
+10.150000,	-49.80
+10.250000,	-49.77
+10.350000,	-49.46
+10.450000,	-49.18
+10.550000,	-48.61
+10.650000,	-48.45
+10.750000,	-48.16
+10.850000,	-47.76
+10.950000,	-47.45
+11.050000,	-47.15
+11.150000,	-46.91
+11.250000,	-46.72
+11.350000,	-46.52
+11.450000,	-46.12
+11.550000,	-45.83
+11.650000,	-45.86
+11.750000,	-45.59
+11.850000,	-44.95
+11.950000,	-45.03
+12.050000,	-45.05
+12.150000,	-44.52
+12.250000,	-44.17
+12.350000,	-44.27
+12.450000,	-44.21
+12.550000,	-74.46
+12.650000,	-73.29
+12.750000,	-72.26
+12.850000,	-71.32
+12.950000,	-70.45
+13.050000,	-69.79
+13.150000,	-69.26
+13.250000,	-69.06
+13.350000,	-68.93
+13.450000,	-68.80
+13.550000,	-68.92
+13.650000,	-68.49
+13.750000,	-68.08
+13.850000,	-68.10
+13.950000,	-67.72
+14.050000,	-67.55
+14.150000,	-67.60
+14.250000,	-67.23
+14.350000,	-67.10
+14.450000,	-67.08
+14.550000,	-66.76
+14.650000,	-66.72
+14.750000,	-66.68
+14.850000,	-66.58
+14.950000,	-66.27
+15.050000,	-35.20
+15.150000,	-33.60
+15.250000,	-59.00
+15.350000,	-34.17
+15.450000,	-41.94
+15.550000,	-41.95
+15.650000,	-34.82
+15.750000,	-60.65
+15.850000,	-35.23
+15.950000,	-42.64
+16.050000,	-41.60
+16.150000,	-35.92
+16.250000,	-60.91
+16.350000,	-35.33
+16.450000,	-42.74
+16.550000,	-41.28
+16.650000,	-36.01
+16.750000,	-60.66
+16.850000,	-35.55
+16.950000,	-43.47
+17.050000,	-41.81
+17.150000,	-35.91
+17.250000,	-61.10
+17.350000,	-35.72
+17.450000,	-43.24
+17.550000,	-51.82
+17.650000,	-51.68
+17.750000,	-51.60
+17.850000,	-51.06
+17.950000,	-50.64
+18.050000,	-50.54
+18.150000,	-50.38
+18.250000,	-49.96
+18.350000,	-49.60
+18.450000,	-49.55
+18.550000,	-49.31
+18.650000,	-49.04
+18.750000,	-48.70
+18.850000,	-48.63
+18.950000,	-48.69
+19.050000,	-48.27
+19.150000,	-48.13
+19.250000,	-48.12
+19.350000,	-47.66
+19.450000,	-47.72
+19.550000,	-47.52
+19.650000,	-46.96
+19.750000,	-47.20
+19.850000,	-47.25
+19.950000,	-46.63
@@ -0,0 +1,200 @@
+0.050000,	-65.17
+0.150000,	-58.73
+0.250000,	-83.18
+0.350000,	-58.11
+0.450000,	-64.61
+0.550000,	-63.75
+0.650000,	-57.04
+0.750000,	-80.85
+0.850000,	-55.94
+0.950000,	-63.76
+1.050000,	-63.19
+1.150000,	-55.97
+1.250000,	-80.61
+1.350000,	-55.67
+1.450000,	-62.17
+1.550000,	-61.91
+1.650000,	-55.49
+1.750000,	-79.67
+1.850000,	-55.10
+1.950000,	-61.96
+2.050000,	-60.90
+2.150000,	-55.00
+2.250000,	-79.40
+2.350000,	-54.83
+2.450000,	-61.92
+2.550000,	-41.47
+2.650000,	-42.67
+2.750000,	-43.08
+2.850000,	-43.01
+2.950000,	-43.00
+3.050000,	-43.08
+3.150000,	-43.12
+3.250000,	-43.07
+3.350000,	-42.88
+3.450000,	-43.17
+3.550000,	-43.14
+3.650000,	-42.91
+3.750000,	-42.86
+3.850000,	-43.23
+3.950000,	-43.16
+4.050000,	-42.80
+4.150000,	-43.02
+4.250000,	-43.31
+4.350000,	-43.09
+4.450000,	-42.85
+4.550000,	-43.02
+4.650000,	-43.24
+4.750000,	-43.01
+4.850000,	-42.90
+4.950000,	-43.07
+5.050000,	-26.57
+5.150000,	-27.30
+5.250000,	-27.50
+5.350000,	-27.76
+5.450000,	-27.61
+5.550000,	-27.66
+5.650000,	-27.71
+5.750000,	-27.72
+5.850000,	-27.70
+5.950000,	-27.71
+6.050000,	-27.64
+6.150000,	-27.64
+6.250000,	-27.75
+6.350000,	-27.63
+6.450000,	-27.71
+6.550000,	-27.72
+6.650000,	-27.63
+6.750000,	-27.82
+6.850000,	-27.73
+6.950000,	-27.66
+7.050000,	-27.70
+7.150000,	-27.81
+7.250000,	-27.63
+7.350000,	-27.68
+7.450000,	-27.74
+7.550000,	-26.70
+7.650000,	-21.43
+7.750000,	-47.29
+7.850000,	-22.83
+7.950000,	-30.29
+8.050000,	-29.55
+8.150000,	-23.30
+8.250000,	-48.83
+8.350000,	-23.17
+8.450000,	-30.11
+8.550000,	-29.05
+8.650000,	-23.60
+8.750000,	-49.43
+8.850000,	-23.24
+8.950000,	-30.36
+9.050000,	-30.20
+9.150000,	-23.85
+9.250000,	-48.67
+9.350000,	-23.64
+9.450000,	-30.30
+9.550000,	-30.17
+9.650000,	-23.87
+9.750000,	-48.88
+9.850000,	-24.00
+9.950000,	-30.35
+10.050000,	-39.18
+10.150000,	-38.61
+10.250000,	-38.86
+10.350000,	-38.83
+10.450000,	-38.24
+10.550000,	-38.26
+10.650000,	-38.11
+10.750000,	-37.79
+10.850000,	-37.75
+10.950000,	-37.70
+11.050000,	-37.17
+11.150000,	-37.25
+11.250000,	-37.38
+11.350000,	-36.89
+11.450000,	-36.69
+11.550000,	-36.82
+11.650000,	-36.73
+11.750000,	-36.45
+11.850000,	-36.24
+11.950000,	-36.26
+12.050000,	-36.24
+12.150000,	-35.98
+12.250000,	-35.80
+12.350000,	-35.95
+12.450000,	-35.79
+12.550000,	-66.33
+12.650000,	-65.33
+12.750000,	-64.39
+12.850000,	-64.00
+12.950000,	-63.14
+13.050000,	-62.50
+13.150000,	-62.02
+13.250000,	-61.88
+13.350000,	-61.65
+13.450000,	-61.37
+13.550000,	-61.43
+13.650000,	-61.09
+13.750000,	-61.15
+13.850000,	-60.98
+13.950000,	-60.60
+14.050000,	-60.68
+14.150000,	-60.44
+14.250000,	-60.33
+14.350000,	-60.31
+14.450000,	-60.05
+14.550000,	-59.85
+14.650000,	-59.92
+14.750000,	-59.81
+14.850000,	-59.54
+14.950000,	-59.61
+15.050000,	-29.04
+15.150000,	-24.67
+15.250000,	-50.22
+15.350000,	-25.36
+15.450000,	-32.12
+15.550000,	-31.15
+15.650000,	-26.05
+15.750000,	-49.48
+15.850000,	-25.68
+15.950000,	-33.06
+16.050000,	-31.89
+16.150000,	-25.95
+16.250000,	-51.25
+16.350000,	-25.64
+16.450000,	-33.24
+16.550000,	-32.02
+16.650000,	-26.22
+16.750000,	-51.27
+16.850000,	-25.67
+16.950000,	-32.38
+17.050000,	-31.98
+17.150000,	-25.93
+17.250000,	-50.88
+17.350000,	-25.31
+17.450000,	-33.05
+17.550000,	-42.08
+17.650000,	-42.10
+17.750000,	-42.06
+17.850000,	-41.74
+17.950000,	-41.53
+18.050000,	-41.43
+18.150000,	-41.53
+18.250000,	-41.36
+18.350000,	-41.15
+18.450000,	-41.06
+18.550000,	-41.01
+18.650000,	-40.96
+18.750000,	-40.60
+18.850000,	-40.63
+18.950000,	-40.75
+19.050000,	-40.71
+19.150000,	-40.41
+19.250000,	-40.22
+19.350000,	-40.25
+19.450000,	-40.42
+19.550000,	-40.25
+19.650000,	-39.76
+19.750000,	-39.99
+19.850000,	-40.04
+19.950000,	-39.85
@@ -0,0 +1,200 @@
+0.050000,	-65.49
+0.150000,	-58.34
+0.250000,	-82.85
+0.350000,	-58.04
+0.450000,	-64.55
+0.550000,	-64.14
+0.650000,	-56.97
+0.750000,	-81.42
+0.850000,	-55.79
+0.950000,	-63.23
+1.050000,	-62.26
+1.150000,	-55.62
+1.250000,	-80.99
+1.350000,	-55.79
+1.450000,	-62.62
+1.550000,	-62.65
+1.650000,	-55.09
+1.750000,	-79.89
+1.850000,	-55.00
+1.950000,	-61.68
+2.050000,	-61.47
+2.150000,	-55.35
+2.250000,	-79.07
+2.350000,	-54.69
+2.450000,	-61.37
+2.550000,	-41.55
+2.650000,	-42.72
+2.750000,	-43.03
+2.850000,	-43.02
+2.950000,	-43.02
+3.050000,	-43.10
+3.150000,	-43.09
+3.250000,	-42.96
+3.350000,	-42.91
+3.450000,	-43.19
+3.550000,	-43.24
+3.650000,	-42.87
+3.750000,	-42.92
+3.850000,	-43.20
+3.950000,	-43.12
+4.050000,	-42.80
+4.150000,	-43.02
+4.250000,	-43.23
+4.350000,	-43.17
+4.450000,	-42.77
+4.550000,	-43.02
+4.650000,	-43.28
+4.750000,	-42.96
+4.850000,	-43.03
+4.950000,	-43.07
+5.050000,	-26.63
+5.150000,	-27.32
+5.250000,	-27.42
+5.350000,	-27.62
+5.450000,	-27.74
+5.550000,	-27.64
+5.650000,	-27.66
+5.750000,	-27.76
+5.850000,	-27.66
+5.950000,	-27.72
+6.050000,	-27.73
+6.150000,	-27.75
+6.250000,	-27.77
+6.350000,	-27.71
+6.450000,	-27.70
+6.550000,	-27.74
+6.650000,	-27.78
+6.750000,	-27.71
+6.850000,	-27.63
+6.950000,	-27.77
+7.050000,	-27.68
+7.150000,	-27.74
+7.250000,	-27.71
+7.350000,	-27.63
+7.450000,	-27.66
+7.550000,	-26.73
+7.650000,	-21.89
+7.750000,	-47.51
+7.850000,	-23.10
+7.950000,	-29.50
+8.050000,	-29.07
+8.150000,	-24.30
+8.250000,	-47.86
+8.350000,	-23.25
+8.450000,	-30.89
+8.550000,	-30.10
+8.650000,	-23.85
+8.750000,	-48.67
+8.850000,	-23.51
+8.950000,	-30.76
+9.050000,	-30.79
+9.150000,	-23.69
+9.250000,	-48.44
+9.350000,	-23.67
+9.450000,	-30.48
+9.550000,	-29.73
+9.650000,	-23.51
+9.750000,	-48.59
+9.850000,	-23.99
+9.950000,	-30.43
+10.050000,	-39.02
+10.150000,	-38.60
+10.250000,	-38.82
+10.350000,	-38.84
+10.450000,	-38.28
+10.550000,	-38.26
+10.650000,	-38.12
+10.750000,	-37.80
+10.850000,	-37.86
+10.950000,	-37.59
+11.050000,	-37.21
+11.150000,	-37.27
+11.250000,	-37.30
+11.350000,	-36.90
+11.450000,	-36.80
+11.550000,	-36.87
+11.650000,	-36.71
+11.750000,	-36.44
+11.850000,	-36.22
+11.950000,	-36.34
+12.050000,	-36.19
+12.150000,	-36.02
+12.250000,	-35.77
+12.350000,	-35.95
+12.450000,	-35.83
+12.550000,	-66.27
+12.650000,	-65.32
+12.750000,	-64.58
+12.850000,	-64.04
+12.950000,	-63.25
+13.050000,	-62.43
+13.150000,	-61.89
+13.250000,	-61.83
+13.350000,	-61.65
+13.450000,	-61.50
+13.550000,	-61.43
+13.650000,	-60.99
+13.750000,	-61.06
+13.850000,	-60.95
+13.950000,	-60.71
+14.050000,	-60.73
+14.150000,	-60.39
+14.250000,	-60.29
+14.350000,	-60.29
+14.450000,	-59.98
+14.550000,	-59.92
+14.650000,	-59.97
+14.750000,	-59.65
+14.850000,	-59.59
+14.950000,	-59.50
+15.050000,	-28.60
+15.150000,	-24.66
+15.250000,	-49.89
+15.350000,	-25.17
+15.450000,	-32.25
+15.550000,	-31.48
+15.650000,	-26.10
+15.750000,	-51.78
+15.850000,	-25.69
+15.950000,	-33.13
+16.050000,	-32.68
+16.150000,	-25.70
+16.250000,	-51.88
+16.350000,	-26.04
+16.450000,	-32.74
+16.550000,	-32.41
+16.650000,	-26.12
+16.750000,	-51.09
+16.850000,	-25.75
+16.950000,	-33.24
+17.050000,	-31.73
+17.150000,	-26.10
+17.250000,	-51.35
+17.350000,	-26.33
+17.450000,	-33.14
+17.550000,	-42.05
+17.650000,	-42.16
+17.750000,	-41.99
+17.850000,	-41.77
+17.950000,	-41.61
+18.050000,	-41.53
+18.150000,	-41.60
+18.250000,	-41.39
+18.350000,	-41.04
+18.450000,	-41.10
+18.550000,	-41.09
+18.650000,	-41.01
+18.750000,	-40.69
+18.850000,	-40.59
+18.950000,	-40.70
+19.050000,	-40.67
+19.150000,	-40.46
+19.250000,	-40.25
+19.350000,	-40.25
+19.450000,	-40.40
+19.550000,	-40.26
+19.650000,	-39.81
+19.750000,	-39.92
+19.850000,	-40.10
+19.950000,	-39.81
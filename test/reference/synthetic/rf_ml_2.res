@@ -0,0 +1,200 @@
+0.050000,	-62.42
+0.150000,	-55.25
+0.250000,	-80.40
+0.350000,	-54.31
+0.450000,	-62.18
+0.550000,	-60.60
+0.650000,	-53.75
+0.750000,	-78.67
+0.850000,	-53.83
+0.950000,	-59.49
+1.050000,	-58.98
+1.150000,	-52.88
+1.250000,	-77.59
+1.350000,	-52.59
+1.450000,	-59.28
+1.550000,	-58.90
+1.650000,	-52.32
+1.750000,	-77.02
+1.850000,	-52.16
+1.950000,	-58.76
+2.050000,	-57.45
+2.150000,	-51.94
+2.250000,	-76.68
+2.350000,	-51.78
+2.450000,	-58.54
+2.550000,	-38.40
+2.650000,	-39.58
+2.750000,	-39.96
+2.850000,	-39.90
+2.950000,	-39.87
+3.050000,	-39.97
+3.150000,	-40.04
+3.250000,	-39.94
+3.350000,	-39.81
+3.450000,	-40.04
+3.550000,	-40.13
+3.650000,	-39.80
+3.750000,	-39.81
+3.850000,	-40.11
+3.950000,	-40.11
+4.050000,	-39.71
+4.150000,	-39.86
+4.250000,	-40.23
+4.350000,	-40.01
+4.450000,	-39.73
+4.550000,	-39.93
+4.650000,	-40.11
+4.750000,	-39.91
+4.850000,	-39.89
+4.950000,	-39.96
+5.050000,	-23.44
+5.150000,	-24.25
+5.250000,	-24.36
+5.350000,	-24.57
+5.450000,	-24.63
+5.550000,	-24.64
+5.650000,	-24.61
+5.750000,	-24.70
+5.850000,	-24.64
+5.950000,	-24.65
+6.050000,	-24.65
+6.150000,	-24.59
+6.250000,	-24.54
+6.350000,	-24.60
+6.450000,	-24.52
+6.550000,	-24.65
+6.650000,	-24.66
+6.750000,	-24.55
+6.850000,	-24.66
+6.950000,	-24.62
+7.050000,	-24.60
+7.150000,	-24.67
+7.250000,	-24.56
+7.350000,	-24.60
+7.450000,	-24.58
+7.550000,	-22.76
+7.650000,	-18.44
+7.750000,	-44.57
+7.850000,	-19.59
+7.950000,	-27.26
+8.050000,	-25.97
+8.150000,	-20.59
+8.250000,	-45.21
+8.350000,	-20.50
+8.450000,	-27.39
+8.550000,	-26.46
+8.650000,	-20.60
+8.750000,	-46.12
+8.850000,	-20.44
+8.950000,	-27.56
+9.050000,	-26.70
+9.150000,	-20.76
+9.250000,	-46.04
+9.350000,	-20.51
+9.450000,	-28.11
+9.550000,	-27.11
+9.650000,	-20.69
+9.750000,	-45.76
+9.850000,	-20.40
+9.950000,	-26.91
+10.050000,	-35.94
+10.150000,	-35.47
+10.250000,	-35.65
+10.350000,	-35.77
+10.450000,	-35.19
+10.550000,	-35.20
+10.650000,	-35.04
+10.750000,	-34.70
+10.850000,	-34.71
+10.950000,	-34.56
+11.050000,	-34.18
+11.150000,	-34.07
+11.250000,	-34.25
+11.350000,	-33.88
+11.450000,	-33.64
+11.550000,	-33.71
+11.650000,	-33.67
+11.750000,	-33.32
+11.850000,	-33.14
+11.950000,	-33.19
+12.050000,	-33.21
+12.150000,	-32.95
+12.250000,	-32.69
+12.350000,	-32.87
+12.450000,	-32.82
+12.550000,	-63.21
+12.650000,	-62.27
+12.750000,	-61.24
+12.850000,	-61.03
+12.950000,	-60.15
+13.050000,	-59.42
+13.150000,	-58.98
+13.250000,	-58.82
+13.350000,	-58.53
+13.450000,	-58.43
+13.550000,	-58.40
+13.650000,	-58.04
+13.750000,	-57.98
+13.850000,	-57.86
+13.950000,	-57.53
+14.050000,	-57.64
+14.150000,	-57.47
+14.250000,	-57.29
+14.350000,	-57.23
+14.450000,	-56.87
+14.550000,	-56.91
+14.650000,	-56.84
+14.750000,	-56.57
+14.850000,	-56.46
+14.950000,	-56.46
+15.050000,	-25.20
+15.150000,	-21.24
+15.250000,	-47.07
+15.350000,	-21.78
+15.450000,	-29.35
+15.550000,	-28.30
+15.650000,	-22.76
+15.750000,	-46.59
+15.850000,	-22.21
+15.950000,	-29.88
+16.050000,	-29.24
+16.150000,	-23.08
+16.250000,	-48.00
+16.350000,	-22.29
+16.450000,	-29.98
+16.550000,	-29.04
+16.650000,	-22.76
+16.750000,	-48.52
+16.850000,	-23.02
+16.950000,	-30.38
+17.050000,	-29.23
+17.150000,	-22.64
+17.250000,	-48.08
+17.350000,	-22.60
+17.450000,	-30.26
+17.550000,	-38.92
+17.650000,	-39.00
+17.750000,	-38.95
+17.850000,	-38.74
+17.950000,	-38.52
+18.050000,	-38.40
+18.150000,	-38.50
+18.250000,	-38.23
+18.350000,	-37.94
+18.450000,	-38.01
+18.550000,	-38.08
+18.650000,	-37.90
+18.750000,	-37.62
+18.850000,	-37.53
+18.950000,	-37.61
+19.050000,	-37.51
+19.150000,	-37.26
+19.250000,	-37.16
+19.350000,	-37.19
+19.450000,	-37.25
+19.550000,	-37.11
+19.650000,	-36.65
+19.750000,	-36.84
+19.850000,	-37.06
+19.950000,	-36.64
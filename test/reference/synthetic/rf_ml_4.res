@@ -0,0 +1,200 @@
+0.050000,	-69.89
+0.150000,	-63.43
+0.250000,	-87.31
+0.350000,	-63.13
+0.450000,	-69.68
+0.550000,	-68.77
+0.650000,	-61.79
+0.750000,	-86.02
+0.850000,	-61.63
+0.950000,	-68.13
+1.050000,	-67.53
+1.150000,	-60.57
+1.250000,	-84.93
+1.350000,	-60.23
+1.450000,	-66.33
+1.550000,	-66.20
+1.650000,	-60.26
+1.750000,	-84.95
+1.850000,	-59.53
+1.950000,	-66.20
+2.050000,	-65.55
+2.150000,	-59.97
+2.250000,	-84.78
+2.350000,	-59.68
+2.450000,	-66.11
+2.550000,	-46.43
+2.650000,	-47.45
+2.750000,	-47.93
+2.850000,	-47.91
+2.950000,	-47.85
+3.050000,	-47.96
+3.150000,	-48.08
+3.250000,	-47.89
+3.350000,	-47.75
+3.450000,	-48.09
+3.550000,	-48.07
+3.650000,	-47.77
+3.750000,	-47.82
+3.850000,	-48.01
+3.950000,	-48.01
+4.050000,	-47.70
+4.150000,	-47.86
+4.250000,	-48.14
+4.350000,	-48.02
+4.450000,	-47.64
+4.550000,	-47.92
+4.650000,	-48.15
+4.750000,	-47.92
+4.850000,	-47.76
+4.950000,	-47.93
+5.050000,	-31.50
+5.150000,	-32.15
+5.250000,	-32.26
+5.350000,	-32.61
+5.450000,	-32.71
+5.550000,	-32.61
+5.650000,	-32.61
+5.750000,	-32.48
+5.850000,	-32.48
+5.950000,	-32.50
+6.050000,	-32.62
+6.150000,	-32.58
+6.250000,	-32.61
+6.350000,	-32.48
+6.450000,	-32.56
+6.550000,	-32.68
+6.650000,	-32.60
+6.750000,	-32.51
+6.850000,	-32.57
+6.950000,	-32.55
+7.050000,	-32.52
+7.150000,	-32.58
+7.250000,	-32.52
+7.350000,	-32.55
+7.450000,	-32.49
+7.550000,	-30.99
+7.650000,	-26.21
+7.750000,	-52.11
+7.850000,	-27.51
+7.950000,	-34.88
+8.050000,	-34.33
+8.150000,	-28.44
+8.250000,	-52.96
+8.350000,	-28.38
+8.450000,	-35.11
+8.550000,	-34.58
+8.650000,	-29.27
+8.750000,	-53.49
+8.850000,	-28.34
+8.950000,	-35.53
+9.050000,	-34.97
+9.150000,	-28.75
+9.250000,	-53.91
+9.350000,	-28.69
+9.450000,	-35.58
+9.550000,	-34.76
+9.650000,	-28.74
+9.750000,	-54.09
+9.850000,	-28.38
+9.950000,	-35.39
+10.050000,	-43.94
+10.150000,	-43.52
+10.250000,	-43.69
+10.350000,	-43.68
+10.450000,	-43.07
+10.550000,	-43.08
+10.650000,	-42.98
+10.750000,	-42.67
+10.850000,	-42.67
+10.950000,	-42.56
+11.050000,	-42.19
+11.150000,	-42.13
+11.250000,	-42.21
+11.350000,	-41.85
+11.450000,	-41.56
+11.550000,	-41.70
+11.650000,	-41.60
+11.750000,	-41.39
+11.850000,	-41.06
+11.950000,	-41.13
+12.050000,	-41.14
+12.150000,	-40.81
+12.250000,	-40.55
+12.350000,	-40.78
+12.450000,	-40.66
+12.550000,	-71.05
+12.650000,	-70.16
+12.750000,	-69.36
+12.850000,	-68.78
+12.950000,	-67.92
+13.050000,	-67.33
+13.150000,	-66.82
+13.250000,	-66.79
+13.350000,	-66.46
+13.450000,	-66.22
+13.550000,	-66.26
+13.650000,	-65.87
+13.750000,	-65.80
+13.850000,	-65.73
+13.950000,	-65.48
+14.050000,	-65.44
+14.150000,	-65.15
+14.250000,	-65.17
+14.350000,	-65.17
+14.450000,	-64.89
+14.550000,	-64.82
+14.650000,	-64.63
+14.750000,	-64.49
+14.850000,	-64.28
+14.950000,	-64.36
+15.050000,	-33.35
+15.150000,	-29.10
+15.250000,	-54.76
+15.350000,	-29.94
+15.450000,	-37.59
+15.550000,	-37.11
+15.650000,	-30.40
+15.750000,	-55.35
+15.850000,	-30.35
+15.950000,	-38.00
+16.050000,	-36.66
+16.150000,	-30.72
+16.250000,	-55.88
+16.350000,	-30.64
+16.450000,	-38.47
+16.550000,	-37.85
+16.650000,	-30.66
+16.750000,	-56.35
+16.850000,	-30.80
+16.950000,	-37.50
+17.050000,	-37.22
+17.150000,	-30.85
+17.250000,	-54.91
+17.350000,	-31.12
+17.450000,	-37.84
+17.550000,	-46.88
+17.650000,	-46.93
+17.750000,	-46.86
+17.850000,	-46.72
+17.950000,	-46.49
+18.050000,	-46.34
+18.150000,	-46.43
+18.250000,	-46.24
+18.350000,	-45.99
+18.450000,	-45.94
+18.550000,	-45.94
+18.650000,	-45.85
+18.750000,	-45.53
+18.850000,	-45.49
+18.950000,	-45.45
+19.050000,	-45.57
+19.150000,	-45.23
+19.250000,	-45.15
+19.350000,	-45.15
+19.450000,	-45.21
+19.550000,	-45.13
+19.650000,	-44.65
+19.750000,	-44.82
+19.850000,	-44.98
+19.950000,	-44.72
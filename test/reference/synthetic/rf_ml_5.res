@@ -0,0 +1,200 @@
+0.050000,	-70.60
+0.150000,	-63.05
+0.250000,	-88.33
+0.350000,	-62.17
+0.450000,	-69.36
+0.550000,	-68.90
+0.650000,	-61.93
+0.750000,	-86.10
+0.850000,	-60.87
+0.950000,	-68.16
+1.050000,	-67.51
+1.150000,	-60.91
+1.250000,	-85.71
+1.350000,	-60.83
+1.450000,	-67.08
+1.550000,	-66.21
+1.650000,	-60.41
+1.750000,	-84.86
+1.850000,	-59.78
+1.950000,	-66.98
+2.050000,	-66.46
+2.150000,	-60.13
+2.250000,	-83.93
+2.350000,	-59.39
+2.450000,	-65.87
+2.550000,	-46.35
+2.650000,	-47.58
+2.750000,	-47.92
+2.850000,	-47.85
+2.950000,	-47.96
+3.050000,	-47.97
+3.150000,	-47.98
+3.250000,	-47.88
+3.350000,	-47.80
+3.450000,	-48.02
+3.550000,	-48.02
+3.650000,	-47.71
+3.750000,	-47.75
+3.850000,	-48.03
+3.950000,	-48.07
+4.050000,	-47.70
+4.150000,	-47.87
+4.250000,	-48.09
+4.350000,	-48.00
+4.450000,	-47.61
+4.550000,	-47.86
+4.650000,	-48.15
+4.750000,	-47.93
+4.850000,	-47.78
+4.950000,	-47.87
+5.050000,	-31.40
+5.150000,	-32.07
+5.250000,	-32.29
+5.350000,	-32.64
+5.450000,	-32.48
+5.550000,	-32.53
+5.650000,	-32.54
+5.750000,	-32.62
+5.850000,	-32.57
+5.950000,	-32.55
+6.050000,	-32.65
+6.150000,	-32.63
+6.250000,	-32.51
+6.350000,	-32.46
+6.450000,	-32.51
+6.550000,	-32.56
+6.650000,	-32.55
+6.750000,	-32.54
+6.850000,	-32.53
+6.950000,	-32.49
+7.050000,	-32.64
+7.150000,	-32.53
+7.250000,	-32.50
+7.350000,	-32.57
+7.450000,	-32.50
+7.550000,	-31.34
+7.650000,	-26.17
+7.750000,	-51.99
+7.850000,	-27.18
+7.950000,	-35.12
+8.050000,	-34.85
+8.150000,	-28.37
+8.250000,	-53.88
+8.350000,	-28.44
+8.450000,	-35.30
+8.550000,	-34.63
+8.650000,	-28.81
+8.750000,	-54.46
+8.850000,	-29.01
+8.950000,	-35.92
+9.050000,	-35.11
+9.150000,	-29.05
+9.250000,	-53.60
+9.350000,	-28.65
+9.450000,	-35.21
+9.550000,	-35.01
+9.650000,	-28.71
+9.750000,	-54.72
+9.850000,	-28.62
+9.950000,	-36.11
+10.050000,	-43.94
+10.150000,	-43.44
+10.250000,	-43.75
+10.350000,	-43.64
+10.450000,	-43.18
+10.550000,	-43.09
+10.650000,	-43.07
+10.750000,	-42.69
+10.850000,	-42.66
+10.950000,	-42.51
+11.050000,	-42.10
+11.150000,	-42.16
+11.250000,	-42.24
+11.350000,	-41.82
+11.450000,	-41.68
+11.550000,	-41.69
+11.650000,	-41.58
+11.750000,	-41.43
+11.850000,	-41.06
+11.950000,	-41.20
+12.050000,	-41.12
+12.150000,	-40.84
+12.250000,	-40.60
+12.350000,	-40.79
+12.450000,	-40.67
+12.550000,	-71.09
+12.650000,	-70.06
+12.750000,	-69.22
+12.850000,	-68.76
+12.950000,	-67.82
+13.050000,	-67.31
+13.150000,	-66.80
+13.250000,	-66.73
+13.350000,	-66.50
+13.450000,	-66.16
+13.550000,	-66.29
+13.650000,	-65.88
+13.750000,	-65.85
+13.850000,	-65.72
+13.950000,	-65.44
+14.050000,	-65.42
+14.150000,	-65.23
+14.250000,	-65.09
+14.350000,	-65.08
+14.450000,	-64.78
+14.550000,	-64.64
+14.650000,	-64.79
+14.750000,	-64.50
+14.850000,	-64.45
+14.950000,	-64.42
+15.050000,	-33.37
+15.150000,	-30.01
+15.250000,	-55.15
+15.350000,	-29.93
+15.450000,	-37.19
+15.550000,	-37.44
+15.650000,	-30.15
+15.750000,	-55.91
+15.850000,	-30.54
+15.950000,	-37.96
+16.050000,	-36.79
+16.150000,	-31.02
+16.250000,	-55.98
+16.350000,	-30.46
+16.450000,	-37.63
+16.550000,	-36.47
+16.650000,	-31.00
+16.750000,	-55.69
+16.850000,	-30.70
+16.950000,	-38.37
+17.050000,	-37.00
+17.150000,	-30.96
+17.250000,	-56.09
+17.350000,	-30.83
+17.450000,	-38.14
+17.550000,	-46.95
+17.650000,	-47.01
+17.750000,	-46.95
+17.850000,	-46.69
+17.950000,	-46.49
+18.050000,	-46.37
+18.150000,	-46.46
+18.250000,	-46.27
+18.350000,	-45.87
+18.450000,	-45.93
+18.550000,	-45.97
+18.650000,	-45.90
+18.750000,	-45.46
+18.850000,	-45.47
+18.950000,	-45.54
+19.050000,	-45.55
+19.150000,	-45.24
+19.250000,	-45.15
+19.350000,	-45.16
+19.450000,	-45.22
+19.550000,	-45.09
+19.650000,	-44.58
+19.750000,	-44.81
+19.850000,	-44.98
+19.950000,	-44.69
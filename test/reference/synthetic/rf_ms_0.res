@@ -0,0 +1,200 @@
+0.050000,	-65.17
+0.150000,	-58.73
+0.250000,	-83.62
+0.350000,	-58.91
+0.450000,	-65.42
+0.550000,	-64.24
+0.650000,	-57.82
+0.750000,	-81.83
+0.850000,	-57.34
+0.950000,	-65.17
+1.050000,	-64.53
+1.150000,	-57.31
+1.250000,	-82.17
+1.350000,	-57.41
+1.450000,	-63.91
+1.550000,	-63.56
+1.650000,	-56.96
+1.750000,	-81.33
+1.850000,	-56.95
+1.950000,	-63.62
+2.050000,	-62.80
+2.150000,	-56.39
+2.250000,	-80.92
+2.350000,	-56.57
+2.450000,	-63.51
+2.550000,	-42.52
+2.650000,	-43.07
+2.750000,	-43.08
+2.850000,	-43.01
+2.950000,	-43.00
+3.050000,	-43.08
+3.150000,	-43.12
+3.250000,	-43.07
+3.350000,	-42.88
+3.450000,	-43.17
+3.550000,	-43.14
+3.650000,	-42.91
+3.750000,	-42.86
+3.850000,	-43.23
+3.950000,	-43.16
+4.050000,	-42.80
+4.150000,	-43.02
+4.250000,	-43.31
+4.350000,	-43.09
+4.450000,	-42.85
+4.550000,	-43.02
+4.650000,	-43.24
+4.750000,	-43.01
+4.850000,	-42.90
+4.950000,	-43.07
+5.050000,	-27.48
+5.150000,	-29.23
+5.250000,	-29.91
+5.350000,	-30.04
+5.450000,	-29.89
+5.550000,	-30.17
+5.650000,	-30.43
+5.750000,	-30.44
+5.850000,	-30.42
+5.950000,	-30.44
+6.050000,	-30.37
+6.150000,	-30.36
+6.250000,	-30.48
+6.350000,	-30.35
+6.450000,	-30.43
+6.550000,	-30.44
+6.650000,	-30.36
+6.750000,	-30.55
+6.850000,	-30.46
+6.950000,	-30.39
+7.050000,	-30.43
+7.150000,	-30.53
+7.250000,	-30.35
+7.350000,	-30.41
+7.450000,	-30.46
+7.550000,	-29.36
+7.650000,	-25.42
+7.750000,	-51.93
+7.850000,	-27.91
+7.950000,	-36.18
+8.050000,	-34.93
+8.150000,	-29.25
+8.250000,	-54.93
+8.350000,	-29.25
+8.450000,	-36.73
+8.550000,	-34.80
+8.650000,	-29.89
+8.750000,	-55.37
+8.850000,	-29.37
+8.950000,	-36.69
+9.050000,	-36.22
+9.150000,	-30.14
+9.250000,	-54.83
+9.350000,	-29.86
+9.450000,	-36.63
+9.550000,	-36.19
+9.650000,	-30.25
+9.750000,	-55.21
+9.850000,	-30.22
+9.950000,	-36.88
+10.050000,	-45.49
+10.150000,	-45.08
+10.250000,	-45.15
+10.350000,	-45.22
+10.450000,	-44.83
+10.550000,	-44.80
+10.650000,	-44.79
+10.750000,	-44.83
+10.850000,	-44.79
+10.950000,	-44.37
+11.050000,	-44.15
+11.150000,	-44.23
+11.250000,	-44.41
+11.350000,	-44.31
+11.450000,	-43.63
+11.550000,	-43.76
+11.650000,	-44.00
+11.750000,	-43.81
+11.850000,	-43.52
+11.950000,	-43.26
+12.050000,	-43.53
+12.150000,	-43.27
+12.250000,	-43.09
+12.350000,	-43.22
+12.450000,	-43.03
+12.550000,	-72.97
+12.650000,	-70.90
+12.750000,	-69.09
+12.850000,	-67.48
+12.950000,	-66.02
+13.050000,	-64.61
+13.150000,	-63.67
+13.250000,	-62.51
+13.350000,	-62.30
+13.450000,	-62.24
+13.550000,	-61.98
+13.650000,	-61.90
+13.750000,	-61.98
+13.850000,	-61.95
+13.950000,	-61.62
+14.050000,	-61.47
+14.150000,	-61.47
+14.250000,	-61.49
+14.350000,	-61.39
+14.450000,	-61.07
+14.550000,	-60.96
+14.650000,	-61.04
+14.750000,	-61.17
+14.850000,	-60.64
+14.950000,	-60.68
+15.050000,	-30.20
+15.150000,	-27.38
+15.250000,	-53.29
+15.350000,	-28.94
+15.450000,	-36.48
+15.550000,	-35.02
+15.650000,	-30.36
+15.750000,	-53.70
+15.850000,	-29.97
+15.950000,	-37.74
+16.050000,	-36.01
+16.150000,	-30.52
+16.250000,	-55.64
+16.350000,	-30.13
+16.450000,	-37.92
+16.550000,	-36.45
+16.650000,	-30.85
+16.750000,	-55.79
+16.850000,	-30.23
+16.950000,	-37.06
+17.050000,	-36.42
+17.150000,	-30.56
+17.250000,	-55.42
+17.350000,	-29.87
+17.450000,	-37.73
+17.550000,	-46.63
+17.650000,	-46.67
+17.750000,	-46.86
+17.850000,	-46.49
+17.950000,	-46.04
+18.050000,	-46.29
+18.150000,	-46.39
+18.250000,	-46.20
+18.350000,	-45.92
+18.450000,	-45.97
+18.550000,	-45.92
+18.650000,	-45.87
+18.750000,	-45.52
+18.850000,	-45.59
+18.950000,	-45.70
+19.050000,	-45.67
+19.150000,	-45.38
+19.250000,	-45.21
+19.350000,	-45.24
+19.450000,	-45.42
+19.550000,	-45.09
+19.650000,	-44.79
+19.750000,	-45.02
+19.850000,	-45.08
+19.950000,	-44.75
@@ -0,0 +1,200 @@
+0.050000,	-65.49
+0.150000,	-58.34
+0.250000,	-83.23
+0.350000,	-58.85
+0.450000,	-65.35
+0.550000,	-64.63
+0.650000,	-57.76
+0.750000,	-82.39
+0.850000,	-57.20
+0.950000,	-64.64
+1.050000,	-63.60
+1.150000,	-56.96
+1.250000,	-82.54
+1.350000,	-57.53
+1.450000,	-64.37
+1.550000,	-64.31
+1.650000,	-56.53
+1.750000,	-81.58
+1.850000,	-56.86
+1.950000,	-63.34
+2.050000,	-63.35
+2.150000,	-56.77
+2.250000,	-80.64
+2.350000,	-56.40
+2.450000,	-62.96
+2.550000,	-42.60
+2.650000,	-43.13
+2.750000,	-43.03
+2.850000,	-43.02
+2.950000,	-43.02
+3.050000,	-43.10
+3.150000,	-43.09
+3.250000,	-42.96
+3.350000,	-42.91
+3.450000,	-43.19
+3.550000,	-43.24
+3.650000,	-42.87
+3.750000,	-42.92
+3.850000,	-43.20
+3.950000,	-43.12
+4.050000,	-42.80
+4.150000,	-43.02
+4.250000,	-43.23
+4.350000,	-43.17
+4.450000,	-42.77
+4.550000,	-43.02
+4.650000,	-43.28
+4.750000,	-42.96
+4.850000,	-43.03
+4.950000,	-43.07
+5.050000,	-27.55
+5.150000,	-29.24
+5.250000,	-29.83
+5.350000,	-29.90
+5.450000,	-30.02
+5.550000,	-30.14
+5.650000,	-30.39
+5.750000,	-30.48
+5.850000,	-30.38
+5.950000,	-30.44
+6.050000,	-30.46
+6.150000,	-30.48
+6.250000,	-30.50
+6.350000,	-30.43
+6.450000,	-30.43
+6.550000,	-30.47
+6.650000,	-30.51
+6.750000,	-30.43
+6.850000,	-30.35
+6.950000,	-30.49
+7.050000,	-30.40
+7.150000,	-30.46
+7.250000,	-30.44
+7.350000,	-30.35
+7.450000,	-30.38
+7.550000,	-29.37
+7.650000,	-25.88
+7.750000,	-52.22
+7.850000,	-28.15
+7.950000,	-35.39
+8.050000,	-34.43
+8.150000,	-30.25
+8.250000,	-53.95
+8.350000,	-29.32
+8.450000,	-37.51
+8.550000,	-35.85
+8.650000,	-30.11
+8.750000,	-54.48
+8.850000,	-29.62
+8.950000,	-37.09
+9.050000,	-36.81
+9.150000,	-29.97
+9.250000,	-54.61
+9.350000,	-29.88
+9.450000,	-36.81
+9.550000,	-35.75
+9.650000,	-29.89
+9.750000,	-54.89
+9.850000,	-30.20
+9.950000,	-36.94
+10.050000,	-45.32
+10.150000,	-45.07
+10.250000,	-45.11
+10.350000,	-45.23
+10.450000,	-44.87
+10.550000,	-44.80
+10.650000,	-44.80
+10.750000,	-44.84
+10.850000,	-44.91
+10.950000,	-44.25
+11.050000,	-44.19
+11.150000,	-44.26
+11.250000,	-44.33
+11.350000,	-44.31
+11.450000,	-43.73
+11.550000,	-43.80
+11.650000,	-43.98
+11.750000,	-43.80
+11.850000,	-43.50
+11.950000,	-43.34
+12.050000,	-43.48
+12.150000,	-43.31
+12.250000,	-43.07
+12.350000,	-43.22
+12.450000,	-43.06
+12.550000,	-72.90
+12.650000,	-70.91
+12.750000,	-69.28
+12.850000,	-67.52
+12.950000,	-66.12
+13.050000,	-64.53
+13.150000,	-63.53
+13.250000,	-62.46
+13.350000,	-62.30
+13.450000,	-62.37
+13.550000,	-61.97
+13.650000,	-61.81
+13.750000,	-61.88
+13.850000,	-61.92
+13.950000,	-61.72
+14.050000,	-61.52
+14.150000,	-61.43
+14.250000,	-61.44
+14.350000,	-61.38
+14.450000,	-61.01
+14.550000,	-61.03
+14.650000,	-61.08
+14.750000,	-61.01
+14.850000,	-60.68
+14.950000,	-60.57
+15.050000,	-29.76
+15.150000,	-27.38
+15.250000,	-52.96
+15.350000,	-28.78
+15.450000,	-36.60
+15.550000,	-35.36
+15.650000,	-30.41
+15.750000,	-56.01
+15.850000,	-29.97
+15.950000,	-37.81
+16.050000,	-36.79
+16.150000,	-30.26
+16.250000,	-56.33
+16.350000,	-30.52
+16.450000,	-37.42
+16.550000,	-36.85
+16.650000,	-30.75
+16.750000,	-55.63
+16.850000,	-30.31
+16.950000,	-37.93
+17.050000,	-36.17
+17.150000,	-30.72
+17.250000,	-55.88
+17.350000,	-30.87
+17.450000,	-37.82
+17.550000,	-46.60
+17.650000,	-46.74
+17.750000,	-46.80
+17.850000,	-46.52
+17.950000,	-46.11
+18.050000,	-46.39
+18.150000,	-46.47
+18.250000,	-46.23
+18.350000,	-45.81
+18.450000,	-46.01
+18.550000,	-46.00
+18.650000,	-45.92
+18.750000,	-45.60
+18.850000,	-45.54
+18.950000,	-45.66
+19.050000,	-45.63
+19.150000,	-45.43
+19.250000,	-45.25
+19.350000,	-45.25
+19.450000,	-45.40
+19.550000,	-45.10
+19.650000,	-44.85
+19.750000,	-44.96
+19.850000,	-45.13
+19.950000,	-44.70
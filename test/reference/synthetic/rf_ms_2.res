@@ -0,0 +1,200 @@
+0.050000,	-62.42
+0.150000,	-55.25
+0.250000,	-80.78
+0.350000,	-55.11
+0.450000,	-62.99
+0.550000,	-61.09
+0.650000,	-54.51
+0.750000,	-79.63
+0.850000,	-55.24
+0.950000,	-60.90
+1.050000,	-60.31
+1.150000,	-54.22
+1.250000,	-79.15
+1.350000,	-54.34
+1.450000,	-61.03
+1.550000,	-60.56
+1.650000,	-53.77
+1.750000,	-78.66
+1.850000,	-54.00
+1.950000,	-60.41
+2.050000,	-59.34
+2.150000,	-53.34
+2.250000,	-78.32
+2.350000,	-53.51
+2.450000,	-60.12
+2.550000,	-39.45
+2.650000,	-39.99
+2.750000,	-39.96
+2.850000,	-39.90
+2.950000,	-39.87
+3.050000,	-39.97
+3.150000,	-40.04
+3.250000,	-39.94
+3.350000,	-39.81
+3.450000,	-40.04
+3.550000,	-40.13
+3.650000,	-39.80
+3.750000,	-39.81
+3.850000,	-40.11
+3.950000,	-40.11
+4.050000,	-39.71
+4.150000,	-39.86
+4.250000,	-40.23
+4.350000,	-40.01
+4.450000,	-39.73
+4.550000,	-39.93
+4.650000,	-40.11
+4.750000,	-39.91
+4.850000,	-39.89
+4.950000,	-39.96
+5.050000,	-24.36
+5.150000,	-26.19
+5.250000,	-26.77
+5.350000,	-26.85
+5.450000,	-26.91
+5.550000,	-27.14
+5.650000,	-27.34
+5.750000,	-27.43
+5.850000,	-27.36
+5.950000,	-27.38
+6.050000,	-27.38
+6.150000,	-27.31
+6.250000,	-27.26
+6.350000,	-27.32
+6.450000,	-27.24
+6.550000,	-27.38
+6.650000,	-27.39
+6.750000,	-27.28
+6.850000,	-27.38
+6.950000,	-27.34
+7.050000,	-27.32
+7.150000,	-27.39
+7.250000,	-27.28
+7.350000,	-27.33
+7.450000,	-27.30
+7.550000,	-25.39
+7.650000,	-22.48
+7.750000,	-49.25
+7.850000,	-24.70
+7.950000,	-33.15
+8.050000,	-31.35
+8.150000,	-26.58
+8.250000,	-51.31
+8.350000,	-26.52
+8.450000,	-34.01
+8.550000,	-32.21
+8.650000,	-26.86
+8.750000,	-51.99
+8.850000,	-26.54
+8.950000,	-33.89
+9.050000,	-32.72
+9.150000,	-27.03
+9.250000,	-52.20
+9.350000,	-26.73
+9.450000,	-34.43
+9.550000,	-33.13
+9.650000,	-27.06
+9.750000,	-52.02
+9.850000,	-26.62
+9.950000,	-33.43
+10.050000,	-42.24
+10.150000,	-41.94
+10.250000,	-41.95
+10.350000,	-42.16
+10.450000,	-41.77
+10.550000,	-41.75
+10.650000,	-41.71
+10.750000,	-41.74
+10.850000,	-41.76
+10.950000,	-41.22
+11.050000,	-41.17
+11.150000,	-41.06
+11.250000,	-41.29
+11.350000,	-41.29
+11.450000,	-40.57
+11.550000,	-40.65
+11.650000,	-40.94
+11.750000,	-40.67
+11.850000,	-40.42
+11.950000,	-40.19
+12.050000,	-40.51
+12.150000,	-40.25
+12.250000,	-39.98
+12.350000,	-40.14
+12.450000,	-40.05
+12.550000,	-69.84
+12.650000,	-67.85
+12.750000,	-65.95
+12.850000,	-64.52
+12.950000,	-63.03
+13.050000,	-61.52
+13.150000,	-60.62
+13.250000,	-59.44
+13.350000,	-59.19
+13.450000,	-59.30
+13.550000,	-58.95
+13.650000,	-58.86
+13.750000,	-58.80
+13.850000,	-58.83
+13.950000,	-58.55
+14.050000,	-58.43
+14.150000,	-58.51
+14.250000,	-58.45
+14.350000,	-58.31
+14.450000,	-57.90
+14.550000,	-58.02
+14.650000,	-57.95
+14.750000,	-57.92
+14.850000,	-57.56
+14.950000,	-57.53
+15.050000,	-26.47
+15.150000,	-23.92
+15.250000,	-50.14
+15.350000,	-25.36
+15.450000,	-33.71
+15.550000,	-32.20
+15.650000,	-27.08
+15.750000,	-50.66
+15.850000,	-26.55
+15.950000,	-34.56
+16.050000,	-33.34
+16.150000,	-27.65
+16.250000,	-52.47
+16.350000,	-26.79
+16.450000,	-34.66
+16.550000,	-33.48
+16.650000,	-27.38
+16.750000,	-53.06
+16.850000,	-27.58
+16.950000,	-35.06
+17.050000,	-33.67
+17.150000,	-27.26
+17.250000,	-52.64
+17.350000,	-27.16
+17.450000,	-34.94
+17.550000,	-43.46
+17.650000,	-43.58
+17.750000,	-43.76
+17.850000,	-43.49
+17.950000,	-43.02
+18.050000,	-43.26
+18.150000,	-43.36
+18.250000,	-43.07
+18.350000,	-42.72
+18.450000,	-42.93
+18.550000,	-42.99
+18.650000,	-42.81
+18.750000,	-42.53
+18.850000,	-42.48
+18.950000,	-42.57
+19.050000,	-42.47
+19.150000,	-42.24
+19.250000,	-42.15
+19.350000,	-42.19
+19.450000,	-42.25
+19.550000,	-41.95
+19.650000,	-41.69
+19.750000,	-41.88
+19.850000,	-42.10
+19.950000,	-41.54
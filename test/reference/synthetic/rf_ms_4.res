@@ -0,0 +1,200 @@
+0.050000,	-69.89
+0.150000,	-63.43
+0.250000,	-87.72
+0.350000,	-63.93
+0.450000,	-70.48
+0.550000,	-69.26
+0.650000,	-62.58
+0.750000,	-86.95
+0.850000,	-63.05
+0.950000,	-69.54
+1.050000,	-68.87
+1.150000,	-61.92
+1.250000,	-86.45
+1.350000,	-61.98
+1.450000,	-68.07
+1.550000,	-67.86
+1.650000,	-61.72
+1.750000,	-86.64
+1.850000,	-61.38
+1.950000,	-67.86
+2.050000,	-67.44
+2.150000,	-61.36
+2.250000,	-86.31
+2.350000,	-61.42
+2.450000,	-67.70
+2.550000,	-47.47
+2.650000,	-47.84
+2.750000,	-47.93
+2.850000,	-47.91
+2.950000,	-47.85
+3.050000,	-47.96
+3.150000,	-48.08
+3.250000,	-47.89
+3.350000,	-47.75
+3.450000,	-48.09
+3.550000,	-48.07
+3.650000,	-47.77
+3.750000,	-47.82
+3.850000,	-48.01
+3.950000,	-48.01
+4.050000,	-47.70
+4.150000,	-47.86
+4.250000,	-48.14
+4.350000,	-48.02
+4.450000,	-47.64
+4.550000,	-47.92
+4.650000,	-48.15
+4.750000,	-47.92
+4.850000,	-47.76
+4.950000,	-47.93
+5.050000,	-32.41
+5.150000,	-34.08
+5.250000,	-34.67
+5.350000,	-34.89
+5.450000,	-34.99
+5.550000,	-35.10
+5.650000,	-35.33
+5.750000,	-35.20
+5.850000,	-35.21
+5.950000,	-35.23
+6.050000,	-35.34
+6.150000,	-35.30
+6.250000,	-35.33
+6.350000,	-35.20
+6.450000,	-35.29
+6.550000,	-35.41
+6.650000,	-35.32
+6.750000,	-35.24
+6.850000,	-35.30
+6.950000,	-35.27
+7.050000,	-35.24
+7.150000,	-35.30
+7.250000,	-35.24
+7.350000,	-35.28
+7.450000,	-35.21
+7.550000,	-33.66
+7.650000,	-30.21
+7.750000,	-56.77
+7.850000,	-32.55
+7.950000,	-40.78
+8.050000,	-39.71
+8.150000,	-34.39
+8.250000,	-59.08
+8.350000,	-34.43
+8.450000,	-41.73
+8.550000,	-40.32
+8.650000,	-35.55
+8.750000,	-59.41
+8.850000,	-34.46
+8.950000,	-41.86
+9.050000,	-40.99
+9.150000,	-35.03
+9.250000,	-60.09
+9.350000,	-34.91
+9.450000,	-41.91
+9.550000,	-40.78
+9.650000,	-35.09
+9.750000,	-60.40
+9.850000,	-34.61
+9.950000,	-41.91
+10.050000,	-50.25
+10.150000,	-49.99
+10.250000,	-49.99
+10.350000,	-50.07
+10.450000,	-49.66
+10.550000,	-49.63
+10.650000,	-49.66
+10.750000,	-49.72
+10.850000,	-49.71
+10.950000,	-49.22
+11.050000,	-49.18
+11.150000,	-49.12
+11.250000,	-49.24
+11.350000,	-49.26
+11.450000,	-48.50
+11.550000,	-48.63
+11.650000,	-48.88
+11.750000,	-48.75
+11.850000,	-48.35
+11.950000,	-48.13
+12.050000,	-48.44
+12.150000,	-48.11
+12.250000,	-47.84
+12.350000,	-48.05
+12.450000,	-47.89
+12.550000,	-77.67
+12.650000,	-75.74
+12.750000,	-74.06
+12.850000,	-72.26
+12.950000,	-70.79
+13.050000,	-69.44
+13.150000,	-68.46
+13.250000,	-67.42
+13.350000,	-67.12
+13.450000,	-67.08
+13.550000,	-66.81
+13.650000,	-66.69
+13.750000,	-66.63
+13.850000,	-66.70
+13.950000,	-66.50
+14.050000,	-66.22
+14.150000,	-66.19
+14.250000,	-66.33
+14.350000,	-66.25
+14.450000,	-65.92
+14.550000,	-65.93
+14.650000,	-65.74
+14.750000,	-65.85
+14.850000,	-65.37
+14.950000,	-65.42
+15.050000,	-34.58
+15.150000,	-31.75
+15.250000,	-57.83
+15.350000,	-33.54
+15.450000,	-41.95
+15.550000,	-40.98
+15.650000,	-34.71
+15.750000,	-59.51
+15.850000,	-34.65
+15.950000,	-42.68
+16.050000,	-40.76
+16.150000,	-35.28
+16.250000,	-60.28
+16.350000,	-35.14
+16.450000,	-43.15
+16.550000,	-42.28
+16.650000,	-35.31
+16.750000,	-60.88
+16.850000,	-35.37
+16.950000,	-42.18
+17.050000,	-41.66
+17.150000,	-35.46
+17.250000,	-59.43
+17.350000,	-35.67
+17.450000,	-42.52
+17.550000,	-51.43
+17.650000,	-51.51
+17.750000,	-51.67
+17.850000,	-51.47
+17.950000,	-51.00
+18.050000,	-51.21
+18.150000,	-51.29
+18.250000,	-51.09
+18.350000,	-50.75
+18.450000,	-50.85
+18.550000,	-50.85
+18.650000,	-50.76
+18.750000,	-50.44
+18.850000,	-50.44
+18.950000,	-50.41
+19.050000,	-50.52
+19.150000,	-50.20
+19.250000,	-50.15
+19.350000,	-50.15
+19.450000,	-50.20
+19.550000,	-49.97
+19.650000,	-49.68
+19.750000,	-49.85
+19.850000,	-50.01
+19.950000,	-49.61
@@ -0,0 +1,200 @@
+0.050000,	-70.60
+0.150000,	-63.05
+0.250000,	-88.79
+0.350000,	-62.97
+0.450000,	-70.18
+0.550000,	-69.39
+0.650000,	-62.70
+0.750000,	-87.02
+0.850000,	-62.29
+0.950000,	-69.57
+1.050000,	-68.84
+1.150000,	-62.25
+1.250000,	-87.22
+1.350000,	-62.57
+1.450000,	-68.82
+1.550000,	-67.87
+1.650000,	-61.87
+1.750000,	-86.48
+1.850000,	-61.61
+1.950000,	-68.63
+2.050000,	-68.36
+2.150000,	-61.52
+2.250000,	-85.50
+2.350000,	-61.12
+2.450000,	-67.46
+2.550000,	-47.39
+2.650000,	-48.00
+2.750000,	-47.92
+2.850000,	-47.85
+2.950000,	-47.96
+3.050000,	-47.97
+3.150000,	-47.98
+3.250000,	-47.88
+3.350000,	-47.80
+3.450000,	-48.02
+3.550000,	-48.02
+3.650000,	-47.71
+3.750000,	-47.75
+3.850000,	-48.03
+3.950000,	-48.07
+4.050000,	-47.70
+4.150000,	-47.87
+4.250000,	-48.09
+4.350000,	-48.00
+4.450000,	-47.61
+4.550000,	-47.86
+4.650000,	-48.15
+4.750000,	-47.93
+4.850000,	-47.78
+4.950000,	-47.87
+5.050000,	-32.30
+5.150000,	-34.01
+5.250000,	-34.70
+5.350000,	-34.92
+5.450000,	-34.76
+5.550000,	-35.03
+5.650000,	-35.27
+5.750000,	-35.34
+5.850000,	-35.30
+5.950000,	-35.27
+6.050000,	-35.38
+6.150000,	-35.36
+6.250000,	-35.24
+6.350000,	-35.18
+6.450000,	-35.23
+6.550000,	-35.28
+6.650000,	-35.28
+6.750000,	-35.26
+6.850000,	-35.26
+6.950000,	-35.21
+7.050000,	-35.37
+7.150000,	-35.25
+7.250000,	-35.22
+7.350000,	-35.29
+7.450000,	-35.23
+7.550000,	-33.97
+7.650000,	-30.18
+7.750000,	-56.62
+7.850000,	-32.28
+7.950000,	-41.01
+8.050000,	-40.21
+8.150000,	-34.35
+8.250000,	-59.98
+8.350000,	-34.49
+8.450000,	-41.92
+8.550000,	-40.32
+8.650000,	-35.09
+8.750000,	-60.29
+8.850000,	-35.10
+8.950000,	-42.24
+9.050000,	-41.13
+9.150000,	-35.33
+9.250000,	-59.76
+9.350000,	-34.89
+9.450000,	-41.54
+9.550000,	-41.03
+9.650000,	-35.08
+9.750000,	-60.98
+9.850000,	-34.83
+9.950000,	-42.65
+10.050000,	-50.24
+10.150000,	-49.91
+10.250000,	-50.05
+10.350000,	-50.03
+10.450000,	-49.77
+10.550000,	-49.63
+10.650000,	-49.74
+10.750000,	-49.73
+10.850000,	-49.70
+10.950000,	-49.17
+11.050000,	-49.09
+11.150000,	-49.15
+11.250000,	-49.27
+11.350000,	-49.23
+11.450000,	-48.62
+11.550000,	-48.62
+11.650000,	-48.85
+11.750000,	-48.79
+11.850000,	-48.34
+11.950000,	-48.20
+12.050000,	-48.42
+12.150000,	-48.13
+12.250000,	-47.90
+12.350000,	-48.06
+12.450000,	-47.91
+12.550000,	-77.71
+12.650000,	-75.62
+12.750000,	-73.92
+12.850000,	-72.22
+12.950000,	-70.70
+13.050000,	-69.42
+13.150000,	-68.44
+13.250000,	-67.36
+13.350000,	-67.16
+13.450000,	-67.03
+13.550000,	-66.84
+13.650000,	-66.70
+13.750000,	-66.67
+13.850000,	-66.69
+13.950000,	-66.45
+14.050000,	-66.21
+14.150000,	-66.26
+14.250000,	-66.24
+14.350000,	-66.15
+14.450000,	-65.80
+14.550000,	-65.75
+14.650000,	-65.89
+14.750000,	-65.86
+14.850000,	-65.54
+14.950000,	-65.48
+15.050000,	-34.59
+15.150000,	-32.72
+15.250000,	-58.22
+15.350000,	-33.53
+15.450000,	-41.55
+15.550000,	-41.33
+15.650000,	-34.45
+15.750000,	-60.08
+15.850000,	-34.82
+15.950000,	-42.64
+16.050000,	-40.91
+16.150000,	-35.59
+16.250000,	-60.40
+16.350000,	-34.96
+16.450000,	-42.32
+16.550000,	-40.91
+16.650000,	-35.63
+16.750000,	-60.26
+16.850000,	-35.26
+16.950000,	-43.05
+17.050000,	-41.44
+17.150000,	-35.57
+17.250000,	-60.65
+17.350000,	-35.37
+17.450000,	-42.82
+17.550000,	-51.50
+17.650000,	-51.59
+17.750000,	-51.76
+17.850000,	-51.44
+17.950000,	-51.00
+18.050000,	-51.23
+18.150000,	-51.32
+18.250000,	-51.11
+18.350000,	-50.65
+18.450000,	-50.84
+18.550000,	-50.88
+18.650000,	-50.81
+18.750000,	-50.38
+18.850000,	-50.43
+18.950000,	-50.49
+19.050000,	-50.51
+19.150000,	-50.21
+19.250000,	-50.15
+19.350000,	-50.15
+19.450000,	-50.22
+19.550000,	-49.93
+19.650000,	-49.62
+19.750000,	-49.85
+19.850000,	-50.01
+19.950000,	-49.59
@@ -0,0 +1,200 @@
+0.050000,	-63.96
+0.150000,	-57.01
+0.250000,	-80.36
+0.350000,	-54.47
+0.450000,	-60.54
+0.550000,	-58.75
+0.650000,	-51.82
+0.750000,	-75.04
+0.850000,	-49.80
+0.950000,	-57.32
+1.050000,	-56.18
+1.150000,	-48.78
+1.250000,	-72.81
+1.350000,	-47.55
+1.450000,	-53.75
+1.550000,	-53.02
+1.650000,	-46.74
+1.750000,	-70.85
+1.850000,	-46.12
+1.950000,	-53.07
+2.050000,	-51.67
+2.150000,	-45.74
+2.250000,	-70.10
+2.350000,	-46.10
+2.450000,	-53.40
+2.550000,	-38.29
+2.650000,	-40.26
+2.750000,	-41.12
+2.850000,	-41.32
+2.950000,	-41.70
+3.050000,	-42.22
+3.150000,	-42.32
+3.250000,	-42.27
+3.350000,	-42.11
+3.450000,	-43.17
+3.550000,	-43.14
+3.650000,	-42.91
+3.750000,	-42.86
+3.850000,	-43.23
+3.950000,	-43.16
+4.050000,	-42.80
+4.150000,	-43.02
+4.250000,	-43.31
+4.350000,	-43.09
+4.450000,	-42.85
+4.550000,	-43.02
+4.650000,	-43.24
+4.750000,	-43.01
+4.850000,	-42.90
+4.950000,	-43.08
+5.050000,	-28.01
+5.150000,	-29.43
+5.250000,	-30.00
+5.350000,	-30.04
+5.450000,	-29.89
+5.550000,	-30.36
+5.650000,	-30.43
+5.750000,	-30.44
+5.850000,	-30.42
+5.950000,	-30.44
+6.050000,	-30.37
+6.150000,	-30.36
+6.250000,	-30.48
+6.350000,	-30.35
+6.450000,	-30.43
+6.550000,	-30.44
+6.650000,	-30.36
+6.750000,	-30.55
+6.850000,	-30.46
+6.950000,	-30.39
+7.050000,	-30.43
+7.150000,	-30.53
+7.250000,	-30.35
+7.350000,	-30.41
+7.450000,	-30.46
+7.550000,	-29.70
+7.650000,	-25.63
+7.750000,	-48.38
+7.850000,	-26.89
+7.950000,	-36.18
+8.050000,	-31.42
+8.150000,	-28.47
+8.250000,	-50.20
+8.350000,	-26.97
+8.450000,	-35.57
+8.550000,	-31.13
+8.650000,	-28.40
+8.750000,	-50.67
+8.850000,	-27.01
+8.950000,	-35.53
+9.050000,	-31.62
+9.150000,	-28.01
+9.250000,	-49.90
+9.350000,	-27.48
+9.450000,	-35.74
+9.550000,	-31.55
+9.650000,	-28.26
+9.750000,	-50.20
+9.850000,	-27.41
+9.950000,	-35.48
+10.050000,	-41.21
+10.150000,	-39.67
+10.250000,	-39.16
+10.350000,	-38.75
+10.450000,	-38.22
+10.550000,	-37.76
+10.650000,	-37.39
+10.750000,	-37.15
+10.850000,	-36.83
+10.950000,	-36.56
+11.050000,	-36.23
+11.150000,	-35.97
+11.250000,	-36.15
+11.350000,	-36.07
+11.450000,	-35.86
+11.550000,	-35.75
+11.650000,	-35.85
+11.750000,	-35.66
+11.850000,	-35.45
+11.950000,	-35.58
+12.050000,	-35.85
+12.150000,	-35.59
+12.250000,	-35.41
+12.350000,	-35.72
+12.450000,	-35.79
+12.550000,	-65.26
+12.650000,	-59.24
+12.750000,	-55.19
+12.850000,	-53.70
+12.950000,	-53.28
+13.050000,	-52.81
+13.150000,	-52.51
+13.250000,	-52.14
+13.350000,	-51.80
+13.450000,	-51.70
+13.550000,	-51.26
+13.650000,	-51.28
+13.750000,	-50.99
+13.850000,	-50.82
+13.950000,	-50.69
+14.050000,	-50.31
+14.150000,	-50.31
+14.250000,	-50.32
+14.350000,	-50.07
+14.450000,	-49.86
+14.550000,	-49.75
+14.650000,	-49.82
+14.750000,	-49.95
+14.850000,	-49.56
+14.950000,	-49.43
+15.050000,	-30.85
+15.150000,	-28.01
+15.250000,	-50.39
+15.350000,	-27.93
+15.450000,	-36.48
+15.550000,	-31.60
+15.650000,	-29.69
+15.750000,	-49.63
+15.850000,	-27.74
+15.950000,	-36.58
+16.050000,	-31.83
+16.150000,	-29.56
+16.250000,	-50.91
+16.350000,	-27.97
+16.450000,	-37.13
+16.550000,	-32.16
+16.650000,	-29.75
+16.750000,	-51.43
+16.850000,	-27.88
+16.950000,	-36.65
+17.050000,	-32.32
+17.150000,	-28.81
+17.250000,	-50.91
+17.350000,	-27.38
+17.450000,	-36.57
+17.550000,	-42.00
+17.650000,	-41.44
+17.750000,	-41.14
+17.850000,	-40.40
+17.950000,	-39.90
+18.050000,	-39.85
+18.150000,	-39.67
+18.250000,	-39.28
+18.350000,	-39.23
+18.450000,	-38.98
+18.550000,	-38.91
+18.650000,	-38.61
+18.750000,	-38.53
+18.850000,	-38.62
+18.950000,	-38.68
+19.050000,	-38.40
+19.150000,	-38.37
+19.250000,	-38.28
+19.350000,	-38.31
+19.450000,	-38.48
+19.550000,	-38.35
+19.650000,	-38.17
+19.750000,	-38.40
+19.850000,	-38.46
+19.950000,	-38.27
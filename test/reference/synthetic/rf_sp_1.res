@@ -0,0 +1,200 @@
+0.050000,	-64.31
+0.150000,	-56.61
+0.250000,	-80.03
+0.350000,	-54.38
+0.450000,	-60.47
+0.550000,	-59.14
+0.650000,	-51.77
+0.750000,	-75.67
+0.850000,	-49.68
+0.950000,	-56.79
+1.050000,	-55.21
+1.150000,	-48.44
+1.250000,	-73.19
+1.350000,	-47.67
+1.450000,	-54.21
+1.550000,	-53.76
+1.650000,	-46.34
+1.750000,	-71.14
+1.850000,	-46.03
+1.950000,	-52.79
+2.050000,	-52.22
+2.150000,	-46.10
+2.250000,	-69.78
+2.350000,	-45.97
+2.450000,	-52.85
+2.550000,	-38.39
+2.650000,	-40.31
+2.750000,	-41.08
+2.850000,	-41.33
+2.950000,	-41.72
+3.050000,	-42.24
+3.150000,	-42.29
+3.250000,	-42.16
+3.350000,	-42.14
+3.450000,	-43.19
+3.550000,	-43.24
+3.650000,	-42.87
+3.750000,	-42.92
+3.850000,	-43.20
+3.950000,	-43.12
+4.050000,	-42.80
+4.150000,	-43.02
+4.250000,	-43.23
+4.350000,	-43.17
+4.450000,	-42.77
+4.550000,	-43.02
+4.650000,	-43.28
+4.750000,	-42.96
+4.850000,	-43.03
+4.950000,	-43.07
+5.050000,	-28.08
+5.150000,	-29.44
+5.250000,	-29.93
+5.350000,	-29.90
+5.450000,	-30.02
+5.550000,	-30.33
+5.650000,	-30.39
+5.750000,	-30.48
+5.850000,	-30.38
+5.950000,	-30.44
+6.050000,	-30.46
+6.150000,	-30.48
+6.250000,	-30.50
+6.350000,	-30.43
+6.450000,	-30.43
+6.550000,	-30.47
+6.650000,	-30.51
+6.750000,	-30.43
+6.850000,	-30.35
+6.950000,	-30.49
+7.050000,	-30.40
+7.150000,	-30.46
+7.250000,	-30.44
+7.350000,	-30.35
+7.450000,	-30.38
+7.550000,	-29.69
+7.650000,	-26.09
+7.750000,	-49.05
+7.850000,	-27.02
+7.950000,	-35.39
+8.050000,	-30.91
+8.150000,	-29.48
+8.250000,	-48.85
+8.350000,	-27.07
+8.450000,	-36.35
+8.550000,	-32.06
+8.650000,	-28.59
+8.750000,	-49.10
+8.850000,	-27.12
+8.950000,	-35.93
+9.050000,	-32.03
+9.150000,	-27.80
+9.250000,	-49.91
+9.350000,	-27.52
+9.450000,	-35.92
+9.550000,	-31.35
+9.650000,	-27.89
+9.750000,	-49.64
+9.850000,	-27.43
+9.950000,	-35.53
+10.050000,	-41.04
+10.150000,	-39.66
+10.250000,	-39.12
+10.350000,	-38.76
+10.450000,	-38.25
+10.550000,	-37.76
+10.650000,	-37.39
+10.750000,	-37.15
+10.850000,	-36.95
+10.950000,	-36.45
+11.050000,	-36.27
+11.150000,	-36.00
+11.250000,	-36.07
+11.350000,	-36.08
+11.450000,	-35.97
+11.550000,	-35.79
+11.650000,	-35.84
+11.750000,	-35.65
+11.850000,	-35.43
+11.950000,	-35.66
+12.050000,	-35.80
+12.150000,	-35.63
+12.250000,	-35.39
+12.350000,	-35.71
+12.450000,	-35.83
+12.550000,	-65.21
+12.650000,	-59.25
+12.750000,	-55.39
+12.850000,	-53.74
+12.950000,	-53.38
+13.050000,	-52.74
+13.150000,	-52.38
+13.250000,	-52.09
+13.350000,	-51.79
+13.450000,	-51.82
+13.550000,	-51.25
+13.650000,	-51.18
+13.750000,	-50.90
+13.850000,	-50.79
+13.950000,	-50.80
+14.050000,	-50.36
+14.150000,	-50.26
+14.250000,	-50.28
+14.350000,	-50.05
+14.450000,	-49.80
+14.550000,	-49.81
+14.650000,	-49.87
+14.750000,	-49.79
+14.850000,	-49.60
+14.950000,	-49.31
+15.050000,	-30.49
+15.150000,	-27.98
+15.250000,	-50.26
+15.350000,	-27.97
+15.450000,	-36.60
+15.550000,	-32.02
+15.650000,	-29.75
+15.750000,	-51.99
+15.850000,	-27.69
+15.950000,	-36.65
+16.050000,	-32.52
+16.150000,	-29.22
+16.250000,	-51.95
+16.350000,	-28.30
+16.450000,	-36.63
+16.550000,	-32.47
+16.650000,	-29.68
+16.750000,	-51.51
+16.850000,	-28.03
+16.950000,	-37.52
+17.050000,	-32.26
+17.150000,	-28.95
+17.250000,	-51.28
+17.350000,	-28.10
+17.450000,	-36.66
+17.550000,	-41.97
+17.650000,	-41.51
+17.750000,	-41.09
+17.850000,	-40.43
+17.950000,	-39.98
+18.050000,	-39.95
+18.150000,	-39.75
+18.250000,	-39.31
+18.350000,	-39.12
+18.450000,	-39.02
+18.550000,	-39.00
+18.650000,	-38.66
+18.750000,	-38.61
+18.850000,	-38.58
+18.950000,	-38.64
+19.050000,	-38.37
+19.150000,	-38.42
+19.250000,	-38.32
+19.350000,	-38.31
+19.450000,	-38.46
+19.550000,	-38.35
+19.650000,	-38.23
+19.750000,	-38.34
+19.850000,	-38.52
+19.950000,	-38.22
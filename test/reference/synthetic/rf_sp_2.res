@@ -0,0 +1,200 @@
+0.050000,	-61.21
+0.150000,	-53.52
+0.250000,	-77.62
+0.350000,	-50.67
+0.450000,	-58.10
+0.550000,	-55.60
+0.650000,	-48.51
+0.750000,	-72.88
+0.850000,	-47.70
+0.950000,	-53.04
+1.050000,	-51.95
+1.150000,	-45.70
+1.250000,	-69.76
+1.350000,	-44.48
+1.450000,	-50.87
+1.550000,	-50.01
+1.650000,	-43.56
+1.750000,	-68.23
+1.850000,	-43.19
+1.950000,	-49.87
+2.050000,	-48.21
+2.150000,	-42.68
+2.250000,	-67.40
+2.350000,	-43.08
+2.450000,	-50.02
+2.550000,	-35.20
+2.650000,	-37.17
+2.750000,	-38.00
+2.850000,	-38.21
+2.950000,	-38.57
+3.050000,	-39.11
+3.150000,	-39.23
+3.250000,	-39.14
+3.350000,	-39.04
+3.450000,	-40.04
+3.550000,	-40.13
+3.650000,	-39.80
+3.750000,	-39.81
+3.850000,	-40.11
+3.950000,	-40.11
+4.050000,	-39.71
+4.150000,	-39.86
+4.250000,	-40.23
+4.350000,	-40.01
+4.450000,	-39.73
+4.550000,	-39.93
+4.650000,	-40.11
+4.750000,	-39.91
+4.850000,	-39.89
+4.950000,	-39.96
+5.050000,	-24.89
+5.150000,	-26.38
+5.250000,	-26.86
+5.350000,	-26.85
+5.450000,	-26.91
+5.550000,	-27.33
+5.650000,	-27.34
+5.750000,	-27.43
+5.850000,	-27.36
+5.950000,	-27.38
+6.050000,	-27.38
+6.150000,	-27.31
+6.250000,	-27.26
+6.350000,	-27.32
+6.450000,	-27.24
+6.550000,	-27.38
+6.650000,	-27.39
+6.750000,	-27.28
+6.850000,	-27.38
+6.950000,	-27.34
+7.050000,	-27.32
+7.150000,	-27.39
+7.250000,	-27.28
+7.350000,	-27.33
+7.450000,	-27.30
+7.550000,	-25.76
+7.650000,	-22.69
+7.750000,	-45.93
+7.850000,	-23.72
+7.950000,	-33.15
+8.050000,	-27.86
+8.150000,	-25.81
+8.250000,	-46.54
+8.350000,	-24.22
+8.450000,	-32.85
+8.550000,	-28.60
+8.650000,	-25.34
+8.750000,	-46.93
+8.850000,	-24.01
+8.950000,	-32.73
+9.050000,	-27.97
+9.150000,	-24.82
+9.250000,	-47.38
+9.350000,	-24.41
+9.450000,	-33.55
+9.550000,	-28.86
+9.650000,	-25.07
+9.750000,	-46.51
+9.850000,	-23.91
+9.950000,	-32.04
+10.050000,	-37.96
+10.150000,	-36.52
+10.250000,	-35.95
+10.350000,	-35.70
+10.450000,	-35.16
+10.550000,	-34.70
+10.650000,	-34.31
+10.750000,	-34.05
+10.850000,	-33.80
+10.950000,	-33.41
+11.050000,	-33.25
+11.150000,	-32.80
+11.250000,	-33.03
+11.350000,	-33.05
+11.450000,	-32.81
+11.550000,	-32.64
+11.650000,	-32.79
+11.750000,	-32.53
+11.850000,	-32.35
+11.950000,	-32.51
+12.050000,	-32.83
+12.150000,	-32.57
+12.250000,	-32.30
+12.350000,	-32.63
+12.450000,	-32.82
+12.550000,	-62.12
+12.650000,	-56.21
+12.750000,	-52.06
+12.850000,	-50.72
+12.950000,	-50.29
+13.050000,	-49.72
+13.150000,	-49.46
+13.250000,	-49.07
+13.350000,	-48.68
+13.450000,	-48.75
+13.550000,	-48.23
+13.650000,	-48.23
+13.750000,	-47.82
+13.850000,	-47.70
+13.950000,	-47.62
+14.050000,	-47.27
+14.150000,	-47.33
+14.250000,	-47.28
+14.350000,	-46.99
+14.450000,	-46.68
+14.550000,	-46.81
+14.650000,	-46.73
+14.750000,	-46.71
+14.850000,	-46.48
+14.950000,	-46.27
+15.050000,	-27.18
+15.150000,	-24.54
+15.250000,	-47.19
+15.350000,	-24.50
+15.450000,	-33.71
+15.550000,	-28.98
+15.650000,	-26.41
+15.750000,	-46.01
+15.850000,	-24.39
+15.950000,	-33.40
+16.050000,	-29.07
+16.150000,	-26.75
+16.250000,	-48.44
+16.350000,	-24.70
+16.450000,	-33.87
+16.550000,	-29.16
+16.650000,	-26.25
+16.750000,	-48.85
+16.850000,	-25.21
+16.950000,	-34.66
+17.050000,	-29.56
+17.150000,	-25.51
+17.250000,	-48.45
+17.350000,	-24.55
+17.450000,	-33.78
+17.550000,	-38.83
+17.650000,	-38.35
+17.750000,	-38.04
+17.850000,	-37.40
+17.950000,	-36.89
+18.050000,	-36.82
+18.150000,	-36.65
+18.250000,	-36.15
+18.350000,	-36.03
+18.450000,	-35.94
+18.550000,	-35.99
+18.650000,	-35.56
+18.750000,	-35.54
+18.850000,	-35.51
+18.950000,	-35.55
+19.050000,	-35.21
+19.150000,	-35.22
+19.250000,	-35.22
+19.350000,	-35.26
+19.450000,	-35.31
+19.550000,	-35.20
+19.650000,	-35.07
+19.750000,	-35.26
+19.850000,	-35.48
+19.950000,	-35.06
@@ -0,0 +1,200 @@
+0.050000,	-68.68
+0.150000,	-61.67
+0.250000,	-84.57
+0.350000,	-59.47
+0.450000,	-65.60
+0.550000,	-63.77
+0.650000,	-56.59
+0.750000,	-80.23
+0.850000,	-55.49
+0.950000,	-61.68
+1.050000,	-60.49
+1.150000,	-53.39
+1.250000,	-77.11
+1.350000,	-52.12
+1.450000,	-57.91
+1.550000,	-57.31
+1.650000,	-51.52
+1.750000,	-76.20
+1.850000,	-50.55
+1.950000,	-57.31
+2.050000,	-56.31
+2.150000,	-50.70
+2.250000,	-75.49
+2.350000,	-50.96
+2.450000,	-57.59
+2.550000,	-43.24
+2.650000,	-45.04
+2.750000,	-45.97
+2.850000,	-46.22
+2.950000,	-46.55
+3.050000,	-47.10
+3.150000,	-47.28
+3.250000,	-47.09
+3.350000,	-46.98
+3.450000,	-48.09
+3.550000,	-48.07
+3.650000,	-47.77
+3.750000,	-47.82
+3.850000,	-48.01
+3.950000,	-48.01
+4.050000,	-47.70
+4.150000,	-47.86
+4.250000,	-48.14
+4.350000,	-48.02
+4.450000,	-47.64
+4.550000,	-47.92
+4.650000,	-48.15
+4.750000,	-47.92
+4.850000,	-47.76
+4.950000,	-47.93
+5.050000,	-32.94
+5.150000,	-34.28
+5.250000,	-34.76
+5.350000,	-34.89
+5.450000,	-34.99
+5.550000,	-35.30
+5.650000,	-35.33
+5.750000,	-35.20
+5.850000,	-35.21
+5.950000,	-35.23
+6.050000,	-35.34
+6.150000,	-35.30
+6.250000,	-35.33
+6.350000,	-35.20
+6.450000,	-35.29
+6.550000,	-35.41
+6.650000,	-35.32
+6.750000,	-35.24
+6.850000,	-35.30
+6.950000,	-35.27
+7.050000,	-35.24
+7.150000,	-35.30
+7.250000,	-35.24
+7.350000,	-35.28
+7.450000,	-35.21
+7.550000,	-34.01
+7.650000,	-30.42
+7.750000,	-53.32
+7.850000,	-31.51
+7.950000,	-40.78
+8.050000,	-36.27
+8.150000,	-33.60
+8.250000,	-54.45
+8.350000,	-31.96
+8.450000,	-40.57
+8.550000,	-36.76
+8.650000,	-34.06
+8.750000,	-54.59
+8.850000,	-31.99
+8.950000,	-40.70
+9.050000,	-36.29
+9.150000,	-32.85
+9.250000,	-55.40
+9.350000,	-32.52
+9.450000,	-41.02
+9.550000,	-36.32
+9.650000,	-33.07
+9.750000,	-55.27
+9.850000,	-31.88
+9.950000,	-40.50
+10.050000,	-45.97
+10.150000,	-44.58
+10.250000,	-43.99
+10.350000,	-43.60
+10.450000,	-43.05
+10.550000,	-42.58
+10.650000,	-42.25
+10.750000,	-42.03
+10.850000,	-41.75
+10.950000,	-41.41
+11.050000,	-41.26
+11.150000,	-40.86
+11.250000,	-40.98
+11.350000,	-41.02
+11.450000,	-40.74
+11.550000,	-40.63
+11.650000,	-40.73
+11.750000,	-40.60
+11.850000,	-40.27
+11.950000,	-40.45
+12.050000,	-40.76
+12.150000,	-40.43
+12.250000,	-40.16
+12.350000,	-40.55
+12.450000,	-40.66
+12.550000,	-69.98
+12.650000,	-64.13
+12.750000,	-60.18
+12.850000,	-58.48
+12.950000,	-58.06
+13.050000,	-57.64
+13.150000,	-57.31
+13.250000,	-57.05
+13.350000,	-56.61
+13.450000,	-56.54
+13.550000,	-56.09
+13.650000,	-56.06
+13.750000,	-55.65
+13.850000,	-55.58
+13.950000,	-55.57
+14.050000,	-55.06
+14.150000,	-55.01
+14.250000,	-55.16
+14.350000,	-54.93
+14.450000,	-54.71
+14.550000,	-54.71
+14.650000,	-54.53
+14.750000,	-54.64
+14.850000,	-54.31
+14.950000,	-54.17
+15.050000,	-35.30
+15.150000,	-32.40
+15.250000,	-55.12
+15.350000,	-32.63
+15.450000,	-41.95
+15.550000,	-37.51
+15.650000,	-34.03
+15.750000,	-55.17
+15.850000,	-32.42
+15.950000,	-41.52
+16.050000,	-36.51
+16.150000,	-34.18
+16.250000,	-55.88
+16.350000,	-33.10
+16.450000,	-42.36
+16.550000,	-37.87
+16.650000,	-34.13
+16.750000,	-56.57
+16.850000,	-33.04
+16.950000,	-41.77
+17.050000,	-37.46
+17.150000,	-33.71
+17.250000,	-54.52
+17.350000,	-32.99
+17.450000,	-41.36
+17.550000,	-46.80
+17.650000,	-46.28
+17.750000,	-45.95
+17.850000,	-45.37
+17.950000,	-44.86
+18.050000,	-44.76
+18.150000,	-44.58
+18.250000,	-44.17
+18.350000,	-44.06
+18.450000,	-43.86
+18.550000,	-43.85
+18.650000,	-43.50
+18.750000,	-43.46
+18.850000,	-43.47
+18.950000,	-43.39
+19.050000,	-43.26
+19.150000,	-43.18
+19.250000,	-43.21
+19.350000,	-43.21
+19.450000,	-43.27
+19.550000,	-43.23
+19.650000,	-43.06
+19.750000,	-43.23
+19.850000,	-43.39
+19.950000,	-43.13
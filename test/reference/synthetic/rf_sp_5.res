@@ -0,0 +1,200 @@
+0.050000,	-69.44
+0.150000,	-61.31
+0.250000,	-85.65
+0.350000,	-58.49
+0.450000,	-65.29
+0.550000,	-63.90
+0.650000,	-56.72
+0.750000,	-80.28
+0.850000,	-54.73
+0.950000,	-61.72
+1.050000,	-60.48
+1.150000,	-53.73
+1.250000,	-77.90
+1.350000,	-52.72
+1.450000,	-58.67
+1.550000,	-57.32
+1.650000,	-51.67
+1.750000,	-76.09
+1.850000,	-50.82
+1.950000,	-58.09
+2.050000,	-57.23
+2.150000,	-50.87
+2.250000,	-74.66
+2.350000,	-50.67
+2.450000,	-57.36
+2.550000,	-43.21
+2.650000,	-45.18
+2.750000,	-45.96
+2.850000,	-46.15
+2.950000,	-46.66
+3.050000,	-47.11
+3.150000,	-47.18
+3.250000,	-47.08
+3.350000,	-47.03
+3.450000,	-48.02
+3.550000,	-48.02
+3.650000,	-47.71
+3.750000,	-47.75
+3.850000,	-48.03
+3.950000,	-48.07
+4.050000,	-47.70
+4.150000,	-47.87
+4.250000,	-48.09
+4.350000,	-48.00
+4.450000,	-47.61
+4.550000,	-47.86
+4.650000,	-48.15
+4.750000,	-47.93
+4.850000,	-47.78
+4.950000,	-47.87
+5.050000,	-32.83
+5.150000,	-34.20
+5.250000,	-34.79
+5.350000,	-34.92
+5.450000,	-34.76
+5.550000,	-35.22
+5.650000,	-35.27
+5.750000,	-35.34
+5.850000,	-35.30
+5.950000,	-35.27
+6.050000,	-35.38
+6.150000,	-35.36
+6.250000,	-35.24
+6.350000,	-35.18
+6.450000,	-35.23
+6.550000,	-35.28
+6.650000,	-35.28
+6.750000,	-35.26
+6.850000,	-35.26
+6.950000,	-35.21
+7.050000,	-35.37
+7.150000,	-35.25
+7.250000,	-35.22
+7.350000,	-35.29
+7.450000,	-35.23
+7.550000,	-34.32
+7.650000,	-30.39
+7.750000,	-52.99
+7.850000,	-31.28
+7.950000,	-41.01
+8.050000,	-36.58
+8.150000,	-33.58
+8.250000,	-55.34
+8.350000,	-32.11
+8.450000,	-40.76
+8.550000,	-36.59
+8.650000,	-33.60
+8.750000,	-55.03
+8.850000,	-32.51
+8.950000,	-41.08
+9.050000,	-36.42
+9.150000,	-33.15
+9.250000,	-54.74
+9.350000,	-32.62
+9.450000,	-40.65
+9.550000,	-36.48
+9.650000,	-33.09
+9.750000,	-55.49
+9.850000,	-32.03
+9.950000,	-41.25
+10.050000,	-45.97
+10.150000,	-44.50
+10.250000,	-44.05
+10.350000,	-43.57
+10.450000,	-43.16
+10.550000,	-42.59
+10.650000,	-42.34
+10.750000,	-42.04
+10.850000,	-41.74
+10.950000,	-41.36
+11.050000,	-41.17
+11.150000,	-40.89
+11.250000,	-41.01
+11.350000,	-40.99
+11.450000,	-40.86
+11.550000,	-40.61
+11.650000,	-40.70
+11.750000,	-40.64
+11.850000,	-40.27
+11.950000,	-40.52
+12.050000,	-40.74
+12.150000,	-40.45
+12.250000,	-40.22
+12.350000,	-40.56
+12.450000,	-40.67
+12.550000,	-70.01
+12.650000,	-63.98
+12.750000,	-60.02
+12.850000,	-58.45
+12.950000,	-57.97
+13.050000,	-57.62
+13.150000,	-57.29
+13.250000,	-56.99
+13.350000,	-56.64
+13.450000,	-56.48
+13.550000,	-56.12
+13.650000,	-56.07
+13.750000,	-55.69
+13.850000,	-55.57
+13.950000,	-55.53
+14.050000,	-55.05
+14.150000,	-55.09
+14.250000,	-55.08
+14.350000,	-54.83
+14.450000,	-54.59
+14.550000,	-54.54
+14.650000,	-54.68
+14.750000,	-54.64
+14.850000,	-54.47
+14.950000,	-54.23
+15.050000,	-35.31
+15.150000,	-33.33
+15.250000,	-55.38
+15.350000,	-32.64
+15.450000,	-41.55
+15.550000,	-37.97
+15.650000,	-33.77
+15.750000,	-55.82
+15.850000,	-32.50
+15.950000,	-41.48
+16.050000,	-36.69
+16.150000,	-34.68
+16.250000,	-56.13
+16.350000,	-32.95
+16.450000,	-41.52
+16.550000,	-36.58
+16.650000,	-34.52
+16.750000,	-56.60
+16.850000,	-32.97
+16.950000,	-42.64
+17.050000,	-37.27
+17.150000,	-33.80
+17.250000,	-56.34
+17.350000,	-32.73
+17.450000,	-41.65
+17.550000,	-46.86
+17.650000,	-46.36
+17.750000,	-46.04
+17.850000,	-45.35
+17.950000,	-44.86
+18.050000,	-44.78
+18.150000,	-44.61
+18.250000,	-44.20
+18.350000,	-43.96
+18.450000,	-43.85
+18.550000,	-43.88
+18.650000,	-43.55
+18.750000,	-43.39
+18.850000,	-43.46
+18.950000,	-43.47
+19.050000,	-43.24
+19.150000,	-43.20
+19.250000,	-43.21
+19.350000,	-43.22
+19.450000,	-43.28
+19.550000,	-43.19
+19.650000,	-43.00
+19.750000,	-43.23
+19.850000,	-43.39
+19.950000,	-43.11
@@ -0,0 +1,170 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Stage accounting of dlb_md_emul_query_complexity()
+ *
+ * Queries configurations with unit models, where each stage costs one
+ * cycle per unit of work, so the estimate counts how often the emulator
+ * runs each stage: encoder filters by channel, the compressor's channels
+ * and downmixes, gain application by output and the fixed cost per call.
+ *
+ * Exit codes: 0 pass, 1 mismatch.
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+#include "dlb_md_emul_api.h"
+#include "emul_fixture.h"
+
+static bool near(double a, double b)
+{
+    return std::fabs(a - b) < 1e-9 * (1.0 + std::fabs(b));
+}
+
+static void config_3_2_1(dlb_md_emul_process_config_t *conf)
+{
+    static const DLB_MD_EMUL_CHANNEL_MAP layout[6] =
+    {
+        DLB_MD_EMUL_CHAN_LEFT, DLB_MD_EMUL_CHAN_RGHT, DLB_MD_EMUL_CHAN_CNTR,
+        DLB_MD_EMUL_CHAN_LFE, DLB_MD_EMUL_CHAN_LSUR, DLB_MD_EMUL_CHAN_RSUR
+    };
+
+    memset(conf, 0, sizeof(*conf));
+    conf->channel_mode = DLB_MD_EMUL_CHMOD_3_2_1;
+    conf->dolbye_channel_mode = DLB_MD_EMUL_CHMOD_3_2_1;
+    conf->lfe_on = 1;
+    for (int c = 0; c < DLB_MD_EMUL_MAX_CHANS; c++)
+    {
+        conf->a_chan_map[c] = c < 6 ? layout[c] : DLB_MD_EMUL_CHAN_NONE;
+    }
+    conf->sample_offset = DLB_MD_EMUL_MAX_CHANS;
+    conf->num_samples = 6 * DLB_MD_EMUL_BLOCK_SIZE;
+    conf->sample_rate = 48000u;
+    conf->hpfon = 1;
+    conf->bwlpfon = 1;
+    conf->lfelpfon = 1;
+    conf->sur90on = 1;
+    conf->suratton = 1;
+    conf->comp_mode[0] = DLB_MD_EMUL_CM_LINE;
+    conf->comp_mode[1] = DLB_MD_EMUL_CM_RF;
+    conf->dialnorm = 27;
+    conf->control = (DLB_MD_EMUL_CONTROL_ENCODER_ENABLE | DLB_MD_EMUL_CONTROL_DECODER_ENABLE | DLB_MD_EMUL_CONTROL_DRC_CALC_ENABLE);
+    conf->drc_profile = DLB_MD_EMUL_COMPR_FILM_STANDARD;
+    conf->comp_profile = DLB_MD_EMUL_COMPR_FILM_STANDARD;
+}
+
+int main(void)
+{
+    dlb_md_emul_process_config_t    conf;
+    dlb_md_emul_complexity_model_t  unit;
+    dlb_md_emul_complexity_t        c;
+    double                          sum;
+
+    /* Every stage one cycle per unit of work */
+    memset(&unit, 0, sizeof(unit));
+    unit.hpf = unit.bwlpf = unit.lfelpf = unit.psf_main = unit.psf_surr = unit.suratt = 1.0;
+    unit.loudness = 1.0;
+    for (int d = 0; d < DLB_MD_EMUL_DMX_TYPES; d++)
+    {
+        unit.downmix[d] = 1.0;
+    }
+    unit.gain_calc = unit.gain_apply = unit.aux_copy = unit.call = 1.0;
+
+    config_3_2_1(&conf);
+    check(dlb_md_emul_query_complexity(nullptr, 1, &unit, &c) != 0, "NULL config rejected");
+    check(dlb_md_emul_query_complexity(&conf, 3, &unit, &c) != 0, "three outputs rejected");
+    conf.num_samples = DLB_MD_EMUL_BLOCK_SIZE - 1;
+    check(dlb_md_emul_query_complexity(&conf, 1, &unit, &c) != 0, "less than a block rejected");
+
+    /* L R C: hpf bwlpf psf_main, LFE: hpf lfelpf psf_main, Ls Rs: suratt hpf bwlpf psf_surr */
+    config_3_2_1(&conf);
+    check(dlb_md_emul_query_complexity(&conf, 2, &unit, &c) == 0, "query");
+    check(c.encoder_filters[0] == 3.0 && c.encoder_filters[1] == 3.0 && c.encoder_filters[2] == 3.0, "front filters");
+    check(c.encoder_filters[3] == 3.0, "LFE filters");
+    check(c.encoder_filters[4] == 4.0 && c.encoder_filters[5] == 4.0, "surround filters");
+    check(c.encoder_filters[6] == 0.0 && c.encoder_filters[7] == 0.0, "unmapped slots");
+    check(c.loudness == 6.0, "compressor channels with LFE");
+    check(c.downmix[0] == 6.0 && c.downmix[DLB_MD_EMUL_DMX_TYPES - 1] == 6.0, "downmix channels");
+    check(near(c.gain_calc, 1.0 / DLB_MD_EMUL_BLOCK_SIZE), "gain computers per block");
+    check(c.gain_apply[0] == 6.0 && c.gain_apply[1] == 12.0, "gain application, second output with its copy");
+    check(near(c.call, 1.0 / (6 * DLB_MD_EMUL_BLOCK_SIZE)), "call cost spread over the samples");
+    sum = c.loudness + c.gain_calc + c.gain_apply[0] + c.gain_apply[1] + c.call;
+    for (int ch = 0; ch < DLB_MD_EMUL_MAX_CHANS; ch++)
+    {
+        sum += c.encoder_filters[ch];
+    }
+    for (int d = 0; d < DLB_MD_EMUL_DMX_TYPES; d++)
+    {
+        sum += c.downmix[d];
+    }
+    check(near(c.total, sum), "total is the sum of the stages");
+
+    /* Partial blocks at the end of a call are not processed */
+    conf.num_samples = 6 * DLB_MD_EMUL_BLOCK_SIZE + 100;
+    dlb_md_emul_query_complexity(&conf, 2, &unit, &c);
+    check(near(c.call, 1.0 / (6 * DLB_MD_EMUL_BLOCK_SIZE)), "whole blocks only");
+
+    /* Stages that are switched off cost nothing */
+    config_3_2_1(&conf);
+    conf.control = DLB_MD_EMUL_CONTROL_DECODER_ENABLE;
+    conf.comp_mode[0] = DLB_MD_EMUL_CM_NONE;
+    dlb_md_emul_query_complexity(&conf, 1, &unit, &c);
+    check(c.encoder_filters[0] == 0.0 && c.loudness == 0.0 && c.gain_calc == 0.0 && c.gain_apply[0] == 0.0, "switched off stages");
+    conf.control = DLB_MD_EMUL_CONTROL_DISABLE_ALL;
+    dlb_md_emul_query_complexity(&conf, 1, &unit, &c);
+    check(c.total == 0.0, "nothing enabled, no call");
+
+    /* Stereo has no downmix to protect */
+    config_3_2_1(&conf);
+    conf.channel_mode = DLB_MD_EMUL_CHMOD_2_0_0;
+    conf.lfe_on = 0;
+    for (int ch = 2; ch < DLB_MD_EMUL_MAX_CHANS; ch++)
+    {
+        conf.a_chan_map[ch] = DLB_MD_EMUL_CHAN_NONE;
+    }
+    dlb_md_emul_query_complexity(&conf, 1, &unit, &c);
+    check(c.loudness == 2.0 && c.downmix[0] == 0.0 && c.gain_apply[0] == 2.0, "stereo compressor and gain");
+
+    /* The built-in model */
+    config_3_2_1(&conf);
+    check(dlb_md_emul_query_complexity(&conf, 1, nullptr, &c) == 0 && c.total > 0.0, "built-in model");
+    check(dlb_md_emul_get_complexity_model()->loudness > 0.0, "built-in model terms");
+    printf("3/2.1, all filters, one output: %.0f cycles per sample frame, %.0f MHz at 48 kHz\n", c.total, c.total * 48000.0 / 1e6);
+
+    return check_result();
+}
@@ -0,0 +1,432 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  In-process DRC conformance check over the reference profile / mode matrix
+ *
+ * Runs the ten line / RF mode and compression profile combinations of
+ * test_drc.sh in parallel inside one process, measures the output power
+ * curves with the library analyser and compares them with the reference
+ * .res files using the graph_check limits of test_drc.sh.
+ *
+ * Exit codes: 0 pass, 1 fail, 77 (CTest skip) when the source is missing.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sndfile.hh>
+
+#include "dlb_md_emul_api.h"
+#include "dlb_md_emul_pwr.h"
+#include "md_emul_instance.h"
+#include "synth_programme.h"
+
+#define CONFORMANCE_CHANNELS    6
+#define CONFORMANCE_DIALNORM    31
+#define CONFORMANCE_MAX_DEV     1.6     /* graph_check -max of test_drc.sh */
+#define CONFORMANCE_MEAN_DEV    0.6     /* graph_check -dev of test_drc.sh */
+#define CONFORMANCE_SKIP        77
+#define SYNTH_SEED              1
+
+static const char *mode_name[] = { "line", "rf" };
+static const char *profile_name[] = { "fs", "fl", "ms", "ml", "sp" };
+static const int compared_channels[] = { 0, 1, 2, 4, 5 };
+
+typedef struct
+{
+    int                                 mode;       /**< 0 line, 1 RF */
+    int                                 profile;    /**< 1..5 */
+    std::vector<std::vector<double> >   curves;     /**< per channel, rounded as in the .res files */
+    std::string                         error;
+} matrix_entry;
+
+/*
+ * The configuration MdEmu builds for "-p0 -s0 -a7 -dn31 -k<profile> -c<mode>".
+ * -c falls through to -g on the MdEmu command line, so the LFE low pass flag
+ * takes the compression mode value.
+ */
+static void conformance_config(int mode, int profile, dlb_md_emul_process_config_t *emul_conf)
+{
+    memset(emul_conf, 0, sizeof(*emul_conf));
+
+    emul_conf->dolbye_channel_mode = DLB_MD_EMUL_CHMOD_3_2_1;
+    emul_conf->channel_mode = DLB_MD_EMUL_CHMOD_3_2_1;
+    emul_conf->lfe_on = 1;
+    for (int i = 0; i < DLB_MD_EMUL_MAX_CHANS; i++)
+    {
+        emul_conf->a_chan_map[i] = DLB_MD_EMUL_CHAN_NONE;
+    }
+    emul_conf->a_chan_map[0] = DLB_MD_EMUL_CHAN_LEFT;
+    emul_conf->a_chan_map[1] = DLB_MD_EMUL_CHAN_RGHT;
+    emul_conf->a_chan_map[2] = DLB_MD_EMUL_CHAN_CNTR;
+    emul_conf->a_chan_map[3] = DLB_MD_EMUL_CHAN_LFE;
+    emul_conf->a_chan_map[4] = DLB_MD_EMUL_CHAN_LSUR;
+    emul_conf->a_chan_map[5] = DLB_MD_EMUL_CHAN_RSUR;
+
+    emul_conf->sample_offset = CONFORMANCE_CHANNELS;
+    emul_conf->num_samples = DLB_MD_EMUL_BLOCK_SIZE;
+    emul_conf->sample_rate = 48000u;
+
+    emul_conf->comp_mode[0] = mode ? DLB_MD_EMUL_CM_RF : DLB_MD_EMUL_CM_LINE;
+    emul_conf->comp_mode[1] = DLB_MD_EMUL_CM_NONE;
+    emul_conf->dialnorm = CONFORMANCE_DIALNORM;
+    emul_conf->lfelpfon = mode ? 3 : 2;
+    emul_conf->control = (DLB_MD_EMUL_CONTROL_ENCODER_ENABLE | DLB_MD_EMUL_CONTROL_DECODER_ENABLE | DLB_MD_EMUL_CONTROL_DRC_CALC_ENABLE);
+    emul_conf->drc_profile = (DLB_MD_EMUL_COMPRESSION_PROFILE)profile;
+    emul_conf->comp_profile = (DLB_MD_EMUL_COMPRESSION_PROFILE)profile;
+}
+
+/* Value as it reads back from a "%.2f" .res file */
+static double res_round(double value)
+{
+    char text[32];
+
+    snprintf(text, sizeof(text), "%.2f", value);
+    return strtod(text, nullptr);
+}
+
+/* Emulate one combination over the whole source and measure its output */
+static void run_entry(const std::vector<DLB_LFRACT> *source, uint64_t frames, matrix_entry *entry)
+{
+    dlb_md_emul_process_config_t emul_conf;
+    dlb_md_emul_pwr_config_t     pwr_config = { CONFORMANCE_CHANNELS, 48000u, 4800u };
+    std::vector<char>            pwr_mem;
+    dlb_md_emul_pwr_t           *pwr;
+    std::vector<DLB_LFRACT>      block(CONFORMANCE_CHANNELS * DLB_MD_EMUL_BLOCK_SIZE);
+    std::vector<DLB_LFRACT>      secondary(DLB_MD_EMUL_MAX_CHANS * DLB_MD_EMUL_BLOCK_SIZE);
+    std::vector<DLB_LFRACT>      pcm(CONFORMANCE_CHANNELS * DLB_MD_EMUL_BLOCK_SIZE);
+    dlb_md_emul_pwr_point_t      points[DLB_MD_EMUL_BLOCK_SIZE / 4800 + 1];
+    md_emul_instance             emul = {};
+    size_t                       mem_size;
+
+    try
+    {
+        conformance_config(entry->mode, entry->profile, &emul_conf);
+        dlb_md_emul_pwr_query_mem(&pwr_config, &mem_size);
+        pwr_mem.resize(mem_size);
+        dlb_md_emul_pwr_open(&pwr_config, pwr_mem.data(), &pwr);
+        entry->curves.assign(CONFORMANCE_CHANNELS, std::vector<double>());
+
+        md_emul_instance_open(&emul);
+        emul_conf.pa_in_data[0] = block.data();
+        emul_conf.pa_in_data[1] = secondary.data();
+
+        for (uint64_t start = 0; start < frames; start += DLB_MD_EMUL_BLOCK_SIZE)
+        {
+            uint32_t valid = (uint32_t)std::min<uint64_t>(DLB_MD_EMUL_BLOCK_SIZE, frames - start);
+            uint32_t num_points;
+
+            std::fill(block.begin(), block.end(), 0.0);
+            std::copy(source->begin() + start * CONFORMANCE_CHANNELS,
+                      source->begin() + (start + valid) * CONFORMANCE_CHANNELS, block.begin());
+            md_emul_instance_process(&emul, &emul_conf, 1);
+
+            /* measured as written to and read back from a 16 bit file */
+            for (size_t i = 0; i < (size_t)valid * CONFORMANCE_CHANNELS; i++)
+            {
+                pcm[i] = (int16_t)lrint((double)block[i] * 0x7FFF) / (double)0x8000;
+            }
+            dlb_md_emul_pwr_process(pwr, pcm.data(), CONFORMANCE_CHANNELS, valid, points,
+                                    sizeof(points) / sizeof(points[0]), &num_points);
+            for (uint32_t p = 0; p < num_points; p++)
+            {
+                for (int c = 0; c < CONFORMANCE_CHANNELS; c++)
+                {
+                    entry->curves[c].push_back(res_round(points[p].power_db[c]));
+                }
+            }
+        }
+        md_emul_instance_close(&emul);
+        dlb_md_emul_pwr_close(pwr);
+    }
+    catch (const std::exception &e)
+    {
+        md_emul_instance_close(&emul);
+        entry->error = e.what();
+    }
+}
+
+static bool load_reference(const std::string &file, std::vector<double> *values)
+{
+    FILE  *fp = fopen(file.c_str(), "r");
+    double x, y;
+
+    if (!fp)
+    {
+        return false;
+    }
+    while (fscanf(fp, " %lf, %lf", &x, &y) == 2)
+    {
+        values->push_back(y);
+    }
+    fclose(fp);
+    return true;
+}
+
+static void write_curve(const std::string &file, const std::vector<double> &curve)
+{
+    FILE *fp = fopen(file.c_str(), "w");
+
+    if (!fp)
+    {
+        throw std::runtime_error("Cannot write " + file);
+    }
+    for (size_t i = 0; i < curve.size(); i++)
+    {
+        fprintf(fp, "%f,\t%.2f\n", (i + 0.5) * 0.1, curve[i]);
+    }
+    fclose(fp);
+}
+
+/* graph_check dual file mode with the test_drc.sh limits; returns the failure or "" */
+static std::string compare_curve(const std::vector<double> &curve, const std::vector<double> &reference,
+                                 double *max_dev, double *mean_dev)
+{
+    double total = 0.0;
+
+    *max_dev = 0.0;
+    if (curve.size() < reference.size())
+    {
+        return "output has " + std::to_string(curve.size()) + " points, reference " + std::to_string(reference.size());
+    }
+    for (size_t i = 0; i < reference.size(); i++)
+    {
+        double dev = std::fabs(reference[i] - curve[i]);
+
+        total += dev;
+        *max_dev = std::max(*max_dev, dev);
+    }
+    // scaled by the final line number as graph_check does
+    *mean_dev = total / (double)(reference.size() + 1);
+    if (*max_dev > CONFORMANCE_MAX_DEV)
+    {
+        return "maximum deviation limit exceeded";
+    }
+    if (*mean_dev > CONFORMANCE_MEAN_DEV)
+    {
+        return "average deviation limit exceeded";
+    }
+    return "";
+}
+
+static void show_usage(void)
+{
+    std::cout << "Usage:" << std::endl <<
+"\tmdemu_conformance [options]" << std::endl <<
+"Options:" << std::endl <<
+"        --source=FILE     6 channel source of the reference curves [synthetic programme]" << std::endl <<
+"        --seconds=S       Length of the synthetic programme [--seconds=20]" << std::endl <<
+"        --reference=DIR   Directory of <mode>_<profile>_<channel>.res curves" << std::endl <<
+"        --write-res=DIR   Also write the measured curves to DIR" << std::endl <<
+"        --jobs=N          Combinations run in parallel [one per core]" << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    std::string             source_file;
+    std::string             reference_dir;
+    std::string             write_dir;
+    double                  seconds = 20.0;
+    unsigned int            num_jobs = std::thread::hardware_concurrency();
+    std::vector<DLB_LFRACT> source;
+    uint64_t                frames;
+    std::vector<matrix_entry> matrix;
+    int                     failures = 0;
+    int                     compared = 0;
+    double                  worst_max = 0.0, total_mean = 0.0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        size_t      eq = arg.find('=');
+        std::string name = arg.substr(0, eq);
+        std::string value = (eq == std::string::npos) ? "" : arg.substr(eq + 1);
+
+        if (name == "--source")
+        {
+            source_file = value;
+        }
+        else if (name == "--seconds")
+        {
+            seconds = std::stod(value);
+        }
+        else if (name == "--reference")
+        {
+            reference_dir = value;
+        }
+        else if (name == "--write-res")
+        {
+            write_dir = value;
+        }
+        else if (name == "--jobs")
+        {
+            num_jobs = (unsigned int)std::stoi(value);
+        }
+        else
+        {
+            show_usage();
+            return 2;
+        }
+    }
+    if (reference_dir.empty() && write_dir.empty())
+    {
+        show_usage();
+        return 2;
+    }
+
+    if (!source_file.empty())
+    {
+        SndfileHandle input(source_file.c_str());
+
+        if (input.error())
+        {
+            std::cout << "Skipped: source " << source_file << " not found" << std::endl;
+            return CONFORMANCE_SKIP;
+        }
+        if (input.channels() != CONFORMANCE_CHANNELS)
+        {
+            std::cerr << "Source must have " << CONFORMANCE_CHANNELS << " channels" << std::endl;
+            return 2;
+        }
+        frames = (uint64_t)input.frames();
+        source.resize(frames * CONFORMANCE_CHANNELS);
+        input.readf(source.data(), (sf_count_t)frames);
+    }
+    else
+    {
+        synth_programme synth;
+
+        frames = (uint64_t)(seconds * SYNTH_PROGRAMME_SAMPLE_RATE);
+        source.resize(frames * CONFORMANCE_CHANNELS);
+        synth_programme_init(&synth, CONFORMANCE_CHANNELS, SYNTH_SEED);
+        synth_programme_render(&synth, source.data(), (uint32_t)frames);
+    }
+
+    for (int mode = 0; mode < 2; mode++)
+    {
+        for (int profile = 1; profile <= 5; profile++)
+        {
+            matrix.push_back({ mode, profile, {}, "" });
+        }
+    }
+
+    /* every combination has its own emulator, the source is shared read only */
+    num_jobs = std::max(1u, std::min(num_jobs, (unsigned int)matrix.size()));
+    for (size_t first = 0; first < matrix.size(); first += num_jobs)
+    {
+        std::vector<std::thread> workers;
+
+        for (size_t e = first; e < std::min(matrix.size(), first + num_jobs); e++)
+        {
+            workers.emplace_back(run_entry, &source, frames, &matrix[e]);
+        }
+        for (std::thread &worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    for (matrix_entry &entry : matrix)
+    {
+        std::string stem = std::string(mode_name[entry.mode]) + "_" + profile_name[entry.profile - 1];
+
+        if (!entry.error.empty())
+        {
+            std::cout << "Fail " << stem << ": " << entry.error << std::endl;
+            failures++;
+            continue;
+        }
+        for (int chan : compared_channels)
+        {
+            std::string file = stem + "_" + std::to_string(chan) + ".res";
+            std::vector<double> reference;
+            std::string failure;
+            double max_dev = 0.0, mean_dev = 0.0;
+
+            if (!write_dir.empty())
+            {
+                write_curve(write_dir + "/" + file, entry.curves[chan]);
+            }
+            if (reference_dir.empty())
+            {
+                continue;
+            }
+            if (!load_reference(reference_dir + "/" + file, &reference) || reference.empty())
+            {
+                failure = "no reference " + reference_dir + "/" + file;
+            }
+            else
+            {
+                failure = compare_curve(entry.curves[chan], reference, &max_dev, &mean_dev);
+                worst_max = std::max(worst_max, max_dev);
+                total_mean += mean_dev;
+                compared++;
+            }
+
+            std::ostringstream line;
+            line.setf(std::ios::fixed);
+            line.precision(3);
+            line << (failure.empty() ? "Pass " : "Fail ") << file << " max " << max_dev << " mean " << mean_dev;
+            if (!failure.empty())
+            {
+                line << ": " << failure;
+                failures++;
+            }
+            std::cout << line.str() << std::endl;
+        }
+    }
+
+    if (compared)
+    {
+        /* accuracy of the whole matrix, e.g. of another numeric backend against float64 curves */
+        std::ostringstream line;
+        line.setf(std::ios::fixed);
+        line.precision(3);
+        line << "Deviation over " << compared << " curves: max " << worst_max << " dB, mean " << total_mean / compared << " dB";
+        std::cout << line.str() << std::endl;
+    }
+    std::cout << "Failures: " << failures << std::endl;
+    std::cout << (failures ? "Fail" : "Pass") << std::endl;
+    return failures ? 1 : 0;
+}
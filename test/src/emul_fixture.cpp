@@ -0,0 +1,132 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Shared fixture of the emulator tests
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "emul_fixture.h"
+
+static int failures = 0;
+
+void check(bool ok, const char *what)
+{
+    if (!ok)
+    {
+        printf("FAIL %s\n", what);
+        failures++;
+    }
+}
+
+int check_result(void)
+{
+    printf("%s\n", failures ? "FAIL" : "ok");
+    return failures ? 1 : 0;
+}
+
+void fixture_config(dlb_md_emul_process_config_t *emul_conf)
+{
+    memset(emul_conf, 0, sizeof(*emul_conf));
+
+    emul_conf->dolbye_channel_mode = DLB_MD_EMUL_CHMOD_3_2_1;
+    emul_conf->channel_mode = DLB_MD_EMUL_CHMOD_3_2_1;
+    emul_conf->lfe_on = 1;
+    for (int i = 0; i < DLB_MD_EMUL_MAX_CHANS; i++)
+    {
+        emul_conf->a_chan_map[i] = DLB_MD_EMUL_CHAN_NONE;
+    }
+    emul_conf->a_chan_map[0] = DLB_MD_EMUL_CHAN_LEFT;
+    emul_conf->a_chan_map[1] = DLB_MD_EMUL_CHAN_RGHT;
+    emul_conf->a_chan_map[2] = DLB_MD_EMUL_CHAN_CNTR;
+    emul_conf->a_chan_map[3] = DLB_MD_EMUL_CHAN_LFE;
+    emul_conf->a_chan_map[4] = DLB_MD_EMUL_CHAN_LSUR;
+    emul_conf->a_chan_map[5] = DLB_MD_EMUL_CHAN_RSUR;
+
+    /* the copy to the second output steps over DLB_MD_EMUL_MAX_CHANS channels */
+    emul_conf->sample_offset = DLB_MD_EMUL_MAX_CHANS;
+    emul_conf->num_samples = FIXTURE_CALL_BLOCKS * DLB_MD_EMUL_BLOCK_SIZE;
+    emul_conf->sample_rate = 48000u;
+
+    emul_conf->comp_mode[0] = DLB_MD_EMUL_CM_LINE;
+    emul_conf->comp_mode[1] = DLB_MD_EMUL_CM_RF;
+    emul_conf->dialnorm = 31;
+    emul_conf->control = (DLB_MD_EMUL_CONTROL_ENCODER_ENABLE | DLB_MD_EMUL_CONTROL_DECODER_ENABLE | DLB_MD_EMUL_CONTROL_DRC_CALC_ENABLE);
+    emul_conf->drc_profile = DLB_MD_EMUL_COMPR_FILM_STANDARD;
+    emul_conf->comp_profile = DLB_MD_EMUL_COMPR_FILM_STANDARD;
+}
+
+void fixture_render_call
+    (synth_programme                *synth
+    ,dlb_md_emul_process_config_t   *emul_conf
+    )
+{
+    std::vector<DLB_LFRACT> pcm(FIXTURE_CHANNELS * emul_conf->num_samples);
+
+    synth_programme_render(synth, pcm.data(), emul_conf->num_samples);
+    for (uint32_t i = 0; i < emul_conf->num_samples; i++)
+    {
+        for (int c = 0; c < DLB_MD_EMUL_MAX_CHANS; c++)
+        {
+            emul_conf->pa_in_data[0][i * DLB_MD_EMUL_MAX_CHANS + c] = c < FIXTURE_CHANNELS ? pcm[i * FIXTURE_CHANNELS + c] : 0.0;
+        }
+    }
+}
+
+void fixture_process_call
+    (md_emul_instance               *emul
+    ,synth_programme                *synth
+    ,dlb_md_emul_process_config_t   *emul_conf
+    )
+{
+    fixture_render_call(synth, emul_conf);
+    md_emul_instance_process(emul, emul_conf, 2);
+}
+
+void fixture_run_calls
+    (md_emul_instance               *emul
+    ,synth_programme                *synth
+    ,dlb_md_emul_process_config_t   *emul_conf
+    ,int                             calls
+    )
+{
+    for (int call = 0; call < calls; call++)
+    {
+        fixture_process_call(emul, synth, emul_conf);
+    }
+}
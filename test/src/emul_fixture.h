@@ -0,0 +1,85 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Shared fixture of the emulator tests
+ *
+ * Failure counting for the test programs, and the conformance programme as
+ * 5.1 in DLB_MD_EMUL_MAX_CHANS strided buffers through two outputs (line and
+ * RF) in calls of FIXTURE_CALL_BLOCKS blocks.
+ */
+
+#ifndef EMUL_FIXTURE_H
+#define EMUL_FIXTURE_H
+
+#include "dlb_md_emul_api.h"
+#include "md_emul_instance.h"
+#include "synth_programme.h"
+
+#define FIXTURE_CHANNELS        6
+#define FIXTURE_CALL_BLOCKS     6
+#define FIXTURE_CALLS           400     /* 12.8 s */
+#define FIXTURE_BUFFER_SIZE     (DLB_MD_EMUL_MAX_CHANS * FIXTURE_CALL_BLOCKS * DLB_MD_EMUL_BLOCK_SIZE)
+
+/* Print and count a failed check */
+void check(bool ok, const char *what);
+
+/* Print the verdict of all checks, returns the exit code: 0 pass, 1 mismatch */
+int check_result(void);
+
+/* 5.1 with LFE, line mode on output 0 and RF on output 1, dialnorm 31, film standard */
+void fixture_config(dlb_md_emul_process_config_t *emul_conf);
+
+/* Render the next call of the programme into pa_in_data[0] */
+void fixture_render_call
+    (synth_programme                *synth
+    ,dlb_md_emul_process_config_t   *emul_conf
+    );
+
+/* Render the next call and process it through both outputs */
+void fixture_process_call
+    (md_emul_instance               *emul
+    ,synth_programme                *synth
+    ,dlb_md_emul_process_config_t   *emul_conf
+    );
+
+void fixture_run_calls
+    (md_emul_instance               *emul
+    ,synth_programme                *synth
+    ,dlb_md_emul_process_config_t   *emul_conf
+    ,int                             calls
+    );
+
+#endif /* EMUL_FIXTURE_H */
@@ -0,0 +1,358 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Multi-stream engine against direct processing
+ *
+ * Runs several streams, each with its own settings and programme, through
+ * the engine's worker pool and processes the same calls on a plain handle
+ * with dlb_md_emul_process(). Every stream must complete its blocks in
+ * submission order with the outputs and status of the direct calls, one
+ * block deliberately too short included, and its statistics must add up to
+ * what was submitted. Buffers go back to the submitter from the completion
+ * callback, so the engine never holds more than a few per stream.
+ *
+ * Exit codes: 0 pass, 1 mismatch.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "dlb_md_emul_engine.h"
+#include "emul_fixture.h"
+
+#define ENGINE_STREAMS      6
+#define ENGINE_WORKERS      4
+#define ENGINE_QUEUE_DEPTH  4
+#define ENGINE_CALLS        40
+#define ENGINE_POOL         (ENGINE_QUEUE_DEPTH + 2)   /* buffers per stream */
+#define SHORT_STREAM        2                          /* stream and call given a block too short */
+#define SHORT_CALL          7
+
+typedef struct
+{
+    std::vector<DLB_LFRACT>         main_buf;
+    std::vector<DLB_LFRACT>         aux_buf;
+    dlb_md_emul_process_config_t    emul_conf;
+    std::atomic<bool>               busy;
+} pool_buffer;
+
+typedef struct
+{
+    dlb_md_emul_process_config_t    emul_conf;
+    uint32_t                        seed;
+    uint32_t                        id;
+    std::vector<uint64_t>           ref_hash;
+    std::vector<int32_t>            ref_status;
+    std::vector<uint64_t>           hash;
+    std::vector<int32_t>            status;
+    pool_buffer                     pool[ENGINE_POOL];
+    std::atomic<uint64_t>           next_done;
+    std::atomic<bool>               in_order;
+} stream_state;
+
+/* FNV-1a over both outputs of a call */
+static uint64_t outputs_hash(const dlb_md_emul_process_config_t *emul_conf, uint32_t num_samples)
+{
+    uint64_t h = 14695981039346656037ull;
+
+    for (int output = 0; output < 2; output++)
+    {
+        const unsigned char *p = (const unsigned char *)emul_conf->pa_in_data[output];
+
+        for (size_t i = 0; i < num_samples * DLB_MD_EMUL_MAX_CHANS * sizeof(DLB_LFRACT); i++)
+        {
+            h = (h ^ p[i]) * 1099511628211ull;
+        }
+    }
+    return h;
+}
+
+/* Each stream its own programme, dialnorm and modes */
+static void stream_setup(stream_state *st, int s)
+{
+    fixture_config(&st->emul_conf);
+    st->emul_conf.dialnorm = 31 - 4 * s;
+    if (s % 2)
+    {
+        st->emul_conf.comp_mode[0] = DLB_MD_EMUL_CM_RF;
+        st->emul_conf.comp_mode[1] = DLB_MD_EMUL_CM_LINE;
+    }
+    if (s % 3 == 2)
+    {
+        st->emul_conf.drc_profile = DLB_MD_EMUL_COMPR_MUSIC_LIGHT;
+    }
+    st->seed = (uint32_t)s + 1;
+    st->ref_hash.assign(ENGINE_CALLS, 0);
+    st->ref_status.assign(ENGINE_CALLS, 0);
+    st->hash.assign(ENGINE_CALLS, 0);
+    st->status.assign(ENGINE_CALLS, 1);
+    for (int i = 0; i < ENGINE_POOL; i++)
+    {
+        st->pool[i].main_buf.assign(FIXTURE_BUFFER_SIZE, 0.0);
+        st->pool[i].aux_buf.assign(FIXTURE_BUFFER_SIZE, 0.0);
+        st->pool[i].busy = false;
+    }
+    st->next_done = 0;
+    st->in_order = true;
+}
+
+/* Render call number call of a stream into a buffer, the short block keeps its full programme */
+static void render_call(stream_state *st, synth_programme *synth, pool_buffer *buf, int s, int call)
+{
+    buf->emul_conf = st->emul_conf;
+    buf->emul_conf.pa_in_data[0] = buf->main_buf.data();
+    buf->emul_conf.pa_in_data[1] = buf->aux_buf.data();
+    fixture_render_call(synth, &buf->emul_conf);
+    std::fill(buf->aux_buf.begin(), buf->aux_buf.end(), (DLB_LFRACT)0);
+    if (s == SHORT_STREAM && call == SHORT_CALL)
+    {
+        buf->emul_conf.num_samples = DLB_MD_EMUL_BLOCK_SIZE / 2;
+    }
+}
+
+static void run_direct(stream_state *st, int s)
+{
+    dlb_md_emul_size_t  emul_size;
+    dlb_md_emul_hdl_t   hdl;
+    std::vector<char>   static_mem, dynamic_mem;
+    synth_programme     synth;
+    pool_buffer        *buf = &st->pool[0];
+
+    dlb_md_emul_query_mem(&emul_size);
+    static_mem.resize(emul_size.emul_static_mem_size + emul_size.compr_static_mem_size + emul_size.compr_ext_static_mem_size);
+    dynamic_mem.resize(emul_size.emul_dynamic_mem_size + emul_size.compr_dynamic_mem_size);
+    if (dlb_md_emul_open(&emul_size, &hdl, static_mem.data(), dynamic_mem.data()))
+    {
+        throw std::runtime_error("Failed to open the direct emulator");
+    }
+    synth_programme_init(&synth, FIXTURE_CHANNELS, st->seed);
+    for (int call = 0; call < ENGINE_CALLS; call++)
+    {
+        render_call(st, &synth, buf, s, call);
+        st->ref_status[call] = dlb_md_emul_process(&hdl, &buf->emul_conf, 2);
+        st->ref_hash[call] = outputs_hash(&buf->emul_conf, st->emul_conf.num_samples);
+    }
+    dlb_md_emul_close(&hdl);
+}
+
+static void block_done
+    (void                               *p_user
+    ,uint32_t                            stream_id
+    ,uint64_t                            block_index
+    ,const dlb_md_emul_process_config_t *p_config
+    ,int32_t                             status
+    )
+{
+    stream_state *st = (stream_state *)p_user;
+    uint64_t expect = st->next_done.load(std::memory_order_relaxed);
+
+    if (stream_id != st->id || block_index != expect || block_index >= ENGINE_CALLS)
+    {
+        st->in_order = false;
+        return;
+    }
+    st->hash[block_index] = outputs_hash(p_config, st->emul_conf.num_samples);
+    st->status[block_index] = status;
+    st->next_done.store(expect + 1, std::memory_order_relaxed);
+    st->pool[block_index % ENGINE_POOL].busy.store(false, std::memory_order_release);
+}
+
+/* Round-robin over the streams, a stream waits while its next buffer is in flight or its queue is full */
+static uint64_t submit_all(dlb_md_emul_engine_t *p_engine, std::vector<stream_state> &streams)
+{
+    synth_programme synth[ENGINE_STREAMS];
+    int             submitted[ENGINE_STREAMS] = {0};
+    bool            rendered[ENGINE_STREAMS] = {false};
+    uint64_t        queue_full = 0;
+    int             remaining = ENGINE_STREAMS;
+
+    for (int s = 0; s < ENGINE_STREAMS; s++)
+    {
+        synth_programme_init(&synth[s], FIXTURE_CHANNELS, streams[s].seed);
+    }
+    while (remaining)
+    {
+        bool progress = false;
+
+        for (int s = 0; s < ENGINE_STREAMS; s++)
+        {
+            stream_state *st = &streams[s];
+            pool_buffer *buf = &st->pool[submitted[s] % ENGINE_POOL];
+            int32_t err;
+
+            if (submitted[s] == ENGINE_CALLS)
+            {
+                continue;
+            }
+            if (!rendered[s])
+            {
+                if (buf->busy.load(std::memory_order_acquire))
+                {
+                    continue;
+                }
+                render_call(st, &synth[s], buf, s, submitted[s]);
+                buf->busy.store(true, std::memory_order_relaxed);
+                rendered[s] = true;
+            }
+
+            err = dlb_md_emul_engine_submit(p_engine, st->id, &buf->emul_conf);
+            if (err == DLB_MD_EMUL_ENGINE_QUEUE_FULL)
+            {
+                queue_full++;
+                continue;
+            }
+            if (err != DLB_MD_EMUL_ENGINE_OK)
+            {
+                throw std::runtime_error("submit returned " + std::to_string(err));
+            }
+            rendered[s] = false;
+            progress = true;
+            if (++submitted[s] == ENGINE_CALLS)
+            {
+                remaining--;
+            }
+        }
+        if (!progress)
+        {
+            std::this_thread::yield();
+        }
+    }
+    return queue_full;
+}
+
+int main(void)
+{
+    dlb_md_emul_engine_config_t  engine_conf = {};
+    dlb_md_emul_stream_config_t  stream_conf = {};
+    dlb_md_emul_engine_t        *p_engine = nullptr;
+    std::vector<stream_state>    streams(ENGINE_STREAMS);
+    std::vector<uint8_t>         engine_mem;
+    uint32_t                     extra_id;
+    uint64_t                     queue_full;
+    size_t                       size;
+
+    try
+    {
+        for (int s = 0; s < ENGINE_STREAMS; s++)
+        {
+            stream_setup(&streams[s], s);
+            run_direct(&streams[s], s);
+        }
+        check(streams[SHORT_STREAM].ref_status[SHORT_CALL] != 0, "direct call refuses the short block");
+
+        engine_conf.num_workers = ENGINE_WORKERS;
+        engine_conf.max_streams = ENGINE_STREAMS;
+        engine_conf.queue_depth = ENGINE_QUEUE_DEPTH;
+        if (dlb_md_emul_engine_query_mem(&engine_conf, &size) != DLB_MD_EMUL_ENGINE_OK)
+        {
+            throw std::runtime_error("Failed to query engine memory");
+        }
+        engine_mem.assign(size, 0);
+        if (dlb_md_emul_engine_open(&engine_conf, engine_mem.data(), &p_engine) != DLB_MD_EMUL_ENGINE_OK)
+        {
+            throw std::runtime_error("Failed to open the engine");
+        }
+
+        stream_conf.num_outputs = 0;
+        check(dlb_md_emul_engine_add_stream(p_engine, &stream_conf, &extra_id) == DLB_MD_EMUL_ENGINE_INVALID_PARAM, "no outputs rejected");
+        stream_conf.num_outputs = 2;
+        stream_conf.done_cb = block_done;
+        for (int s = 0; s < ENGINE_STREAMS; s++)
+        {
+            stream_conf.p_user = &streams[s];
+            if (dlb_md_emul_engine_add_stream(p_engine, &stream_conf, &streams[s].id) != DLB_MD_EMUL_ENGINE_OK)
+            {
+                throw std::runtime_error("Failed to add a stream");
+            }
+        }
+        check(dlb_md_emul_engine_add_stream(p_engine, &stream_conf, &extra_id) == DLB_MD_EMUL_ENGINE_NO_FREE_STREAM, "stream slots exhausted");
+        check(dlb_md_emul_engine_submit(p_engine, ENGINE_STREAMS, &streams[0].emul_conf) == DLB_MD_EMUL_ENGINE_INVALID_PARAM, "unknown stream rejected");
+
+        queue_full = submit_all(p_engine, streams);
+        printf("%d streams of %d calls on %d workers, %llu submits found the queue full\n", ENGINE_STREAMS, ENGINE_CALLS,
+               ENGINE_WORKERS, (unsigned long long)queue_full);
+
+        for (int s = 0; s < ENGINE_STREAMS; s++)
+        {
+            stream_state *st = &streams[s];
+            dlb_md_emul_stream_stats_t stats;
+            uint64_t hist_sum = 0;
+            bool outputs_match = true;
+            bool status_match = true;
+
+            check(dlb_md_emul_engine_drain(p_engine, st->id) == DLB_MD_EMUL_ENGINE_OK, "drain");
+            check(st->in_order && st->next_done.load() == ENGINE_CALLS, "blocks completed in submission order");
+            for (int call = 0; call < ENGINE_CALLS; call++)
+            {
+                outputs_match = outputs_match && st->hash[call] == st->ref_hash[call];
+                status_match = status_match && st->status[call] == st->ref_status[call];
+            }
+            check(outputs_match, "outputs of the direct calls");
+            check(status_match, "status of the direct calls");
+
+            check(dlb_md_emul_engine_get_stream_stats(p_engine, st->id, &stats) == DLB_MD_EMUL_ENGINE_OK, "stream stats");
+            for (int b = 0; b < DLB_MD_EMUL_ENGINE_HIST_BUCKETS; b++)
+            {
+                hist_sum += stats.latency_hist[b];
+            }
+            check(stats.blocks_submitted == ENGINE_CALLS && stats.blocks_processed == ENGINE_CALLS, "blocks submitted and processed");
+            check(stats.blocks_failed == (s == SHORT_STREAM ? 1u : 0u), "failed blocks");
+            check(hist_sum == stats.blocks_processed, "latency histogram covers every block");
+            check(stats.max_latency_us <= stats.total_latency_us, "maximum latency");
+            check(stats.deadline_misses == 0, "no deadline, no misses");
+            check(dlb_md_emul_engine_remove_stream(p_engine, st->id) == DLB_MD_EMUL_ENGINE_OK, "remove stream");
+        }
+
+        check(dlb_md_emul_engine_add_stream(p_engine, &stream_conf, &extra_id) == DLB_MD_EMUL_ENGINE_OK, "removed slot reused");
+        dlb_md_emul_engine_close(p_engine);
+    }
+    catch (const std::exception &e)
+    {
+        printf("FAIL %s\n", e.what());
+        if (p_engine)
+        {
+            dlb_md_emul_engine_close(p_engine);
+        }
+        return 1;
+    }
+
+    return check_result();
+}
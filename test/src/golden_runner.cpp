@@ -0,0 +1,481 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Bit-exact golden output regression check
+ *
+ * Runs half second excerpts of the synthetic programme, and a fade of one of
+ * them to silence, through every channel mode and LFE setting, every encoder
+ * filter flag set, every compression mode, profile and a spread of dialnorm
+ * values, and records a 64 bit FNV-1a hash of the output and of the emulator
+ * state after each block, which carries the DRC and compr gains the gainwords
+ * are derived from. The hashes are compared
+ * with a golden file. Builds that are not meant to be bit-exact (another
+ * backend or fast math) can be checked against --tolerance=DB on the output
+ * level and peak of each run instead.
+ *
+ * Exit codes: 0 pass, 1 mismatch or error.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "dlb_md_emul_api.h"
+#include "md_emul_instance.h"
+#include "bench_layout.h"
+#include "synth_programme.h"
+
+#define GOLDEN_SAMPLE_RATE      48000u
+#define GOLDEN_BLOCKS           94          /* half a second at 48 kHz */
+#define GOLDEN_EXCERPTS         8           /* one across each level step of the programme, then a fade */
+#define GOLDEN_STEP_EXCERPTS    7
+#define GOLDEN_FADE_EXCERPT     3           /* the -4 dB step */
+#define GOLDEN_FADE_DB          320.0       /* through the bottom of the compressor's log range to silence */
+#define GOLDEN_STEP_SECONDS     2.5
+#define GOLDEN_NUM_FILTER_SETS  32          /* hpfon, bwlpfon, lfelpfon, sur90on, suratton */
+#define SYNTH_SEED              1
+
+static const char *comp_mode_name[] = { "none", "dialnorm", "custom", "line", "rf" };
+static const int   dialnorm_values[] = { 1, 24, 31 };
+
+#define NUM_COMP_MODES  5
+#define NUM_PROFILES    6
+#define NUM_DIALNORMS   3
+
+typedef struct
+{
+    const bench_layout *layout;
+    int                 lfe_on;
+    int                 filters;        /**< bit 0 hpfon .. bit 4 suratton */
+    int                 comp_mode;
+    int                 profile;
+    int                 dialnorm;
+    int                 excerpt;
+    std::string         name;
+    uint64_t            output_hash;
+    uint64_t            state_hash;
+    double              rms_db;
+    double              peak_db;
+    std::string         error;
+} golden_run;
+
+typedef struct
+{
+    uint64_t    output_hash;
+    uint64_t    state_hash;
+    double      rms_db;
+    double      peak_db;
+} golden_entry;
+
+/* FNV-1a over 64 bit words, sizes are multiples of 8 bytes here */
+static uint64_t fnv1a(uint64_t hash, const void *data, size_t size)
+{
+    const unsigned char *p = (const unsigned char *)data;
+
+    for (size_t i = 0; i + 8 <= size; i += 8)
+    {
+        uint64_t word;
+
+        memcpy(&word, p + i, sizeof(word));
+        hash ^= word;
+        hash *= 0x100000001b3ull;
+    }
+    for (size_t i = size & ~(size_t)7; i < size; i++)
+    {
+        hash ^= p[i];
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+#define FNV1A_OFFSET    0xcbf29ce484222325ull
+
+/*
+ * Every mode and LFE setting crossed with every compression mode, profile and
+ * dialnorm; the filter flag sets cycle within each channel mode so that every
+ * set is used with every mode, and the excerpts cycle over the level steps.
+ */
+static std::vector<golden_run> build_matrix(void)
+{
+    std::vector<golden_run> runs;
+
+    for (int l = 0; l < bench_num_layouts; l++)
+    {
+        const bench_layout *layout = &bench_layouts[l];
+
+        for (int lfe = 0; lfe <= (layout->lfe_channel >= 0); lfe++)
+        {
+            int index = 0;
+
+            for (int comp_mode = 0; comp_mode < NUM_COMP_MODES; comp_mode++)
+            {
+                for (int profile = 0; profile < NUM_PROFILES; profile++)
+                {
+                    for (int d = 0; d < NUM_DIALNORMS; d++, index++)
+                    {
+                        golden_run run = {};
+                        char       name[128];
+
+                        run.layout = layout;
+                        run.lfe_on = lfe;
+                        run.filters = index % GOLDEN_NUM_FILTER_SETS;
+                        run.comp_mode = comp_mode;
+                        run.profile = profile;
+                        run.dialnorm = dialnorm_values[d];
+                        run.excerpt = index % GOLDEN_EXCERPTS;
+                        snprintf(name, sizeof(name), "%s:lfe%d:f%02d:%s:p%d:dn%d", layout->name, lfe, run.filters,
+                                 comp_mode_name[comp_mode], profile, run.dialnorm);
+                        run.name = name;
+                        runs.push_back(run);
+                    }
+                }
+            }
+        }
+    }
+    return runs;
+}
+
+/* Half a second around each level step of the conformance programme and a fade of one of them, 8 channels interleaved */
+static std::vector<std::vector<DLB_LFRACT> > render_excerpts(void)
+{
+    std::vector<std::vector<DLB_LFRACT> > excerpts(GOLDEN_EXCERPTS);
+    uint32_t                              excerpt_frames = GOLDEN_BLOCKS * DLB_MD_EMUL_BLOCK_SIZE;
+    synth_programme                       synth;
+    uint64_t                              frame = 0;
+    std::vector<DLB_LFRACT>               skip((size_t)GOLDEN_SAMPLE_RATE * DLB_MD_EMUL_MAX_CHANS);
+
+    synth_programme_init(&synth, DLB_MD_EMUL_MAX_CHANS, SYNTH_SEED);
+    for (int e = 0; e < GOLDEN_STEP_EXCERPTS; e++)
+    {
+        uint64_t start = (uint64_t)(((e + 1) * GOLDEN_STEP_SECONDS - 0.25) * GOLDEN_SAMPLE_RATE);
+
+        while (frame < start)
+        {
+            uint32_t frames = (uint32_t)std::min<uint64_t>(start - frame, GOLDEN_SAMPLE_RATE);
+
+            synth_programme_render(&synth, skip.data(), frames);
+            frame += frames;
+        }
+        excerpts[e].resize((size_t)excerpt_frames * DLB_MD_EMUL_MAX_CHANS);
+        synth_programme_render(&synth, excerpts[e].data(), excerpt_frames);
+        frame += excerpt_frames;
+    }
+
+    /* near-silent blocks must come out as silence rather than as very loud ones */
+    excerpts[GOLDEN_STEP_EXCERPTS] = excerpts[GOLDEN_FADE_EXCERPT];
+    for (uint32_t n = 0; n < excerpt_frames; n++)
+    {
+        double gain = std::pow(10.0, -GOLDEN_FADE_DB * n / excerpt_frames / 20.0);
+
+        for (int c = 0; c < DLB_MD_EMUL_MAX_CHANS; c++)
+        {
+            excerpts[GOLDEN_STEP_EXCERPTS][(size_t)n * DLB_MD_EMUL_MAX_CHANS + c] *= gain;
+        }
+    }
+    return excerpts;
+}
+
+static void golden_config(const golden_run *run, dlb_md_emul_process_config_t *emul_conf)
+{
+    memset(emul_conf, 0, sizeof(*emul_conf));
+    emul_conf->channel_mode = run->layout->channel_mode;
+    emul_conf->dolbye_channel_mode = run->layout->channel_mode;
+    bench_layout_channel_map(run->layout, emul_conf);
+    emul_conf->lfe_on = run->lfe_on;
+    emul_conf->sample_offset = run->layout->channels;
+    emul_conf->num_samples = DLB_MD_EMUL_BLOCK_SIZE;
+    emul_conf->sample_rate = GOLDEN_SAMPLE_RATE;
+
+    emul_conf->hpfon = (run->filters >> 0) & 1;
+    emul_conf->bwlpfon = (run->filters >> 1) & 1;
+    emul_conf->lfelpfon = (run->filters >> 2) & 1;
+    emul_conf->sur90on = (run->filters >> 3) & 1;
+    emul_conf->suratton = (run->filters >> 4) & 1;
+
+    emul_conf->comp_mode[0] = (DLB_MD_EMUL_COMPRESSION_MODE)run->comp_mode;
+    emul_conf->custom_boost[0] = DLB_LcF(0.5);
+    emul_conf->custom_cut[0] = DLB_LcF(0.75);
+    emul_conf->dialnorm = run->dialnorm;
+    emul_conf->control = (DLB_MD_EMUL_CONTROL_ENCODER_ENABLE | DLB_MD_EMUL_CONTROL_DECODER_ENABLE | DLB_MD_EMUL_CONTROL_DRC_CALC_ENABLE);
+    emul_conf->drc_profile = (DLB_MD_EMUL_COMPRESSION_PROFILE)run->profile;
+    emul_conf->comp_profile = (DLB_MD_EMUL_COMPRESSION_PROFILE)run->profile;
+}
+
+static void execute_run(const std::vector<DLB_LFRACT> *excerpt, golden_run *run)
+{
+    dlb_md_emul_process_config_t emul_conf;
+    md_emul_instance             emul = {};
+    int                          channels = run->layout->channels;
+    size_t                       block_samples = (size_t)DLB_MD_EMUL_BLOCK_SIZE * channels;
+    std::vector<DLB_LFRACT>      block((size_t)DLB_MD_EMUL_BLOCK_SIZE * DLB_MD_EMUL_MAX_CHANS);    /* the emulator addresses every channel slot */
+    std::vector<DLB_LFRACT>      secondary((size_t)DLB_MD_EMUL_BLOCK_SIZE * DLB_MD_EMUL_MAX_CHANS);
+    std::vector<unsigned char>   state(dlb_md_emul_query_state_size());
+    double                       sum = 0.0, peak = 0.0;
+
+    golden_config(run, &emul_conf);
+    emul_conf.pa_in_data[0] = block.data();
+    emul_conf.pa_in_data[1] = secondary.data();
+    run->output_hash = FNV1A_OFFSET;
+    run->state_hash = FNV1A_OFFSET;
+
+    try
+    {
+        md_emul_instance_open(&emul);
+        for (int b = 0; b < GOLDEN_BLOCKS; b++)
+        {
+            const DLB_LFRACT *in = excerpt->data() + (size_t)b * DLB_MD_EMUL_BLOCK_SIZE * DLB_MD_EMUL_MAX_CHANS;
+
+            for (int n = 0; n < DLB_MD_EMUL_BLOCK_SIZE; n++)
+            {
+                std::copy(in + n * DLB_MD_EMUL_MAX_CHANS, in + n * DLB_MD_EMUL_MAX_CHANS + channels, block.begin() + n * channels);
+            }
+            md_emul_instance_process(&emul, &emul_conf, 1);
+
+            std::fill(state.begin(), state.end(), 0);
+            if (dlb_md_emul_save_state(&emul.hdl, state.data(), (uint32_t)state.size()))
+            {
+                throw std::runtime_error("Saving the emulator state failed");
+            }
+            run->output_hash = fnv1a(run->output_hash, block.data(), block_samples * sizeof(DLB_LFRACT));
+            run->state_hash = fnv1a(run->state_hash, state.data(), state.size());
+            for (size_t i = 0; i < block_samples; i++)
+            {
+                double v = DLB_F_L(block[i]);
+
+                sum += v * v;
+                peak = std::max(peak, std::fabs(v));
+            }
+        }
+        md_emul_instance_close(&emul);
+    }
+    catch (const std::exception &e)
+    {
+        md_emul_instance_close(&emul);
+        run->error = e.what();
+    }
+    run->rms_db = 10.0 * std::log10(sum / (double)(block_samples * GOLDEN_BLOCKS) + 1e-20);
+    run->peak_db = 20.0 * std::log10(peak + 1e-10);
+}
+
+static std::map<std::string, golden_entry> load_golden(const std::string &file)
+{
+    std::map<std::string, golden_entry> golden;
+    FILE                               *fp = fopen(file.c_str(), "r");
+    char                                line[256];
+    char                                name[128];
+    unsigned long long                  output_hash, state_hash;
+    golden_entry                        entry;
+
+    if (!fp)
+    {
+        throw std::runtime_error("Cannot read " + file);
+    }
+    while (fgets(line, sizeof(line), fp))
+    {
+        if (line[0] != '#' &&
+            sscanf(line, "%127s %llx %llx %lf %lf", name, &output_hash, &state_hash, &entry.rms_db, &entry.peak_db) == 5)
+        {
+            entry.output_hash = output_hash;
+            entry.state_hash = state_hash;
+            golden[name] = entry;
+        }
+    }
+    fclose(fp);
+    return golden;
+}
+
+static void write_golden(const std::string &file, const std::vector<golden_run> &runs)
+{
+    FILE *fp = fopen(file.c_str(), "w");
+
+    if (!fp)
+    {
+        throw std::runtime_error("Cannot write " + file);
+    }
+    fprintf(fp, "# run output_hash state_hash rms_db peak_db, written by mdemu_golden --write\n");
+    for (const golden_run &run : runs)
+    {
+        fprintf(fp, "%s %016llx %016llx %.4f %.4f\n", run.name.c_str(), (unsigned long long)run.output_hash,
+                (unsigned long long)run.state_hash, run.rms_db, run.peak_db);
+    }
+    fclose(fp);
+}
+
+static void show_usage(void)
+{
+    std::cout << "Usage:" << std::endl <<
+"\tmdemu_golden [options]" << std::endl <<
+"Options:" << std::endl <<
+"        --golden=FILE     Golden hashes to compare with" << std::endl <<
+"        --write=FILE      Write the golden hashes of this build instead" << std::endl <<
+"        --tolerance=DB    Accept runs whose hashes differ when the output level and peak are" << std::endl <<
+"                          within DB of the golden values (for builds not meant to be bit-exact)" << std::endl <<
+"        --jobs=N          Worker threads [one per core]" << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    std::string             golden_file;
+    std::string             write_file;
+    double                  tolerance = -1.0;
+    unsigned int            jobs = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<golden_run> runs = build_matrix();
+    int                     exact = 0, bounded = 0, failed = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        size_t      eq = arg.find('=');
+        std::string name = arg.substr(0, eq);
+        std::string value = (eq == std::string::npos) ? "" : arg.substr(eq + 1);
+
+        if (name == "--golden")
+        {
+            golden_file = value;
+        }
+        else if (name == "--write")
+        {
+            write_file = value;
+        }
+        else if (name == "--tolerance")
+        {
+            tolerance = std::stod(value);
+        }
+        else if (name == "--jobs")
+        {
+            jobs = std::max(1, std::stoi(value));
+        }
+        else
+        {
+            show_usage();
+            return 1;
+        }
+    }
+    if (golden_file.empty() == write_file.empty())
+    {
+        show_usage();
+        return 1;
+    }
+
+    try
+    {
+        std::map<std::string, golden_entry>   golden;
+        std::vector<std::vector<DLB_LFRACT> > excerpts = render_excerpts();
+        std::vector<std::thread>              workers;
+        std::atomic<size_t>                   next(0);
+
+        if (!golden_file.empty())
+        {
+            golden = load_golden(golden_file);
+        }
+        for (unsigned int j = 0; j < std::min<size_t>(jobs, runs.size()); j++)
+        {
+            workers.emplace_back([&]() {
+                for (size_t r = next++; r < runs.size(); r = next++)
+                {
+                    execute_run(&excerpts[runs[r].excerpt], &runs[r]);
+                }
+            });
+        }
+        for (std::thread &worker : workers)
+        {
+            worker.join();
+        }
+
+        for (const golden_run &run : runs)
+        {
+            if (!run.error.empty())
+            {
+                std::cout << "FAIL  " << run.name << ": " << run.error << std::endl;
+                failed++;
+            }
+        }
+        if (failed)
+        {
+            return 1;
+        }
+        if (!write_file.empty())
+        {
+            write_golden(write_file, runs);
+            std::cout << "Wrote " << runs.size() << " golden hashes to " << write_file << std::endl;
+            return 0;
+        }
+
+        for (const golden_run &run : runs)
+        {
+            auto it = golden.find(run.name);
+
+            if (it == golden.end())
+            {
+                std::cout << "FAIL  " << run.name << ": not in " << golden_file << std::endl;
+                failed++;
+            }
+            else if (it->second.output_hash == run.output_hash && it->second.state_hash == run.state_hash)
+            {
+                exact++;
+            }
+            else if (tolerance >= 0.0 && std::fabs(it->second.rms_db - run.rms_db) <= tolerance &&
+                     std::fabs(it->second.peak_db - run.peak_db) <= tolerance)
+            {
+                bounded++;
+            }
+            else
+            {
+                printf("FAIL  %s: output %016llx state %016llx, golden %016llx %016llx, level %+.4f dB peak %+.4f dB\n",
+                       run.name.c_str(), (unsigned long long)run.output_hash, (unsigned long long)run.state_hash,
+                       (unsigned long long)it->second.output_hash, (unsigned long long)it->second.state_hash,
+                       run.rms_db - it->second.rms_db, run.peak_db - it->second.peak_db);
+                failed++;
+            }
+        }
+        printf("%zu runs: %d bit-exact, %d within %.4f dB, %d failed\n", runs.size(), exact, bounded,
+               std::max(tolerance, 0.0), failed);
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,326 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Emulators sized by dlb_md_emul_query_mem_config()
+ *
+ * Opens emulators in memory of exactly the queried size with guard bytes
+ * behind every block, checks that they give the output of an emulator
+ * opened for every configuration, and that a configuration or saved state
+ * needing more is refused without touching the emulator or its neighbours,
+ * and that only the taps the memory was sized for can be set.
+ *
+ * Exit codes: 0 pass, 1 mismatch.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "dlb_md_emul_api.h"
+#include "dlb_md_emul_meter.h"
+#include "dlb_md_emul_trace.h"
+#include "emul_fixture.h"
+
+#define GUARD_BYTES     64
+#define GUARD_VALUE     0xA5
+#define TEST_BLOCKS     6
+#define TEST_CALLS      20
+
+/* An emulator in memory of exactly the queried size, guard bytes behind each block */
+struct sized_emulator
+{
+    dlb_md_emul_size_t      size;
+    dlb_md_emul_hdl_t       hdl;
+    std::vector<uint8_t>    static_mem;
+    std::vector<uint8_t>    dynamic_mem;
+    uint32_t                static_size;
+    uint32_t                dynamic_size;
+
+    bool open(const dlb_md_emul_size_t &queried)
+    {
+        size         = queried;
+        static_size  = size.emul_static_mem_size + size.compr_static_mem_size + size.compr_ext_static_mem_size;
+        dynamic_size = size.emul_dynamic_mem_size + size.compr_dynamic_mem_size;
+        static_mem.assign(static_size + GUARD_BYTES, GUARD_VALUE);
+        dynamic_mem.assign(dynamic_size + GUARD_BYTES, GUARD_VALUE);
+        return dlb_md_emul_open(&size, &hdl, static_mem.data(), dynamic_mem.data()) == 0;
+    }
+
+    bool guards_intact() const
+    {
+        for (int i = 0; i < GUARD_BYTES; i++)
+        {
+            if (static_mem[static_size + i] != GUARD_VALUE || dynamic_mem[dynamic_size + i] != GUARD_VALUE)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+/* Interleaved buffers of one call for both outputs */
+struct call_buffers
+{
+    std::vector<DLB_LFRACT> out[DLB_MD_EMUL_MAX_OUTPUTS];
+};
+
+static void make_config
+    (dlb_md_emul_process_config_t *conf
+    ,DLB_MD_EMUL_CHANNEL_MODE      mode
+    ,int                           chans
+    ,int                           blocks
+    )
+{
+    memset(conf, 0, sizeof(*conf));
+    conf->channel_mode = mode;
+    conf->dolbye_channel_mode = mode;
+    conf->lfe_on = chans == 6 || chans == 8;
+    for (int c = 0; c < DLB_MD_EMUL_MAX_CHANS; c++)
+    {
+        conf->a_chan_map[c] = c < chans ? (DLB_MD_EMUL_CHANNEL_MAP)c : DLB_MD_EMUL_CHAN_NONE;
+    }
+    conf->sample_offset = DLB_MD_EMUL_MAX_CHANS;
+    conf->num_samples = blocks * DLB_MD_EMUL_BLOCK_SIZE;
+    conf->sample_rate = 48000u;
+    conf->hpfon = 1;
+    conf->bwlpfon = 1;
+    conf->lfelpfon = 1;
+    conf->comp_mode[0] = DLB_MD_EMUL_CM_LINE;
+    conf->comp_mode[1] = DLB_MD_EMUL_CM_RF;
+    conf->dialnorm = 27;
+    conf->control = (DLB_MD_EMUL_CONTROL_ENCODER_ENABLE | DLB_MD_EMUL_CONTROL_DECODER_ENABLE | DLB_MD_EMUL_CONTROL_DRC_CALC_ENABLE);
+    conf->drc_profile = DLB_MD_EMUL_COMPR_FILM_STANDARD;
+    conf->comp_profile = DLB_MD_EMUL_COMPR_FILM_STANDARD;
+}
+
+/* Noise bursts at changing levels, the same for every call index */
+static void fill_call(call_buffers *buf, int call, int num_samples)
+{
+    uint32_t seed = 0x9E3779B9u * (uint32_t)(call + 1);
+    double   level = (call % 4 == 3) ? 0.9 : 0.05 * (1 + call % 4);
+
+    for (int o = 0; o < DLB_MD_EMUL_MAX_OUTPUTS; o++)
+    {
+        buf->out[o].assign((size_t)num_samples * DLB_MD_EMUL_MAX_CHANS, DLB_LcF(0.0));
+    }
+    for (size_t i = 0; i < buf->out[0].size(); i++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        buf->out[0][i] = DLB_LcF(level * ((double)(seed >> 8) / 8388608.0 - 1.0));
+    }
+}
+
+static int32_t run_call(dlb_md_emul_hdl_t *hdl, dlb_md_emul_process_config_t *conf, call_buffers *buf, int num_outputs, int call)
+{
+    fill_call(buf, call, conf->num_samples);
+    conf->pa_in_data[0] = buf->out[0].data();
+    conf->pa_in_data[1] = buf->out[1].data();
+    return dlb_md_emul_process(hdl, conf, num_outputs);
+}
+
+static bool same_output(const call_buffers &a, const call_buffers &b, int num_outputs)
+{
+    for (int o = 0; o < num_outputs; o++)
+    {
+        if (memcmp(a.out[o].data(), b.out[o].data(), a.out[o].size() * sizeof(DLB_LFRACT)) != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void count_block(void *p_context, const dlb_md_emul_trace_record_t *)
+{
+    ++*static_cast<int *>(p_context);
+}
+
+static uint32_t total_size(const dlb_md_emul_size_t &size)
+{
+    return size.emul_static_mem_size + size.emul_dynamic_mem_size + size.compr_static_mem_size +
+           size.compr_dynamic_mem_size + size.compr_ext_static_mem_size;
+}
+
+int main(void)
+{
+    dlb_md_emul_process_config_t    conf, grown;
+    dlb_md_emul_size_t              all_size, size;
+    sized_emulator                  full, small;
+    call_buffers                    full_buf, small_buf;
+    bool                            same = true;
+
+    /* Queries */
+    make_config(&conf, DLB_MD_EMUL_CHMOD_2_0_0, 2, TEST_BLOCKS);
+    check(dlb_md_emul_query_mem_config(nullptr, 1, 0, &size) != 0, "NULL config rejected");
+    check(dlb_md_emul_query_mem_config(&conf, 3, 0, &size) != 0, "three outputs rejected");
+    conf.num_samples = DLB_MD_EMUL_BLOCK_SIZE - 1;
+    check(dlb_md_emul_query_mem_config(&conf, 1, 0, &size) != 0, "less than a block rejected");
+    conf.num_samples = 9 * DLB_MD_EMUL_BLOCK_SIZE;
+    check(dlb_md_emul_query_mem_config(&conf, 1, 0, &size) != 0, "more than eight blocks rejected");
+    conf.num_samples = TEST_BLOCKS * DLB_MD_EMUL_BLOCK_SIZE;
+    check(dlb_md_emul_query_mem_config(&conf, 1, 4, &size) != 0, "unknown tap rejected");
+
+    check(dlb_md_emul_query_mem(&all_size) == 0, "query every configuration");
+    make_config(&conf, DLB_MD_EMUL_CHMOD_3_4_1, 8, 8);
+    check(dlb_md_emul_query_mem_config(&conf, 2, DLB_MD_EMUL_TAP_METER | DLB_MD_EMUL_TAP_TRACE, &size) == 0 &&
+          total_size(size) <= total_size(all_size), "3/4.1 with eight blocks and both taps fits the full size");
+    {
+        static const struct { DLB_MD_EMUL_CHANNEL_MODE mode; int chans; const char *name; } layouts[] =
+        {
+            { DLB_MD_EMUL_CHMOD_1_0_0, 1, "1/0" }, { DLB_MD_EMUL_CHMOD_2_0_0, 2, "2/0" },
+            { DLB_MD_EMUL_CHMOD_3_2_1, 6, "3/2.1" }, { DLB_MD_EMUL_CHMOD_3_4_1, 8, "3/4.1" }
+        };
+        printf("every configuration: %u bytes\n", total_size(all_size));
+        for (const auto &l : layouts)
+        {
+            make_config(&conf, l.mode, l.chans, TEST_BLOCKS);
+            dlb_md_emul_query_mem_config(&conf, 1, 0, &size);
+            printf("%-6s %d blocks, one output: %u bytes\n", l.name, TEST_BLOCKS, total_size(size));
+        }
+    }
+
+    /* A stereo emulator gives the output of one opened for everything */
+    make_config(&conf, DLB_MD_EMUL_CHMOD_2_0_0, 2, TEST_BLOCKS);
+    check(dlb_md_emul_query_mem_config(&conf, 2, 0, &size) == 0, "query stereo");
+    check(total_size(size) < total_size(all_size), "stereo needs less memory");
+    check(full.open(all_size) && small.open(size), "open");
+    for (int call = 0; call < TEST_CALLS / 2; call++)
+    {
+        check(run_call(&full.hdl, &conf, &full_buf, 2, call) == 0, "process full");
+        check(run_call(&small.hdl, &conf, &small_buf, 2, call) == 0, "process stereo");
+        same = same && same_output(full_buf, small_buf, 2);
+    }
+    check(same, "stereo output equals the full emulator's");
+    check(small.guards_intact(), "no write past the stereo memory");
+
+    /* Anything larger is refused, and the emulator carries on as if it never came */
+    grown = conf;
+    grown.channel_mode = DLB_MD_EMUL_CHMOD_3_2_1;
+    check(run_call(&small.hdl, &grown, &small_buf, 2, 0) == DLB_MD_EMUL_ERR_CAPACITY, "more compressor channels refused");
+    grown = conf;
+    grown.num_samples = (TEST_BLOCKS + 1) * DLB_MD_EMUL_BLOCK_SIZE;
+    check(run_call(&small.hdl, &grown, &small_buf, 2, 0) == DLB_MD_EMUL_ERR_CAPACITY, "more blocks refused");
+    grown = conf;
+    grown.a_chan_map[2] = DLB_MD_EMUL_CHAN_CNTR;
+    check(run_call(&small.hdl, &grown, &small_buf, 2, 0) == DLB_MD_EMUL_ERR_CAPACITY, "more filtered channels refused");
+    grown = conf;
+    grown.sur90on = 1;
+    check(run_call(&small.hdl, &grown, &small_buf, 2, 0) == DLB_MD_EMUL_ERR_CAPACITY, "another encoder filter refused");
+    check(small.guards_intact(), "refused calls write nothing");
+
+    for (int call = TEST_CALLS / 2; call < TEST_CALLS; call++)
+    {
+        run_call(&full.hdl, &conf, &full_buf, 2, call);
+        run_call(&small.hdl, &conf, &small_buf, 2, call);
+        same = same && same_output(full_buf, small_buf, 2);
+    }
+    check(same, "stereo output unchanged by the refused calls");
+
+    /* Smaller configurations fit */
+    make_config(&grown, DLB_MD_EMUL_CHMOD_1_0_0, 1, 2);
+    check(run_call(&small.hdl, &grown, &small_buf, 1, 0) == 0, "mono with fewer blocks fits");
+    check(small.guards_intact(), "no write past the memory after a smaller configuration");
+
+    /* Taps only where the memory has their storage */
+    {
+        sized_emulator traced;
+        dlb_md_emul_size_t untraced_size;
+        dlb_md_emul_meter_t *meter = nullptr;
+        size_t meter_size = 0;
+        int blocks = 0;
+
+        dlb_md_emul_meter_query_mem(4, &meter_size);
+        std::vector<uint64_t> meter_mem(meter_size / sizeof(uint64_t) + 8);
+        void *meter_base = reinterpret_cast<void *>((reinterpret_cast<uintptr_t>(meter_mem.data()) + 63) & ~uintptr_t(63));
+        check(dlb_md_emul_meter_init(meter_base, meter_size, 4, &meter) == 0, "meter");
+
+        check(dlb_md_emul_set_trace(&small.hdl, count_block, &blocks) == DLB_MD_EMUL_ERR_CAPACITY, "trace without storage refused");
+        check(dlb_md_emul_set_meter(&small.hdl, nullptr) == 0, "removing a tap without storage");
+        check(small.guards_intact(), "no write past the memory after a refused tap");
+
+        dlb_md_emul_query_mem_config(&conf, 2, 0, &untraced_size);
+        check(dlb_md_emul_query_mem_config(&conf, 2, DLB_MD_EMUL_TAP_TRACE, &size) == 0 &&
+              total_size(size) > total_size(untraced_size), "trace storage sized");
+        check(traced.open(size), "open with trace storage");
+        check(dlb_md_emul_set_trace(&traced.hdl, count_block, &blocks) == 0, "trace with storage");
+        check(dlb_md_emul_set_meter(&traced.hdl, meter) == DLB_MD_EMUL_ERR_CAPACITY,
+              "meter without storage refused");
+        run_call(&traced.hdl, &conf, &small_buf, 2, 0);
+        check(blocks == TEST_BLOCKS, "trace called for every block");
+        check(traced.guards_intact(), "no write past the memory with a trace");
+        dlb_md_emul_close(&traced.hdl);
+    }
+
+    /* Saved states must fit as well */
+    {
+        std::vector<uint8_t> state(dlb_md_emul_query_state_size());
+        dlb_md_emul_process_config_t wide;
+
+        dlb_md_emul_reset(&small.hdl);
+        dlb_md_emul_reset(&full.hdl);
+        run_call(&small.hdl, &conf, &small_buf, 2, 0);
+        check(dlb_md_emul_save_state(&small.hdl, state.data(), (uint32_t)state.size()) == 0, "save stereo state");
+        check(dlb_md_emul_load_state(&full.hdl, state.data(), (uint32_t)state.size()) == 0, "stereo state loads into the full emulator");
+        check(dlb_md_emul_load_state(&small.hdl, state.data(), (uint32_t)state.size()) == 0, "stereo state loads back");
+
+        make_config(&wide, DLB_MD_EMUL_CHMOD_2_0_0, 4, TEST_BLOCKS);
+        run_call(&full.hdl, &wide, &full_buf, 2, 1);
+        check(dlb_md_emul_save_state(&full.hdl, state.data(), (uint32_t)state.size()) == 0, "save wide state");
+        check(dlb_md_emul_load_state(&small.hdl, state.data(), (uint32_t)state.size()) == DLB_MD_EMUL_ERR_CAPACITY,
+              "state with histories beyond the capacity refused");
+        check(small.guards_intact(), "no write past the memory after loading states");
+    }
+
+    /* Sizes from an older caller, without capacity, open for everything */
+    {
+        sized_emulator legacy;
+
+        size = all_size;
+        size.num_blocks = 0;
+        make_config(&conf, DLB_MD_EMUL_CHMOD_3_4_1, 8, 8);
+        check(legacy.open(size) && run_call(&legacy.hdl, &conf, &full_buf, 2, 0) == 0, "sizes without capacity");
+        make_config(&conf, DLB_MD_EMUL_CHMOD_2_0_0, 2, 1);
+        dlb_md_emul_query_mem_config(&conf, 1, 0, &size);
+        size.emul_static_mem_size -= 16;
+        check(!legacy.open(size), "memory below the capacity refused");
+    }
+
+    dlb_md_emul_close(&small.hdl);
+    dlb_md_emul_close(&full.hdl);
+
+    return check_result();
+}
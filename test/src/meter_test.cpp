@@ -0,0 +1,255 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Live metering tap of an emulator handle
+ *
+ * Lays out meters in private memory and checks the layout checks, then runs
+ * the conformance programme through two outputs (line and RF) with a reader
+ * thread following the meter while the emulator publishes. Every block must
+ * be either read in order or counted as lost, the records must match the
+ * configuration and the output buffers, and a detached meter must stay
+ * still. A meter of four records read only at the end keeps the last four.
+ *
+ * Exit codes: 0 pass, 1 mismatch.
+ */
+
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "dlb_md_emul_meter.h"
+#include "emul_fixture.h"
+
+#define METER_CAPACITY      64
+
+/* Memory aligned as the meter needs it */
+static void *meter_memory(std::vector<uint8_t> *buf, size_t size)
+{
+    buf->assign(size + 64, 0);
+    return buf->data() + (64 - (uintptr_t)buf->data() % 64) % 64;
+}
+
+/* Peak of one channel of one block of an output buffer */
+static double block_peak(const DLB_LFRACT *buf, int block, int chan)
+{
+    double peak = 0.0;
+
+    for (int i = 0; i < DLB_MD_EMUL_BLOCK_SIZE; i++)
+    {
+        peak = std::max(peak, std::fabs((double)buf[(block * DLB_MD_EMUL_BLOCK_SIZE + i) * DLB_MD_EMUL_MAX_CHANS + chan]));
+    }
+    return peak;
+}
+
+static void check_layout(void)
+{
+    std::vector<uint8_t> buf;
+    dlb_md_emul_meter_t *p_meter;
+    size_t size;
+    void *p_mem;
+
+    check(dlb_md_emul_meter_query_mem(1, &size) == DLB_MD_EMUL_METER_INVALID_PARAM, "capacity of one rejected");
+    check(dlb_md_emul_meter_query_mem(8, &size) == DLB_MD_EMUL_METER_OK, "query");
+    p_mem = meter_memory(&buf, size);
+
+    check(dlb_md_emul_meter_attach(p_mem, size, &p_meter) == DLB_MD_EMUL_METER_BAD_LAYOUT, "attach to empty memory");
+    check(dlb_md_emul_meter_init((uint8_t *)p_mem + 8, size, 8, &p_meter) == DLB_MD_EMUL_METER_INVALID_PARAM, "unaligned memory rejected");
+    check(dlb_md_emul_meter_init(p_mem, size - 1, 8, &p_meter) == DLB_MD_EMUL_METER_MEM_ALLOC_ERR, "short memory rejected");
+    check(dlb_md_emul_meter_init(p_mem, size, 8, &p_meter) == DLB_MD_EMUL_METER_OK, "init");
+    check(dlb_md_emul_meter_attach(p_mem, size, &p_meter) == DLB_MD_EMUL_METER_OK && p_meter == p_mem, "attach");
+    check(dlb_md_emul_meter_attach(p_mem, size - 1, &p_meter) == DLB_MD_EMUL_METER_MEM_ALLOC_ERR, "attach to a short mapping");
+}
+
+static void run_calls
+    (md_emul_instance *emul
+    ,synth_programme *synth
+    ,dlb_md_emul_process_config_t *emul_conf
+    ,int calls
+    ,const dlb_md_emul_meter_t *p_meter
+    )
+{
+    dlb_md_emul_meter_record_t records[FIXTURE_CALL_BLOCKS];
+    uint64_t cursor, lost = 0;
+    uint32_t num_read;
+
+    for (int call = 0; call < calls; call++)
+    {
+        fixture_process_call(emul, synth, emul_conf);
+
+        if (!p_meter)
+        {
+            continue;
+        }
+        /* The records of this call against the output buffers */
+        dlb_md_emul_meter_get_head(p_meter, &cursor);
+        cursor -= FIXTURE_CALL_BLOCKS;
+        dlb_md_emul_meter_read(p_meter, &cursor, records, FIXTURE_CALL_BLOCKS, &num_read, &lost);
+        check(num_read == FIXTURE_CALL_BLOCKS && lost == 0, "records of the last call");
+        for (uint32_t b = 0; b < num_read; b++)
+        {
+            const dlb_md_emul_meter_record_t *r = &records[b];
+            bool peaks_match = true;
+
+            for (int output = 0; output < 2; output++)
+            {
+                for (int c = 0; c < DLB_MD_EMUL_MAX_CHANS; c++)
+                {
+                    double expect = c < FIXTURE_CHANNELS ? block_peak(emul_conf->pa_in_data[output], (int)b, c) : 0.0;
+
+                    peaks_match = peaks_match && r->peak[output][c] == expect;
+                }
+            }
+            check(peaks_match, "peaks of the output buffers");
+            check(r->block_index == (uint64_t)call * FIXTURE_CALL_BLOCKS + b, "block index");
+            check(r->num_outputs == 2 && r->channel_mask == 0x3F, "outputs and channels");
+            check(r->flags == (DLB_MD_EMUL_METER_DRC_CALC | DLB_MD_EMUL_METER_DECODER), "flags");
+            check(r->drc_gain_db <= 24.0 && r->compr_gain_db <= 24.0 && r->drc_gain_db > -60.0, "gain range");
+            /* dialnorm 31 adds nothing, the line mode window ends on the quantised DRC gain */
+            check(std::fabs(20.0 * std::log10(r->applied_gain[0]) - r->drc_gain_db) < 0.6, "applied line mode gain");
+        }
+    }
+}
+
+int main(void)
+{
+    dlb_md_emul_process_config_t emul_conf;
+    md_emul_instance             emul = {};
+    synth_programme              synth;
+    std::vector<DLB_LFRACT>      main_buf(FIXTURE_BUFFER_SIZE);
+    std::vector<DLB_LFRACT>      aux_buf(FIXTURE_BUFFER_SIZE);
+    std::vector<uint8_t>         meter_buf;
+    dlb_md_emul_meter_t         *p_meter;
+    const dlb_md_emul_meter_t   *p_reader;
+    std::atomic<bool>            done(false);
+    uint64_t                     reader_blocks = 0, reader_lost = 0;
+    bool                         reader_in_order = true;
+    uint64_t                     head, head_detached;
+    size_t                       size;
+    void                        *p_mem;
+
+    try
+    {
+        check_layout();
+
+        md_emul_instance_open(&emul);
+        fixture_config(&emul_conf);
+        emul_conf.pa_in_data[0] = main_buf.data();
+        emul_conf.pa_in_data[1] = aux_buf.data();
+        synth_programme_init(&synth, FIXTURE_CHANNELS, 1);
+
+        dlb_md_emul_meter_query_mem(METER_CAPACITY, &size);
+        p_mem = meter_memory(&meter_buf, size);
+        dlb_md_emul_meter_init(p_mem, size, METER_CAPACITY, &p_meter);
+        dlb_md_emul_meter_attach(p_mem, size, (dlb_md_emul_meter_t **)&p_reader);
+        check(dlb_md_emul_set_meter(nullptr, p_meter) != 0, "NULL handle rejected");
+        check(dlb_md_emul_set_meter(&emul.hdl, p_meter) == 0, "meter attached");
+
+        /* A monitor following the meter while the emulator runs */
+        std::thread reader([&]()
+        {
+            dlb_md_emul_meter_record_t records[8];
+            uint64_t cursor = 0, expect = 0;
+            uint32_t num_read;
+
+            for (;;)
+            {
+                bool last = done.load();
+                uint64_t lost_before = reader_lost;
+
+                dlb_md_emul_meter_read(p_reader, &cursor, records, 8, &num_read, &reader_lost);
+                expect += reader_lost - lost_before;
+                for (uint32_t i = 0; i < num_read; i++)
+                {
+                    reader_in_order = reader_in_order && records[i].block_index == expect;
+                    expect = records[i].block_index + 1;
+                }
+                reader_blocks += num_read;
+                if (last && num_read == 0)
+                {
+                    break;
+                }
+            }
+        });
+        run_calls(&emul, &synth, &emul_conf, FIXTURE_CALLS, p_reader);
+        done = true;
+        reader.join();
+
+        dlb_md_emul_meter_get_head(p_reader, &head);
+        printf("published %llu blocks, reader got %llu and lost %llu\n", (unsigned long long)head,
+               (unsigned long long)reader_blocks, (unsigned long long)reader_lost);
+        check(head == (uint64_t)FIXTURE_CALLS * FIXTURE_CALL_BLOCKS, "one record per block");
+        check(reader_blocks + reader_lost == head, "every block read or counted as lost");
+        check(reader_in_order, "reader sees the blocks in order");
+
+        check(dlb_md_emul_set_meter(&emul.hdl, nullptr) == 0, "meter detached");
+        run_calls(&emul, &synth, &emul_conf, 10, nullptr);
+        dlb_md_emul_meter_get_head(p_reader, &head_detached);
+        check(head_detached == head, "nothing published after detaching");
+
+        /* A reader left behind keeps the newest capacity records */
+        {
+            std::vector<uint8_t> small_buf;
+            dlb_md_emul_meter_record_t records[8];
+            dlb_md_emul_meter_t *p_small;
+            uint64_t cursor = 0, lost = 0;
+            uint32_t num_read;
+
+            dlb_md_emul_meter_query_mem(4, &size);
+            dlb_md_emul_meter_init(meter_memory(&small_buf, size), size, 4, &p_small);
+            dlb_md_emul_set_meter(&emul.hdl, p_small);
+            run_calls(&emul, &synth, &emul_conf, 2, nullptr);
+            dlb_md_emul_meter_read(p_small, &cursor, records, 8, &num_read, &lost);
+            check(num_read == 4 && lost == 2 * FIXTURE_CALL_BLOCKS - 4, "overrun reader loses the oldest records");
+            check(records[0].block_index == 2 * FIXTURE_CALL_BLOCKS - 4 && records[3].block_index == 2 * FIXTURE_CALL_BLOCKS - 1,
+                  "overrun reader gets the newest records");
+            dlb_md_emul_set_meter(&emul.hdl, nullptr);
+        }
+
+        md_emul_instance_close(&emul);
+    }
+    catch (const std::exception &e)
+    {
+        printf("FAIL %s\n", e.what());
+        md_emul_instance_close(&emul);
+        return 1;
+    }
+
+    return check_result();
+}
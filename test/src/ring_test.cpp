@@ -0,0 +1,324 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Ring buffer streaming with producer, emulator and consumer threads
+ *
+ * Checks the full and empty cases of each stage on one thread first: an
+ * acquire or write into a full ring and a process or consumer call on an
+ * empty one must fail and be counted. A ring with two outputs left
+ * unprocessed must give the same audio on both. Then streams the
+ * conformance programme through a small ring with a thread per stage. The
+ * consumer must see every block once, in order, bit-exact with
+ * dlb_md_emul_process() on a plain handle in the buffer layout of the
+ * fixture, and the overrun and underrun counters must match the retries of
+ * the threads.
+ *
+ * Exit codes: 0 pass, 1 mismatch.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "dlb_md_emul_ring.h"
+#include "emul_fixture.h"
+
+#define RING_BLOCKS         4
+#define RING_STREAM_BLOCKS  1500    /* 8 s */
+#define BLOCK_FRAMES_LEN    (DLB_MD_EMUL_BLOCK_SIZE * FIXTURE_CHANNELS)
+#define BLOCK_SLOTS_LEN     (DLB_MD_EMUL_BLOCK_SIZE * DLB_MD_EMUL_MAX_CHANS)
+
+/* Memory of a ring, throws on failure */
+static dlb_md_emul_ring_t *ring_open(std::vector<uint8_t> *mem, uint32_t num_blocks)
+{
+    dlb_md_emul_ring_config_t ring_conf;
+    dlb_md_emul_ring_t *p_ring;
+    size_t size;
+
+    ring_conf.num_blocks = num_blocks;
+    ring_conf.num_channels = FIXTURE_CHANNELS;
+    ring_conf.num_outputs = 2;
+    if (dlb_md_emul_ring_query_mem(&ring_conf, &size) != DLB_MD_EMUL_RING_OK)
+    {
+        throw std::runtime_error("Failed to query ring memory");
+    }
+    mem->assign(size, 0);
+    if (dlb_md_emul_ring_open(&ring_conf, mem->data(), &p_ring) != DLB_MD_EMUL_RING_OK)
+    {
+        throw std::runtime_error("Failed to open the ring");
+    }
+    return p_ring;
+}
+
+/* One block of the emulator configuration of the fixture */
+static void ring_config(dlb_md_emul_process_config_t *emul_conf)
+{
+    fixture_config(emul_conf);
+    emul_conf->num_samples = DLB_MD_EMUL_BLOCK_SIZE;
+}
+
+/* The used channels of two blocks of frames with DLB_MD_EMUL_MAX_CHANS slots agree */
+static bool frames_equal(const DLB_LFRACT *p_a, const DLB_LFRACT *p_b)
+{
+    for (int i = 0; i < DLB_MD_EMUL_BLOCK_SIZE; i++)
+    {
+        if (memcmp(p_a + i * DLB_MD_EMUL_MAX_CHANS, p_b + i * DLB_MD_EMUL_MAX_CHANS, sizeof(DLB_LFRACT) * FIXTURE_CHANNELS))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void check_full_and_empty(const dlb_md_emul_process_config_t *emul_conf)
+{
+    std::vector<uint8_t> mem;
+    std::vector<DLB_LFRACT> frames(BLOCK_FRAMES_LEN, 0.0);
+    dlb_md_emul_ring_t *p_ring = ring_open(&mem, RING_BLOCKS);
+    dlb_md_emul_ring_stats_t stats;
+    dlb_md_emul_ring_span_t span;
+
+    check(dlb_md_emul_ring_process(p_ring, emul_conf) == DLB_MD_EMUL_RING_EMPTY, "process on an empty ring");
+    check(dlb_md_emul_ring_consumer_acquire(p_ring, &span) == DLB_MD_EMUL_RING_EMPTY, "consume from an empty ring");
+    check(dlb_md_emul_ring_consumer_release(p_ring) == DLB_MD_EMUL_RING_EMPTY, "release with nothing acquired");
+
+    for (int b = 0; b < RING_BLOCKS; b++)
+    {
+        check(dlb_md_emul_ring_write(p_ring, frames.data()) == DLB_MD_EMUL_RING_OK, "write into free blocks");
+    }
+    check(dlb_md_emul_ring_producer_acquire(p_ring) == nullptr, "acquire from a full ring");
+    check(dlb_md_emul_ring_write(p_ring, frames.data()) == DLB_MD_EMUL_RING_FULL, "write into a full ring");
+
+    dlb_md_emul_ring_get_stats(p_ring, &stats);
+    check(stats.capacity == RING_BLOCKS && stats.fill == RING_BLOCKS && stats.pending == RING_BLOCKS && stats.ready == 0, "fill of a full ring");
+    check(stats.overruns == 2 && stats.process_underruns == 1 && stats.consumer_underruns == 1, "counters of the full and empty cases");
+
+    check(dlb_md_emul_ring_process(p_ring, emul_conf) == DLB_MD_EMUL_RING_OK, "process");
+    check(dlb_md_emul_ring_consumer_acquire(p_ring, &span) == DLB_MD_EMUL_RING_OK, "consume");
+    check(span.block_index == 0 && span.status == 0 && span.num_frames == DLB_MD_EMUL_BLOCK_SIZE &&
+          span.num_channels == FIXTURE_CHANNELS && span.frame_stride == DLB_MD_EMUL_MAX_CHANS, "span of the first block");
+    check(dlb_md_emul_ring_producer_acquire(p_ring) == nullptr, "acquired block is not released yet");
+    check(dlb_md_emul_ring_consumer_release(p_ring) == DLB_MD_EMUL_RING_OK, "release");
+    check(dlb_md_emul_ring_producer_acquire(p_ring) != nullptr, "released block free again");
+
+    dlb_md_emul_ring_get_stats(p_ring, &stats);
+    check(stats.fill == RING_BLOCKS - 1 && stats.pending == RING_BLOCKS - 1 && stats.ready == 0, "fill after one block");
+    check(stats.overruns == 3, "every failed acquire counted");
+    dlb_md_emul_ring_close(p_ring);
+}
+
+/* Decoder only with no compression on either output, the second output is a copy of the first */
+static void check_second_output(void)
+{
+    std::vector<uint8_t> mem;
+    std::vector<DLB_LFRACT> frames(BLOCK_FRAMES_LEN);
+    dlb_md_emul_ring_t *p_ring = ring_open(&mem, RING_BLOCKS);
+    dlb_md_emul_process_config_t emul_conf;
+    dlb_md_emul_ring_span_t span;
+    synth_programme synth;
+    bool outputs_equal = true;
+
+    ring_config(&emul_conf);
+    emul_conf.control = DLB_MD_EMUL_CONTROL_DECODER_ENABLE;
+    emul_conf.comp_mode[0] = DLB_MD_EMUL_CM_NONE;
+    emul_conf.comp_mode[1] = DLB_MD_EMUL_CM_NONE;
+    synth_programme_init(&synth, FIXTURE_CHANNELS, 2);
+
+    for (int b = 0; b < 2 * RING_BLOCKS; b++)
+    {
+        synth_programme_render(&synth, frames.data(), DLB_MD_EMUL_BLOCK_SIZE);
+        dlb_md_emul_ring_write(p_ring, frames.data());
+        check(dlb_md_emul_ring_process(p_ring, &emul_conf) == DLB_MD_EMUL_RING_OK, "process without compression");
+        dlb_md_emul_ring_consumer_acquire(p_ring, &span);
+        outputs_equal = outputs_equal && frames_equal(span.pa_data[0], span.pa_data[1]);
+        dlb_md_emul_ring_consumer_release(p_ring);
+    }
+    check(outputs_equal, "second output without compression equals the first");
+    dlb_md_emul_ring_close(p_ring);
+}
+
+/* The programme one block per call on a plain handle in the buffer layout of the fixture, both outputs of every block */
+static void run_direct
+    (const dlb_md_emul_process_config_t *ring_conf
+    ,std::vector<DLB_LFRACT>           *output
+    ,std::vector<int32_t>              *status
+    )
+{
+    dlb_md_emul_process_config_t emul_conf = *ring_conf;
+    std::vector<DLB_LFRACT> main_buf(BLOCK_SLOTS_LEN);
+    std::vector<DLB_LFRACT> aux_buf(BLOCK_SLOTS_LEN);
+    std::vector<char> static_mem, dynamic_mem;
+    dlb_md_emul_size_t emul_size;
+    dlb_md_emul_hdl_t hdl;
+    synth_programme synth;
+
+    dlb_md_emul_query_mem(&emul_size);
+    static_mem.resize(emul_size.emul_static_mem_size + emul_size.compr_static_mem_size + emul_size.compr_ext_static_mem_size);
+    dynamic_mem.resize(emul_size.emul_dynamic_mem_size + emul_size.compr_dynamic_mem_size);
+    if (dlb_md_emul_open(&emul_size, &hdl, static_mem.data(), dynamic_mem.data()))
+    {
+        throw std::runtime_error("Failed to open the direct emulator");
+    }
+
+    emul_conf.pa_in_data[0] = main_buf.data();
+    emul_conf.pa_in_data[1] = aux_buf.data();
+    synth_programme_init(&synth, FIXTURE_CHANNELS, 1);
+    for (int b = 0; b < RING_STREAM_BLOCKS; b++)
+    {
+        fixture_render_call(&synth, &emul_conf);
+        (*status)[b] = dlb_md_emul_process(&hdl, &emul_conf, 2);
+        memcpy(output->data() + (2 * b) * BLOCK_SLOTS_LEN, main_buf.data(), sizeof(DLB_LFRACT) * BLOCK_SLOTS_LEN);
+        memcpy(output->data() + (2 * b + 1) * BLOCK_SLOTS_LEN, aux_buf.data(), sizeof(DLB_LFRACT) * BLOCK_SLOTS_LEN);
+    }
+    dlb_md_emul_close(&hdl);
+}
+
+int main(void)
+{
+    dlb_md_emul_process_config_t emul_conf;
+    synth_programme              synth;
+    std::vector<DLB_LFRACT>      input(RING_STREAM_BLOCKS * BLOCK_FRAMES_LEN);
+    std::vector<DLB_LFRACT>      expect(2 * RING_STREAM_BLOCKS * BLOCK_SLOTS_LEN);
+    std::vector<int32_t>         expect_status(RING_STREAM_BLOCKS);
+    std::vector<uint8_t>         mem;
+    dlb_md_emul_ring_t          *p_ring;
+    dlb_md_emul_ring_stats_t     stats;
+    uint64_t                     producer_full = 0, process_empty = 0, consumer_empty = 0;
+    uint64_t                     consumed = 0;
+    bool                         in_order = true, outputs_match = true, status_match = true;
+
+    try
+    {
+        ring_config(&emul_conf);
+        check_full_and_empty(&emul_conf);
+        check_second_output();
+
+        synth_programme_init(&synth, FIXTURE_CHANNELS, 1);
+        synth_programme_render(&synth, input.data(), RING_STREAM_BLOCKS * DLB_MD_EMUL_BLOCK_SIZE);
+        run_direct(&emul_conf, &expect, &expect_status);
+
+        p_ring = ring_open(&mem, RING_BLOCKS);
+
+        /* Odd blocks are copied in by dlb_md_emul_ring_write, even ones filled in place */
+        std::thread producer([&]()
+        {
+            for (int b = 0; b < RING_STREAM_BLOCKS; b++)
+            {
+                const DLB_LFRACT *p_frames = input.data() + b * BLOCK_FRAMES_LEN;
+
+                if (b % 2)
+                {
+                    while (dlb_md_emul_ring_write(p_ring, p_frames) == DLB_MD_EMUL_RING_FULL)
+                    {
+                        producer_full++;
+                        std::this_thread::yield();
+                    }
+                    continue;
+                }
+
+                DLB_LFRACT *p_block;
+                while (!(p_block = dlb_md_emul_ring_producer_acquire(p_ring)))
+                {
+                    producer_full++;
+                    std::this_thread::yield();
+                }
+                for (int i = 0; i < DLB_MD_EMUL_BLOCK_SIZE; i++)
+                {
+                    memcpy(p_block + i * DLB_MD_EMUL_MAX_CHANS, p_frames + i * FIXTURE_CHANNELS, sizeof(DLB_LFRACT) * FIXTURE_CHANNELS);
+                }
+                dlb_md_emul_ring_producer_commit(p_ring);
+            }
+        });
+        std::thread emulator([&]()
+        {
+            for (int b = 0; b < RING_STREAM_BLOCKS; b++)
+            {
+                while (dlb_md_emul_ring_process(p_ring, &emul_conf) == DLB_MD_EMUL_RING_EMPTY)
+                {
+                    process_empty++;
+                    std::this_thread::yield();
+                }
+            }
+        });
+        std::thread consumer([&]()
+        {
+            dlb_md_emul_ring_span_t span;
+
+            for (int b = 0; b < RING_STREAM_BLOCKS; b++)
+            {
+                while (dlb_md_emul_ring_consumer_acquire(p_ring, &span) != DLB_MD_EMUL_RING_OK)
+                {
+                    consumer_empty++;
+                    std::this_thread::yield();
+                }
+                in_order = in_order && span.block_index == (uint64_t)b;
+                status_match = status_match && span.status == expect_status[b];
+                for (int output = 0; output < 2; output++)
+                {
+                    outputs_match = outputs_match && frames_equal(span.pa_data[output], expect.data() + (2 * b + output) * BLOCK_SLOTS_LEN);
+                }
+                dlb_md_emul_ring_consumer_release(p_ring);
+                consumed++;
+            }
+        });
+        producer.join();
+        emulator.join();
+        consumer.join();
+
+        dlb_md_emul_ring_get_stats(p_ring, &stats);
+        printf("%d blocks through %d, %llu overruns, %llu process and %llu consumer underruns\n", RING_STREAM_BLOCKS, RING_BLOCKS,
+               (unsigned long long)stats.overruns, (unsigned long long)stats.process_underruns, (unsigned long long)stats.consumer_underruns);
+        check(consumed == RING_STREAM_BLOCKS && in_order, "every block consumed once and in order");
+        check(outputs_match, "outputs of the direct calls");
+        check(status_match, "status of the direct calls");
+        check(stats.blocks_produced == RING_STREAM_BLOCKS && stats.blocks_processed == RING_STREAM_BLOCKS &&
+              stats.blocks_consumed == RING_STREAM_BLOCKS, "blocks through every stage");
+        check(stats.fill == 0 && stats.pending == 0 && stats.ready == 0, "ring drained");
+        check(stats.overruns == producer_full, "overruns as the producer saw them");
+        check(stats.process_underruns == process_empty, "process underruns as the emulator saw them");
+        check(stats.consumer_underruns == consumer_empty, "consumer underruns as the consumer saw them");
+        dlb_md_emul_ring_close(p_ring);
+    }
+    catch (const std::exception &e)
+    {
+        printf("FAIL %s\n", e.what());
+        return 1;
+    }
+
+    return check_result();
+}
@@ -0,0 +1,146 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Runtime statistics of an emulator handle
+ *
+ * Runs the conformance programme through two outputs (line and RF) in calls of
+ * six blocks and checks that the counters of dlb_md_emul_get_stats add up: one
+ * DRC clip protection update and one histogram entry per output per block, one
+ * compr clip protection update per call, time in every stage, and nothing but
+ * the new calls after a reset of the statistics.
+ *
+ * Exit codes: 0 pass, 1 mismatch, 77 library built without statistics.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+#include "emul_fixture.h"
+
+static uint64_t hist_sum(const dlb_md_emul_stats_t *stats, int output)
+{
+    uint64_t sum = 0;
+
+    for (int i = 0; i < DLB_MD_EMUL_STATS_GR_BINS; i++)
+    {
+        sum += stats->gain_reduction_hist[output][i];
+    }
+    return sum;
+}
+
+/* Counters of FIXTURE_CALLS calls */
+static void check_counts(const dlb_md_emul_stats_t *stats, uint64_t calls, const char *when)
+{
+    uint64_t blocks = calls * FIXTURE_CALL_BLOCKS;
+
+    printf("%s: %llu blocks, DRC clip %llu attacks %llu holds min %.2f mean %.2f dB,"
+           " compr clip %llu attacks %llu holds min %.2f mean %.2f dB\n", when,
+           (unsigned long long)stats->blocks_processed,
+           (unsigned long long)stats->dlim_attacks, (unsigned long long)stats->dlim_holds,
+           stats->dlim_gain_min_db, stats->dlim_gain_mean_db,
+           (unsigned long long)stats->clim_attacks, (unsigned long long)stats->clim_holds,
+           stats->clim_gain_min_db, stats->clim_gain_mean_db);
+
+    check(stats->blocks_processed == blocks, "blocks processed");
+    check(stats->dlim_updates == blocks, "one DRC clip protection update per block");
+    check(stats->clim_updates == calls, "one compr clip protection update per call");
+    check(stats->dlim_attacks + stats->dlim_holds <= stats->dlim_updates, "DRC clip events");
+    check(stats->clim_attacks + stats->clim_holds <= stats->clim_updates, "compr clip events");
+    check(stats->dlim_attacks > 0 && stats->clim_attacks > 0, "clip protection attacks on a programme near full scale");
+    check(stats->dlim_gain_min_db <= stats->dlim_gain_mean_db, "DRC clip gain min <= mean");
+    check(stats->clim_gain_min_db <= stats->clim_gain_mean_db, "compr clip gain min <= mean");
+    check(hist_sum(stats, 0) == blocks && hist_sum(stats, 1) == blocks, "one histogram entry per output per block");
+    check(stats->gain_reduction_hist[0][0] < blocks, "line mode reduces the gain at dialnorm 31");
+    for (int i = 0; i < DLB_MD_EMUL_NUM_STAGES; i++)
+    {
+        check(stats->stage_time_ns[i] > 0, "time in every stage");
+    }
+}
+
+int main(void)
+{
+    dlb_md_emul_process_config_t emul_conf;
+    dlb_md_emul_stats_t          stats;
+    md_emul_instance             emul = {};
+    synth_programme              synth;
+    std::vector<DLB_LFRACT>      main_buf(FIXTURE_BUFFER_SIZE);
+    std::vector<DLB_LFRACT>      aux_buf(FIXTURE_BUFFER_SIZE);
+
+    try
+    {
+        md_emul_instance_open(&emul);
+        if (dlb_md_emul_get_stats(&emul.hdl, &stats, 0))
+        {
+            printf("library built without statistics\n");
+            md_emul_instance_close(&emul);
+            return 77;
+        }
+        check(stats.blocks_processed == 0 && stats.dlim_updates == 0, "nothing counted after open");
+        check(dlb_md_emul_get_stats(&emul.hdl, nullptr, 0) != 0, "NULL statistics rejected");
+
+        fixture_config(&emul_conf);
+        emul_conf.pa_in_data[0] = main_buf.data();
+        emul_conf.pa_in_data[1] = aux_buf.data();
+        synth_programme_init(&synth, FIXTURE_CHANNELS, 1);
+
+        fixture_run_calls(&emul, &synth, &emul_conf, FIXTURE_CALLS);
+        dlb_md_emul_get_stats(&emul.hdl, &stats, 1);
+        check_counts(&stats, FIXTURE_CALLS, "first interval");
+        /* opened for 8 blocks, the six block calls re-open the compressor once */
+        check(stats.compr_reopens == 1, "one compressor re-open");
+
+        dlb_md_emul_get_stats(&emul.hdl, &stats, 0);
+        check(stats.blocks_processed == 0 && stats.dlim_updates == 0 && stats.clim_updates == 0 &&
+              hist_sum(&stats, 0) == 0 && stats.stage_time_ns[0] == 0, "cleared by the reset");
+
+        fixture_run_calls(&emul, &synth, &emul_conf, FIXTURE_CALLS);
+        dlb_md_emul_get_stats(&emul.hdl, &stats, 0);
+        check_counts(&stats, FIXTURE_CALLS, "second interval");
+        check(stats.compr_reopens == 0, "no re-open in the second interval");
+
+        md_emul_instance_close(&emul);
+    }
+    catch (const std::exception &e)
+    {
+        printf("FAIL %s\n", e.what());
+        md_emul_instance_close(&emul);
+        return 1;
+    }
+
+    return check_result();
+}
@@ -0,0 +1,239 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Deterministic synthetic programme material for tests and benchmarks
+ */
+
+#include <cmath>
+
+#include "synth_programme.h"
+
+#define SECTION_SECONDS     2.5
+#define NUM_SECTIONS        8
+#define LFE_CHANNEL         3
+#define NOISE_FLOOR         1.0e-5  /* -100 dBFS, as a recording has */
+#define CENTRE_CHANNEL      2
+
+#define WORD_SECONDS        1.2     /* dialogue word and pause */
+#define WORD_ON_SECONDS     0.8
+#define TRANSIENT_SECONDS   0.37    /* transient spacing */
+#define TRANSIENT_DECAY     0.008   /* seconds */
+
+static const double section_level_db[NUM_SECTIONS] = { -45.0, -30.0, -12.0, -4.0, -20.0, -50.0, -8.0, -25.0 };
+
+typedef enum
+{
+    BROADCAST_PINK,
+    BROADCAST_DIALOGUE,
+    BROADCAST_TRANSIENTS,
+    BROADCAST_SILENCE
+} broadcast_kind;
+
+typedef struct
+{
+    broadcast_kind  kind;
+    double          level_db;       /**< of the noise, dialogue or transient bed */
+    double          seconds;
+} broadcast_section;
+
+static const broadcast_section broadcast_sections[] =
+{
+    { BROADCAST_PINK,       -35.0, 4.0 },
+    { BROADCAST_DIALOGUE,   -27.0, 6.0 },
+    { BROADCAST_PINK,       -23.0, 4.0 },
+    { BROADCAST_SILENCE,      0.0, 1.5 },
+    { BROADCAST_TRANSIENTS, -40.0, 4.0 },
+    { BROADCAST_PINK,       -12.0, 4.0 },
+    { BROADCAST_DIALOGUE,   -16.0, 6.0 },
+    { BROADCAST_SILENCE,      0.0, 0.5 },
+    { BROADCAST_PINK,        -6.0, 3.0 },
+    { BROADCAST_TRANSIENTS, -28.0, 3.0 },
+};
+
+#define NUM_BROADCAST_SECTIONS  (sizeof(broadcast_sections) / sizeof(broadcast_sections[0]))
+#define BROADCAST_CYCLE_SECONDS 36.0
+
+/* L, R, C, LFE, Ls, Rs, then back surrounds */
+static const double channel_gain[DLB_MD_EMUL_MAX_CHANS] = { 0.7, 0.7, 1.0, 0.5, 0.4, 0.4, 0.3, 0.3 };
+
+static const double two_pi = 6.283185307179586;
+
+/* White noise in [-1, 1) */
+static double next_noise(synth_programme *synth)
+{
+    synth->noise = synth->noise * 1664525u + 1013904223u;
+    return (double)(int32_t)synth->noise / 2147483648.0;
+}
+
+/* Pink noise from white, Paul Kellet's three pole approximation */
+static double next_pink(synth_programme *synth, int channel, double white)
+{
+    double *b = synth->pink[channel];
+
+    b[0] = 0.99765 * b[0] + white * 0.0990460;
+    b[1] = 0.96300 * b[1] + white * 0.2965164;
+    b[2] = 0.57000 * b[2] + white * 1.0526913;
+    return 0.25 * (b[0] + b[1] + b[2] + white * 0.1848);
+}
+
+void synth_programme_init(synth_programme *synth, int channels, uint32_t seed)
+{
+    synth_programme_config config = { channels, LFE_CHANNEL, SYNTH_PROGRAMME_SAMPLE_RATE, SYNTH_CONTENT_CONFORMANCE };
+
+    synth_programme_open(synth, &config, seed);
+}
+
+void synth_programme_open(synth_programme *synth, const synth_programme_config *config, uint32_t seed)
+{
+    synth->channels = config->channels;
+    synth->lfe_channel = config->lfe_channel;
+    synth->dialogue_channel = (config->channels > CENTRE_CHANNEL) ? CENTRE_CHANNEL : -1;
+    synth->sample_rate = (double)config->sample_rate;
+    synth->content = config->content;
+    synth->noise = seed;
+    synth->frame = 0;
+    for (int c = 0; c < DLB_MD_EMUL_MAX_CHANS; c++)
+    {
+        synth->lowpass[c] = 0.0;
+        synth->pink[c][0] = synth->pink[c][1] = synth->pink[c][2] = 0.0;
+    }
+}
+
+static void render_broadcast(synth_programme *synth, DLB_LFRACT *out, uint32_t frames)
+{
+    for (uint32_t n = 0; n < frames; n++, synth->frame++)
+    {
+        double t = (double)synth->frame / synth->sample_rate;
+        double position = std::fmod(t, BROADCAST_CYCLE_SECONDS);
+        size_t section = 0;
+
+        while (section + 1 < NUM_BROADCAST_SECTIONS && position >= broadcast_sections[section].seconds)
+        {
+            position -= broadcast_sections[section].seconds;
+            section++;
+        }
+
+        const broadcast_section &s = broadcast_sections[section];
+        double level = std::pow(10.0, s.level_db / 20.0);
+        double syllable = 0.5 - 0.5 * std::cos(two_pi * 4.0 * t);
+        double word = (std::fmod(position, WORD_SECONDS) < WORD_ON_SECONDS) ? 1.0 : 0.0;
+        double transient = std::exp(-std::fmod(position, TRANSIENT_SECONDS) / TRANSIENT_DECAY);
+        double lfe_tone = std::sin(two_pi * 45.0 * t);
+
+        for (int c = 0; c < synth->channels; c++)
+        {
+            double noise = next_noise(synth);
+            double pink = next_pink(synth, c, noise);
+            double x = 0.0;
+
+            synth->lowpass[c] += 0.15 * (noise - synth->lowpass[c]);
+
+            switch (s.kind)
+            {
+                case BROADCAST_PINK:
+                    x = level * ((c == synth->lfe_channel) ? 0.5 * lfe_tone : channel_gain[c] * pink);
+                    break;
+                case BROADCAST_DIALOGUE:
+                    if (c == synth->dialogue_channel || synth->dialogue_channel < 0)
+                    {
+                        /* voiced 140 Hz buzz and noise shaped into syllables and words */
+                        x = level * word * syllable * syllable * (2.5 * synth->lowpass[c] + 0.3 * std::sin(two_pi * 140.0 * t));
+                    }
+                    else if (c != synth->lfe_channel)
+                    {
+                        x = 0.03 * level * pink;    /* room tone */
+                    }
+                    break;
+                case BROADCAST_TRANSIENTS:
+                    x = (c == synth->lfe_channel) ? 0.9 * transient * lfe_tone
+                                                  : level * pink + 0.9 * channel_gain[c] * transient * noise;
+                    break;
+                case BROADCAST_SILENCE:
+                    break;
+            }
+            *out++ = (x > 1.0) ? 1.0 : ((x < -1.0) ? -1.0 : x);
+        }
+    }
+}
+
+void synth_programme_render(synth_programme *synth, DLB_LFRACT *out, uint32_t frames)
+{
+    if (synth->content == SYNTH_CONTENT_BROADCAST)
+    {
+        render_broadcast(synth, out, frames);
+        return;
+    }
+
+    for (uint32_t n = 0; n < frames; n++, synth->frame++)
+    {
+        double t = (double)synth->frame / synth->sample_rate;
+        int section = (int)(t / SECTION_SECONDS);
+        double level = std::pow(10.0, section_level_db[section % NUM_SECTIONS] / 20.0);
+        double syllable = 0.5 - 0.5 * std::cos(two_pi * 4.0 * t);
+        double chord = (std::sin(two_pi * 220.0 * t) + std::sin(two_pi * 277.18 * t) + std::sin(two_pi * 329.63 * t)) / 3.0;
+
+        for (int c = 0; c < synth->channels; c++)
+        {
+            double noise = next_noise(synth);
+            double x;
+
+            /* one pole low pass turns the noise into a speech-like spectrum */
+            synth->lowpass[c] += 0.15 * (noise - synth->lowpass[c]);
+
+            if (c == synth->lfe_channel)
+            {
+                x = std::sin(two_pi * 45.0 * t);
+            }
+            else
+            {
+                switch (section % 3)
+                {
+                    case 0:     /* speech */
+                        x = 2.5 * synth->lowpass[c] * syllable * syllable;
+                        break;
+                    case 1:     /* music */
+                        x = 0.8 * chord + 0.2 * synth->lowpass[c];
+                        break;
+                    default:    /* effects */
+                        x = 0.5 * noise;
+                        break;
+                }
+            }
+            x = x * level * channel_gain[c] + NOISE_FLOOR * noise;
+            *out++ = (x > 1.0) ? 1.0 : ((x < -1.0) ? -1.0 : x);
+        }
+    }
+}
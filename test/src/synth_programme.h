@@ -0,0 +1,93 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Deterministic synthetic programme material for tests and benchmarks
+ *
+ * A 5.1 programme of speech-like bursts, chords and noise whose level steps
+ * between quiet and near full scale every few seconds, so every DRC profile
+ * has both boost and cut regions to work on. The output only depends on the
+ * seed, no source file has to be shipped.
+ *
+ * The broadcast content is a 36 second cycle of pink noise at loudness steps,
+ * dialogue on the centre channel over a room tone, transients over a quiet
+ * bed and silence gaps, for any channel count and sample rate.
+ */
+
+#ifndef SYNTH_PROGRAMME_H
+#define SYNTH_PROGRAMME_H
+
+#include <cstdint>
+
+#include "dlb_md_emul_api.h"
+
+#define SYNTH_PROGRAMME_SAMPLE_RATE     48000
+
+typedef enum
+{
+    SYNTH_CONTENT_CONFORMANCE,              /**< the programme of the conformance tests */
+    SYNTH_CONTENT_BROADCAST                 /**< pink noise steps, dialogue, transients and silence */
+} synth_content;
+
+typedef struct
+{
+    int             channels;
+    int             lfe_channel;            /**< -1 for none */
+    uint32_t        sample_rate;
+    synth_content   content;
+} synth_programme_config;
+
+typedef struct
+{
+    int             channels;
+    int             lfe_channel;
+    int             dialogue_channel;       /**< -1 puts dialogue on every channel */
+    double          sample_rate;
+    synth_content   content;
+    uint32_t        noise;                  /**< LCG state */
+    uint64_t        frame;
+    double          lowpass[DLB_MD_EMUL_MAX_CHANS];
+    double          pink[DLB_MD_EMUL_MAX_CHANS][3];
+} synth_programme;
+
+/* Conformance programme at 48 kHz, channel 3 is the LFE */
+void synth_programme_init(synth_programme *synth, int channels, uint32_t seed);
+
+void synth_programme_open(synth_programme *synth, const synth_programme_config *config, uint32_t seed);
+
+/* Render the next frames, interleaved */
+void synth_programme_render(synth_programme *synth, DLB_LFRACT *out, uint32_t frames);
+
+#endif /* SYNTH_PROGRAMME_H */
@@ -0,0 +1,231 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Per-block DRC trace of an emulator handle and the trace file writer
+ *
+ * Runs the conformance programme through two outputs (line and RF) with the
+ * trace handed to both an in-memory collector and a trace_writer with small
+ * buffers, so the emulator overtakes the writer thread. Checks that every
+ * block is traced once and in order, that the gain computer values are
+ * consistent with each other and with the emitted dynrng and compr words,
+ * that the applied line mode gain follows dynrng, and that the file holds
+ * exactly the collected records.
+ *
+ * Exit codes: 0 pass, 1 mismatch.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+#include "dlb_md_emul_trace.h"
+#include "emul_fixture.h"
+#include "trace_writer.h"
+
+#define TRACE_FILE          "mdemu_trace_test.bin"
+
+typedef struct
+{
+    std::vector<dlb_md_emul_trace_record_t> records;
+    trace_writer                           *writer;
+} trace_collector;
+
+static void collect(void *context, const dlb_md_emul_trace_record_t *record)
+{
+    trace_collector *c = (trace_collector *)context;
+
+    c->records.push_back(*record);
+    if (c->writer)
+    {
+        trace_writer_record(c->writer, record);
+    }
+}
+
+/* dynrng: 3 bit exponent, 5 bit mantissa; compr: 4 bit exponent, 4 bit mantissa */
+static double dynrng_db(int code)
+{
+    int x = (code >> 5) & 7;
+
+    x = x > 3 ? x - 8 : x;
+    return 20.0 * std::log10(std::ldexp((32.0 + (code & 31)) / 64.0, x + 1));
+}
+
+static double compr_db(int code)
+{
+    int x = (code >> 4) & 15;
+
+    x = x > 7 ? x - 16 : x;
+    return 20.0 * std::log10(std::ldexp((16.0 + (code & 15)) / 32.0, x + 1));
+}
+
+static void check_records(const std::vector<dlb_md_emul_trace_record_t> &records)
+{
+    double max_dynrng_err = 0.0, max_compr_err = 0.0, max_applied_err = 0.0;
+    bool in_order = true, flags = true, limits = true, frame_gain = true, holds = true;
+
+    for (size_t b = 0; b < records.size(); b++)
+    {
+        const dlb_md_emul_trace_record_t *r = &records[b];
+        size_t first = b - b % FIXTURE_CALL_BLOCKS;
+        double lowest = r->compr_gain_db;
+        double compr_gain;
+
+        in_order = in_order && r->block_index == b && r->num_outputs == 2;
+        flags = flags && r->flags == (DLB_MD_EMUL_TRACE_DRC_CALC | DLB_MD_EMUL_TRACE_DECODER);
+        holds = holds && r->dyn_hold >= 0 && r->dlim_hold >= 0 && r->compr_hold >= 0 && r->clim_hold >= 0;
+        limits = limits && r->dyn_gain_db <= 24.0 && r->dlim_gain_db <= 24.0 && r->compr_gain_db <= 24.0 && r->clim_gain_db <= 24.0;
+
+        /* The compr word goes with the frame, the lowest gain of its blocks, scaled separately */
+        for (size_t i = first; i < first + FIXTURE_CALL_BLOCKS && i < records.size(); i++)
+        {
+            lowest = std::min(lowest, records[i].compr_gain_db);
+        }
+        if (first + FIXTURE_CALL_BLOCKS <= records.size())
+        {
+            frame_gain = frame_gain && std::fabs(r->compr_frame_gain_db - lowest) < 1e-3;
+        }
+
+        /*
+         * The words carry the gain after clip protection, quantised down by
+         * less than one mantissa step. The first compr step above 0 dB is
+         * sent as 0xFF, -0.28 dB.
+         */
+        compr_gain = std::min(r->compr_frame_gain_db, r->clim_gain_db);
+        if (r->compr_code == 0xFF && compr_gain >= 0.0)
+        {
+            compr_gain = compr_db(0xFF);
+        }
+        max_dynrng_err = std::max(max_dynrng_err, std::fabs(dynrng_db(r->dynrng_code) - std::min(r->dyn_gain_db, r->dlim_gain_db)));
+        max_compr_err = std::max(max_compr_err, std::fabs(compr_db(r->compr_code) - compr_gain));
+
+        /* dialnorm 31 adds nothing, the line mode window ends on the dynrng gain */
+        max_applied_err = std::max(max_applied_err, std::fabs(20.0 * std::log10(r->applied_gain[0]) - dynrng_db(r->dynrng_code)));
+    }
+    printf("%zu records, dynrng %.3f dB, compr %.3f dB, applied %.3f dB off\n",
+           records.size(), max_dynrng_err, max_compr_err, max_applied_err);
+
+    check(records.size() == (size_t)FIXTURE_CALLS * FIXTURE_CALL_BLOCKS, "one record per block");
+    check(in_order, "block index and outputs");
+    check(flags, "flags");
+    check(holds, "hold counters");
+    check(limits, "gain range");
+    check(frame_gain, "frame compr gain is the lowest of its blocks");
+    check(max_dynrng_err < 0.3, "dynrng word follows the DRC gain");
+    check(max_compr_err < 0.55, "compr word follows the compr gain");
+    check(max_applied_err < 0.6, "applied line mode gain follows dynrng");
+}
+
+static void check_file(const std::vector<dlb_md_emul_trace_record_t> &records, uint64_t written)
+{
+    dlb_md_emul_trace_file_header_t header;
+    std::vector<dlb_md_emul_trace_record_t> read(records.size() + 1);
+    FILE *f = fopen(TRACE_FILE, "rb");
+    size_t num_read;
+
+    check(f != nullptr, "trace file opened");
+    if (!f)
+    {
+        return;
+    }
+    check(fread(&header, sizeof(header), 1, f) == 1, "file header read");
+    check(header.magic == DLB_MD_EMUL_TRACE_MAGIC && header.version == DLB_MD_EMUL_TRACE_VERSION
+          && header.record_size == sizeof(dlb_md_emul_trace_record_t), "file header");
+    num_read = fread(read.data(), sizeof(dlb_md_emul_trace_record_t), read.size(), f);
+    fclose(f);
+    remove(TRACE_FILE);
+
+    check(written == records.size() && num_read == records.size(), "every record written");
+    check(num_read == records.size()
+          && !memcmp(read.data(), records.data(), records.size() * sizeof(dlb_md_emul_trace_record_t)), "file holds the records");
+}
+
+int main(void)
+{
+    dlb_md_emul_process_config_t emul_conf;
+    md_emul_instance             emul = {};
+    synth_programme              synth;
+    std::vector<DLB_LFRACT>      main_buf(FIXTURE_BUFFER_SIZE);
+    std::vector<DLB_LFRACT>      aux_buf(FIXTURE_BUFFER_SIZE);
+    trace_writer                 writer = {};
+    trace_collector              collector;
+    size_t                       traced;
+
+    try
+    {
+        md_emul_instance_open(&emul);
+        fixture_config(&emul_conf);
+        emul_conf.pa_in_data[0] = main_buf.data();
+        emul_conf.pa_in_data[1] = aux_buf.data();
+        synth_programme_init(&synth, FIXTURE_CHANNELS, 1);
+
+        /* Buffers of 7 records keep the emulator waiting on the writer thread now and then */
+        trace_writer_open(&writer, TRACE_FILE, 7, 2);
+        collector.writer = &writer;
+        check(dlb_md_emul_set_trace(nullptr, collect, &collector) != 0, "NULL handle rejected");
+        check(dlb_md_emul_set_trace(&emul.hdl, collect, &collector) == 0, "trace set");
+
+        fixture_run_calls(&emul, &synth, &emul_conf, FIXTURE_CALLS);
+        trace_writer_close(&writer);
+        check_records(collector.records);
+        check_file(collector.records, writer.records);
+
+        check(dlb_md_emul_set_trace(&emul.hdl, nullptr, nullptr) == 0, "trace removed");
+        traced = collector.records.size();
+        fixture_run_calls(&emul, &synth, &emul_conf, 10);
+        check(collector.records.size() == traced, "nothing traced after removing it");
+
+        /* Setting it again starts the block index over */
+        collector.writer = nullptr;
+        collector.records.clear();
+        dlb_md_emul_set_trace(&emul.hdl, collect, &collector);
+        fixture_run_calls(&emul, &synth, &emul_conf, 1);
+        check(collector.records.size() == FIXTURE_CALL_BLOCKS && collector.records[0].block_index == 0, "block index starts over");
+        dlb_md_emul_set_trace(&emul.hdl, nullptr, nullptr);
+
+        md_emul_instance_close(&emul);
+    }
+    catch (const std::exception &e)
+    {
+        printf("FAIL %s\n", e.what());
+        md_emul_instance_close(&emul);
+        return 1;
+    }
+
+    return check_result();
+}
@@ -0,0 +1,217 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  x86 SIMD dsplib kernels against the generic loops
+ *
+ * Runs every vector kernel of each instruction set the processor supports on
+ * lengths around the vector widths, several strides and inputs with signed
+ * zeros, ties and negative peaks, and compares with the generic kernels. The
+ * abs max and multiply kernels must be bit-exact; the dot product sums in
+ * another order and is checked against a relative bound.
+ *
+ * Exit codes: 0 pass, 1 mismatch, 77 SIMD backend not built in.
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "dlb_dsplib/blk.h"
+
+#ifdef DLB_VEC_X86_SIMD_ACTIVE
+
+typedef struct
+{
+    const char *name;
+    void      (*fill)(std::vector<DLB_LFRACT> *buf, uint32_t seed);
+} vec_pattern;
+
+static void fill_noise(std::vector<DLB_LFRACT> *buf, uint32_t seed)
+{
+    for (DLB_LFRACT &x : *buf)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        x = 0.5 * ((double)(int32_t)seed / 2147483648.0);
+    }
+}
+
+/* Noise with the peak negative and once more positive: the abs max ties */
+static void fill_ties(std::vector<DLB_LFRACT> *buf, uint32_t seed)
+{
+    fill_noise(buf, seed);
+    (*buf)[buf->size() / 2] = -0.75;
+    (*buf)[buf->size() - 1] = 0.75;
+}
+
+static void fill_negative(std::vector<DLB_LFRACT> *buf, uint32_t seed)
+{
+    fill_noise(buf, seed);
+    for (DLB_LFRACT &x : *buf)
+    {
+        x = -std::fabs(x);
+    }
+}
+
+/* Digital silence of both signs, the abs max result depends on the order */
+static void fill_zeros(std::vector<DLB_LFRACT> *buf, uint32_t seed)
+{
+    for (DLB_LFRACT &x : *buf)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        x = (seed & 0x10000) ? -0.0 : 0.0;
+    }
+}
+
+static const vec_pattern patterns[] =
+{
+    { "noise",    fill_noise },
+    { "ties",     fill_ties },
+    { "negative", fill_negative },
+    { "zeros",    fill_zeros },
+};
+
+static const unsigned lengths[] = { 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 32, 33, 63, 256, 257 };
+static const unsigned strides[] = { 1, 2, 3, 6, 8 };
+
+static bool same_bits(DLB_LFRACT a, DLB_LFRACT b)
+{
+    return !memcmp(&a, &b, sizeof(a));
+}
+
+static int check_isa(dlb_vec_isa isa)
+{
+    const char *name = dlb_vec_x86_isa_name(isa);
+    int         failures = 0;
+
+    for (const vec_pattern &p : patterns)
+    {
+        for (unsigned n : lengths)
+        {
+            for (unsigned stride : strides)
+            {
+                std::vector<DLB_LFRACT> a((size_t)n * stride), b(a.size());
+                std::vector<DLB_LFRACT> ref(n), out(n);
+                DLB_LFRACT              ref_max, max, ref_smax, smax;
+                DLB_NACCU               ref_dot, dot;
+                std::string             what = std::string(name) + " " + p.name + " n=" + std::to_string(n) +
+                                               " stride=" + std::to_string(stride);
+
+                p.fill(&a, 1 + n * 7 + stride);
+                fill_noise(&b, 2 + n);
+
+                dlb_vec_x86_select(DLB_VEC_ISA_GENERIC);
+                ref_max = DLB_vec_Labs_maxLU(a.data(), n);
+                ref_smax = DLB_vec_Labs_max_strideLUU(a.data(), stride, n);
+                ref_dot = DLB_vec_NdotLLU(a.data(), b.data(), n);
+
+                dlb_vec_x86_select(isa);
+                max = DLB_vec_Labs_maxLU(a.data(), n);
+                smax = DLB_vec_Labs_max_strideLUU(a.data(), stride, n);
+                dot = DLB_vec_NdotLLU(a.data(), b.data(), n);
+
+                if (!same_bits(ref_max, max) || !same_bits(ref_smax, smax))
+                {
+                    printf("FAIL abs max %s: %.17g %.17g, generic %.17g %.17g\n", what.c_str(), max, smax, ref_max, ref_smax);
+                    failures++;
+                }
+                if (std::fabs(dot - ref_dot) > 1e-12 * (1.0 + std::fabs(ref_dot)) * n)
+                {
+                    printf("FAIL dot %s: %.17g, generic %.17g\n", what.c_str(), dot, ref_dot);
+                    failures++;
+                }
+                if (stride != 1)
+                {
+                    continue;
+                }
+
+                dlb_vec_x86_select(DLB_VEC_ISA_GENERIC);
+                DLB_vec_LmaskLSU(ref.data(), a.data(), b.data(), n);
+                dlb_vec_x86_select(isa);
+                DLB_vec_LmaskLSU(out.data(), a.data(), b.data(), n);
+                if (memcmp(ref.data(), out.data(), n * sizeof(DLB_LFRACT)))
+                {
+                    printf("FAIL mask %s\n", what.c_str());
+                    failures++;
+                }
+
+                dlb_vec_x86_select(DLB_VEC_ISA_GENERIC);
+                DLB_vec_LmpyLSU(ref.data(), a.data(), 0.3, n);
+                dlb_vec_x86_select(isa);
+                DLB_vec_LmpyLSU(out.data(), a.data(), 0.3, n);
+                if (memcmp(ref.data(), out.data(), n * sizeof(DLB_LFRACT)))
+                {
+                    printf("FAIL mpy %s\n", what.c_str());
+                    failures++;
+                }
+
+                out = a;
+                DLB_vec_LmpyLSU_inplace(out.data(), 0.3, n);
+                if (memcmp(ref.data(), out.data(), n * sizeof(DLB_LFRACT)))
+                {
+                    printf("FAIL mpy in place %s\n", what.c_str());
+                    failures++;
+                }
+            }
+        }
+    }
+    printf("%-8s %s\n", name, failures ? "FAIL" : "ok");
+    return failures;
+}
+
+int main(void)
+{
+    dlb_vec_isa detected = dlb_vec_x86_detect();
+    int         failures = 0;
+
+    printf("detected %s, running %s\n", dlb_vec_x86_isa_name(detected), dlb_vec_x86_isa_name(dlb_vec_x86_active()));
+    for (int isa = DLB_VEC_ISA_SSE2; isa <= (int)detected; isa++)
+    {
+        failures += check_isa((dlb_vec_isa)isa);
+    }
+    return failures ? 1 : 0;
+}
+
+#else
+
+int main(void)
+{
+    printf("x86 SIMD dsplib backend not built in\n");
+    return 77;
+}
+
+#endif
@@ -27,8 +27,6 @@ mkdir -p test/tmp
 export source_file=test/sources/6_comp.wav
 
 comp_no=2
-pass_num=0
-fail_num=0
 
 for comp in line rf; do
 
@@ -38,17 +36,23 @@ for comp in line rf; do
 		./test/test_case51_emu.sh $source_file 7 31 $prof_no $comp_no 
 		((prof_no++))
 		for chan in 0 1 2 4 5; do
-			$gc ./test/output/6_comp.emu."$chan".res ./test/reference/"$comp"_"$prof"_"$chan".res -max 1.6 -dev 0.6
-			if [ $? -eq "0" ]; then
-				((pass_num++))
-			else
-				((fail_num++))
-			fi
+			mv ./test/output/6_comp.emu."$chan".res ./test/output/"$comp"_"$prof"_"$chan".res
+			echo ./test/output/"$comp"_"$prof"_"$chan".res ./test/reference/"$comp"_"$prof"_"$chan".res >> test/tmp/pairs.txt
 		done
 	done
 	((comp_no++))
 done
 
+# One graph_check run compares every curve, test/output/report.xml is a JUnit report for CI
+$gc -batch test/tmp/pairs.txt -max 1.6 -dev 0.6 -json test/output/report.json -junit test/output/report.xml | tee test/tmp/graph_check.txt
+gc_status=${PIPESTATUS[0]}
+pass_num=`grep -c "^Pass " test/tmp/graph_check.txt`
+fail_num=`grep -c "^Fail " test/tmp/graph_check.txt`
+if [ $gc_status -gt 1 ]; then
+	# the pair list itself could not be processed
+	((fail_num++))
+fi
+
 echo "Number of passes: " $pass_num
 echo "Number of failures: " $fail_num
 if [ $fail_num -eq "0" ]; then
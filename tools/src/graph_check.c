@@ -42,6 +42,8 @@
 #include <stdlib.h>
 #include <math.h>
 
+#include "graph_check_batch.h"
+
 void print_usage(void);
 
 
@@ -69,6 +71,10 @@ int main(int argc, char *argv[])
     unsigned int expect_num_comp = 0;
     int num_comp = 0;
     int min_num_comp = 0;
+    char batch_file[1024] = "\0";
+    char *json_file = NULL, *junit_file = NULL;
+    int num_threads = 0;
+    graph_check_limits limits;
 
     for (i = 1 ; i < argc ; i++)
     {
@@ -204,6 +210,71 @@ int main(int argc, char *argv[])
             verbose_mode = 1;
         }
 
+        if (!strcmp(argv[i],"-q"))
+        {
+            quiet_mode = 1;
+        }
+
+        if (!strcmp(argv[i],"-batch") || !strcmp(argv[i],"-j") ||
+            !strcmp(argv[i],"-json") || !strcmp(argv[i],"-junit"))
+        {
+            if (i == (argc - 1))
+            {
+                print_usage();
+                fprintf(stderr, "Error: Can't find %s value\n", argv[i]);
+                exit(-1);
+            }
+            if (!strcmp(argv[i],"-batch"))
+            {
+                strncpy(batch_file, argv[i+1], sizeof(batch_file) - 1);
+            }
+            else if (!strcmp(argv[i],"-j"))
+            {
+                num_threads = atoi(argv[i+1]);
+            }
+            else if (!strcmp(argv[i],"-json"))
+            {
+                json_file = argv[i+1];
+            }
+            else
+            {
+                junit_file = argv[i+1];
+            }
+            // We increment i here to step over the next parameter
+            // which has been parsed as the value
+            i++;
+        }
+
+    }
+
+    // Batch mode compares the pairs of a list with the dual file mode limits
+    if (strlen(batch_file) > 0)
+    {
+        if (strlen(filename1) > 0)
+        {
+            print_usage();
+            fprintf(stderr, "Error: Files are taken from the batch list\n");
+            exit(-2);
+        }
+        if (!(min_enabled || max_enabled || total_enabled))
+        {
+            fprintf(stderr,"Max, Min or Max average levels must be specified in batch mode\n");
+            print_usage();
+            exit(-3);
+        }
+        limits.min = min;
+        limits.max = max;
+        limits.total = total;
+        limits.xmin = xmin;
+        limits.xmax = xmax;
+        limits.min_enabled = min_enabled;
+        limits.max_enabled = max_enabled;
+        limits.total_enabled = total_enabled;
+        limits.xmin_enabled = xmin_enabled;
+        limits.xmax_enabled = xmax_enabled;
+        limits.expect_num_comp = expect_num_comp;
+        limits.min_num_comp = min_num_comp;
+        return graph_check_batch(batch_file, &limits, num_threads, json_file, junit_file, quiet_mode);
     }
 
     // Check for condition where no filenames were specified
@@ -495,7 +566,14 @@ void print_usage(void)
     fprintf(stderr,"-min <min_val>,            minimum deviation of 2nd columns\n");
     fprintf(stderr,"-max <max_val>,            maximum deviation of 2nd columns\n");
     fprintf(stderr,"-dev,                      maximum average deviation\n");
-    fprintf(stderr,"-v,                        verbose mode\n\n");
+    fprintf(stderr,"-v,                        verbose mode\n");
+    fprintf(stderr,"-q,                        quiet mode\n");
+    fprintf(stderr,"Batch Mode (dual file mode limits for every pair):\n");
+    fprintf(stderr,"-batch <list>,             file with one \"FILE1 FILE2\" pair per line, - for stdin;\n");
+    fprintf(stderr,"                           \"dir1/*.res dir2/*.res\" pairs files by the * text\n");
+    fprintf(stderr,"-j <threads>,              pairs compared in parallel, default one per processor\n");
+    fprintf(stderr,"-json <file>,              write a JSON report\n");
+    fprintf(stderr,"-junit <file>,             write a JUnit XML report\n\n");
     fprintf(stderr,"This tools is intended to operate on the standard output of the SATS tools\n");
     fprintf(stderr,"The standard output of the SATS tools when used in text mode should be\n");
     fprintf(stderr,"redirected to a file. These files can be specified in the command line\n");
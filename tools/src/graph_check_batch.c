@@ -0,0 +1,640 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Batch mode of graph_check: many file pairs, one process, one report
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define GRAPH_CHECK_POSIX
+#include <glob.h>
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#include "graph_check_batch.h"
+
+#define MAX_NAME        1024
+#define MAX_MESSAGE     (MAX_NAME + 256)
+
+typedef struct
+{
+    char            file1[MAX_NAME];
+    char            file2[MAX_NAME];
+    int             passed;
+    int             error;              /* a file could not be read */
+    unsigned int    num_comp;
+    unsigned int    x_mismatches;
+    double          max_deviation;
+    double          mean_deviation;
+    char            message[MAX_MESSAGE];   /* first violation or the error */
+} pair_result;
+
+typedef struct
+{
+    double         *x;
+    double         *y;
+    unsigned int    count;
+} res_curve;
+
+typedef struct
+{
+    pair_result                *results;
+    unsigned int                num_pairs;
+    unsigned int                next;
+    const graph_check_limits   *limits;
+#ifdef GRAPH_CHECK_POSIX
+    pthread_mutex_t             lock;
+#endif
+} batch_queue;
+
+static const double pow10_table[] =
+{
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/*
+ * Parse a decimal number. Up to 15 significant digits and 22 fraction
+ * digits the mantissa and the power of ten are exact, so one division gives
+ * the correctly rounded value, the same as strtod; anything else goes to strtod.
+ */
+static const char *parse_number(const char *p, double *value)
+{
+    const char *start = p;
+    unsigned long long mantissa = 0;
+    int digits = 0, fraction = 0, negative = 0;
+
+    if (*p == '-' || *p == '+')
+    {
+        negative = (*p == '-');
+        p++;
+    }
+    for (; *p >= '0' && *p <= '9'; p++, digits++)
+    {
+        mantissa = mantissa * 10 + (unsigned long long)(*p - '0');
+    }
+    if (*p == '.')
+    {
+        for (p++; *p >= '0' && *p <= '9'; p++, digits++, fraction++)
+        {
+            mantissa = mantissa * 10 + (unsigned long long)(*p - '0');
+        }
+    }
+    if (digits == 0)
+    {
+        return NULL;
+    }
+    if (*p == 'e' || *p == 'E' || digits > 15 || fraction > 22)
+    {
+        char *end;
+
+        *value = strtod(start, &end);
+        return end;
+    }
+    *value = (double)mantissa / pow10_table[fraction];
+    if (negative)
+    {
+        *value = -*value;
+    }
+    return p;
+}
+
+static int is_space(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+/* Read a whole "x, y" per line file; returns the failing line, 0 on success */
+static unsigned int load_curve(const char *filename, res_curve *curve, char *message)
+{
+    FILE *fid = fopen(filename, "rb");
+    char *text, *p;
+    long size;
+    unsigned int capacity = 0;
+
+    curve->x = NULL;
+    curve->y = NULL;
+    curve->count = 0;
+    if (fid == NULL)
+    {
+        snprintf(message, MAX_MESSAGE, "File %s not found", filename);
+        return 1;
+    }
+    fseek(fid, 0, SEEK_END);
+    size = ftell(fid);
+    fseek(fid, 0, SEEK_SET);
+    text = malloc((size_t)size + 1);
+    if (text == NULL || fread(text, 1, (size_t)size, fid) != (size_t)size)
+    {
+        snprintf(message, MAX_MESSAGE, "Cannot read %s", filename);
+        free(text);
+        fclose(fid);
+        return 1;
+    }
+    fclose(fid);
+    text[size] = '\0';
+
+    p = text;
+    for (;;)
+    {
+        double x, y;
+
+        while (is_space(*p))
+        {
+            p++;
+        }
+        if (*p == '\0')
+        {
+            break;
+        }
+        // same fields as the %s%s of dual file mode: "x," then "y"
+        p = (char *)parse_number(p, &x);
+        if (p != NULL && *p == ',')
+        {
+            p++;
+        }
+        while (p != NULL && is_space(*p))
+        {
+            p++;
+        }
+        p = p ? (char *)parse_number(p, &y) : NULL;
+        if (p == NULL)
+        {
+            snprintf(message, MAX_MESSAGE, "Formatting problem in %s at line %u", filename, curve->count + 1);
+            free(text);
+            return curve->count + 1;
+        }
+        while (*p != '\0' && !is_space(*p))
+        {
+            p++;
+        }
+        if (curve->count == capacity)
+        {
+            capacity = capacity ? 2 * capacity : 1024;
+            curve->x = realloc(curve->x, capacity * sizeof(double));
+            curve->y = realloc(curve->y, capacity * sizeof(double));
+        }
+        curve->x[curve->count] = x;
+        curve->y[curve->count] = y;
+        curve->count++;
+    }
+    free(text);
+    return 0;
+}
+
+static void free_curve(res_curve *curve)
+{
+    free(curve->x);
+    free(curve->y);
+}
+
+static void fail(pair_result *result, const char *message)
+{
+    if (result->passed)
+    {
+        snprintf(result->message, MAX_MESSAGE, "%s", message);
+    }
+    result->passed = 0;
+}
+
+/* The checks of dual file mode for one pair */
+static void compare_pair(const graph_check_limits *limits, pair_result *result)
+{
+    res_curve curve1 = { NULL, NULL, 0 }, curve2 = { NULL, NULL, 0 };
+    char message[MAX_MESSAGE];
+    double total_deviation = 0.0;
+    unsigned int i;
+
+    result->passed = 1;
+    result->message[0] = '\0';
+
+    if (load_curve(result->file1, &curve1, result->message) ||
+        load_curve(result->file2, &curve2, result->message))
+    {
+        free_curve(&curve1);
+        free_curve(&curve2);
+        result->passed = 0;
+        result->error = 1;
+        return;
+    }
+    if (curve2.count < curve1.count)
+    {
+        snprintf(result->message, MAX_MESSAGE, "Formatting problem in %s at line %u", result->file2, curve2.count + 1);
+        result->passed = 0;
+        result->error = 1;
+    }
+
+    for (i = 0; !result->error && i < curve1.count; i++)
+    {
+        double x1 = curve1.x[i], y1 = curve1.y[i];
+        double deviation = fabs(y1 - curve2.y[i]);
+
+        if ((!limits->xmin_enabled || (x1 >= limits->xmin)) &&
+            (!limits->xmax_enabled || (x1 <= limits->xmax)))
+        {
+            total_deviation += deviation;
+            if (deviation > result->max_deviation)
+            {
+                result->max_deviation = deviation;
+            }
+            if (x1 != curve2.x[i])
+            {
+                result->x_mismatches++;
+            }
+            if (limits->min_enabled && (deviation < limits->min))
+            {
+                snprintf(message, sizeof(message), "Min. deviation limit of %3.2f violated by %3.2f and %3.2f at line %u",
+                         limits->min, y1, curve2.y[i], i + 1);
+                fail(result, message);
+            }
+            if (limits->max_enabled && (deviation > limits->max))
+            {
+                snprintf(message, sizeof(message), "Max. deviation limit of %3.2f violated by %3.2f and %3.2f at line %u",
+                         limits->max, y1, curve2.y[i], i + 1);
+                fail(result, message);
+            }
+            result->num_comp++;
+        }
+    }
+
+    if (!result->error)
+    {
+        // scaled by the final line number as in dual file mode
+        result->mean_deviation = total_deviation / (double)(curve1.count + 1);
+        if (limits->total_enabled && (result->mean_deviation > limits->total))
+        {
+            snprintf(message, sizeof(message), "Average deviation of %3.2f violates maximum limit of %3.2f",
+                     result->mean_deviation, limits->total);
+            fail(result, message);
+        }
+        if ((limits->expect_num_comp > 0) && (limits->expect_num_comp != result->num_comp))
+        {
+            snprintf(message, sizeof(message), "%u Comparisons made doesn't match expected value of %u",
+                     result->num_comp, limits->expect_num_comp);
+            fail(result, message);
+        }
+        if ((int)result->num_comp < limits->min_num_comp)
+        {
+            snprintf(message, sizeof(message), "%u comparisons violates minimum value of %u",
+                     result->num_comp, limits->min_num_comp);
+            fail(result, message);
+        }
+    }
+    free_curve(&curve1);
+    free_curve(&curve2);
+}
+
+static void *compare_worker(void *arg)
+{
+    batch_queue *queue = (batch_queue *)arg;
+
+    for (;;)
+    {
+        unsigned int pair;
+
+#ifdef GRAPH_CHECK_POSIX
+        pthread_mutex_lock(&queue->lock);
+#endif
+        pair = queue->next++;
+#ifdef GRAPH_CHECK_POSIX
+        pthread_mutex_unlock(&queue->lock);
+#endif
+        if (pair >= queue->num_pairs)
+        {
+            return NULL;
+        }
+        compare_pair(queue->limits, &queue->results[pair]);
+    }
+}
+
+static int add_pair(pair_result **results, unsigned int *num_pairs, unsigned int *capacity,
+                    const char *file1, const char *file2)
+{
+    pair_result *result;
+
+    if (strlen(file1) >= MAX_NAME || strlen(file2) >= MAX_NAME)
+    {
+        fprintf(stderr, "Error: File name too long\n");
+        return -1;
+    }
+    if (*num_pairs == *capacity)
+    {
+        *capacity = *capacity ? 2 * *capacity : 64;
+        *results = realloc(*results, *capacity * sizeof(pair_result));
+    }
+    result = &(*results)[(*num_pairs)++];
+    memset(result, 0, sizeof(*result));
+    strcpy(result->file1, file1);
+    strcpy(result->file2, file2);
+    return 0;
+}
+
+/* Pair every match of pattern1 with pattern2, its '*' replaced by the matched text */
+static int add_glob(pair_result **results, unsigned int *num_pairs, unsigned int *capacity,
+                    const char *pattern1, const char *pattern2)
+{
+#ifdef GRAPH_CHECK_POSIX
+    const char *star1 = strchr(pattern1, '*');
+    const char *star2 = strchr(pattern2, '*');
+    size_t prefix = (size_t)(star1 - pattern1);
+    size_t suffix = strlen(star1 + 1);
+    glob_t matches;
+    size_t m;
+    int err = 0;
+
+    if (star1 == NULL || star2 == NULL || strchr(star1 + 1, '*') || strchr(star2 + 1, '*'))
+    {
+        fprintf(stderr, "Error: Glob pairs need exactly one '*' in each name: %s %s\n", pattern1, pattern2);
+        return -1;
+    }
+    if (glob(pattern1, 0, NULL, &matches) != 0)
+    {
+        fprintf(stderr, "Error: No files match %s\n", pattern1);
+        return -1;
+    }
+    for (m = 0; !err && m < matches.gl_pathc; m++)
+    {
+        const char *match = matches.gl_pathv[m];
+        size_t stem = strlen(match) - prefix - suffix;
+        char file2[MAX_NAME];
+
+        if (strlen(pattern2) + stem >= MAX_NAME)
+        {
+            fprintf(stderr, "Error: File name too long\n");
+            err = -1;
+            break;
+        }
+        snprintf(file2, sizeof(file2), "%.*s%.*s%s", (int)(star2 - pattern2), pattern2,
+                 (int)stem, match + prefix, star2 + 1);
+        err = add_pair(results, num_pairs, capacity, match, file2);
+    }
+    globfree(&matches);
+    return err;
+#else
+    (void)results; (void)num_pairs; (void)capacity; (void)pattern2;
+    fprintf(stderr, "Error: Globs are not supported on this platform: %s\n", pattern1);
+    return -1;
+#endif
+}
+
+static void write_escaped(FILE *fid, const char *text, int xml)
+{
+    for (; *text; text++)
+    {
+        if (xml && *text == '&')
+        {
+            fputs("&amp;", fid);
+        }
+        else if (xml && *text == '<')
+        {
+            fputs("&lt;", fid);
+        }
+        else if (xml && *text == '>')
+        {
+            fputs("&gt;", fid);
+        }
+        else if (*text == '"')
+        {
+            fputs(xml ? "&quot;" : "\\\"", fid);
+        }
+        else if (!xml && *text == '\\')
+        {
+            fputs("\\\\", fid);
+        }
+        else
+        {
+            fputc(*text, fid);
+        }
+    }
+}
+
+static int write_json(const char *filename, const pair_result *results, unsigned int num_pairs, unsigned int failed)
+{
+    FILE *fid = fopen(filename, "w");
+    unsigned int i;
+
+    if (fid == NULL)
+    {
+        fprintf(stderr, "Error: Cannot write %s\n", filename);
+        return -1;
+    }
+    fprintf(fid, "{\n  \"pairs\": %u,\n  \"passed\": %u,\n  \"failed\": %u,\n  \"results\": [\n",
+            num_pairs, num_pairs - failed, failed);
+    for (i = 0; i < num_pairs; i++)
+    {
+        const pair_result *r = &results[i];
+
+        fputs("    { \"file1\": \"", fid);
+        write_escaped(fid, r->file1, 0);
+        fputs("\", \"file2\": \"", fid);
+        write_escaped(fid, r->file2, 0);
+        fprintf(fid, "\", \"result\": \"%s\", \"comparisons\": %u, \"max_deviation\": %.4f, "
+                "\"mean_deviation\": %.6f, \"x_mismatches\": %u, \"message\": \"",
+                r->passed ? "Pass" : (r->error ? "Error" : "Fail"), r->num_comp,
+                r->max_deviation, r->mean_deviation, r->x_mismatches);
+        write_escaped(fid, r->message, 0);
+        fprintf(fid, "\" }%s\n", (i + 1 < num_pairs) ? "," : "");
+    }
+    fputs("  ]\n}\n", fid);
+    fclose(fid);
+    return 0;
+}
+
+static int write_junit(const char *filename, const pair_result *results, unsigned int num_pairs)
+{
+    FILE *fid = fopen(filename, "w");
+    unsigned int i, failures = 0, errors = 0;
+
+    if (fid == NULL)
+    {
+        fprintf(stderr, "Error: Cannot write %s\n", filename);
+        return -1;
+    }
+    for (i = 0; i < num_pairs; i++)
+    {
+        errors += results[i].error;
+        failures += !results[i].passed && !results[i].error;
+    }
+    fprintf(fid, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
+    fprintf(fid, "<testsuite name=\"graph_check\" tests=\"%u\" failures=\"%u\" errors=\"%u\">\n",
+            num_pairs, failures, errors);
+    for (i = 0; i < num_pairs; i++)
+    {
+        const pair_result *r = &results[i];
+
+        fputs("  <testcase classname=\"graph_check\" name=\"", fid);
+        write_escaped(fid, r->file1, 1);
+        fputs("\">\n", fid);
+        fprintf(fid, "    <system-out>reference %s, max deviation %.4f, mean deviation %.6f</system-out>\n",
+                r->file2, r->max_deviation, r->mean_deviation);
+        if (!r->passed)
+        {
+            fprintf(fid, "    <%s message=\"", r->error ? "error" : "failure");
+            write_escaped(fid, r->message, 1);
+            fputs("\"/>\n", fid);
+        }
+        fputs("  </testcase>\n", fid);
+    }
+    fputs("</testsuite>\n", fid);
+    fclose(fid);
+    return 0;
+}
+
+int graph_check_batch
+    (const char                 *list_file
+    ,const graph_check_limits   *limits
+    ,int                         num_threads
+    ,const char                 *json_file
+    ,const char                 *junit_file
+    ,int                         quiet_mode
+    )
+{
+    FILE *fid = strcmp(list_file, "-") ? fopen(list_file, "r") : stdin;
+    pair_result *results = NULL;
+    unsigned int num_pairs = 0, capacity = 0, failed = 0, i;
+    char line[3 * MAX_NAME];
+    char name1[MAX_NAME], name2[MAX_NAME];
+    batch_queue queue;
+    int err = 0;
+
+    if (fid == NULL)
+    {
+        fprintf(stderr, "Error: File %s not found\n", list_file);
+        return -4;
+    }
+    while (!err && fgets(line, sizeof(line), fid))
+    {
+        if (sscanf(line, "%1023s %1023s", name1, name2) != 2 || name1[0] == '#')
+        {
+            if (sscanf(line, "%1023s", name1) == 1 && name1[0] != '#')
+            {
+                fprintf(stderr, "Error: Expected two file names in %s: %s", list_file, line);
+                err = -6;
+            }
+            continue;
+        }
+        if (strchr(name1, '*'))
+        {
+            err = add_glob(&results, &num_pairs, &capacity, name1, name2);
+        }
+        else
+        {
+            err = add_pair(&results, &num_pairs, &capacity, name1, name2);
+        }
+    }
+    if (fid != stdin)
+    {
+        fclose(fid);
+    }
+    if (err || num_pairs == 0)
+    {
+        if (!err)
+        {
+            fprintf(stderr, "Error: No file pairs in %s\n", list_file);
+        }
+        free(results);
+        return err ? err : -3;
+    }
+
+    queue.results = results;
+    queue.num_pairs = num_pairs;
+    queue.next = 0;
+    queue.limits = limits;
+#ifdef GRAPH_CHECK_POSIX
+    if (num_threads <= 0)
+    {
+        num_threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    }
+    if (num_threads > (int)num_pairs)
+    {
+        num_threads = (int)num_pairs;
+    }
+    if (num_threads > 1)
+    {
+        pthread_t *threads = malloc((size_t)num_threads * sizeof(pthread_t));
+        int t;
+
+        pthread_mutex_init(&queue.lock, NULL);
+        for (t = 0; t < num_threads; t++)
+        {
+            pthread_create(&threads[t], NULL, compare_worker, &queue);
+        }
+        for (t = 0; t < num_threads; t++)
+        {
+            pthread_join(threads[t], NULL);
+        }
+        pthread_mutex_destroy(&queue.lock);
+        free(threads);
+    }
+    else
+    {
+        pthread_mutex_init(&queue.lock, NULL);
+        compare_worker(&queue);
+        pthread_mutex_destroy(&queue.lock);
+    }
+#else
+    (void)num_threads;
+    compare_worker(&queue);
+#endif
+
+    for (i = 0; i < num_pairs; i++)
+    {
+        const pair_result *r = &results[i];
+
+        failed += !r->passed;
+        if (!quiet_mode)
+        {
+            printf("%s %s %s max %.2f mean %.3f%s%s\n", r->passed ? "Pass" : "Fail", r->file1, r->file2,
+                   r->max_deviation, r->mean_deviation, r->message[0] ? ": " : "", r->message);
+        }
+    }
+    printf("Pairs: %u Passed: %u Failed: %u\n", num_pairs, num_pairs - failed, failed);
+    printf("%s\n", failed ? "Fail" : "Pass");
+
+    if ((json_file && write_json(json_file, results, num_pairs, failed)) ||
+        (junit_file && write_junit(junit_file, results, num_pairs)))
+    {
+        free(results);
+        return -10;
+    }
+    free(results);
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,78 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Batch mode of graph_check: many file pairs, one process, one report
+ */
+
+#ifndef GRAPH_CHECK_BATCH_H
+#define GRAPH_CHECK_BATCH_H
+
+/* Limits of dual file mode, applied to every pair */
+typedef struct
+{
+    double          min;
+    double          max;
+    double          total;          /**< maximum average deviation */
+    double          xmin;
+    double          xmax;
+    int             min_enabled;
+    int             max_enabled;
+    int             total_enabled;
+    int             xmin_enabled;
+    int             xmax_enabled;
+    unsigned int    expect_num_comp;
+    int             min_num_comp;
+} graph_check_limits;
+
+/*
+ * Compare every pair of the list file ("-" reads stdin). Each line holds two
+ * file names; a line whose names both contain one '*' is a glob, pairing each
+ * match of the first with the second name with '*' replaced by the same text.
+ * Blank lines and lines starting with '#' are skipped.
+ *
+ * Returns 0 when every pair passes, 1 when any fails and a negative value
+ * when the list cannot be read.
+ */
+int graph_check_batch
+    (const char                 *list_file
+    ,const graph_check_limits   *limits
+    ,int                         num_threads    /* 0 uses one per processor */
+    ,const char                 *json_file      /* NULL writes no JSON report */
+    ,const char                 *junit_file     /* NULL writes no JUnit report */
+    ,int                         quiet_mode
+    );
+
+#endif /* GRAPH_CHECK_BATCH_H */
@@ -0,0 +1,209 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Command line client for the MdEmu --serve emulation service
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#define MAX_REQUEST 4096
+
+void print_usage(void);
+
+static int connect_service(const char *path)
+{
+    struct sockaddr_un addr;
+    int fd;
+
+    if (strlen(path) >= sizeof(addr.sun_path))
+    {
+        fprintf(stderr, "Error: Socket path too long\n");
+        return -1;
+    }
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || connect(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0)
+    {
+        fprintf(stderr, "Error: Cannot connect to %s\n", path);
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+        return -1;
+    }
+    return fd;
+}
+
+/* Append "\tkey=value" to the request */
+static int append_field(char *request, const char *key, const char *value)
+{
+    size_t len = strlen(request);
+
+    if (len + strlen(key) + strlen(value) + 3 >= MAX_REQUEST)
+    {
+        fprintf(stderr, "Error: Request too long\n");
+        return -1;
+    }
+    sprintf(request + len, "\t%s=%s", key, value);
+    return 0;
+}
+
+/* Join argv[first..argc) with spaces into the flags field */
+static int append_flags(char *request, int argc, char *argv[], int first)
+{
+    char flags[MAX_REQUEST] = "";
+    int i;
+
+    for (i = first; i < argc; i++)
+    {
+        if (strlen(flags) + strlen(argv[i]) + 2 >= sizeof(flags))
+        {
+            fprintf(stderr, "Error: Too many flags\n");
+            return -1;
+        }
+        if (i > first)
+        {
+            strcat(flags, " ");
+        }
+        strcat(flags, argv[i]);
+    }
+    return append_field(request, "flags", flags);
+}
+
+int main(int argc, char *argv[])
+{
+    char request[MAX_REQUEST] = "";
+    char line[MAX_REQUEST];
+    int wait_for_job = 0;
+    int result = 0;
+    int fd;
+    FILE *replies;
+
+    if (argc < 3)
+    {
+        print_usage();
+        exit(-1);
+    }
+
+    if (!strcmp(argv[2], "run") && argc >= 5)
+    {
+        strcpy(request, "RUN");
+        if (append_field(request, "input", argv[3]) || append_field(request, "output", argv[4]) ||
+            append_flags(request, argc, argv, 5))
+        {
+            exit(-1);
+        }
+        wait_for_job = 1;
+    }
+    else if (!strcmp(argv[2], "shm") && argc >= 6)
+    {
+        strcpy(request, "RUNSHM");
+        if (append_field(request, "shm", argv[3]) || append_field(request, "channels", argv[4]) ||
+            append_field(request, "frames", argv[5]) || append_flags(request, argc, argv, 6))
+        {
+            exit(-1);
+        }
+        wait_for_job = 1;
+    }
+    else if (!strcmp(argv[2], "stats") && argc == 3)
+    {
+        strcpy(request, "STATS");
+    }
+    else if (!strcmp(argv[2], "shutdown") && argc == 3)
+    {
+        strcpy(request, "SHUTDOWN");
+    }
+    else
+    {
+        print_usage();
+        exit(-1);
+    }
+
+    fd = connect_service(argv[1]);
+    if (fd < 0)
+    {
+        exit(-2);
+    }
+    strcat(request, "\n");
+    if (write(fd, request, strlen(request)) != (ssize_t)strlen(request))
+    {
+        fprintf(stderr, "Error: Request not sent\n");
+        close(fd);
+        exit(-2);
+    }
+
+    /* Print replies until the job has finished, or the single reply otherwise */
+    replies = fdopen(fd, "r");
+    while (fgets(line, sizeof(line), replies))
+    {
+        fputs(line, stdout);
+        fflush(stdout);
+        if (!strncmp(line, "ERROR", 5))
+        {
+            result = 1;
+            break;
+        }
+        if (!wait_for_job || !strncmp(line, "DONE", 4))
+        {
+            break;
+        }
+    }
+    fclose(replies);
+
+    return result;
+}
+
+void print_usage(void)
+{
+    fprintf(stderr, "mdemu_client - client for the MdEmu emulation service\n");
+    fprintf(stderr, "Usage:\n");
+    fprintf(stderr, "\tmdemu_client socket run infile outfile [MdEmu options]\n");
+    fprintf(stderr, "\tmdemu_client socket shm name channels frames [MdEmu options]\n");
+    fprintf(stderr, "\tmdemu_client socket stats\n");
+    fprintf(stderr, "\tmdemu_client socket shutdown\n");
+    fprintf(stderr, "\n");
+    fprintf(stderr, "run and shm print the job status until the job is done and return 0 on success.\n");
+    fprintf(stderr, "shm processes the POSIX shared memory object name, holding channels * frames\n");
+    fprintf(stderr, "interleaved doubles, in place.\n");
+}
@@ -0,0 +1,309 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Reference reader of the MdEmu --meter shared memory tap
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "dlb_md_emul_meter.h"
+
+#define READ_RECORDS    256
+#define POLL_NS         10000000L   /* 10 ms */
+#define DEFAULT_EVERY   19          /* blocks per line, about 0.1 s at 48 kHz */
+
+void print_usage(void);
+
+/* Sums of the blocks of one printed line */
+typedef struct
+{
+    uint32_t    blocks;
+    uint64_t    last_index;
+    uint32_t    flags;
+    uint32_t    num_outputs;
+    uint32_t    channel_mask;
+    double      peak[DLB_MD_EMUL_MAX_OUTPUTS][DLB_MD_EMUL_MAX_CHANS];
+    double      loudness_pwr;
+    double      maxmix_db;
+    double      drc_gain_db;
+    double      compr_gain_db;
+    double      applied_gain[DLB_MD_EMUL_MAX_OUTPUTS];
+} meter_line;
+
+static double now_seconds(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + 1e-9 * (double)ts.tv_nsec;
+}
+
+static double to_db(double linear)
+{
+    return linear > 1e-10 ? 20.0 * log10(linear) : -200.0;
+}
+
+/* Map the meter read-only, NULL while the emulator has not created it yet */
+static const dlb_md_emul_meter_t *attach_meter(const char *name)
+{
+    dlb_md_emul_meter_t *p_meter;
+    struct stat st;
+    void *map;
+    int fd;
+
+    fd = shm_open(name, O_RDONLY, 0);
+    if (fd < 0)
+    {
+        return NULL;
+    }
+    if (fstat(fd, &st) != 0 || st.st_size == 0)
+    {
+        close(fd);
+        return NULL;
+    }
+    map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+    {
+        return NULL;
+    }
+    if (dlb_md_emul_meter_attach(map, (size_t)st.st_size, &p_meter) != DLB_MD_EMUL_METER_OK)
+    {
+        munmap(map, (size_t)st.st_size);
+        return NULL;
+    }
+    return p_meter;
+}
+
+static void add_record(meter_line *line, const dlb_md_emul_meter_record_t *p_record)
+{
+    int output, chan;
+
+    for (output = 0; output < DLB_MD_EMUL_MAX_OUTPUTS; output++)
+    {
+        for (chan = 0; chan < DLB_MD_EMUL_MAX_CHANS; chan++)
+        {
+            if (p_record->peak[output][chan] > line->peak[output][chan])
+            {
+                line->peak[output][chan] = p_record->peak[output][chan];
+            }
+        }
+        line->applied_gain[output] = p_record->applied_gain[output];
+    }
+    line->loudness_pwr += pow(10.0, p_record->log_loudness_db / 10.0);
+    if (line->blocks == 0 || p_record->maxmix_db > line->maxmix_db)
+    {
+        line->maxmix_db = p_record->maxmix_db;
+    }
+    line->drc_gain_db   = p_record->drc_gain_db;
+    line->compr_gain_db = p_record->compr_gain_db;
+    line->last_index    = p_record->block_index;
+    line->flags         = p_record->flags;
+    line->num_outputs   = p_record->num_outputs;
+    line->channel_mask  = p_record->channel_mask;
+    line->blocks++;
+}
+
+/*
+ * block, peaks of the mapped channels in dBFS per output, then the power
+ * mean of the loudness and the highest maxmix of the line, the DRC and
+ * compr gains and the applied gain per output of its last block
+ */
+static void print_line(const meter_line *line)
+{
+    uint32_t output;
+    int chan;
+
+    printf("%10llu ", (unsigned long long)line->last_index);
+    for (output = 0; output < line->num_outputs && output < DLB_MD_EMUL_MAX_OUTPUTS; output++)
+    {
+        printf(" |");
+        for (chan = 0; chan < DLB_MD_EMUL_MAX_CHANS; chan++)
+        {
+            if (line->channel_mask & (1u << chan))
+            {
+                printf(" %6.1f", to_db(line->peak[output][chan]));
+            }
+        }
+    }
+    if (line->flags & DLB_MD_EMUL_METER_DRC_CALC)
+    {
+        printf(" | loud %6.1f maxmix %6.1f | drc %6.2f compr %6.2f",
+               10.0 * log10(line->loudness_pwr / line->blocks), line->maxmix_db,
+               line->drc_gain_db, line->compr_gain_db);
+    }
+    if (line->flags & DLB_MD_EMUL_METER_DECODER)
+    {
+        printf(" | gain");
+        for (output = 0; output < line->num_outputs && output < DLB_MD_EMUL_MAX_OUTPUTS; output++)
+        {
+            printf(" %6.2f", to_db(line->applied_gain[output]));
+        }
+    }
+    printf("\n");
+    fflush(stdout);
+}
+
+int main(int argc, char *argv[])
+{
+    static dlb_md_emul_meter_record_t records[READ_RECORDS];
+    const struct timespec poll = { 0, POLL_NS };
+    const dlb_md_emul_meter_t *p_meter = NULL;
+    meter_line line;
+    uint64_t cursor = 0;
+    uint64_t lost = 0, lost_reported = 0;
+    uint64_t total = 0, max_blocks = 0;
+    uint32_t every = DEFAULT_EVERY;
+    uint32_t num_read, i;
+    double idle_seconds = 0.0;
+    double last_activity;
+    int from_oldest = 0;
+    int arg;
+
+    if (argc < 2)
+    {
+        print_usage();
+        exit(-1);
+    }
+    for (arg = 2; arg < argc; arg++)
+    {
+        if (!strcmp(argv[arg], "-e") && arg + 1 < argc)
+        {
+            every = (uint32_t)atoi(argv[++arg]);
+        }
+        else if (!strcmp(argv[arg], "-n") && arg + 1 < argc)
+        {
+            max_blocks = (uint64_t)atoll(argv[++arg]);
+        }
+        else if (!strcmp(argv[arg], "-i") && arg + 1 < argc)
+        {
+            idle_seconds = atof(argv[++arg]);
+        }
+        else if (!strcmp(argv[arg], "-a"))
+        {
+            from_oldest = 1;
+        }
+        else
+        {
+            print_usage();
+            exit(-1);
+        }
+    }
+    if (every == 0)
+    {
+        every = 1;
+    }
+
+    /* The monitor may start before the emulator */
+    last_activity = now_seconds();
+    while (!(p_meter = attach_meter(argv[1])))
+    {
+        if (idle_seconds > 0.0 && now_seconds() - last_activity > idle_seconds)
+        {
+            fprintf(stderr, "Error: No meter %s\n", argv[1]);
+            exit(-2);
+        }
+        nanosleep(&poll, NULL);
+    }
+    if (!from_oldest)
+    {
+        dlb_md_emul_meter_get_head(p_meter, &cursor);
+    }
+
+    memset(&line, 0, sizeof(line));
+    last_activity = now_seconds();
+    while (max_blocks == 0 || total < max_blocks)
+    {
+        dlb_md_emul_meter_read(p_meter, &cursor, records, READ_RECORDS, &num_read, &lost);
+        if (lost != lost_reported)
+        {
+            fprintf(stderr, "lost %llu blocks\n", (unsigned long long)(lost - lost_reported));
+            lost_reported = lost;
+        }
+        if (num_read == 0)
+        {
+            if (idle_seconds > 0.0 && now_seconds() - last_activity > idle_seconds)
+            {
+                break;
+            }
+            nanosleep(&poll, NULL);
+            continue;
+        }
+        last_activity = now_seconds();
+
+        for (i = 0; i < num_read && (max_blocks == 0 || total < max_blocks); i++, total++)
+        {
+            add_record(&line, &records[i]);
+            if (line.blocks == every)
+            {
+                print_line(&line);
+                memset(&line, 0, sizeof(line));
+            }
+        }
+    }
+    if (line.blocks)
+    {
+        print_line(&line);
+    }
+
+    return 0;
+}
+
+void print_usage(void)
+{
+    fprintf(stderr, "mdemu_meter - follows the blocks MdEmu --meter publishes\n");
+    fprintf(stderr, "Usage:\n");
+    fprintf(stderr, "\tmdemu_meter name [-e blocks] [-n blocks] [-i seconds] [-a]\n");
+    fprintf(stderr, "\n");
+    fprintf(stderr, "\tname  shared memory object given to MdEmu --meter, e.g. /mdemu_meter\n");
+    fprintf(stderr, "\t-e    blocks per printed line [19, about 0.1 s]\n");
+    fprintf(stderr, "\t-n    stop after this many blocks\n");
+    fprintf(stderr, "\t-i    stop after this many seconds without a block [run until interrupted]\n");
+    fprintf(stderr, "\t-a    start at the oldest block still in the meter, not the next one\n");
+    fprintf(stderr, "\n");
+    fprintf(stderr, "Each line shows the last block index, the peak of every mapped channel per\n");
+    fprintf(stderr, "output in dBFS, the mean loudness and highest maxmix of the line on the\n");
+    fprintf(stderr, "compressor scale (-31 dB at the dialogue level), the DRC and compr gains and\n");
+    fprintf(stderr, "the applied gain per output of the last block in dB.\n");
+}
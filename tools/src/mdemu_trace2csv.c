@@ -0,0 +1,183 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Converts an MdEmu --trace file to CSV
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "dlb_md_emul_trace.h"
+
+#define READ_RECORDS    1024
+
+void print_usage(void);
+
+static void print_header(FILE *out)
+{
+    int output;
+
+    fprintf(out, "block,log_loudness_db,maxmix_db,dyn_state_db,dyn_gain_db,dlim_gain_db,"
+                 "compr_state_db,compr_gain_db,compr_frame_gain_db,clim_gain_db,"
+                 "dyn_hold,dlim_hold,compr_hold,clim_hold,dynrng,compr");
+    for (output = 0; output < DLB_MD_EMUL_MAX_OUTPUTS; output++)
+    {
+        fprintf(out, ",applied_gain_%d", output);
+    }
+    fprintf(out, "\n");
+}
+
+/* Fields the record does not hold are left empty */
+static void print_record(FILE *out, const dlb_md_emul_trace_record_t *p_record)
+{
+    uint32_t output;
+
+    fprintf(out, "%llu", (unsigned long long)p_record->block_index);
+    if (p_record->flags & DLB_MD_EMUL_TRACE_DRC_CALC)
+    {
+        fprintf(out, ",%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%d,%d,%d,%d,0x%02X,0x%02X",
+                p_record->log_loudness_db, p_record->maxmix_db,
+                p_record->dyn_state_db, p_record->dyn_gain_db, p_record->dlim_gain_db,
+                p_record->compr_state_db, p_record->compr_gain_db, p_record->compr_frame_gain_db,
+                p_record->clim_gain_db,
+                p_record->dyn_hold, p_record->dlim_hold, p_record->compr_hold, p_record->clim_hold,
+                (unsigned)p_record->dynrng_code, (unsigned)p_record->compr_code);
+    }
+    else
+    {
+        fprintf(out, ",,,,,,,,,,,,,,,");
+    }
+    for (output = 0; output < DLB_MD_EMUL_MAX_OUTPUTS; output++)
+    {
+        if ((p_record->flags & DLB_MD_EMUL_TRACE_DECODER) && output < p_record->num_outputs)
+        {
+            fprintf(out, ",%.6f", p_record->applied_gain[output]);
+        }
+        else
+        {
+            fprintf(out, ",");
+        }
+    }
+    fprintf(out, "\n");
+}
+
+int main(int argc, char *argv[])
+{
+    static dlb_md_emul_trace_record_t records[READ_RECORDS];
+    dlb_md_emul_trace_file_header_t header;
+    FILE *in;
+    FILE *out = stdout;
+    size_t num_read, i;
+    int ret = 0;
+
+    if (argc < 2 || argc > 3)
+    {
+        print_usage();
+        exit(-1);
+    }
+
+    in = fopen(argv[1], "rb");
+    if (!in)
+    {
+        fprintf(stderr, "Error: Cannot open %s\n", argv[1]);
+        exit(-2);
+    }
+    if (fread(&header, sizeof(header), 1, in) != 1
+        || header.magic != DLB_MD_EMUL_TRACE_MAGIC)
+    {
+        fprintf(stderr, "Error: %s is not an MdEmu trace\n", argv[1]);
+        fclose(in);
+        exit(-3);
+    }
+    if (header.version != DLB_MD_EMUL_TRACE_VERSION || header.record_size != sizeof(dlb_md_emul_trace_record_t))
+    {
+        fprintf(stderr, "Error: %s is trace version %u with %u byte records, expected version %d with %u\n",
+                argv[1], header.version, header.record_size,
+                DLB_MD_EMUL_TRACE_VERSION, (unsigned)sizeof(dlb_md_emul_trace_record_t));
+        fclose(in);
+        exit(-3);
+    }
+
+    if (argc == 3 && strcmp(argv[2], "-"))
+    {
+        out = fopen(argv[2], "w");
+        if (!out)
+        {
+            fprintf(stderr, "Error: Cannot create %s\n", argv[2]);
+            fclose(in);
+            exit(-2);
+        }
+    }
+
+    print_header(out);
+    while ((num_read = fread(records, sizeof(dlb_md_emul_trace_record_t), READ_RECORDS, in)) > 0)
+    {
+        for (i = 0; i < num_read; i++)
+        {
+            print_record(out, &records[i]);
+        }
+    }
+    if (ferror(in))
+    {
+        fprintf(stderr, "Error: Cannot read %s\n", argv[1]);
+        ret = -2;
+    }
+    fclose(in);
+    if (out != stdout && fclose(out) != 0)
+    {
+        fprintf(stderr, "Error: Cannot write %s\n", argv[2]);
+        ret = -2;
+    }
+
+    return ret;
+}
+
+void print_usage(void)
+{
+    fprintf(stderr, "mdemu_trace2csv - converts the DRC trace MdEmu --trace writes to CSV\n");
+    fprintf(stderr, "Usage:\n");
+    fprintf(stderr, "\tmdemu_trace2csv trace [csv]\n");
+    fprintf(stderr, "\n");
+    fprintf(stderr, "\ttrace  file written by MdEmu --trace=FILE\n");
+    fprintf(stderr, "\tcsv    output file [stdout]\n");
+    fprintf(stderr, "\n");
+    fprintf(stderr, "One row per block: the loudness and maxmix on the compressor scale (-31 dB\n");
+    fprintf(stderr, "at the dialogue level), the DRC and compr loudness filter states, gains and\n");
+    fprintf(stderr, "clip protection gains in dB, the holdoff counters, the dynrng and compr words\n");
+    fprintf(stderr, "and the linear gain applied to each output. Columns of values the emulator\n");
+    fprintf(stderr, "did not compute for a block are empty.\n");
+}
@@ -0,0 +1,242 @@
+/****************************************************************************
+ *
+ *
+ * Copyright (c) 2025 Dolby International AB.
+ * All rights reserved.
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED
+ * BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file
+ * @brief  Multichannel power versus time analyser, compatible with SATS pwr_vs_time
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <sndfile.h>
+#include "dlb_md_emul_pwr.h"
+
+#define READ_FRAMES 4800
+
+/* Read straight into the sample type of the numeric backend */
+#if defined(DLB_METHOD_IS_FLOAT) && DLB_LFRACT_BITS == 32
+#define SF_READF_LFRACT sf_readf_float
+#else
+#define SF_READF_LFRACT sf_readf_double
+#endif
+
+void print_usage(void);
+
+int main(int argc, char *argv[])
+{
+    char input_name[1024] = "\0";
+    char output_name[1024] = "\0";
+    int selected[DLB_MD_EMUL_MAX_CHANS] = { 0 };
+    int num_selected = 0;
+    int all_channels = 0;
+    double window_ms = 100.0;
+    SF_INFO info;
+    SNDFILE *input;
+    FILE *outputs[DLB_MD_EMUL_MAX_CHANS] = { NULL };
+    dlb_md_emul_pwr_config_t config;
+    dlb_md_emul_pwr_t *p_pwr;
+    dlb_md_emul_pwr_point_t *points;
+    DLB_LFRACT *samples;
+    void *pwr_mem;
+    size_t mem_size;
+    uint32_t max_points, num_points, p;
+    sf_count_t frames;
+    int i, c;
+
+    for (i = 1 ; i < argc ; i++)
+    {
+        if (!strcmp(argv[i], "-c") && i + 1 < argc)
+        {
+            i++;
+            if (!strcmp(argv[i], "all"))
+            {
+                all_channels = 1;
+                continue;
+            }
+            c = atoi(argv[i]);
+            if (c < 0 || c >= DLB_MD_EMUL_MAX_CHANS)
+            {
+                fprintf(stderr, "Error: Invalid channel %s\n", argv[i]);
+                exit(-1);
+            }
+            if (!selected[c])
+            {
+                selected[c] = 1;
+                num_selected++;
+            }
+        }
+        else if (!strcmp(argv[i], "-s"))
+        {
+            // time axis is always in seconds, accepted for compatibility
+        }
+        else if (!strcmp(argv[i], "-i") && i + 1 < argc)
+        {
+            strncpy(input_name, argv[++i], sizeof(input_name) - 1);
+        }
+        else if (!strcmp(argv[i], "-to") && i + 1 < argc)
+        {
+            strncpy(output_name, argv[++i], sizeof(output_name) - 1);
+        }
+        else if (!strcmp(argv[i], "-w") && i + 1 < argc)
+        {
+            window_ms = atof(argv[++i]);
+        }
+        else
+        {
+            print_usage();
+            exit(-1);
+        }
+    }
+
+    if (!strlen(input_name) || !strlen(output_name) || (!num_selected && !all_channels) || window_ms <= 0.0)
+    {
+        print_usage();
+        exit(-1);
+    }
+
+    memset(&info, 0, sizeof(info));
+    input = sf_open(input_name, SFM_READ, &info);
+    if (!input)
+    {
+        fprintf(stderr, "Error: Cannot open %s: %s\n", input_name, sf_strerror(NULL));
+        exit(-1);
+    }
+    if (info.channels > DLB_MD_EMUL_MAX_CHANS)
+    {
+        fprintf(stderr, "Error: %s has more than %d channels\n", input_name, DLB_MD_EMUL_MAX_CHANS);
+        exit(-1);
+    }
+    if (all_channels)
+    {
+        for (c = 0; c < info.channels; c++)
+        {
+            selected[c] = 1;
+        }
+        num_selected = info.channels;
+    }
+    if (num_selected > 1 && !strstr(output_name, "%d"))
+    {
+        fprintf(stderr, "Error: -to must contain %%d when more than one channel is selected\n");
+        exit(-1);
+    }
+
+    for (c = 0; c < DLB_MD_EMUL_MAX_CHANS; c++)
+    {
+        char name[1100];
+
+        if (!selected[c])
+        {
+            continue;
+        }
+        if (c >= info.channels)
+        {
+            fprintf(stderr, "Error: %s has no channel %d\n", input_name, c);
+            exit(-1);
+        }
+        snprintf(name, sizeof(name), output_name, c);
+        outputs[c] = fopen(name, "w");
+        if (!outputs[c])
+        {
+            fprintf(stderr, "Error: Cannot open %s\n", name);
+            exit(-1);
+        }
+    }
+
+    // one pass over the file measures every channel
+    config.num_channels = (uint32_t)info.channels;
+    config.sample_rate = (uint32_t)info.samplerate;
+    config.window_frames = (uint32_t)(window_ms * info.samplerate / 1000.0 + 0.5);
+    if (!config.window_frames
+        || dlb_md_emul_pwr_query_mem(&config, &mem_size) != DLB_MD_EMUL_PWR_OK)
+    {
+        fprintf(stderr, "Error: Invalid analysis window\n");
+        exit(-1);
+    }
+    pwr_mem = malloc(mem_size);
+    max_points = READ_FRAMES / config.window_frames + 1;
+    points = malloc(max_points * sizeof(*points));
+    samples = malloc((size_t)READ_FRAMES * info.channels * sizeof(*samples));
+    if (!pwr_mem || !points || !samples
+        || dlb_md_emul_pwr_open(&config, pwr_mem, &p_pwr) != DLB_MD_EMUL_PWR_OK)
+    {
+        fprintf(stderr, "Error: Cannot create analyser\n");
+        exit(-1);
+    }
+
+    while ((frames = SF_READF_LFRACT(input, samples, READ_FRAMES)) > 0)
+    {
+        dlb_md_emul_pwr_process(p_pwr, samples, (uint32_t)info.channels, (uint32_t)frames, points, max_points, &num_points);
+        for (p = 0; p < num_points; p++)
+        {
+            for (c = 0; c < info.channels; c++)
+            {
+                if (outputs[c])
+                {
+                    fprintf(outputs[c], "%f,\t%.2f\n", points[p].time, points[p].power_db[c]);
+                }
+            }
+        }
+    }
+
+    for (c = 0; c < DLB_MD_EMUL_MAX_CHANS; c++)
+    {
+        if (outputs[c])
+        {
+            fclose(outputs[c]);
+        }
+    }
+    dlb_md_emul_pwr_close(p_pwr);
+    sf_close(input);
+    free(samples);
+    free(points);
+    free(pwr_mem);
+    return 0;
+}
+
+void print_usage(void)
+{
+    fprintf(stderr, "pwr_vs_time - power versus time of one or more channels\n");
+    fprintf(stderr, "Usage:\n");
+    fprintf(stderr, "\tpwr_vs_time -c channel [-c channel ...] [-s] [-w ms] -i infile -to outfile\n");
+    fprintf(stderr, "\n");
+    fprintf(stderr, "-c\tchannel to measure, from 0, or all; may be repeated\n");
+    fprintf(stderr, "-s\ttime axis in seconds (always on, accepted for compatibility)\n");
+    fprintf(stderr, "-w\tanalysis window in milliseconds, default 100\n");
+    fprintf(stderr, "-to\toutput file; must contain %%d, replaced by the channel,\n");
+    fprintf(stderr, "\twhen more than one channel is measured\n");
+    fprintf(stderr, "\n");
+    fprintf(stderr, "Each output line is \"time,<tab>power\" with the time of the window centre\n");
+    fprintf(stderr, "in seconds and the mean power in dBFS, floored at -96 dB.\n");
+}